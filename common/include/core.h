@@ -0,0 +1,105 @@
+/**
+ ******************************************************************************
+ * @file    core.h
+ * @brief   Shared CRC32 Window Core of the UART Projects
+ *
+ * @details
+ *   - One copy of what every project main used to carry: text output over
+ *     SCI (sciDisplayText(), debug_byteCount(), debug_receivedData()), the
+ *     running CRC32 of a window on the table kernels (crc32_kernel.h), the
+ *     RTI window timeout, the window report lines and the window stats.
+ *   - Reception is a separate backend (core_rx.h). The project picks the
+ *     backend, the report port and the window behaviour in its own
+ *     core_cfg.h, which this header includes; the sources of the backends
+ *     that are not selected compile to nothing.
+ *   - Window modes: CORE_WINDOW_IDLE reports once the line has been quiet
+ *     for the timeout, every received byte restarts it. CORE_WINDOW_FIXED
+ *     reports every timeout period, data or not.
+ *
+ * @note
+ *   - coreTick() is the time base: call it once per millisecond, from the
+ *     RTI compare 0 notification or from a delay loop.
+ *   - The window state is not locked. Add and report from the same context
+ *     (both interrupt handlers, or both the main loop), as the projects do.
+ ******************************************************************************
+ */
+#ifndef CORE_H_
+#define CORE_H_
+
+#include "HL_sys_common.h"
+#include "HL_sci.h"
+
+/* RX backends (CORE_RX_BACKEND) */
+#define CORE_RX_POLLING         0U  /* sciIsRxReady()/sciReceiveByte() from the main loop */
+#define CORE_RX_INTERRUPT       1U  /* One RX interrupt per byte, sciReceive() */
+#define CORE_RX_LIN_MBUF        2U  /* One RX interrupt per LIN multi-buffer frame (SCI1) */
+#define CORE_RX_DMA_SINGLE      3U  /* One DMA block, re-armed once consumed (SCI3) */
+#define CORE_RX_DMA_RING        4U  /* Circular DMA ring, armed once (SCI3) */
+#define CORE_RX_DMA_POOL        5U  /* DMA into blocks of the pool, core_pool.h (SCI3) */
+
+/* Window modes (CORE_WINDOW_MODE) */
+#define CORE_WINDOW_IDLE        0U
+#define CORE_WINDOW_FIXED       1U
+
+/* Project configuration */
+#include "core_cfg.h"
+
+#ifndef CORE_RX_BACKEND
+#error "core_cfg.h has to select CORE_RX_BACKEND"
+#endif
+/* Port of the reports */
+#ifndef CORE_UART
+#define CORE_UART               sciREG1
+#endif
+/* Window timeout, can be changed at run time (coreSetTimeout()) */
+#ifndef CORE_TIMEOUT_MS
+#define CORE_TIMEOUT_MS         5000U
+#endif
+#ifndef CORE_WINDOW_MODE
+#define CORE_WINDOW_MODE        CORE_WINDOW_IDLE
+#endif
+/* Hooks around the text output: before a string (length), before each
+ * character and after the string */
+#ifndef CORE_TX_BEGIN
+#define CORE_TX_BEGIN(len)
+#endif
+#ifndef CORE_TX_CHAR
+#define CORE_TX_CHAR()
+#endif
+#ifndef CORE_TX_END
+#define CORE_TX_END()
+#endif
+
+typedef struct
+{
+    uint32_t bytes;     /* Bytes of all windows with data */
+    uint32_t windows;   /* Windows with data */
+    uint32_t empty;     /* Windows without data */
+} coreStats_t;
+
+void coreInit(void);
+void coreTick(void);
+uint32_t coreWindowDue(void);
+void coreWindowRestart(void);
+void coreSetTimeout(uint32_t ms);
+uint32_t coreTimeout(void);
+
+void coreAdd(const uint8_t *data, uint32_t len);
+uint32_t coreCount(void);
+uint32_t coreCrcState(void);
+void coreSetCrcState(uint32_t crc);
+void coreReport(void);
+void coreWindowNext(void);
+
+void coreReportCrc(uint32_t crc);
+void coreKeepCrc(uint32_t crc);
+void coreReportEmpty(void);
+void coreStatsAdd(uint32_t count);
+const coreStats_t *coreGetStats(void);
+void coreClearStats(void);
+
+void sciDisplayText(sciBASE_t *sci, unsigned char *text);
+void debug_receivedData(sciBASE_t *sci, uint8_t *data, uint32_t len);
+void debug_byteCount(sciBASE_t *sci, uint32_t len);
+
+#endif /* CORE_H_ */
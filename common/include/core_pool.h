@@ -0,0 +1,83 @@
+/**
+ ******************************************************************************
+ * @file    core_pool.h
+ * @brief   Reference-Counted Block Pool for Received Data
+ *
+ * @details
+ *   - CORE_POOL_BLOCKS blocks of CORE_POOL_BLOCK_SIZE bytes in a static
+ *     arena (core_pool_arena, section .rxRing). A producer (the DMA pool
+ *     backend, core_rx_dma.c, or a project's own ISR) takes a block with
+ *     corePoolAlloc(), fills it in place and hands spans of it to every
+ *     consumer with corePoolPublish(); nothing is copied on the way.
+ *   - Consumers are called in the order they subscribed, with the block
+ *     and the span. One that is done with the data on return (the CRC of
+ *     the window) does nothing else; one that keeps it (a TX DMA echo, a
+ *     capture list) calls corePoolRetain() and corePoolRelease() once it
+ *     no longer needs the bytes.
+ *   - The producer holds one reference while it writes into the block;
+ *     the block returns to the free list when the last reference goes.
+ *   - The stats give the peak of blocks in use and the allocations that
+ *     found the pool empty, to size CORE_POOL_BLOCKS for the worst burst.
+ *
+ * @note
+ *   - Built only with CORE_POOL_ENABLE (on by default with the DMA pool
+ *     backend), so the arena costs nothing in the other projects.
+ *   - Not locked, as the window state (core.h): allocate, publish and
+ *     release from one context. A consumer that finishes in an interrupt
+ *     (TX DMA done) flags it and releases from the main loop.
+ ******************************************************************************
+ */
+#ifndef CORE_POOL_H_
+#define CORE_POOL_H_
+
+#include "core.h"
+
+#ifndef CORE_POOL_ENABLE
+#define CORE_POOL_ENABLE        ((CORE_RX_BACKEND == CORE_RX_DMA_POOL) ? 1U : 0U)
+#endif
+/* Blocks in the arena, at most 32 */
+#ifndef CORE_POOL_BLOCKS
+#define CORE_POOL_BLOCKS        16U
+#endif
+/* Bytes per block, a multiple of 32 (DMA frame count <= 8191) */
+#ifndef CORE_POOL_BLOCK_SIZE
+#define CORE_POOL_BLOCK_SIZE    512U
+#endif
+#ifndef CORE_POOL_CONSUMERS
+#define CORE_POOL_CONSUMERS     4U
+#endif
+
+typedef struct
+{
+    uint8_t *data;      /* CORE_POOL_BLOCK_SIZE bytes in the arena */
+    uint32_t len;       /* Bytes published so far */
+    uint32_t refs;      /* 0 while on the free list */
+    uint32_t index;
+} corePoolBlock_t;
+
+/** @brief Called with every span published, block valid for the call */
+typedef void (*corePoolConsumer_t)(corePoolBlock_t *block, uint32_t offset, uint32_t len);
+
+typedef struct
+{
+    uint32_t inUse;     /* Blocks off the free list now */
+    uint32_t peak;      /* Most blocks off the free list at once */
+    uint32_t allocs;    /* Blocks handed out */
+    uint32_t exhausted; /* corePoolAlloc() calls that found no free block */
+    uint32_t published; /* Bytes handed to the consumers */
+} corePoolStats_t;
+
+#if (CORE_POOL_ENABLE != 0U)
+extern uint8_t core_pool_arena[CORE_POOL_BLOCKS * CORE_POOL_BLOCK_SIZE];
+
+void corePoolInit(void);
+corePoolBlock_t *corePoolAlloc(void);
+void corePoolRetain(corePoolBlock_t *block);
+void corePoolRelease(corePoolBlock_t *block);
+uint32_t corePoolSubscribe(corePoolConsumer_t consumer);
+void corePoolPublish(corePoolBlock_t *block, uint32_t offset, uint32_t len);
+const corePoolStats_t *corePoolGetStats(void);
+void corePoolClearStats(void);
+#endif
+
+#endif /* CORE_POOL_H_ */
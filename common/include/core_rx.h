@@ -0,0 +1,91 @@
+/**
+ ******************************************************************************
+ * @file    core_rx.h
+ * @brief   Reception Backends of the Shared Core
+ *
+ * @details
+ *   - Every backend implements the same calls; core_cfg.h selects one with
+ *     CORE_RX_BACKEND (core.h) and only its source compiles:
+ *       * CORE_RX_POLLING    core_rx_polling.c, bytes are read in
+ *                            coreRxPoll(), nothing runs in interrupts.
+ *       * CORE_RX_INTERRUPT  core_rx_interrupt.c, sciReceive() of one byte
+ *                            per RX interrupt (sciNotification()).
+ *       * CORE_RX_LIN_MBUF   core_rx_lin_mbuf.c, lin_mbuf_rx.c frames of up
+ *                            to 8 bytes per RX interrupt (SCI1 only).
+ *       * CORE_RX_DMA_SINGLE core_rx_dma.c, one DMA block over the buffer,
+ *                            re-armed once it is full and consumed.
+ *       * CORE_RX_DMA_RING   core_rx_dma.c, circular DMA ring (AUTOINIT)
+ *                            that is armed once.
+ *       * CORE_RX_DMA_POOL   core_rx_dma.c, one DMA block per pool block
+ *                            (core_pool.h), re-armed into the next free
+ *                            block; the blocks go to the consumers by
+ *                            reference.
+ *   - Received bytes are handed to the callback of coreRxInit(): from the
+ *     RX interrupt for the interrupt and LIN backends, from coreRxPoll()
+ *     in the main loop for the polling and DMA backends.
+ *   - coreRxStop() ends reception (a self-test borrowing the port, a
+ *     restart with other settings); coreRxInit() starts it again.
+ *   - With the pool backend the callback is one consumer of the pool;
+ *     more subscribe with corePoolSubscribe() after coreRxInit().
+ *   - The ring DMA backends also expose the buffer itself (core_rx_ring,
+ *     coreRxRingWritePos()) for projects that consume it in place; they
+ *     call coreRxRingSetup()/coreRxRingStart() instead of coreRxInit().
+ *     To detect the DMA lapping them they count the ring wraps from the
+ *     channel's BTC interrupt (coreRxRingWrapped(), coreRxRingWritten()).
+ *
+ * @note
+ *   - The DMA backends need the SCI3 RX DMA request (DMA_REQ30) and the
+ *     cache disabled; the buffer lives in the .rxRing section.
+ *   - The LIN backend needs the lin1HighLevelInterrupt() hook in USER CODE
+ *     (28) of HL_sci.c (see lin_mbuf_rx.h).
+ ******************************************************************************
+ */
+#ifndef CORE_RX_H_
+#define CORE_RX_H_
+
+#include "core.h"
+
+/* Port the backend receives on */
+#ifndef CORE_RX_SCI
+#define CORE_RX_SCI             CORE_UART
+#endif
+/* Buffer of the DMA backends, a power of two (DMA frame count <= 8191) */
+#ifndef CORE_RX_RING_SIZE
+#define CORE_RX_RING_SIZE       4096U
+#endif
+#define CORE_RX_RING_MASK       (CORE_RX_RING_SIZE - 1U)
+/* DMA channel of the DMA backends */
+#ifndef CORE_RX_DMA_CH
+#define CORE_RX_DMA_CH          DMA_CH1
+#endif
+/* Bytes per RX interrupt of the LIN backend (1..8) */
+#ifndef CORE_RX_LIN_FRAME_LEN
+#define CORE_RX_LIN_FRAME_LEN   8U
+#endif
+/* Bytes the polling backend gathers before handing them on */
+#ifndef CORE_RX_POLL_BURST
+#define CORE_RX_POLL_BURST      64U
+#endif
+
+/** @brief Called with every block of received bytes */
+typedef void (*coreRxCallback_t)(const uint8_t *data, uint32_t len);
+
+void coreRxInit(coreRxCallback_t callback);
+uint32_t coreRxPoll(void);
+void coreRxTick(void);
+void coreRxFlush(void);
+void coreRxSuspend(void);
+void coreRxResume(void);
+void coreRxStop(void);
+
+#if ((CORE_RX_BACKEND == CORE_RX_DMA_RING) || (CORE_RX_BACKEND == CORE_RX_DMA_SINGLE))
+extern uint8_t core_rx_ring[CORE_RX_RING_SIZE];
+
+void coreRxRingSetup(void);
+void coreRxRingStart(void);
+uint32_t coreRxRingWritePos(void);
+void coreRxRingWrapped(void);
+uint32_t coreRxRingWritten(void);
+#endif
+
+#endif /* CORE_RX_H_ */
@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @file    crc32_kernel.h
+ * @brief   CRC32 (IEEE 802.3) Kernels
+ *
+ * @details
+ *   - update_crc32() is the original bit-serial kernel (MSB-first state,
+ *     finalized with reflect32() ^ FINAL_XOR). Kept as the reference and
+ *     as the baseline for crc32Benchmark().
+ *   - crc32UpdateTable() is the byte-at-a-time table kernel.
+ *   - crc32UpdateWord() consumes one aligned 32-bit word per step using
+ *     four 256-entry tables (slice-by-4), so a 4 KB span costs 1024 data
+ *     reads of the buffer instead of 4096.
+ *   - crc32UpdateBurst() runs the slice-by-4 step over 32-byte blocks. On
+ *     the R5 (CRC32_KERNEL_ASM) the blocks go through crc32_kernel_r5.asm,
+ *     which fetches each block with one LDM burst; elsewhere a C loop with
+ *     the same block structure is used. With CRC32_KERNEL_ASM reflect8()
+ *     and reflect32() also use a single RBIT instead of a bit loop.
+ *   - The table kernels keep the reflected state: start from CRC32_INIT and
+ *     finalize with ^ CRC32_XOROUT only. Both kernels can be mixed on the
+ *     same running value.
+ ******************************************************************************
+ */
+#ifndef CRC32_KERNEL_H_
+#define CRC32_KERNEL_H_
+
+#include "HL_sys_common.h"
+
+#define CRC32_POLYNOMIAL        0x04C11DB7U
+/* Reflected polynomial used by the table kernels */
+#define CRC32_POLYNOMIAL_REFL   0xEDB88320U
+#define CRC32_INIT              0xFFFFFFFFU
+#define CRC32_XOROUT            0xFFFFFFFFU
+
+#if ((__little_endian__ == 1) || (__LITTLE_ENDIAN__ == 1))
+#define CRC32_LITTLE_ENDIAN     1
+#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define CRC32_LITTLE_ENDIAN     1
+#else
+#define CRC32_LITTLE_ENDIAN     0
+#endif
+
+/* Block size of crc32UpdateBurst(), aligned blocks use whole LDM bursts */
+#define CRC32_BURST_LEN         32U
+
+/* Assembly kernels (crc32_kernel_r5.asm) are written for the BE32 R5 */
+#if defined(__TI_ARM__) && (CRC32_LITTLE_ENDIAN == 0)
+#define CRC32_KERNEL_ASM        1
+#else
+#define CRC32_KERNEL_ASM        0
+#endif
+
+/* Slice-by-4 tables, byte swapped on big-endian builds (crc32_table.c) */
+extern const uint32_t crc32_table[4][256];
+
+uint8_t reflect8(uint8_t data);
+uint32_t reflect32(uint32_t data);
+uint32_t calc_crc32(uint8_t *data, uint32_t len);
+uint32_t update_crc32(uint32_t crc, uint8_t data);
+
+uint32_t crc32UpdateTable(uint32_t crc, const uint8_t *data, uint32_t len);
+uint32_t crc32UpdateWord(uint32_t crc, const uint8_t *data, uint32_t len);
+uint32_t crc32UpdateBurst(uint32_t crc, const uint8_t *data, uint32_t len);
+
+#if (CRC32_KERNEL_ASM == 1)
+/* crc32_kernel_r5.asm, c is the native state (see crc32_kernel.c) */
+uint32_t crc32Rbit(uint32_t data);
+uint32_t crc32Burst32(uint32_t c, const uint32_t *block, uint32_t count);
+#endif
+
+#endif /* CRC32_KERNEL_H_ */
@@ -0,0 +1,51 @@
+/**
+ ******************************************************************************
+ * @file    lin_mbuf_rx.h
+ * @brief   SCI1 (LIN1) Multi-Buffer Reception Backend
+ *
+ * @details
+ *   - SCI1 on the TMS570LC43x is the LIN-capable module, which has eight
+ *     receive buffers (RD0/RD1). In multi-buffer mode one RX interrupt is
+ *     raised per frame of 1..8 bytes instead of one per byte.
+ *   - The frame length is programmable through the FORMAT LENGTH field.
+ *   - The module has no readable byte counter, so a partial frame left at
+ *     the end of a transfer is recovered by linMbufRxFlush(), which pads
+ *     the frame through the internal loopback and works out how many of
+ *     the buffered bytes are real data. The RX pin is ignored for the one
+ *     pad frame this takes, so bytes the host sends in that moment are
+ *     lost; the flush therefore only runs after LIN_MBUF_FLUSH_MS of
+ *     silence, when the host is waiting for a reply or done.
+ *   - In multi-buffer mode the transmitter also works on whole frames, so
+ *     text output through sciSendByte() must be wrapped in
+ *     linMbufRxSuspend()/linMbufRxResume().
+ ******************************************************************************
+ */
+#ifndef LIN_MBUF_RX_H_
+#define LIN_MBUF_RX_H_
+
+#include "HL_sys_common.h"
+#include "HL_lin.h"
+
+/* Number of receive buffers (RD0..RD7) */
+#define LIN_MBUF_MAX_LEN        8U
+/* Idle time after the last completed frame before a partial frame is
+ * flushed. Well above the gaps of USB-UART adapters (FTDI latency timer
+ * 16 ms) and of chunked host writes, which a flush would cut into; 0
+ * leaves the flush to the window end (linMbufRxFlush()) */
+#ifndef LIN_MBUF_FLUSH_MS
+#define LIN_MBUF_FLUSH_MS       50U
+#endif
+
+/** @brief Callback invoked (in interrupt context) for every block of received bytes */
+typedef void (*linMbufRxCallback_t)(const uint8_t *data, uint32_t len);
+
+void linMbufRxInit(linBASE_t *lin, uint32_t frameLength, linMbufRxCallback_t callback);
+void linMbufRxSetFrameLength(uint32_t frameLength);
+uint32_t linMbufRxIsActive(void);
+void linMbufRxHandler(void);
+void linMbufRxTick(void);
+void linMbufRxFlush(void);
+void linMbufRxSuspend(void);
+void linMbufRxResume(void);
+
+#endif /* LIN_MBUF_RX_H_ */
@@ -0,0 +1,56 @@
+/**
+ ******************************************************************************
+ * @file    selftest.h
+ * @brief   SCI Loopback Self-Benchmark
+ *
+ * @details
+ *   - Puts the port of the backend (CORE_RX_SCI) into digital loopback
+ *     and pumps a generated pattern through the project's reception
+ *     backend (core_rx.h) at increasing baud rates, without a host or USB
+ *     adapter on the line.
+ *   - Reports per run whether the pattern came back lossless, the CRC32
+ *     throughput on the received block and the share of CPU cycles spent
+ *     in the backend, then the highest lossless rate.
+ *   - Builds unchanged in the host simulator (sim/), once per backend.
+ ******************************************************************************
+ */
+#ifndef SELFTEST_H_
+#define SELFTEST_H_
+
+#include "HL_sys_common.h"
+#include "HL_sci.h"
+
+/* Bytes pumped through the loopback per run */
+#define SELFTEST_LEN            2048U
+/* Baud rates tried, exact VCLK / (16 * n) divisors */
+#define SELFTEST_BAUD_COUNT     7U
+/* In-band request of the projects without a command interpreter */
+#define SELFTEST_COMMAND        "\x1bselftest"
+
+typedef struct
+{
+    uint32_t baud;          /* Actual rate from the prescaler */
+    uint32_t received;      /* Bytes that came back */
+    uint32_t mismatches;    /* Bytes that differ from the pattern */
+    uint32_t lineErrors;    /* SCI_FE_INT | SCI_OE_INT | SCI_PE_INT flags seen */
+    uint32_t cycles;        /* CPU cycles for the whole transfer */
+    uint32_t rxCycles;      /* CPU cycles inside the backend */
+    uint32_t crcCycles;     /* CPU cycles to CRC the received block */
+    uint32_t crc;
+    uint32_t lossless;
+} selftestResult_t;
+
+typedef struct
+{
+    uint32_t maxBaud;       /* 0 if no rate passed */
+    uint32_t crcBytesPerSec;
+    uint32_t rxPerMille;    /* At the highest passing rate */
+} selftestSummary_t;
+
+const char *selftestBackendName(void);
+void selftestRun(uint32_t baud, selftestResult_t *result);
+void selftestSweep(selftestSummary_t *summary);
+void selftestScan(const uint8_t *data, uint32_t len);
+uint32_t selftestRequested(void);
+
+#endif /* SELFTEST_H_ */
@@ -0,0 +1,273 @@
+/**
+ ******************************************************************************
+ * @file    core.c
+ * @brief   Shared CRC32 Window Core of the UART Projects
+ *
+ * @details
+ *   - The window CRC is kept in the reflected state of the table kernels:
+ *     spans of a word or more go through crc32UpdateBurst(), shorter ones
+ *     (single bytes from the interrupt backends) through crc32UpdateTable().
+ *   - The report lines are the ones uart-crc32-dma and the largefiles
+ *     project have always printed: a "Bytes received" line, then the CRC
+ *     line. uart-crc32 and uart-crc32-interrupt used to print the CRC line
+ *     alone and now print the count line before it too.
+ ******************************************************************************
+ */
+#include "core.h"
+#include "crc32_kernel.h"
+#include "string.h"
+#include <stdio.h>
+
+/* Shorter spans skip the alignment steps of the word kernels */
+#define CORE_WORD_MIN           4U
+
+static volatile uint32_t s_tick = 0U;
+static uint32_t s_timeout = CORE_TIMEOUT_MS;
+static uint32_t s_count = 0U;
+static uint32_t s_crc = CRC32_INIT;
+static coreStats_t s_stats = { 0U, 0U, 0U };
+/* Last reported CRC, 8 hex digits + null terminator */
+static char s_lastCrc[9] = { 0 };
+
+/* The consumer of the RX interrupt backends runs from RAM with the CRC
+   kernels when .ramfunc is linked there (ramfunc.h) */
+#pragma CODE_SECTION(coreAdd, ".ramCode")
+
+/**
+ * @brief  Starts an empty window and clears the stats.
+ */
+void coreInit(void)
+{
+    s_count = 0U;
+    s_crc = CRC32_INIT;
+    s_tick = 0U;
+    coreClearStats();
+}
+
+/**
+ * @brief  Advances the window timer by one millisecond.
+ */
+void coreTick(void)
+{
+    s_tick++;
+}
+
+/**
+ * @brief  Non-zero once the window timeout has elapsed.
+ */
+uint32_t coreWindowDue(void)
+{
+    return (s_tick >= s_timeout) ? 1U : 0U;
+}
+
+/**
+ * @brief  Restarts the window timeout.
+ */
+void coreWindowRestart(void)
+{
+    s_tick = 0U;
+}
+
+/**
+ * @brief  Sets the window timeout.
+ * @param  ms  Timeout in milliseconds.
+ */
+void coreSetTimeout(uint32_t ms)
+{
+    s_timeout = ms;
+}
+
+/**
+ * @brief  Current window timeout in milliseconds.
+ */
+uint32_t coreTimeout(void)
+{
+    return s_timeout;
+}
+
+/**
+ * @brief  Adds received bytes to the window CRC. In CORE_WINDOW_IDLE mode
+ *         the timeout restarts.
+ * @param  data  Received bytes.
+ * @param  len   Number of bytes.
+ */
+void coreAdd(const uint8_t *data, uint32_t len)
+{
+    if (len >= CORE_WORD_MIN)
+    {
+        s_crc = crc32UpdateBurst(s_crc, data, len);
+    }
+    else
+    {
+        s_crc = crc32UpdateTable(s_crc, data, len);
+    }
+    s_count += len;
+#if (CORE_WINDOW_MODE == CORE_WINDOW_IDLE)
+    s_tick = 0U;
+#endif
+}
+
+/**
+ * @brief  Bytes added in the current window.
+ */
+uint32_t coreCount(void)
+{
+    return s_count;
+}
+
+/**
+ * @brief  Running CRC state of the window, reflected, before the final XOR.
+ */
+uint32_t coreCrcState(void)
+{
+    return s_crc;
+}
+
+/**
+ * @brief  Replaces the running CRC state, e.g. to continue a checkpoint.
+ * @param  crc  Reflected state, CRC32_INIT for a new message.
+ */
+void coreSetCrcState(uint32_t crc)
+{
+    s_crc = crc;
+}
+
+/**
+ * @brief  Sends the result of the current window and starts a new one:
+ *         the byte count and the CRC, or the last CRC if no data came in.
+ */
+void coreReport(void)
+{
+    if (s_count == 0U)
+    {
+        coreReportEmpty();
+    }
+    else
+    {
+        debug_byteCount(CORE_UART, s_count);
+        coreReportCrc(s_crc ^ CRC32_XOROUT);
+    }
+    coreWindowNext();
+    s_crc = CRC32_INIT;
+}
+
+/**
+ * @brief  Starts a new window without touching the CRC state, so a CRC
+ *         can run across windows. The finished window goes to the stats.
+ */
+void coreWindowNext(void)
+{
+    coreStatsAdd(s_count);
+    s_count = 0U;
+    s_tick = 0U;
+}
+
+/**
+ * @brief  Books a finished window in the stats.
+ * @param  count  Bytes of the window, 0 for an empty one.
+ */
+void coreStatsAdd(uint32_t count)
+{
+    if (count == 0U)
+    {
+        s_stats.empty++;
+    }
+    else
+    {
+        s_stats.bytes += count;
+        s_stats.windows++;
+    }
+}
+
+/**
+ * @brief  Prints a final CRC32 and keeps it for empty windows.
+ * @param  crc  Final CRC32.
+ */
+void coreReportCrc(uint32_t crc)
+{
+    coreKeepCrc(crc);
+    /* Formatting CRC and sending via UART */
+    sciDisplayText(CORE_UART, (uint8_t *)"Updated CRC in Hex is : 0x");
+    sciDisplayText(CORE_UART, (unsigned char *)s_lastCrc);
+    sciDisplayText(CORE_UART, (uint8_t *)"\r\n");
+}
+
+/**
+ * @brief  Keeps a final CRC32 for empty windows without printing it.
+ * @param  crc  Final CRC32.
+ */
+void coreKeepCrc(uint32_t crc)
+{
+    sprintf(s_lastCrc, "%08lX", (unsigned long)crc);  /* Format CRC as 8-digit upper case hex */
+}
+
+/**
+ * @brief  Prints the line of a window without data.
+ */
+void coreReportEmpty(void)
+{
+    sciDisplayText(CORE_UART, (uint8_t *)"No Data Received, Last Calculated CRC in Hex is : 0x");
+    sciDisplayText(CORE_UART, (unsigned char *)s_lastCrc);
+    sciDisplayText(CORE_UART, (uint8_t *)"\r\n");
+}
+
+/**
+ * @brief  Window stats since coreInit() or coreClearStats().
+ */
+const coreStats_t *coreGetStats(void)
+{
+    return &s_stats;
+}
+
+/**
+ * @brief  Clears the stats and forgets the last CRC.
+ */
+void coreClearStats(void)
+{
+    s_stats.bytes = 0U;
+    s_stats.windows = 0U;
+    s_stats.empty = 0U;
+    memset(s_lastCrc, 0, sizeof(s_lastCrc));
+}
+
+/* Function used to send data through SCI buffer */
+void sciDisplayText(sciBASE_t *sci, unsigned char *text)
+{
+    uint32 length = strlen((const char *)text);
+
+    CORE_TX_BEGIN(length);
+    while(length--)
+    {
+        CORE_TX_CHAR();
+        while ((sci->FLR & 0x4) == 4); /* wait until busy */
+        sciSendByte(sci,*text++);      /* send out text   */
+    };
+    CORE_TX_END();
+}
+
+/*
+ * Debugging purpose only
+ *
+ */
+void debug_receivedData(sciBASE_t *sci, uint8_t *data, uint32_t len)
+{
+    char hexByte[6];
+    uint32_t i;
+    sciDisplayText(sci, (uint8_t *)"\r\nData Received is : ");
+    for (i = 0; i < len; i++) {
+        sprintf(hexByte, " %02X", data[i]);
+        sciDisplayText(sci, (uint8_t *)hexByte);
+    }
+    sciDisplayText(sci, (uint8_t *)"\r\n");
+}
+
+/*
+ * Debugging purpose only
+ *
+ */
+void debug_byteCount(sciBASE_t *sci, uint32_t len)
+{
+    char msg[64];
+    sprintf(msg, "\r\nBytes received: %lu\r\n", len);
+    sciDisplayText(sci, (uint8_t *)msg);
+}
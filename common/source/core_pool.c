@@ -0,0 +1,164 @@
+/**
+ ******************************************************************************
+ * @file    core_pool.c
+ * @brief   Reference-Counted Block Pool for Received Data
+ *
+ * @details
+ *   - The free blocks are a bit mask: corePoolAlloc() takes the lowest
+ *     set bit, corePoolRelease() of the last reference sets it again.
+ *   - corePoolPublish() only passes pointers; the consumers read the
+ *     bytes where the producer wrote them.
+ ******************************************************************************
+ */
+#include "core_pool.h"
+
+#if (CORE_POOL_ENABLE != 0U)
+
+#if ((CORE_POOL_BLOCKS == 0U) || (CORE_POOL_BLOCKS > 32U))
+#error "CORE_POOL_BLOCKS has to be 1..32"
+#endif
+
+#pragma DATA_SECTION(core_pool_arena, ".rxRing")
+#pragma DATA_ALIGN(core_pool_arena, 32)
+uint8_t core_pool_arena[CORE_POOL_BLOCKS * CORE_POOL_BLOCK_SIZE];
+
+static corePoolBlock_t s_blocks[CORE_POOL_BLOCKS];
+static corePoolConsumer_t s_consumers[CORE_POOL_CONSUMERS];
+static uint32_t s_consumerCount = 0U;
+static uint32_t s_free = 0U;
+static corePoolStats_t s_stats;
+
+/**
+ * @brief  Puts every block on the free list and drops the consumers.
+ */
+void corePoolInit(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < CORE_POOL_BLOCKS; i++)
+    {
+        s_blocks[i].data = &core_pool_arena[i * CORE_POOL_BLOCK_SIZE];
+        s_blocks[i].len = 0U;
+        s_blocks[i].refs = 0U;
+        s_blocks[i].index = i;
+    }
+    s_free = (uint32_t)(((uint64_t)1U << CORE_POOL_BLOCKS) - 1U);
+    s_consumerCount = 0U;
+    s_stats.inUse = 0U;
+    corePoolClearStats();
+}
+
+/**
+ * @brief  Takes a free block, with one reference for the caller.
+ * @return NULL if every block is in use.
+ */
+corePoolBlock_t *corePoolAlloc(void)
+{
+    corePoolBlock_t *block;
+    uint32_t i;
+
+    if (s_free == 0U)
+    {
+        s_stats.exhausted++;
+        return NULL;
+    }
+    for (i = 0U; ((s_free >> i) & 1U) == 0U; i++)
+    {
+        /* Lowest free block */
+    }
+    s_free &= ~((uint32_t)1U << i);
+
+    block = &s_blocks[i];
+    block->len = 0U;
+    block->refs = 1U;
+    s_stats.allocs++;
+    s_stats.inUse++;
+    if (s_stats.inUse > s_stats.peak)
+    {
+        s_stats.peak = s_stats.inUse;
+    }
+    return block;
+}
+
+/**
+ * @brief  Takes one more reference, for a consumer that keeps the data
+ *         past its call.
+ */
+void corePoolRetain(corePoolBlock_t *block)
+{
+    block->refs++;
+}
+
+/**
+ * @brief  Drops one reference; the last one returns the block.
+ */
+void corePoolRelease(corePoolBlock_t *block)
+{
+    if (block->refs == 0U)
+    {
+        return;
+    }
+    block->refs--;
+    if (block->refs == 0U)
+    {
+        s_free |= (uint32_t)1U << block->index;
+        s_stats.inUse--;
+    }
+}
+
+/**
+ * @brief  Adds a consumer of every span published from now on.
+ * @return 0 if CORE_POOL_CONSUMERS are already subscribed.
+ */
+uint32_t corePoolSubscribe(corePoolConsumer_t consumer)
+{
+    if (s_consumerCount >= CORE_POOL_CONSUMERS)
+    {
+        return 0U;
+    }
+    s_consumers[s_consumerCount] = consumer;
+    s_consumerCount++;
+    return 1U;
+}
+
+/**
+ * @brief  Hands a span of a block to every consumer.
+ * @param  offset  First byte of the span in the block.
+ * @note   The caller keeps its own reference over the call.
+ */
+void corePoolPublish(corePoolBlock_t *block, uint32_t offset, uint32_t len)
+{
+    uint32_t i;
+
+    if (len == 0U)
+    {
+        return;
+    }
+    block->len = offset + len;
+    s_stats.published += len;
+    for (i = 0U; i < s_consumerCount; i++)
+    {
+        s_consumers[i](block, offset, len);
+    }
+}
+
+const corePoolStats_t *corePoolGetStats(void)
+{
+    return &s_stats;
+}
+
+/**
+ * @brief  Clears the counters, the peak restarts at the blocks in use.
+ */
+void corePoolClearStats(void)
+{
+    uint32_t inUse = s_stats.inUse;
+
+    s_stats.allocs = 0U;
+    s_stats.exhausted = 0U;
+    s_stats.published = 0U;
+    s_stats.inUse = inUse;
+    s_stats.peak = inUse;
+}
+
+#endif
@@ -0,0 +1,417 @@
+/**
+ ******************************************************************************
+ * @file    core_rx_dma.c
+ * @brief   DMA Reception Backends: Circular Ring and Single Block
+ *
+ * @details
+ *   - The DMA channel moves one byte per SCI3 RX request into core_rx_ring,
+ *     destination incrementing. The write position is read back from the
+ *     channel's working control packet (CDADDR), so the CPU never touches
+ *     the bytes until it consumes them. After the channel is armed the
+ *     WCP keeps the address where the previous block stopped until the
+ *     first frame (FTC), so until then the position is the block start.
+ *   - CORE_RX_DMA_RING: AUTOINIT reloads the packet at the end of each
+ *     block, the channel is armed once and never stops; coreRxPoll() hands
+ *     on at most two spans around the wrap. The position alone cannot
+ *     tell a consumer that fell a whole turn behind from one that is
+ *     up to date: a project that needs to know counts the wraps from the
+ *     channel's BTC interrupt (coreRxRingWrapped()) and compares the
+ *     unwrapped count (coreRxRingWritten()) with what it has read.
+ *   - CORE_RX_DMA_SINGLE: one block over the buffer without AUTOINIT. Once
+ *     the block is complete (BTC) and consumed the channel is armed again;
+ *     bytes arriving in between wait in SCI RD and overrun after one
+ *     character, which is what the ring avoids.
+ *   - CORE_RX_DMA_POOL: as the single block, but into a block of the pool
+ *     (core_pool.h). At the block end the channel is armed into the next
+ *     free block before the full one is handed on, and the full one goes
+ *     back to the pool once every consumer has released it. With the pool
+ *     empty the channel stays off and bytes overrun until a block is
+ *     free again.
+ *
+ * @note
+ *   - **Cache must be disabled** in the R5-MPU-PMU tab for DMA to work.
+ *   - SCI3 is the only SCI with DMA requests served on this device.
+ ******************************************************************************
+ */
+#include "core_rx.h"
+
+#if ((CORE_RX_BACKEND == CORE_RX_DMA_RING) || (CORE_RX_BACKEND == CORE_RX_DMA_SINGLE) \
+  || (CORE_RX_BACKEND == CORE_RX_DMA_POOL))
+
+#include "HL_sys_dma.h"
+#if (CORE_RX_BACKEND == CORE_RX_DMA_POOL)
+#include "core_pool.h"
+#endif
+
+#define DMA_SCI3_RX  DMA_REQ30
+#define SCI_SET_RX_DMA      (1<<17)
+#define SCI_SET_RX_DMA_ALL  (1<<18)
+
+#if ((__little_endian__ == 1) || (__LITTLE_ENDIAN__ == 1))
+#define SCI3_RX_ADDR ((uint32_t)(&(sciREG3->RD)))
+#else
+#define SCI3_RX_ADDR ((uint32_t)(&(sciREG3->RD)) + 3)
+#endif
+
+static g_dmaCTRL s_packet;
+static coreRxCallback_t s_callback = NULL;
+/* Next buffer index coreRxPoll() hands on */
+static uint32_t s_read = 0U;
+/* Set once the channel has moved a frame since it was armed */
+static uint32_t s_started = 0U;
+/* Ring wraps since coreRxRingStart(), counted by coreRxRingWrapped() */
+static volatile uint32_t s_wraps = 0U;
+
+static void coreRxDmaSetup(uint32_t dest, uint32_t frames);
+static void coreRxDmaArm(void);
+static uint32_t coreRxDmaDest(void);
+
+#if (CORE_RX_BACKEND == CORE_RX_DMA_POOL)
+
+/* Block the channel writes into, NULL while the pool is empty */
+static corePoolBlock_t *s_fill = NULL;
+
+static void coreRxPoolArm(void);
+static void coreRxPoolCallback(corePoolBlock_t *block, uint32_t offset, uint32_t len);
+
+/**
+ * @brief  Sets up the pool and the DMA channel and starts reception into
+ *         the first block.
+ * @param  callback  Called from coreRxPoll() with each span, as the first
+ *                   consumer of the pool; NULL for none.
+ */
+void coreRxInit(coreRxCallback_t callback)
+{
+    corePoolInit();
+    s_callback = callback;
+    if (callback != NULL)
+    {
+        (void)corePoolSubscribe(&coreRxPoolCallback);
+    }
+    s_fill = NULL;
+    coreRxDmaSetup((uint32_t)core_pool_arena, CORE_POOL_BLOCK_SIZE);
+    coreRxPoolArm();
+}
+
+/**
+ * @brief  Publishes what the DMA has written into the block since the
+ *         last call; at the block end arms the next block first.
+ * @return Number of bytes handed on.
+ */
+uint32_t coreRxPoll(void)
+{
+    corePoolBlock_t *block = s_fill;
+    uint32_t read = s_read;
+    uint32_t done;
+    uint32_t end;
+
+    if (block == NULL)
+    {
+        /* The pool was empty at the last block end */
+        if (corePoolGetStats()->inUse < CORE_POOL_BLOCKS)
+        {
+            coreRxPoolArm();
+        }
+        return 0U;
+    }
+
+    /* Flag first, as the single block */
+    done = (dmaGetInterruptStatus(CORE_RX_DMA_CH, BTC) != FALSE) ? 1U : 0U;
+    if (done != 0U)
+    {
+        end = CORE_POOL_BLOCK_SIZE;
+        dmaREG->BTCFLAG = (uint32_t)1U << CORE_RX_DMA_CH;
+        /* The SCI holds one character until the channel runs again */
+        s_fill = NULL;
+        coreRxPoolArm();
+    }
+    else
+    {
+        end = coreRxDmaDest() - (uint32_t)block->data;
+        end = (end > CORE_POOL_BLOCK_SIZE) ? 0U : end;
+        s_read = (end > read) ? end : read;
+    }
+
+    if (end > read)
+    {
+        corePoolPublish(block, read, end - read);
+    }
+    if (done != 0U)
+    {
+        /* The backend's own reference, held while the DMA wrote */
+        corePoolRelease(block);
+    }
+    return (end > read) ? (end - read) : 0U;
+}
+
+/**
+ * @brief  Takes a free block and arms the channel into it.
+ */
+static void coreRxPoolArm(void)
+{
+    s_fill = corePoolAlloc();
+    if (s_fill == NULL)
+    {
+        return;
+    }
+    s_packet.DADD = (uint32_t)s_fill->data;
+    dmaSetCtrlPacket(CORE_RX_DMA_CH, s_packet);
+    s_read = 0U;
+    coreRxDmaArm();
+}
+
+/**
+ * @brief  The coreRxInit() callback as a pool consumer.
+ */
+static void coreRxPoolCallback(corePoolBlock_t *block, uint32_t offset, uint32_t len)
+{
+    s_callback(&block->data[offset], len);
+}
+
+#else
+
+#pragma DATA_SECTION(core_rx_ring, ".rxRing")
+#pragma DATA_ALIGN(core_rx_ring, 32)
+uint8_t core_rx_ring[CORE_RX_RING_SIZE];
+
+/**
+ * @brief  Sets up the DMA channel and the buffer and starts reception.
+ * @param  callback  Called from coreRxPoll() with each span.
+ */
+void coreRxInit(coreRxCallback_t callback)
+{
+    s_callback = callback;
+    coreRxRingSetup();
+    coreRxRingStart();
+}
+
+/**
+ * @brief  Programs the channel for SCI3 RX into core_rx_ring and enables
+ *         the SCI3 RX DMA request.
+ */
+void coreRxRingSetup(void)
+{
+    coreRxDmaSetup((uint32_t)core_rx_ring, CORE_RX_RING_SIZE);
+}
+
+/**
+ * @brief  Enables the channel for hardware requests from the start of
+ *         the buffer. With the ring this is done once.
+ */
+void coreRxRingStart(void)
+{
+    s_read = 0U;
+    s_wraps = 0U;
+    coreRxDmaArm();
+}
+
+/**
+ * @brief  Returns the buffer index the DMA will write next.
+ *         Derived from the channel's current destination address in the
+ *         working control packet; until the first frame after the channel
+ *         was started the buffer is reported empty.
+ * @note   A completed single block reads back as 0, as for the ring.
+ */
+uint32_t coreRxRingWritePos(void)
+{
+    uint32_t offset = coreRxDmaDest() - (uint32_t)core_rx_ring;
+
+    if (offset > CORE_RX_RING_SIZE)
+    {
+        offset = 0U;
+    }
+    return offset & CORE_RX_RING_MASK;
+}
+
+/**
+ * @brief  Counts a wrap of the ring. Called from the channel's BTC
+ *         interrupt once its flag is cleared.
+ */
+void coreRxRingWrapped(void)
+{
+    s_wraps++;
+}
+
+/**
+ * @brief  Returns the bytes the DMA has written since coreRxRingStart(),
+ *         modulo 2^32: the wraps counted by coreRxRingWrapped() and the
+ *         write position.
+ * @note   A wrap whose interrupt is still pending is counted when the
+ *         position was read after it, so the count never runs a turn
+ *         behind the position. The interrupt has to be taken within half
+ *         a turn of the wrap.
+ */
+uint32_t coreRxRingWritten(void)
+{
+    uint32_t wraps;
+    uint32_t pos;
+    uint32_t pending;
+
+    do
+    {
+        wraps = s_wraps;
+        pos = coreRxRingWritePos();
+        pending = dmaREG->BTCFLAG & ((uint32_t)1U << CORE_RX_DMA_CH);
+    } while (wraps != s_wraps);
+
+    if ((pending != 0U) && (pos < (CORE_RX_RING_SIZE / 2U)))
+    {
+        wraps++;
+    }
+    return (wraps * CORE_RX_RING_SIZE) + pos;
+}
+
+/**
+ * @brief  Hands on everything the DMA has written since the last call.
+ * @return Number of bytes handed on.
+ */
+uint32_t coreRxPoll(void)
+{
+    uint32_t total = 0U;
+#if (CORE_RX_BACKEND == CORE_RX_DMA_RING)
+    uint32_t write_pos = coreRxRingWritePos();
+
+    while (s_read != write_pos)
+    {
+        uint32_t end = (write_pos > s_read) ? write_pos : CORE_RX_RING_SIZE;
+
+        s_callback(&core_rx_ring[s_read], end - s_read);
+        total += end - s_read;
+        s_read = end & CORE_RX_RING_MASK;
+    }
+#else
+    /* Flag first: a block completing after the position read is picked
+     * up on the next call */
+    uint32_t done = (dmaGetInterruptStatus(CORE_RX_DMA_CH, BTC) != FALSE) ? 1U : 0U;
+    uint32_t end = (done != 0U) ? CORE_RX_RING_SIZE : coreRxRingWritePos();
+
+    if (end > s_read)
+    {
+        s_callback(&core_rx_ring[s_read], end - s_read);
+        total = end - s_read;
+        s_read = end;
+    }
+    if (done != 0U)
+    {
+        dmaREG->BTCFLAG = (uint32_t)1U << CORE_RX_DMA_CH;
+        coreRxRingStart();
+    }
+#endif
+    return total;
+}
+
+#endif /* CORE_RX_DMA_POOL */
+
+/**
+ * @brief  Nothing to do per tick.
+ */
+void coreRxTick(void)
+{
+}
+
+/**
+ * @brief  Hands on whatever the DMA has written.
+ */
+void coreRxFlush(void)
+{
+    (void)coreRxPoll();
+}
+
+/**
+ * @brief  Output does not disturb reception.
+ */
+void coreRxSuspend(void)
+{
+}
+
+/**
+ * @brief  Output does not disturb reception.
+ */
+void coreRxResume(void)
+{
+}
+
+/**
+ * @brief  Disables the channel and the SCI3 RX DMA request. Bytes that
+ *         arrive afterwards wait in SCI RD.
+ */
+void coreRxStop(void)
+{
+    dmaREG->HWCHENAR = (uint32_t)1U << CORE_RX_DMA_CH;
+    sciREG3->CLEARINT = SCI_SET_RX_DMA | SCI_SET_RX_DMA_ALL;
+    dmaREG->BTCFLAG = (uint32_t)1U << CORE_RX_DMA_CH;
+#if (CORE_RX_BACKEND == CORE_RX_DMA_POOL)
+    if (s_fill != NULL)
+    {
+        corePoolRelease(s_fill);
+        s_fill = NULL;
+    }
+#endif
+}
+
+/**
+ * @brief  Programs the channel for SCI3 RX: one frame (one byte) per
+ *         request, destination incrementing over the buffer, and enables
+ *         the SCI3 RX DMA request.
+ */
+static void coreRxDmaSetup(uint32_t dest, uint32_t frames)
+{
+    dmaReqAssign(CORE_RX_DMA_CH, DMA_SCI3_RX);
+
+    s_packet.SADD      = SCI3_RX_ADDR;
+    s_packet.DADD      = dest;
+    s_packet.CHCTRL    = 0;
+    s_packet.FRCNT     = frames;
+    s_packet.ELCNT     = 1;
+    s_packet.ELDOFFSET = 0;
+    s_packet.ELSOFFSET = 0;
+    s_packet.FRDOFFSET = 0;
+    s_packet.FRSOFFSET = 0;
+    s_packet.PORTASGN  = PORTB_READ_PORTA_WRITE;
+    s_packet.RDSIZE    = ACCESS_8_BIT;
+    s_packet.WRSIZE    = ACCESS_8_BIT;
+    s_packet.TTYPE     = FRAME_TRANSFER;
+    s_packet.ADDMODERD = ADDR_FIXED;
+    s_packet.ADDMODEWR = ADDR_INC1;
+#if (CORE_RX_BACKEND == CORE_RX_DMA_RING)
+    s_packet.AUTOINIT  = AUTOINIT_ON;
+#else
+    s_packet.AUTOINIT  = AUTOINIT_OFF;
+#endif
+
+    dmaSetCtrlPacket(CORE_RX_DMA_CH, s_packet);
+
+    dmaEnable();
+    sciREG3->SETINT |= SCI_SET_RX_DMA | SCI_SET_RX_DMA_ALL;
+}
+
+/**
+ * @brief  Enables the channel for hardware requests with the packet set
+ *         up; the position counts from its start until the first frame.
+ */
+static void coreRxDmaArm(void)
+{
+    dmaREG->FTCFLAG = (uint32_t)1U << CORE_RX_DMA_CH;
+    s_started = 0U;
+    dmaSetChEnable(CORE_RX_DMA_CH, DMA_HW);
+}
+
+/**
+ * @brief  Returns the address the channel writes next. Before its first
+ *         frame the WCP still holds where the previous block stopped, so
+ *         the start of the block is returned instead.
+ */
+static uint32_t coreRxDmaDest(void)
+{
+    if (s_started == 0U)
+    {
+        if (dmaGetInterruptStatus(CORE_RX_DMA_CH, FTC) == FALSE)
+        {
+            return s_packet.DADD;
+        }
+        s_started = 1U;
+    }
+    return dmaRAMREG->WCP[CORE_RX_DMA_CH].CDADDR;
+}
+
+#endif
@@ -0,0 +1,103 @@
+/**
+ ******************************************************************************
+ * @file    core_rx_interrupt.c
+ * @brief   Interrupt Reception Backend, One Byte per RX Interrupt
+ *
+ * @details
+ *   - sciReceive() of one byte arms the HALCoGen driver; its completion
+ *     calls sciNotification(), which hands the byte to the callback and
+ *     arms the next one.
+ *
+ * @note
+ *   - Needs the SCI RX interrupt in the VIM and SCI_RX_INT enabled
+ *     (coreRxInit() does the latter). Remove sciNotification() from
+ *     HL_notification.c.
+ ******************************************************************************
+ */
+#include "core_rx.h"
+
+#if (CORE_RX_BACKEND == CORE_RX_INTERRUPT)
+
+#define SCI_RECEIVE_LENGTH      1U
+
+static coreRxCallback_t s_callback = NULL;
+/* Byte for sciReceive function */
+static volatile uint8_t s_byte = 0U;
+
+/* The RX interrupt body runs from RAM when .ramfunc is linked there
+   (ramfunc.h) */
+#pragma CODE_SECTION(sciNotification, ".ramCode")
+
+/**
+ * @brief  Enables the RX interrupt and starts the first receive.
+ * @param  callback  Called from the RX interrupt with each byte.
+ * @note   Interrupts have to be enabled for reception to run.
+ */
+void coreRxInit(coreRxCallback_t callback)
+{
+    s_callback = callback;
+    /* Enable UART RX interrupt */
+    sciEnableNotification(CORE_RX_SCI, SCI_RX_INT);
+    /* Start first receive sciReceive Designed for Interrupt Reception */
+    sciReceive(CORE_RX_SCI, SCI_RECEIVE_LENGTH, (uint8_t *)&s_byte);
+}
+
+/* Interrupt handler (called automatically by HALCoGen if enabled) */
+#pragma WEAK(sciNotification)
+void sciNotification(sciBASE_t *sci, uint32 flags)
+{
+    uint8_t byte = s_byte;
+
+    s_callback(&byte, 1U);
+
+    /* Start next receive */
+    sciReceive(sci, SCI_RECEIVE_LENGTH, (uint8_t *)&s_byte);
+}
+
+/**
+ * @brief  Bytes are handed on from the interrupt.
+ * @return 0.
+ */
+uint32_t coreRxPoll(void)
+{
+    return 0U;
+}
+
+/**
+ * @brief  Nothing to do per tick.
+ */
+void coreRxTick(void)
+{
+}
+
+/**
+ * @brief  Every byte is handed on as it arrives.
+ */
+void coreRxFlush(void)
+{
+}
+
+/**
+ * @brief  Output does not disturb reception.
+ */
+void coreRxSuspend(void)
+{
+}
+
+/**
+ * @brief  Output does not disturb reception.
+ */
+void coreRxResume(void)
+{
+}
+
+/**
+ * @brief  Disables the RX interrupt; the armed receive is dropped by the
+ *         next coreRxInit().
+ */
+void coreRxStop(void)
+{
+    sciDisableNotification(CORE_RX_SCI, SCI_RX_INT);
+}
+
+#endif
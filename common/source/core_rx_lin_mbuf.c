@@ -0,0 +1,86 @@
+/**
+ ******************************************************************************
+ * @file    core_rx_lin_mbuf.c
+ * @brief   LIN Multi-Buffer Reception Backend
+ *
+ * @details
+ *   - Maps the backend calls onto lin_mbuf_rx.c: one RX interrupt per
+ *     frame of CORE_RX_LIN_FRAME_LEN bytes, partial frames flushed after
+ *     LIN_MBUF_FLUSH_MS of idle line and at the window end.
+ *   - In multi-buffer mode the transmitter works on whole frames, so text
+ *     output has to be bracketed by coreRxSuspend()/coreRxResume().
+ *
+ * @note
+ *   - SCI1 (linREG1) only; CORE_RX_SCI is ignored.
+ ******************************************************************************
+ */
+#include "core_rx.h"
+
+#if (CORE_RX_BACKEND == CORE_RX_LIN_MBUF)
+
+#include "lin_mbuf_rx.h"
+
+/**
+ * @brief  Enables the RX interrupt and switches SCI1 to multi-buffer mode.
+ * @param  callback  Called from the RX interrupt with each frame.
+ */
+void coreRxInit(coreRxCallback_t callback)
+{
+    /* Enable UART RX interrupt */
+    sciEnableNotification(sciREG1, SCI_RX_INT);
+    /* Switch SCI1 to multi-buffer mode, one interrupt per frame */
+    linMbufRxInit(linREG1, CORE_RX_LIN_FRAME_LEN, callback);
+}
+
+/**
+ * @brief  Frames are handed on from the interrupt.
+ * @return 0.
+ */
+uint32_t coreRxPoll(void)
+{
+    return 0U;
+}
+
+/**
+ * @brief  Flushes a partial frame once the line goes idle.
+ */
+void coreRxTick(void)
+{
+    linMbufRxTick();
+}
+
+/**
+ * @brief  Picks up a short transfer that never completed a frame.
+ */
+void coreRxFlush(void)
+{
+    linMbufRxFlush();
+}
+
+/**
+ * @brief  Leaves multi-buffer mode so text can be sent byte-wise.
+ */
+void coreRxSuspend(void)
+{
+    linMbufRxSuspend();
+}
+
+/**
+ * @brief  Returns to multi-buffer mode after the text output.
+ */
+void coreRxResume(void)
+{
+    linMbufRxResume();
+}
+
+/**
+ * @brief  Disables the RX interrupt and leaves multi-buffer mode; a
+ *         partial frame is discarded.
+ */
+void coreRxStop(void)
+{
+    sciDisableNotification(sciREG1, SCI_RX_INT);
+    linMbufRxSuspend();
+}
+
+#endif
@@ -0,0 +1,114 @@
+/**
+ ******************************************************************************
+ * @file    core_rx_polling.c
+ * @brief   Polling Reception Backend
+ *
+ * @details
+ *   - coreRxPoll() reads every byte SCI already holds and keeps reading
+ *     while the next one arrives within the wait below, then hands the
+ *     burst to the callback in one call, so the CRC runs on spans instead
+ *     of single bytes.
+ *
+ * @note
+ *   - SCI holds one byte: if the main loop does not come back to
+ *     coreRxPoll() within one character time, bytes are lost (overrun).
+ ******************************************************************************
+ */
+#include "core_rx.h"
+
+#if (CORE_RX_BACKEND == CORE_RX_POLLING)
+
+/* Polls of RXRDY without a byte before a burst is handed on */
+#define CORE_RX_POLL_WAIT       64U
+
+static coreRxCallback_t s_callback = NULL;
+
+/**
+ * @brief  Starts reception; sciInit() must have run.
+ * @param  callback  Called from coreRxPoll() with each burst.
+ */
+void coreRxInit(coreRxCallback_t callback)
+{
+    s_callback = callback;
+}
+
+/**
+ * @brief  Reads the bytes waiting on the port and hands them on.
+ * @return Number of bytes received.
+ */
+uint32_t coreRxPoll(void)
+{
+    uint8_t burst[CORE_RX_POLL_BURST];
+    uint32_t total = 0U;
+    uint32_t n = 0U;
+    uint32_t wait = 0U;
+
+    while (wait < CORE_RX_POLL_WAIT)
+    {
+        if (sciIsRxReady(CORE_RX_SCI) != 0U)
+        {
+            burst[n] = (uint8_t)sciReceiveByte(CORE_RX_SCI);
+            n++;
+            wait = 0U;
+            if (n == CORE_RX_POLL_BURST)
+            {
+                s_callback(burst, n);
+                total += n;
+                n = 0U;
+            }
+        }
+        else if (n == 0U)
+        {
+            /* Nothing pending, do not hold up the caller */
+            break;
+        }
+        else
+        {
+            wait++;
+        }
+    }
+    if (n > 0U)
+    {
+        s_callback(burst, n);
+        total += n;
+    }
+    return total;
+}
+
+/**
+ * @brief  Nothing to do per tick.
+ */
+void coreRxTick(void)
+{
+}
+
+/**
+ * @brief  Hands on whatever is waiting.
+ */
+void coreRxFlush(void)
+{
+    (void)coreRxPoll();
+}
+
+/**
+ * @brief  Output does not disturb reception.
+ */
+void coreRxSuspend(void)
+{
+}
+
+/**
+ * @brief  Output does not disturb reception.
+ */
+void coreRxResume(void)
+{
+}
+
+/**
+ * @brief  Nothing runs between polls.
+ */
+void coreRxStop(void)
+{
+}
+
+#endif
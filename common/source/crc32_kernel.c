@@ -0,0 +1,253 @@
+/**
+ ******************************************************************************
+ * @file    crc32_kernel.c
+ * @brief   CRC32 (IEEE 802.3) Kernels
+ *
+ * @details
+ *   - Bit-serial reference kernel moved out of the main file unchanged.
+ *   - Byte table kernel, word-at-a-time (slice-by-4) kernel and 32-byte
+ *     block kernel, all on the reflected CRC state.
+ *
+ * @note
+ *   - The word kernel handles unaligned heads and tails byte by byte, so any
+ *     span can be passed; spans that start on a word boundary (the DMA ring
+ *     is 32-byte aligned) run entirely on word loads.
+ ******************************************************************************
+ */
+#include "crc32_kernel.h"
+
+#if (CRC32_LITTLE_ENDIAN == 1)
+#define CRC32_BYTE_STEP(c, b)   (crc32_table[0][((c) ^ (uint32_t)(b)) & 0xFFU] ^ ((c) >> 8U))
+#define CRC32_WORD_STEP(c)      (crc32_table[3][(c) & 0xFFU] ^ crc32_table[2][((c) >> 8U) & 0xFFU] \
+                               ^ crc32_table[1][((c) >> 16U) & 0xFFU] ^ crc32_table[0][(c) >> 24U])
+#define CRC32_TO_NATIVE(c)      (c)
+#else
+#define CRC32_BYTE_STEP(c, b)   (crc32_table[0][((c) >> 24U) ^ (uint32_t)(b)] ^ ((c) << 8U))
+#define CRC32_WORD_STEP(c)      (crc32_table[0][(c) & 0xFFU] ^ crc32_table[1][((c) >> 8U) & 0xFFU] \
+                               ^ crc32_table[2][((c) >> 16U) & 0xFFU] ^ crc32_table[3][(c) >> 24U])
+#define CRC32_TO_NATIVE(c)      ((((c) >> 24U) & 0x000000FFU) | (((c) >> 8U) & 0x0000FF00U) \
+                               | (((c) << 8U) & 0x00FF0000U) | (((c) << 24U) & 0xFF000000U))
+#endif
+
+#if (CRC32_KERNEL_ASM == 0)
+static uint32_t crc32Burst32(uint32_t c, const uint32_t *block, uint32_t count);
+#endif
+
+/* The kernels run from RAM when .ramfunc is linked there (ramfunc.h) */
+#pragma CODE_SECTION(reflect8, ".ramCode")
+#pragma CODE_SECTION(reflect32, ".ramCode")
+#pragma CODE_SECTION(calc_crc32, ".ramCode")
+#pragma CODE_SECTION(update_crc32, ".ramCode")
+#pragma CODE_SECTION(crc32UpdateTable, ".ramCode")
+#pragma CODE_SECTION(crc32UpdateWord, ".ramCode")
+#pragma CODE_SECTION(crc32UpdateBurst, ".ramCode")
+#if (CRC32_KERNEL_ASM == 0)
+#pragma CODE_SECTION(crc32Burst32, ".ramCode")
+#endif
+
+/* Supporting Function for calculating CRC */
+uint8_t reflect8(uint8_t data)
+{
+#if (CRC32_KERNEL_ASM == 1)
+    return (uint8_t)(crc32Rbit((uint32_t)data) >> 24U);
+#else
+    uint8_t res = 0;
+    int i;
+    for (i = 0; i < 8; i++)
+        res |= ((data >> i) & 1) << (7 - i);
+    return res;
+#endif
+}
+
+/* Supporting Function for calculating CRC */
+uint32_t reflect32(uint32_t data)
+{
+#if (CRC32_KERNEL_ASM == 1)
+    return crc32Rbit(data);
+#else
+    uint32_t res = 0;
+    int i;
+    for (i = 0; i < 32; i++)
+        res |= ((data >> i) & 1) << (31 - i);
+    return res;
+#endif
+}
+
+/* Calculating CRC */
+uint32_t calc_crc32(uint8_t *data, uint32_t len)
+{
+    uint32_t i, crc = CRC32_INIT;
+    int j;
+    for (i = 0; i < len; i++) {
+        crc ^= ((uint32_t)reflect8(data[i])) << 24;
+        for (j = 0; j < 8; j++)
+            crc = (crc & 0x80000000) ? (crc << 1) ^ CRC32_POLYNOMIAL : (crc << 1);
+    }
+    return reflect32(crc) ^ CRC32_XOROUT;
+}
+
+/* Calculating CRC using incremental method */
+uint32_t update_crc32(uint32_t crc, uint8_t data)
+{
+    crc ^= ((uint32_t)reflect8(data)) << 24;
+    for (int j = 0; j < 8; j++)
+        crc = (crc & 0x80000000) ? (crc << 1) ^ CRC32_POLYNOMIAL : (crc << 1);
+    return crc;
+}
+
+/**
+ * @brief  Updates a reflected CRC32 state one byte at a time.
+ * @param  crc   Running state (CRC32_INIT for a new message).
+ * @param  data  Bytes to add.
+ * @param  len   Number of bytes.
+ * @return Updated state, finalize with ^ CRC32_XOROUT.
+ */
+uint32_t crc32UpdateTable(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    uint32_t c = CRC32_TO_NATIVE(crc);
+
+    while (len > 0U)
+    {
+        c = CRC32_BYTE_STEP(c, *data);
+        data++;
+        len--;
+    }
+    return CRC32_TO_NATIVE(c);
+}
+
+/**
+ * @brief  Updates a reflected CRC32 state one 32-bit word at a time.
+ * @param  crc   Running state (CRC32_INIT for a new message).
+ * @param  data  Bytes to add, any alignment.
+ * @param  len   Number of bytes.
+ * @return Updated state, finalize with ^ CRC32_XOROUT.
+ */
+uint32_t crc32UpdateWord(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    uint32_t c = CRC32_TO_NATIVE(crc);
+    const uint32_t *word;
+
+    /* Bring the pointer to a word boundary */
+    while ((len > 0U) && (((uintptr_t)data & 3U) != 0U))
+    {
+        c = CRC32_BYTE_STEP(c, *data);
+        data++;
+        len--;
+    }
+
+    word = (const uint32_t *)data;
+    while (len >= 16U)
+    {
+        c ^= word[0U];
+        c = CRC32_WORD_STEP(c);
+        c ^= word[1U];
+        c = CRC32_WORD_STEP(c);
+        c ^= word[2U];
+        c = CRC32_WORD_STEP(c);
+        c ^= word[3U];
+        c = CRC32_WORD_STEP(c);
+        word += 4U;
+        len -= 16U;
+    }
+    while (len >= 4U)
+    {
+        c ^= *word;
+        c = CRC32_WORD_STEP(c);
+        word++;
+        len -= 4U;
+    }
+
+    data = (const uint8_t *)word;
+    while (len > 0U)
+    {
+        c = CRC32_BYTE_STEP(c, *data);
+        data++;
+        len--;
+    }
+    return CRC32_TO_NATIVE(c);
+}
+
+/**
+ * @brief  Updates a reflected CRC32 state in 32-byte blocks.
+ * @param  crc   Running state (CRC32_INIT for a new message).
+ * @param  data  Bytes to add, any alignment.
+ * @param  len   Number of bytes.
+ * @return Updated state, finalize with ^ CRC32_XOROUT.
+ * @note   The head up to the first 32-byte boundary is handled by bytes
+ *         and words, so only aligned blocks reach crc32Burst32().
+ */
+uint32_t crc32UpdateBurst(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    uint32_t c = CRC32_TO_NATIVE(crc);
+    const uint32_t *word;
+    uint32_t blocks;
+
+    while ((len > 0U) && (((uintptr_t)data & 3U) != 0U))
+    {
+        c = CRC32_BYTE_STEP(c, *data);
+        data++;
+        len--;
+    }
+
+    word = (const uint32_t *)data;
+    while ((len >= 4U) && (((uintptr_t)word & (CRC32_BURST_LEN - 1U)) != 0U))
+    {
+        c ^= *word;
+        c = CRC32_WORD_STEP(c);
+        word++;
+        len -= 4U;
+    }
+
+    blocks = len / CRC32_BURST_LEN;
+    c = crc32Burst32(c, word, blocks);
+    word += blocks * (CRC32_BURST_LEN / 4U);
+    len -= blocks * CRC32_BURST_LEN;
+
+    while (len >= 4U)
+    {
+        c ^= *word;
+        c = CRC32_WORD_STEP(c);
+        word++;
+        len -= 4U;
+    }
+
+    data = (const uint8_t *)word;
+    while (len > 0U)
+    {
+        c = CRC32_BYTE_STEP(c, *data);
+        data++;
+        len--;
+    }
+    return CRC32_TO_NATIVE(c);
+}
+
+#if (CRC32_KERNEL_ASM == 0)
+/**
+ * @brief  Portable version of the block loop in crc32_kernel_r5.asm.
+ * @param  c      Native state.
+ * @param  block  Word aligned pointer to the first block.
+ * @param  count  Number of 32-byte blocks.
+ * @return Updated native state.
+ */
+static uint32_t crc32Burst32(uint32_t c, const uint32_t *block, uint32_t count)
+{
+    uint32_t w[CRC32_BURST_LEN / 4U];
+    uint32_t i;
+
+    while (count > 0U)
+    {
+        for (i = 0U; i < (CRC32_BURST_LEN / 4U); i++)
+        {
+            w[i] = block[i];
+        }
+        for (i = 0U; i < (CRC32_BURST_LEN / 4U); i++)
+        {
+            c ^= w[i];
+            c = CRC32_WORD_STEP(c);
+        }
+        block += CRC32_BURST_LEN / 4U;
+        count--;
+    }
+    return c;
+}
+#endif
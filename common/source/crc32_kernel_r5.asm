@@ -0,0 +1,94 @@
+;-------------------------------------------------------------------------------
+; crc32_kernel_r5.asm
+;
+; Cortex-R5 (BE32) CRC32 kernels, called from crc32_kernel.c when
+; CRC32_KERNEL_ASM is 1.
+;
+;  - crc32Rbit: 32-bit bit reversal in one RBIT, replaces the 32-step
+;    loops of reflect8()/reflect32().
+;  - crc32Burst32: slice-by-4 over whole 32-byte blocks. Each block is
+;    fetched with one 8-register LDM, which the R5 issues as four 64-bit
+;    reads when the pointer is 32-byte aligned, and the four table reads of
+;    each word are issued back to back so the load-use latency of one is
+;    hidden behind the address arithmetic of the next.
+;
+; The state is kept in native (byte swapped) form, the same as the C
+; kernels on big-endian builds, with crc32_table[] holding the byte swapped
+; tables: word step = T0[c & 0xFF] ^ T1[(c >> 8) & 0xFF]
+;                   ^ T2[(c >> 16) & 0xFF] ^ T3[c >> 24].
+;-------------------------------------------------------------------------------
+
+    .sect    ".ramCode"              ; runs from RAM, see ramfunc.h
+    .arm
+
+    .ref     crc32_table
+
+;-------------------------------------------------------------------------------
+; One slice-by-4 word step on r0, with the data word in rd.
+; r3 = &crc32_table[0][0], r12/lr/rd are clobbered.
+
+CRC32_STEP .macro rd
+        eor   r0,  r0,  :rd:
+        and   r12, r0,  #0xFF
+        and   lr,  r0,  #0xFF00
+        and   :rd:, r0, #0xFF0000
+        ldr   r12, [r3, r12, lsl #2]        ; T0[b0]
+        add   lr,  r3,  lr, lsr #6
+        add   :rd:, r3, :rd:, lsr #14
+        ldr   lr,  [lr, #1024]              ; T1[b1]
+        mov   r0,  r0,  lsr #24
+        ldr   :rd:, [:rd:, #2048]           ; T2[b2]
+        add   r0,  r3,  r0, lsl #2
+        ldr   r0,  [r0, #3072]              ; T3[b3]
+        eor   r12, r12, lr
+        eor   r12, r12, :rd:
+        eor   r0,  r0,  r12
+        .endm
+
+;-------------------------------------------------------------------------------
+; Reverse the bit order of a word
+; uint32_t crc32Rbit(uint32_t data)
+
+    .def     crc32Rbit
+    .asmfunc
+
+crc32Rbit
+
+        rbit  r0,  r0
+        bx    lr
+
+    .endasmfunc
+
+;-------------------------------------------------------------------------------
+; Update a native CRC state over 32-byte blocks
+; uint32_t crc32Burst32(uint32_t c, const uint32_t *block, uint32_t count)
+; block must be word aligned, 32-byte alignment gives full LDM bursts.
+
+    .def     crc32Burst32
+    .asmfunc
+
+crc32Burst32
+
+        cmp   r2,  #0
+        bxeq  lr
+        stmfd sp!, {r4-r11, lr}
+        ldr   r3,  crc32TableAddr
+
+crc32Burst32Loop
+        ldmia r1!, {r4-r11}
+        CRC32_STEP r4
+        CRC32_STEP r5
+        CRC32_STEP r6
+        CRC32_STEP r7
+        CRC32_STEP r8
+        CRC32_STEP r9
+        CRC32_STEP r10
+        CRC32_STEP r11
+        subs  r2,  r2,  #1
+        bne   crc32Burst32Loop
+
+        ldmfd sp!, {r4-r11, pc}
+
+crc32TableAddr  .word crc32_table
+
+    .endasmfunc
@@ -0,0 +1,389 @@
+/**
+ ******************************************************************************
+ * @file    crc32_table.c
+ * @brief   Lookup Tables for the Slice-by-4 CRC32 Kernel
+ *
+ * @details
+ *   - Table k maps a byte to its CRC contribution k bytes ahead of the end
+ *     of a 32-bit word (reflected polynomial 0xEDB88320).
+ *   - Big-endian builds use the byte-swapped tables so that words loaded
+ *     from RAM can be folded into the state without a byte reversal.
+ *
+ * @note
+ *   - Generated, do not edit by hand.
+ ******************************************************************************
+ */
+#include "crc32_kernel.h"
+
+/* Runs from RAM with the kernels (ramfunc.h) */
+#pragma DATA_SECTION(crc32_table, ".ramConst")
+
+#if (CRC32_LITTLE_ENDIAN == 1)
+const uint32_t crc32_table[4][256] =
+{
+    {
+        0x00000000U, 0x77073096U, 0xEE0E612CU, 0x990951BAU, 0x076DC419U, 0x706AF48FU,
+        0xE963A535U, 0x9E6495A3U, 0x0EDB8832U, 0x79DCB8A4U, 0xE0D5E91EU, 0x97D2D988U,
+        0x09B64C2BU, 0x7EB17CBDU, 0xE7B82D07U, 0x90BF1D91U, 0x1DB71064U, 0x6AB020F2U,
+        0xF3B97148U, 0x84BE41DEU, 0x1ADAD47DU, 0x6DDDE4EBU, 0xF4D4B551U, 0x83D385C7U,
+        0x136C9856U, 0x646BA8C0U, 0xFD62F97AU, 0x8A65C9ECU, 0x14015C4FU, 0x63066CD9U,
+        0xFA0F3D63U, 0x8D080DF5U, 0x3B6E20C8U, 0x4C69105EU, 0xD56041E4U, 0xA2677172U,
+        0x3C03E4D1U, 0x4B04D447U, 0xD20D85FDU, 0xA50AB56BU, 0x35B5A8FAU, 0x42B2986CU,
+        0xDBBBC9D6U, 0xACBCF940U, 0x32D86CE3U, 0x45DF5C75U, 0xDCD60DCFU, 0xABD13D59U,
+        0x26D930ACU, 0x51DE003AU, 0xC8D75180U, 0xBFD06116U, 0x21B4F4B5U, 0x56B3C423U,
+        0xCFBA9599U, 0xB8BDA50FU, 0x2802B89EU, 0x5F058808U, 0xC60CD9B2U, 0xB10BE924U,
+        0x2F6F7C87U, 0x58684C11U, 0xC1611DABU, 0xB6662D3DU, 0x76DC4190U, 0x01DB7106U,
+        0x98D220BCU, 0xEFD5102AU, 0x71B18589U, 0x06B6B51FU, 0x9FBFE4A5U, 0xE8B8D433U,
+        0x7807C9A2U, 0x0F00F934U, 0x9609A88EU, 0xE10E9818U, 0x7F6A0DBBU, 0x086D3D2DU,
+        0x91646C97U, 0xE6635C01U, 0x6B6B51F4U, 0x1C6C6162U, 0x856530D8U, 0xF262004EU,
+        0x6C0695EDU, 0x1B01A57BU, 0x8208F4C1U, 0xF50FC457U, 0x65B0D9C6U, 0x12B7E950U,
+        0x8BBEB8EAU, 0xFCB9887CU, 0x62DD1DDFU, 0x15DA2D49U, 0x8CD37CF3U, 0xFBD44C65U,
+        0x4DB26158U, 0x3AB551CEU, 0xA3BC0074U, 0xD4BB30E2U, 0x4ADFA541U, 0x3DD895D7U,
+        0xA4D1C46DU, 0xD3D6F4FBU, 0x4369E96AU, 0x346ED9FCU, 0xAD678846U, 0xDA60B8D0U,
+        0x44042D73U, 0x33031DE5U, 0xAA0A4C5FU, 0xDD0D7CC9U, 0x5005713CU, 0x270241AAU,
+        0xBE0B1010U, 0xC90C2086U, 0x5768B525U, 0x206F85B3U, 0xB966D409U, 0xCE61E49FU,
+        0x5EDEF90EU, 0x29D9C998U, 0xB0D09822U, 0xC7D7A8B4U, 0x59B33D17U, 0x2EB40D81U,
+        0xB7BD5C3BU, 0xC0BA6CADU, 0xEDB88320U, 0x9ABFB3B6U, 0x03B6E20CU, 0x74B1D29AU,
+        0xEAD54739U, 0x9DD277AFU, 0x04DB2615U, 0x73DC1683U, 0xE3630B12U, 0x94643B84U,
+        0x0D6D6A3EU, 0x7A6A5AA8U, 0xE40ECF0BU, 0x9309FF9DU, 0x0A00AE27U, 0x7D079EB1U,
+        0xF00F9344U, 0x8708A3D2U, 0x1E01F268U, 0x6906C2FEU, 0xF762575DU, 0x806567CBU,
+        0x196C3671U, 0x6E6B06E7U, 0xFED41B76U, 0x89D32BE0U, 0x10DA7A5AU, 0x67DD4ACCU,
+        0xF9B9DF6FU, 0x8EBEEFF9U, 0x17B7BE43U, 0x60B08ED5U, 0xD6D6A3E8U, 0xA1D1937EU,
+        0x38D8C2C4U, 0x4FDFF252U, 0xD1BB67F1U, 0xA6BC5767U, 0x3FB506DDU, 0x48B2364BU,
+        0xD80D2BDAU, 0xAF0A1B4CU, 0x36034AF6U, 0x41047A60U, 0xDF60EFC3U, 0xA867DF55U,
+        0x316E8EEFU, 0x4669BE79U, 0xCB61B38CU, 0xBC66831AU, 0x256FD2A0U, 0x5268E236U,
+        0xCC0C7795U, 0xBB0B4703U, 0x220216B9U, 0x5505262FU, 0xC5BA3BBEU, 0xB2BD0B28U,
+        0x2BB45A92U, 0x5CB36A04U, 0xC2D7FFA7U, 0xB5D0CF31U, 0x2CD99E8BU, 0x5BDEAE1DU,
+        0x9B64C2B0U, 0xEC63F226U, 0x756AA39CU, 0x026D930AU, 0x9C0906A9U, 0xEB0E363FU,
+        0x72076785U, 0x05005713U, 0x95BF4A82U, 0xE2B87A14U, 0x7BB12BAEU, 0x0CB61B38U,
+        0x92D28E9BU, 0xE5D5BE0DU, 0x7CDCEFB7U, 0x0BDBDF21U, 0x86D3D2D4U, 0xF1D4E242U,
+        0x68DDB3F8U, 0x1FDA836EU, 0x81BE16CDU, 0xF6B9265BU, 0x6FB077E1U, 0x18B74777U,
+        0x88085AE6U, 0xFF0F6A70U, 0x66063BCAU, 0x11010B5CU, 0x8F659EFFU, 0xF862AE69U,
+        0x616BFFD3U, 0x166CCF45U, 0xA00AE278U, 0xD70DD2EEU, 0x4E048354U, 0x3903B3C2U,
+        0xA7672661U, 0xD06016F7U, 0x4969474DU, 0x3E6E77DBU, 0xAED16A4AU, 0xD9D65ADCU,
+        0x40DF0B66U, 0x37D83BF0U, 0xA9BCAE53U, 0xDEBB9EC5U, 0x47B2CF7FU, 0x30B5FFE9U,
+        0xBDBDF21CU, 0xCABAC28AU, 0x53B39330U, 0x24B4A3A6U, 0xBAD03605U, 0xCDD70693U,
+        0x54DE5729U, 0x23D967BFU, 0xB3667A2EU, 0xC4614AB8U, 0x5D681B02U, 0x2A6F2B94U,
+        0xB40BBE37U, 0xC30C8EA1U, 0x5A05DF1BU, 0x2D02EF8DU
+    },
+    {
+        0x00000000U, 0x191B3141U, 0x32366282U, 0x2B2D53C3U, 0x646CC504U, 0x7D77F445U,
+        0x565AA786U, 0x4F4196C7U, 0xC8D98A08U, 0xD1C2BB49U, 0xFAEFE88AU, 0xE3F4D9CBU,
+        0xACB54F0CU, 0xB5AE7E4DU, 0x9E832D8EU, 0x87981CCFU, 0x4AC21251U, 0x53D92310U,
+        0x78F470D3U, 0x61EF4192U, 0x2EAED755U, 0x37B5E614U, 0x1C98B5D7U, 0x05838496U,
+        0x821B9859U, 0x9B00A918U, 0xB02DFADBU, 0xA936CB9AU, 0xE6775D5DU, 0xFF6C6C1CU,
+        0xD4413FDFU, 0xCD5A0E9EU, 0x958424A2U, 0x8C9F15E3U, 0xA7B24620U, 0xBEA97761U,
+        0xF1E8E1A6U, 0xE8F3D0E7U, 0xC3DE8324U, 0xDAC5B265U, 0x5D5DAEAAU, 0x44469FEBU,
+        0x6F6BCC28U, 0x7670FD69U, 0x39316BAEU, 0x202A5AEFU, 0x0B07092CU, 0x121C386DU,
+        0xDF4636F3U, 0xC65D07B2U, 0xED705471U, 0xF46B6530U, 0xBB2AF3F7U, 0xA231C2B6U,
+        0x891C9175U, 0x9007A034U, 0x179FBCFBU, 0x0E848DBAU, 0x25A9DE79U, 0x3CB2EF38U,
+        0x73F379FFU, 0x6AE848BEU, 0x41C51B7DU, 0x58DE2A3CU, 0xF0794F05U, 0xE9627E44U,
+        0xC24F2D87U, 0xDB541CC6U, 0x94158A01U, 0x8D0EBB40U, 0xA623E883U, 0xBF38D9C2U,
+        0x38A0C50DU, 0x21BBF44CU, 0x0A96A78FU, 0x138D96CEU, 0x5CCC0009U, 0x45D73148U,
+        0x6EFA628BU, 0x77E153CAU, 0xBABB5D54U, 0xA3A06C15U, 0x888D3FD6U, 0x91960E97U,
+        0xDED79850U, 0xC7CCA911U, 0xECE1FAD2U, 0xF5FACB93U, 0x7262D75CU, 0x6B79E61DU,
+        0x4054B5DEU, 0x594F849FU, 0x160E1258U, 0x0F152319U, 0x243870DAU, 0x3D23419BU,
+        0x65FD6BA7U, 0x7CE65AE6U, 0x57CB0925U, 0x4ED03864U, 0x0191AEA3U, 0x188A9FE2U,
+        0x33A7CC21U, 0x2ABCFD60U, 0xAD24E1AFU, 0xB43FD0EEU, 0x9F12832DU, 0x8609B26CU,
+        0xC94824ABU, 0xD05315EAU, 0xFB7E4629U, 0xE2657768U, 0x2F3F79F6U, 0x362448B7U,
+        0x1D091B74U, 0x04122A35U, 0x4B53BCF2U, 0x52488DB3U, 0x7965DE70U, 0x607EEF31U,
+        0xE7E6F3FEU, 0xFEFDC2BFU, 0xD5D0917CU, 0xCCCBA03DU, 0x838A36FAU, 0x9A9107BBU,
+        0xB1BC5478U, 0xA8A76539U, 0x3B83984BU, 0x2298A90AU, 0x09B5FAC9U, 0x10AECB88U,
+        0x5FEF5D4FU, 0x46F46C0EU, 0x6DD93FCDU, 0x74C20E8CU, 0xF35A1243U, 0xEA412302U,
+        0xC16C70C1U, 0xD8774180U, 0x9736D747U, 0x8E2DE606U, 0xA500B5C5U, 0xBC1B8484U,
+        0x71418A1AU, 0x685ABB5BU, 0x4377E898U, 0x5A6CD9D9U, 0x152D4F1EU, 0x0C367E5FU,
+        0x271B2D9CU, 0x3E001CDDU, 0xB9980012U, 0xA0833153U, 0x8BAE6290U, 0x92B553D1U,
+        0xDDF4C516U, 0xC4EFF457U, 0xEFC2A794U, 0xF6D996D5U, 0xAE07BCE9U, 0xB71C8DA8U,
+        0x9C31DE6BU, 0x852AEF2AU, 0xCA6B79EDU, 0xD37048ACU, 0xF85D1B6FU, 0xE1462A2EU,
+        0x66DE36E1U, 0x7FC507A0U, 0x54E85463U, 0x4DF36522U, 0x02B2F3E5U, 0x1BA9C2A4U,
+        0x30849167U, 0x299FA026U, 0xE4C5AEB8U, 0xFDDE9FF9U, 0xD6F3CC3AU, 0xCFE8FD7BU,
+        0x80A96BBCU, 0x99B25AFDU, 0xB29F093EU, 0xAB84387FU, 0x2C1C24B0U, 0x350715F1U,
+        0x1E2A4632U, 0x07317773U, 0x4870E1B4U, 0x516BD0F5U, 0x7A468336U, 0x635DB277U,
+        0xCBFAD74EU, 0xD2E1E60FU, 0xF9CCB5CCU, 0xE0D7848DU, 0xAF96124AU, 0xB68D230BU,
+        0x9DA070C8U, 0x84BB4189U, 0x03235D46U, 0x1A386C07U, 0x31153FC4U, 0x280E0E85U,
+        0x674F9842U, 0x7E54A903U, 0x5579FAC0U, 0x4C62CB81U, 0x8138C51FU, 0x9823F45EU,
+        0xB30EA79DU, 0xAA1596DCU, 0xE554001BU, 0xFC4F315AU, 0xD7626299U, 0xCE7953D8U,
+        0x49E14F17U, 0x50FA7E56U, 0x7BD72D95U, 0x62CC1CD4U, 0x2D8D8A13U, 0x3496BB52U,
+        0x1FBBE891U, 0x06A0D9D0U, 0x5E7EF3ECU, 0x4765C2ADU, 0x6C48916EU, 0x7553A02FU,
+        0x3A1236E8U, 0x230907A9U, 0x0824546AU, 0x113F652BU, 0x96A779E4U, 0x8FBC48A5U,
+        0xA4911B66U, 0xBD8A2A27U, 0xF2CBBCE0U, 0xEBD08DA1U, 0xC0FDDE62U, 0xD9E6EF23U,
+        0x14BCE1BDU, 0x0DA7D0FCU, 0x268A833FU, 0x3F91B27EU, 0x70D024B9U, 0x69CB15F8U,
+        0x42E6463BU, 0x5BFD777AU, 0xDC656BB5U, 0xC57E5AF4U, 0xEE530937U, 0xF7483876U,
+        0xB809AEB1U, 0xA1129FF0U, 0x8A3FCC33U, 0x9324FD72U
+    },
+    {
+        0x00000000U, 0x01C26A37U, 0x0384D46EU, 0x0246BE59U, 0x0709A8DCU, 0x06CBC2EBU,
+        0x048D7CB2U, 0x054F1685U, 0x0E1351B8U, 0x0FD13B8FU, 0x0D9785D6U, 0x0C55EFE1U,
+        0x091AF964U, 0x08D89353U, 0x0A9E2D0AU, 0x0B5C473DU, 0x1C26A370U, 0x1DE4C947U,
+        0x1FA2771EU, 0x1E601D29U, 0x1B2F0BACU, 0x1AED619BU, 0x18ABDFC2U, 0x1969B5F5U,
+        0x1235F2C8U, 0x13F798FFU, 0x11B126A6U, 0x10734C91U, 0x153C5A14U, 0x14FE3023U,
+        0x16B88E7AU, 0x177AE44DU, 0x384D46E0U, 0x398F2CD7U, 0x3BC9928EU, 0x3A0BF8B9U,
+        0x3F44EE3CU, 0x3E86840BU, 0x3CC03A52U, 0x3D025065U, 0x365E1758U, 0x379C7D6FU,
+        0x35DAC336U, 0x3418A901U, 0x3157BF84U, 0x3095D5B3U, 0x32D36BEAU, 0x331101DDU,
+        0x246BE590U, 0x25A98FA7U, 0x27EF31FEU, 0x262D5BC9U, 0x23624D4CU, 0x22A0277BU,
+        0x20E69922U, 0x2124F315U, 0x2A78B428U, 0x2BBADE1FU, 0x29FC6046U, 0x283E0A71U,
+        0x2D711CF4U, 0x2CB376C3U, 0x2EF5C89AU, 0x2F37A2ADU, 0x709A8DC0U, 0x7158E7F7U,
+        0x731E59AEU, 0x72DC3399U, 0x7793251CU, 0x76514F2BU, 0x7417F172U, 0x75D59B45U,
+        0x7E89DC78U, 0x7F4BB64FU, 0x7D0D0816U, 0x7CCF6221U, 0x798074A4U, 0x78421E93U,
+        0x7A04A0CAU, 0x7BC6CAFDU, 0x6CBC2EB0U, 0x6D7E4487U, 0x6F38FADEU, 0x6EFA90E9U,
+        0x6BB5866CU, 0x6A77EC5BU, 0x68315202U, 0x69F33835U, 0x62AF7F08U, 0x636D153FU,
+        0x612BAB66U, 0x60E9C151U, 0x65A6D7D4U, 0x6464BDE3U, 0x662203BAU, 0x67E0698DU,
+        0x48D7CB20U, 0x4915A117U, 0x4B531F4EU, 0x4A917579U, 0x4FDE63FCU, 0x4E1C09CBU,
+        0x4C5AB792U, 0x4D98DDA5U, 0x46C49A98U, 0x4706F0AFU, 0x45404EF6U, 0x448224C1U,
+        0x41CD3244U, 0x400F5873U, 0x4249E62AU, 0x438B8C1DU, 0x54F16850U, 0x55330267U,
+        0x5775BC3EU, 0x56B7D609U, 0x53F8C08CU, 0x523AAABBU, 0x507C14E2U, 0x51BE7ED5U,
+        0x5AE239E8U, 0x5B2053DFU, 0x5966ED86U, 0x58A487B1U, 0x5DEB9134U, 0x5C29FB03U,
+        0x5E6F455AU, 0x5FAD2F6DU, 0xE1351B80U, 0xE0F771B7U, 0xE2B1CFEEU, 0xE373A5D9U,
+        0xE63CB35CU, 0xE7FED96BU, 0xE5B86732U, 0xE47A0D05U, 0xEF264A38U, 0xEEE4200FU,
+        0xECA29E56U, 0xED60F461U, 0xE82FE2E4U, 0xE9ED88D3U, 0xEBAB368AU, 0xEA695CBDU,
+        0xFD13B8F0U, 0xFCD1D2C7U, 0xFE976C9EU, 0xFF5506A9U, 0xFA1A102CU, 0xFBD87A1BU,
+        0xF99EC442U, 0xF85CAE75U, 0xF300E948U, 0xF2C2837FU, 0xF0843D26U, 0xF1465711U,
+        0xF4094194U, 0xF5CB2BA3U, 0xF78D95FAU, 0xF64FFFCDU, 0xD9785D60U, 0xD8BA3757U,
+        0xDAFC890EU, 0xDB3EE339U, 0xDE71F5BCU, 0xDFB39F8BU, 0xDDF521D2U, 0xDC374BE5U,
+        0xD76B0CD8U, 0xD6A966EFU, 0xD4EFD8B6U, 0xD52DB281U, 0xD062A404U, 0xD1A0CE33U,
+        0xD3E6706AU, 0xD2241A5DU, 0xC55EFE10U, 0xC49C9427U, 0xC6DA2A7EU, 0xC7184049U,
+        0xC25756CCU, 0xC3953CFBU, 0xC1D382A2U, 0xC011E895U, 0xCB4DAFA8U, 0xCA8FC59FU,
+        0xC8C97BC6U, 0xC90B11F1U, 0xCC440774U, 0xCD866D43U, 0xCFC0D31AU, 0xCE02B92DU,
+        0x91AF9640U, 0x906DFC77U, 0x922B422EU, 0x93E92819U, 0x96A63E9CU, 0x976454ABU,
+        0x9522EAF2U, 0x94E080C5U, 0x9FBCC7F8U, 0x9E7EADCFU, 0x9C381396U, 0x9DFA79A1U,
+        0x98B56F24U, 0x99770513U, 0x9B31BB4AU, 0x9AF3D17DU, 0x8D893530U, 0x8C4B5F07U,
+        0x8E0DE15EU, 0x8FCF8B69U, 0x8A809DECU, 0x8B42F7DBU, 0x89044982U, 0x88C623B5U,
+        0x839A6488U, 0x82580EBFU, 0x801EB0E6U, 0x81DCDAD1U, 0x8493CC54U, 0x8551A663U,
+        0x8717183AU, 0x86D5720DU, 0xA9E2D0A0U, 0xA820BA97U, 0xAA6604CEU, 0xABA46EF9U,
+        0xAEEB787CU, 0xAF29124BU, 0xAD6FAC12U, 0xACADC625U, 0xA7F18118U, 0xA633EB2FU,
+        0xA4755576U, 0xA5B73F41U, 0xA0F829C4U, 0xA13A43F3U, 0xA37CFDAAU, 0xA2BE979DU,
+        0xB5C473D0U, 0xB40619E7U, 0xB640A7BEU, 0xB782CD89U, 0xB2CDDB0CU, 0xB30FB13BU,
+        0xB1490F62U, 0xB08B6555U, 0xBBD72268U, 0xBA15485FU, 0xB853F606U, 0xB9919C31U,
+        0xBCDE8AB4U, 0xBD1CE083U, 0xBF5A5EDAU, 0xBE9834EDU
+    },
+    {
+        0x00000000U, 0xB8BC6765U, 0xAA09C88BU, 0x12B5AFEEU, 0x8F629757U, 0x37DEF032U,
+        0x256B5FDCU, 0x9DD738B9U, 0xC5B428EFU, 0x7D084F8AU, 0x6FBDE064U, 0xD7018701U,
+        0x4AD6BFB8U, 0xF26AD8DDU, 0xE0DF7733U, 0x58631056U, 0x5019579FU, 0xE8A530FAU,
+        0xFA109F14U, 0x42ACF871U, 0xDF7BC0C8U, 0x67C7A7ADU, 0x75720843U, 0xCDCE6F26U,
+        0x95AD7F70U, 0x2D111815U, 0x3FA4B7FBU, 0x8718D09EU, 0x1ACFE827U, 0xA2738F42U,
+        0xB0C620ACU, 0x087A47C9U, 0xA032AF3EU, 0x188EC85BU, 0x0A3B67B5U, 0xB28700D0U,
+        0x2F503869U, 0x97EC5F0CU, 0x8559F0E2U, 0x3DE59787U, 0x658687D1U, 0xDD3AE0B4U,
+        0xCF8F4F5AU, 0x7733283FU, 0xEAE41086U, 0x525877E3U, 0x40EDD80DU, 0xF851BF68U,
+        0xF02BF8A1U, 0x48979FC4U, 0x5A22302AU, 0xE29E574FU, 0x7F496FF6U, 0xC7F50893U,
+        0xD540A77DU, 0x6DFCC018U, 0x359FD04EU, 0x8D23B72BU, 0x9F9618C5U, 0x272A7FA0U,
+        0xBAFD4719U, 0x0241207CU, 0x10F48F92U, 0xA848E8F7U, 0x9B14583DU, 0x23A83F58U,
+        0x311D90B6U, 0x89A1F7D3U, 0x1476CF6AU, 0xACCAA80FU, 0xBE7F07E1U, 0x06C36084U,
+        0x5EA070D2U, 0xE61C17B7U, 0xF4A9B859U, 0x4C15DF3CU, 0xD1C2E785U, 0x697E80E0U,
+        0x7BCB2F0EU, 0xC377486BU, 0xCB0D0FA2U, 0x73B168C7U, 0x6104C729U, 0xD9B8A04CU,
+        0x446F98F5U, 0xFCD3FF90U, 0xEE66507EU, 0x56DA371BU, 0x0EB9274DU, 0xB6054028U,
+        0xA4B0EFC6U, 0x1C0C88A3U, 0x81DBB01AU, 0x3967D77FU, 0x2BD27891U, 0x936E1FF4U,
+        0x3B26F703U, 0x839A9066U, 0x912F3F88U, 0x299358EDU, 0xB4446054U, 0x0CF80731U,
+        0x1E4DA8DFU, 0xA6F1CFBAU, 0xFE92DFECU, 0x462EB889U, 0x549B1767U, 0xEC277002U,
+        0x71F048BBU, 0xC94C2FDEU, 0xDBF98030U, 0x6345E755U, 0x6B3FA09CU, 0xD383C7F9U,
+        0xC1366817U, 0x798A0F72U, 0xE45D37CBU, 0x5CE150AEU, 0x4E54FF40U, 0xF6E89825U,
+        0xAE8B8873U, 0x1637EF16U, 0x048240F8U, 0xBC3E279DU, 0x21E91F24U, 0x99557841U,
+        0x8BE0D7AFU, 0x335CB0CAU, 0xED59B63BU, 0x55E5D15EU, 0x47507EB0U, 0xFFEC19D5U,
+        0x623B216CU, 0xDA874609U, 0xC832E9E7U, 0x708E8E82U, 0x28ED9ED4U, 0x9051F9B1U,
+        0x82E4565FU, 0x3A58313AU, 0xA78F0983U, 0x1F336EE6U, 0x0D86C108U, 0xB53AA66DU,
+        0xBD40E1A4U, 0x05FC86C1U, 0x1749292FU, 0xAFF54E4AU, 0x322276F3U, 0x8A9E1196U,
+        0x982BBE78U, 0x2097D91DU, 0x78F4C94BU, 0xC048AE2EU, 0xD2FD01C0U, 0x6A4166A5U,
+        0xF7965E1CU, 0x4F2A3979U, 0x5D9F9697U, 0xE523F1F2U, 0x4D6B1905U, 0xF5D77E60U,
+        0xE762D18EU, 0x5FDEB6EBU, 0xC2098E52U, 0x7AB5E937U, 0x680046D9U, 0xD0BC21BCU,
+        0x88DF31EAU, 0x3063568FU, 0x22D6F961U, 0x9A6A9E04U, 0x07BDA6BDU, 0xBF01C1D8U,
+        0xADB46E36U, 0x15080953U, 0x1D724E9AU, 0xA5CE29FFU, 0xB77B8611U, 0x0FC7E174U,
+        0x9210D9CDU, 0x2AACBEA8U, 0x38191146U, 0x80A57623U, 0xD8C66675U, 0x607A0110U,
+        0x72CFAEFEU, 0xCA73C99BU, 0x57A4F122U, 0xEF189647U, 0xFDAD39A9U, 0x45115ECCU,
+        0x764DEE06U, 0xCEF18963U, 0xDC44268DU, 0x64F841E8U, 0xF92F7951U, 0x41931E34U,
+        0x5326B1DAU, 0xEB9AD6BFU, 0xB3F9C6E9U, 0x0B45A18CU, 0x19F00E62U, 0xA14C6907U,
+        0x3C9B51BEU, 0x842736DBU, 0x96929935U, 0x2E2EFE50U, 0x2654B999U, 0x9EE8DEFCU,
+        0x8C5D7112U, 0x34E11677U, 0xA9362ECEU, 0x118A49ABU, 0x033FE645U, 0xBB838120U,
+        0xE3E09176U, 0x5B5CF613U, 0x49E959FDU, 0xF1553E98U, 0x6C820621U, 0xD43E6144U,
+        0xC68BCEAAU, 0x7E37A9CFU, 0xD67F4138U, 0x6EC3265DU, 0x7C7689B3U, 0xC4CAEED6U,
+        0x591DD66FU, 0xE1A1B10AU, 0xF3141EE4U, 0x4BA87981U, 0x13CB69D7U, 0xAB770EB2U,
+        0xB9C2A15CU, 0x017EC639U, 0x9CA9FE80U, 0x241599E5U, 0x36A0360BU, 0x8E1C516EU,
+        0x866616A7U, 0x3EDA71C2U, 0x2C6FDE2CU, 0x94D3B949U, 0x090481F0U, 0xB1B8E695U,
+        0xA30D497BU, 0x1BB12E1EU, 0x43D23E48U, 0xFB6E592DU, 0xE9DBF6C3U, 0x516791A6U,
+        0xCCB0A91FU, 0x740CCE7AU, 0x66B96194U, 0xDE0506F1U
+    }
+};
+#else
+const uint32_t crc32_table[4][256] =
+{
+    {
+        0x00000000U, 0x96300777U, 0x2C610EEEU, 0xBA510999U, 0x19C46D07U, 0x8FF46A70U,
+        0x35A563E9U, 0xA395649EU, 0x3288DB0EU, 0xA4B8DC79U, 0x1EE9D5E0U, 0x88D9D297U,
+        0x2B4CB609U, 0xBD7CB17EU, 0x072DB8E7U, 0x911DBF90U, 0x6410B71DU, 0xF220B06AU,
+        0x4871B9F3U, 0xDE41BE84U, 0x7DD4DA1AU, 0xEBE4DD6DU, 0x51B5D4F4U, 0xC785D383U,
+        0x56986C13U, 0xC0A86B64U, 0x7AF962FDU, 0xECC9658AU, 0x4F5C0114U, 0xD96C0663U,
+        0x633D0FFAU, 0xF50D088DU, 0xC8206E3BU, 0x5E10694CU, 0xE44160D5U, 0x727167A2U,
+        0xD1E4033CU, 0x47D4044BU, 0xFD850DD2U, 0x6BB50AA5U, 0xFAA8B535U, 0x6C98B242U,
+        0xD6C9BBDBU, 0x40F9BCACU, 0xE36CD832U, 0x755CDF45U, 0xCF0DD6DCU, 0x593DD1ABU,
+        0xAC30D926U, 0x3A00DE51U, 0x8051D7C8U, 0x1661D0BFU, 0xB5F4B421U, 0x23C4B356U,
+        0x9995BACFU, 0x0FA5BDB8U, 0x9EB80228U, 0x0888055FU, 0xB2D90CC6U, 0x24E90BB1U,
+        0x877C6F2FU, 0x114C6858U, 0xAB1D61C1U, 0x3D2D66B6U, 0x9041DC76U, 0x0671DB01U,
+        0xBC20D298U, 0x2A10D5EFU, 0x8985B171U, 0x1FB5B606U, 0xA5E4BF9FU, 0x33D4B8E8U,
+        0xA2C90778U, 0x34F9000FU, 0x8EA80996U, 0x18980EE1U, 0xBB0D6A7FU, 0x2D3D6D08U,
+        0x976C6491U, 0x015C63E6U, 0xF4516B6BU, 0x62616C1CU, 0xD8306585U, 0x4E0062F2U,
+        0xED95066CU, 0x7BA5011BU, 0xC1F40882U, 0x57C40FF5U, 0xC6D9B065U, 0x50E9B712U,
+        0xEAB8BE8BU, 0x7C88B9FCU, 0xDF1DDD62U, 0x492DDA15U, 0xF37CD38CU, 0x654CD4FBU,
+        0x5861B24DU, 0xCE51B53AU, 0x7400BCA3U, 0xE230BBD4U, 0x41A5DF4AU, 0xD795D83DU,
+        0x6DC4D1A4U, 0xFBF4D6D3U, 0x6AE96943U, 0xFCD96E34U, 0x468867ADU, 0xD0B860DAU,
+        0x732D0444U, 0xE51D0333U, 0x5F4C0AAAU, 0xC97C0DDDU, 0x3C710550U, 0xAA410227U,
+        0x10100BBEU, 0x86200CC9U, 0x25B56857U, 0xB3856F20U, 0x09D466B9U, 0x9FE461CEU,
+        0x0EF9DE5EU, 0x98C9D929U, 0x2298D0B0U, 0xB4A8D7C7U, 0x173DB359U, 0x810DB42EU,
+        0x3B5CBDB7U, 0xAD6CBAC0U, 0x2083B8EDU, 0xB6B3BF9AU, 0x0CE2B603U, 0x9AD2B174U,
+        0x3947D5EAU, 0xAF77D29DU, 0x1526DB04U, 0x8316DC73U, 0x120B63E3U, 0x843B6494U,
+        0x3E6A6D0DU, 0xA85A6A7AU, 0x0BCF0EE4U, 0x9DFF0993U, 0x27AE000AU, 0xB19E077DU,
+        0x44930FF0U, 0xD2A30887U, 0x68F2011EU, 0xFEC20669U, 0x5D5762F7U, 0xCB676580U,
+        0x71366C19U, 0xE7066B6EU, 0x761BD4FEU, 0xE02BD389U, 0x5A7ADA10U, 0xCC4ADD67U,
+        0x6FDFB9F9U, 0xF9EFBE8EU, 0x43BEB717U, 0xD58EB060U, 0xE8A3D6D6U, 0x7E93D1A1U,
+        0xC4C2D838U, 0x52F2DF4FU, 0xF167BBD1U, 0x6757BCA6U, 0xDD06B53FU, 0x4B36B248U,
+        0xDA2B0DD8U, 0x4C1B0AAFU, 0xF64A0336U, 0x607A0441U, 0xC3EF60DFU, 0x55DF67A8U,
+        0xEF8E6E31U, 0x79BE6946U, 0x8CB361CBU, 0x1A8366BCU, 0xA0D26F25U, 0x36E26852U,
+        0x95770CCCU, 0x03470BBBU, 0xB9160222U, 0x2F260555U, 0xBE3BBAC5U, 0x280BBDB2U,
+        0x925AB42BU, 0x046AB35CU, 0xA7FFD7C2U, 0x31CFD0B5U, 0x8B9ED92CU, 0x1DAEDE5BU,
+        0xB0C2649BU, 0x26F263ECU, 0x9CA36A75U, 0x0A936D02U, 0xA906099CU, 0x3F360EEBU,
+        0x85670772U, 0x13570005U, 0x824ABF95U, 0x147AB8E2U, 0xAE2BB17BU, 0x381BB60CU,
+        0x9B8ED292U, 0x0DBED5E5U, 0xB7EFDC7CU, 0x21DFDB0BU, 0xD4D2D386U, 0x42E2D4F1U,
+        0xF8B3DD68U, 0x6E83DA1FU, 0xCD16BE81U, 0x5B26B9F6U, 0xE177B06FU, 0x7747B718U,
+        0xE65A0888U, 0x706A0FFFU, 0xCA3B0666U, 0x5C0B0111U, 0xFF9E658FU, 0x69AE62F8U,
+        0xD3FF6B61U, 0x45CF6C16U, 0x78E20AA0U, 0xEED20DD7U, 0x5483044EU, 0xC2B30339U,
+        0x612667A7U, 0xF71660D0U, 0x4D476949U, 0xDB776E3EU, 0x4A6AD1AEU, 0xDC5AD6D9U,
+        0x660BDF40U, 0xF03BD837U, 0x53AEBCA9U, 0xC59EBBDEU, 0x7FCFB247U, 0xE9FFB530U,
+        0x1CF2BDBDU, 0x8AC2BACAU, 0x3093B353U, 0xA6A3B424U, 0x0536D0BAU, 0x9306D7CDU,
+        0x2957DE54U, 0xBF67D923U, 0x2E7A66B3U, 0xB84A61C4U, 0x021B685DU, 0x942B6F2AU,
+        0x37BE0BB4U, 0xA18E0CC3U, 0x1BDF055AU, 0x8DEF022DU
+    },
+    {
+        0x00000000U, 0x41311B19U, 0x82623632U, 0xC3532D2BU, 0x04C56C64U, 0x45F4777DU,
+        0x86A75A56U, 0xC796414FU, 0x088AD9C8U, 0x49BBC2D1U, 0x8AE8EFFAU, 0xCBD9F4E3U,
+        0x0C4FB5ACU, 0x4D7EAEB5U, 0x8E2D839EU, 0xCF1C9887U, 0x5112C24AU, 0x1023D953U,
+        0xD370F478U, 0x9241EF61U, 0x55D7AE2EU, 0x14E6B537U, 0xD7B5981CU, 0x96848305U,
+        0x59981B82U, 0x18A9009BU, 0xDBFA2DB0U, 0x9ACB36A9U, 0x5D5D77E6U, 0x1C6C6CFFU,
+        0xDF3F41D4U, 0x9E0E5ACDU, 0xA2248495U, 0xE3159F8CU, 0x2046B2A7U, 0x6177A9BEU,
+        0xA6E1E8F1U, 0xE7D0F3E8U, 0x2483DEC3U, 0x65B2C5DAU, 0xAAAE5D5DU, 0xEB9F4644U,
+        0x28CC6B6FU, 0x69FD7076U, 0xAE6B3139U, 0xEF5A2A20U, 0x2C09070BU, 0x6D381C12U,
+        0xF33646DFU, 0xB2075DC6U, 0x715470EDU, 0x30656BF4U, 0xF7F32ABBU, 0xB6C231A2U,
+        0x75911C89U, 0x34A00790U, 0xFBBC9F17U, 0xBA8D840EU, 0x79DEA925U, 0x38EFB23CU,
+        0xFF79F373U, 0xBE48E86AU, 0x7D1BC541U, 0x3C2ADE58U, 0x054F79F0U, 0x447E62E9U,
+        0x872D4FC2U, 0xC61C54DBU, 0x018A1594U, 0x40BB0E8DU, 0x83E823A6U, 0xC2D938BFU,
+        0x0DC5A038U, 0x4CF4BB21U, 0x8FA7960AU, 0xCE968D13U, 0x0900CC5CU, 0x4831D745U,
+        0x8B62FA6EU, 0xCA53E177U, 0x545DBBBAU, 0x156CA0A3U, 0xD63F8D88U, 0x970E9691U,
+        0x5098D7DEU, 0x11A9CCC7U, 0xD2FAE1ECU, 0x93CBFAF5U, 0x5CD76272U, 0x1DE6796BU,
+        0xDEB55440U, 0x9F844F59U, 0x58120E16U, 0x1923150FU, 0xDA703824U, 0x9B41233DU,
+        0xA76BFD65U, 0xE65AE67CU, 0x2509CB57U, 0x6438D04EU, 0xA3AE9101U, 0xE29F8A18U,
+        0x21CCA733U, 0x60FDBC2AU, 0xAFE124ADU, 0xEED03FB4U, 0x2D83129FU, 0x6CB20986U,
+        0xAB2448C9U, 0xEA1553D0U, 0x29467EFBU, 0x687765E2U, 0xF6793F2FU, 0xB7482436U,
+        0x741B091DU, 0x352A1204U, 0xF2BC534BU, 0xB38D4852U, 0x70DE6579U, 0x31EF7E60U,
+        0xFEF3E6E7U, 0xBFC2FDFEU, 0x7C91D0D5U, 0x3DA0CBCCU, 0xFA368A83U, 0xBB07919AU,
+        0x7854BCB1U, 0x3965A7A8U, 0x4B98833BU, 0x0AA99822U, 0xC9FAB509U, 0x88CBAE10U,
+        0x4F5DEF5FU, 0x0E6CF446U, 0xCD3FD96DU, 0x8C0EC274U, 0x43125AF3U, 0x022341EAU,
+        0xC1706CC1U, 0x804177D8U, 0x47D73697U, 0x06E62D8EU, 0xC5B500A5U, 0x84841BBCU,
+        0x1A8A4171U, 0x5BBB5A68U, 0x98E87743U, 0xD9D96C5AU, 0x1E4F2D15U, 0x5F7E360CU,
+        0x9C2D1B27U, 0xDD1C003EU, 0x120098B9U, 0x533183A0U, 0x9062AE8BU, 0xD153B592U,
+        0x16C5F4DDU, 0x57F4EFC4U, 0x94A7C2EFU, 0xD596D9F6U, 0xE9BC07AEU, 0xA88D1CB7U,
+        0x6BDE319CU, 0x2AEF2A85U, 0xED796BCAU, 0xAC4870D3U, 0x6F1B5DF8U, 0x2E2A46E1U,
+        0xE136DE66U, 0xA007C57FU, 0x6354E854U, 0x2265F34DU, 0xE5F3B202U, 0xA4C2A91BU,
+        0x67918430U, 0x26A09F29U, 0xB8AEC5E4U, 0xF99FDEFDU, 0x3ACCF3D6U, 0x7BFDE8CFU,
+        0xBC6BA980U, 0xFD5AB299U, 0x3E099FB2U, 0x7F3884ABU, 0xB0241C2CU, 0xF1150735U,
+        0x32462A1EU, 0x73773107U, 0xB4E17048U, 0xF5D06B51U, 0x3683467AU, 0x77B25D63U,
+        0x4ED7FACBU, 0x0FE6E1D2U, 0xCCB5CCF9U, 0x8D84D7E0U, 0x4A1296AFU, 0x0B238DB6U,
+        0xC870A09DU, 0x8941BB84U, 0x465D2303U, 0x076C381AU, 0xC43F1531U, 0x850E0E28U,
+        0x42984F67U, 0x03A9547EU, 0xC0FA7955U, 0x81CB624CU, 0x1FC53881U, 0x5EF42398U,
+        0x9DA70EB3U, 0xDC9615AAU, 0x1B0054E5U, 0x5A314FFCU, 0x996262D7U, 0xD85379CEU,
+        0x174FE149U, 0x567EFA50U, 0x952DD77BU, 0xD41CCC62U, 0x138A8D2DU, 0x52BB9634U,
+        0x91E8BB1FU, 0xD0D9A006U, 0xECF37E5EU, 0xADC26547U, 0x6E91486CU, 0x2FA05375U,
+        0xE836123AU, 0xA9070923U, 0x6A542408U, 0x2B653F11U, 0xE479A796U, 0xA548BC8FU,
+        0x661B91A4U, 0x272A8ABDU, 0xE0BCCBF2U, 0xA18DD0EBU, 0x62DEFDC0U, 0x23EFE6D9U,
+        0xBDE1BC14U, 0xFCD0A70DU, 0x3F838A26U, 0x7EB2913FU, 0xB924D070U, 0xF815CB69U,
+        0x3B46E642U, 0x7A77FD5BU, 0xB56B65DCU, 0xF45A7EC5U, 0x370953EEU, 0x763848F7U,
+        0xB1AE09B8U, 0xF09F12A1U, 0x33CC3F8AU, 0x72FD2493U
+    },
+    {
+        0x00000000U, 0x376AC201U, 0x6ED48403U, 0x59BE4602U, 0xDCA80907U, 0xEBC2CB06U,
+        0xB27C8D04U, 0x85164F05U, 0xB851130EU, 0x8F3BD10FU, 0xD685970DU, 0xE1EF550CU,
+        0x64F91A09U, 0x5393D808U, 0x0A2D9E0AU, 0x3D475C0BU, 0x70A3261CU, 0x47C9E41DU,
+        0x1E77A21FU, 0x291D601EU, 0xAC0B2F1BU, 0x9B61ED1AU, 0xC2DFAB18U, 0xF5B56919U,
+        0xC8F23512U, 0xFF98F713U, 0xA626B111U, 0x914C7310U, 0x145A3C15U, 0x2330FE14U,
+        0x7A8EB816U, 0x4DE47A17U, 0xE0464D38U, 0xD72C8F39U, 0x8E92C93BU, 0xB9F80B3AU,
+        0x3CEE443FU, 0x0B84863EU, 0x523AC03CU, 0x6550023DU, 0x58175E36U, 0x6F7D9C37U,
+        0x36C3DA35U, 0x01A91834U, 0x84BF5731U, 0xB3D59530U, 0xEA6BD332U, 0xDD011133U,
+        0x90E56B24U, 0xA78FA925U, 0xFE31EF27U, 0xC95B2D26U, 0x4C4D6223U, 0x7B27A022U,
+        0x2299E620U, 0x15F32421U, 0x28B4782AU, 0x1FDEBA2BU, 0x4660FC29U, 0x710A3E28U,
+        0xF41C712DU, 0xC376B32CU, 0x9AC8F52EU, 0xADA2372FU, 0xC08D9A70U, 0xF7E75871U,
+        0xAE591E73U, 0x9933DC72U, 0x1C259377U, 0x2B4F5176U, 0x72F11774U, 0x459BD575U,
+        0x78DC897EU, 0x4FB64B7FU, 0x16080D7DU, 0x2162CF7CU, 0xA4748079U, 0x931E4278U,
+        0xCAA0047AU, 0xFDCAC67BU, 0xB02EBC6CU, 0x87447E6DU, 0xDEFA386FU, 0xE990FA6EU,
+        0x6C86B56BU, 0x5BEC776AU, 0x02523168U, 0x3538F369U, 0x087FAF62U, 0x3F156D63U,
+        0x66AB2B61U, 0x51C1E960U, 0xD4D7A665U, 0xE3BD6464U, 0xBA032266U, 0x8D69E067U,
+        0x20CBD748U, 0x17A11549U, 0x4E1F534BU, 0x7975914AU, 0xFC63DE4FU, 0xCB091C4EU,
+        0x92B75A4CU, 0xA5DD984DU, 0x989AC446U, 0xAFF00647U, 0xF64E4045U, 0xC1248244U,
+        0x4432CD41U, 0x73580F40U, 0x2AE64942U, 0x1D8C8B43U, 0x5068F154U, 0x67023355U,
+        0x3EBC7557U, 0x09D6B756U, 0x8CC0F853U, 0xBBAA3A52U, 0xE2147C50U, 0xD57EBE51U,
+        0xE839E25AU, 0xDF53205BU, 0x86ED6659U, 0xB187A458U, 0x3491EB5DU, 0x03FB295CU,
+        0x5A456F5EU, 0x6D2FAD5FU, 0x801B35E1U, 0xB771F7E0U, 0xEECFB1E2U, 0xD9A573E3U,
+        0x5CB33CE6U, 0x6BD9FEE7U, 0x3267B8E5U, 0x050D7AE4U, 0x384A26EFU, 0x0F20E4EEU,
+        0x569EA2ECU, 0x61F460EDU, 0xE4E22FE8U, 0xD388EDE9U, 0x8A36ABEBU, 0xBD5C69EAU,
+        0xF0B813FDU, 0xC7D2D1FCU, 0x9E6C97FEU, 0xA90655FFU, 0x2C101AFAU, 0x1B7AD8FBU,
+        0x42C49EF9U, 0x75AE5CF8U, 0x48E900F3U, 0x7F83C2F2U, 0x263D84F0U, 0x115746F1U,
+        0x944109F4U, 0xA32BCBF5U, 0xFA958DF7U, 0xCDFF4FF6U, 0x605D78D9U, 0x5737BAD8U,
+        0x0E89FCDAU, 0x39E33EDBU, 0xBCF571DEU, 0x8B9FB3DFU, 0xD221F5DDU, 0xE54B37DCU,
+        0xD80C6BD7U, 0xEF66A9D6U, 0xB6D8EFD4U, 0x81B22DD5U, 0x04A462D0U, 0x33CEA0D1U,
+        0x6A70E6D3U, 0x5D1A24D2U, 0x10FE5EC5U, 0x27949CC4U, 0x7E2ADAC6U, 0x494018C7U,
+        0xCC5657C2U, 0xFB3C95C3U, 0xA282D3C1U, 0x95E811C0U, 0xA8AF4DCBU, 0x9FC58FCAU,
+        0xC67BC9C8U, 0xF1110BC9U, 0x740744CCU, 0x436D86CDU, 0x1AD3C0CFU, 0x2DB902CEU,
+        0x4096AF91U, 0x77FC6D90U, 0x2E422B92U, 0x1928E993U, 0x9C3EA696U, 0xAB546497U,
+        0xF2EA2295U, 0xC580E094U, 0xF8C7BC9FU, 0xCFAD7E9EU, 0x9613389CU, 0xA179FA9DU,
+        0x246FB598U, 0x13057799U, 0x4ABB319BU, 0x7DD1F39AU, 0x3035898DU, 0x075F4B8CU,
+        0x5EE10D8EU, 0x698BCF8FU, 0xEC9D808AU, 0xDBF7428BU, 0x82490489U, 0xB523C688U,
+        0x88649A83U, 0xBF0E5882U, 0xE6B01E80U, 0xD1DADC81U, 0x54CC9384U, 0x63A65185U,
+        0x3A181787U, 0x0D72D586U, 0xA0D0E2A9U, 0x97BA20A8U, 0xCE0466AAU, 0xF96EA4ABU,
+        0x7C78EBAEU, 0x4B1229AFU, 0x12AC6FADU, 0x25C6ADACU, 0x1881F1A7U, 0x2FEB33A6U,
+        0x765575A4U, 0x413FB7A5U, 0xC429F8A0U, 0xF3433AA1U, 0xAAFD7CA3U, 0x9D97BEA2U,
+        0xD073C4B5U, 0xE71906B4U, 0xBEA740B6U, 0x89CD82B7U, 0x0CDBCDB2U, 0x3BB10FB3U,
+        0x620F49B1U, 0x55658BB0U, 0x6822D7BBU, 0x5F4815BAU, 0x06F653B8U, 0x319C91B9U,
+        0xB48ADEBCU, 0x83E01CBDU, 0xDA5E5ABFU, 0xED3498BEU
+    },
+    {
+        0x00000000U, 0x6567BCB8U, 0x8BC809AAU, 0xEEAFB512U, 0x5797628FU, 0x32F0DE37U,
+        0xDC5F6B25U, 0xB938D79DU, 0xEF28B4C5U, 0x8A4F087DU, 0x64E0BD6FU, 0x018701D7U,
+        0xB8BFD64AU, 0xDDD86AF2U, 0x3377DFE0U, 0x56106358U, 0x9F571950U, 0xFA30A5E8U,
+        0x149F10FAU, 0x71F8AC42U, 0xC8C07BDFU, 0xADA7C767U, 0x43087275U, 0x266FCECDU,
+        0x707FAD95U, 0x1518112DU, 0xFBB7A43FU, 0x9ED01887U, 0x27E8CF1AU, 0x428F73A2U,
+        0xAC20C6B0U, 0xC9477A08U, 0x3EAF32A0U, 0x5BC88E18U, 0xB5673B0AU, 0xD00087B2U,
+        0x6938502FU, 0x0C5FEC97U, 0xE2F05985U, 0x8797E53DU, 0xD1878665U, 0xB4E03ADDU,
+        0x5A4F8FCFU, 0x3F283377U, 0x8610E4EAU, 0xE3775852U, 0x0DD8ED40U, 0x68BF51F8U,
+        0xA1F82BF0U, 0xC49F9748U, 0x2A30225AU, 0x4F579EE2U, 0xF66F497FU, 0x9308F5C7U,
+        0x7DA740D5U, 0x18C0FC6DU, 0x4ED09F35U, 0x2BB7238DU, 0xC518969FU, 0xA07F2A27U,
+        0x1947FDBAU, 0x7C204102U, 0x928FF410U, 0xF7E848A8U, 0x3D58149BU, 0x583FA823U,
+        0xB6901D31U, 0xD3F7A189U, 0x6ACF7614U, 0x0FA8CAACU, 0xE1077FBEU, 0x8460C306U,
+        0xD270A05EU, 0xB7171CE6U, 0x59B8A9F4U, 0x3CDF154CU, 0x85E7C2D1U, 0xE0807E69U,
+        0x0E2FCB7BU, 0x6B4877C3U, 0xA20F0DCBU, 0xC768B173U, 0x29C70461U, 0x4CA0B8D9U,
+        0xF5986F44U, 0x90FFD3FCU, 0x7E5066EEU, 0x1B37DA56U, 0x4D27B90EU, 0x284005B6U,
+        0xC6EFB0A4U, 0xA3880C1CU, 0x1AB0DB81U, 0x7FD76739U, 0x9178D22BU, 0xF41F6E93U,
+        0x03F7263BU, 0x66909A83U, 0x883F2F91U, 0xED589329U, 0x546044B4U, 0x3107F80CU,
+        0xDFA84D1EU, 0xBACFF1A6U, 0xECDF92FEU, 0x89B82E46U, 0x67179B54U, 0x027027ECU,
+        0xBB48F071U, 0xDE2F4CC9U, 0x3080F9DBU, 0x55E74563U, 0x9CA03F6BU, 0xF9C783D3U,
+        0x176836C1U, 0x720F8A79U, 0xCB375DE4U, 0xAE50E15CU, 0x40FF544EU, 0x2598E8F6U,
+        0x73888BAEU, 0x16EF3716U, 0xF8408204U, 0x9D273EBCU, 0x241FE921U, 0x41785599U,
+        0xAFD7E08BU, 0xCAB05C33U, 0x3BB659EDU, 0x5ED1E555U, 0xB07E5047U, 0xD519ECFFU,
+        0x6C213B62U, 0x094687DAU, 0xE7E932C8U, 0x828E8E70U, 0xD49EED28U, 0xB1F95190U,
+        0x5F56E482U, 0x3A31583AU, 0x83098FA7U, 0xE66E331FU, 0x08C1860DU, 0x6DA63AB5U,
+        0xA4E140BDU, 0xC186FC05U, 0x2F294917U, 0x4A4EF5AFU, 0xF3762232U, 0x96119E8AU,
+        0x78BE2B98U, 0x1DD99720U, 0x4BC9F478U, 0x2EAE48C0U, 0xC001FDD2U, 0xA566416AU,
+        0x1C5E96F7U, 0x79392A4FU, 0x97969F5DU, 0xF2F123E5U, 0x05196B4DU, 0x607ED7F5U,
+        0x8ED162E7U, 0xEBB6DE5FU, 0x528E09C2U, 0x37E9B57AU, 0xD9460068U, 0xBC21BCD0U,
+        0xEA31DF88U, 0x8F566330U, 0x61F9D622U, 0x049E6A9AU, 0xBDA6BD07U, 0xD8C101BFU,
+        0x366EB4ADU, 0x53090815U, 0x9A4E721DU, 0xFF29CEA5U, 0x11867BB7U, 0x74E1C70FU,
+        0xCDD91092U, 0xA8BEAC2AU, 0x46111938U, 0x2376A580U, 0x7566C6D8U, 0x10017A60U,
+        0xFEAECF72U, 0x9BC973CAU, 0x22F1A457U, 0x479618EFU, 0xA939ADFDU, 0xCC5E1145U,
+        0x06EE4D76U, 0x6389F1CEU, 0x8D2644DCU, 0xE841F864U, 0x51792FF9U, 0x341E9341U,
+        0xDAB12653U, 0xBFD69AEBU, 0xE9C6F9B3U, 0x8CA1450BU, 0x620EF019U, 0x07694CA1U,
+        0xBE519B3CU, 0xDB362784U, 0x35999296U, 0x50FE2E2EU, 0x99B95426U, 0xFCDEE89EU,
+        0x12715D8CU, 0x7716E134U, 0xCE2E36A9U, 0xAB498A11U, 0x45E63F03U, 0x208183BBU,
+        0x7691E0E3U, 0x13F65C5BU, 0xFD59E949U, 0x983E55F1U, 0x2106826CU, 0x44613ED4U,
+        0xAACE8BC6U, 0xCFA9377EU, 0x38417FD6U, 0x5D26C36EU, 0xB389767CU, 0xD6EECAC4U,
+        0x6FD61D59U, 0x0AB1A1E1U, 0xE41E14F3U, 0x8179A84BU, 0xD769CB13U, 0xB20E77ABU,
+        0x5CA1C2B9U, 0x39C67E01U, 0x80FEA99CU, 0xE5991524U, 0x0B36A036U, 0x6E511C8EU,
+        0xA7166686U, 0xC271DA3EU, 0x2CDE6F2CU, 0x49B9D394U, 0xF0810409U, 0x95E6B8B1U,
+        0x7B490DA3U, 0x1E2EB11BU, 0x483ED243U, 0x2D596EFBU, 0xC3F6DBE9U, 0xA6916751U,
+        0x1FA9B0CCU, 0x7ACE0C74U, 0x9461B966U, 0xF10605DEU
+    }
+};
+#endif
@@ -0,0 +1,284 @@
+/**
+ ******************************************************************************
+ * @file    lin_mbuf_rx.c
+ * @brief   SCI1 (LIN1) Multi-Buffer Reception Backend
+ *
+ * @details
+ *   - linMbufRxInit() switches the module into multi-buffer SCI mode and
+ *     programs the frame length (1..8 bytes per RX interrupt).
+ *   - linMbufRxHandler() is called from lin1HighLevelInterrupt() (see the
+ *     USER CODE block in HL_sci.c) and reads a whole frame with two word
+ *     reads of RD1/RD0.
+ *   - linMbufRxTick() is called from the 1ms RTI notification and flushes a
+ *     partial frame once the line has been idle for LIN_MBUF_FLUSH_MS (if
+ *     not 0), so a command line ending in a partial frame is answered
+ *     without waiting for the window end.
+ *
+ * @note
+ *   - Byte n of a frame is held in bits 31-8n..24-8n of RD0/RD1, so the
+ *     word reads below give the same byte order on BE32 and LE builds.
+ ******************************************************************************
+ */
+#include "lin_mbuf_rx.h"
+
+/* GCR1 bits */
+#define LIN_GCR1_SWNRST         0x00000080U
+#define LIN_GCR1_MBUF_MODE      0x00000400U
+/* FORMAT LENGTH field (frame length - 1) */
+#define LIN_FORMAT_LENGTH_MASK  0x00070000U
+#define LIN_FORMAT_LENGTH_SHIFT 16U
+/* FLR bits not covered by HL_lin.h */
+#define LIN_FLR_TX_EMPTY        0x00000800U
+/* IODFTCTRL values, same encoding as sciEnableLoopback()/sciDisableLoopback() */
+#define LIN_IODFT_DIGITAL_LPBK  0x00000A00U
+#define LIN_IODFT_DISABLE       0x00000500U
+
+/* Pad bytes used by the flush, byte n of the pad frame is LIN_MBUF_PAD_BASE + n */
+#define LIN_MBUF_PAD_BASE       0xF8U
+#define LIN_MBUF_PAD_TD0        0xF8F9FAFBU
+#define LIN_MBUF_PAD_TD1        0xFCFDFEFFU
+
+#define LIN_RD0(lin)            (*(volatile uint32_t *)&(lin)->RDx[0U])
+#define LIN_RD1(lin)            (*(volatile uint32_t *)&(lin)->RDx[4U])
+#define LIN_TD0(lin)            (*(volatile uint32_t *)&(lin)->TDx[0U])
+#define LIN_TD1(lin)            (*(volatile uint32_t *)&(lin)->TDx[4U])
+
+static linBASE_t *s_lin = NULL;
+static linMbufRxCallback_t s_callback = NULL;
+static uint32_t s_frameLength = LIN_MBUF_MAX_LEN;
+static volatile uint32_t s_active = 0U;
+/* Set when a frame completed since the last flush */
+static volatile uint32_t s_frameSeen = 0U;
+static volatile uint32_t s_idleMs = 0U;
+
+static void linMbufRxReadFrame(uint8_t *frame);
+static void linMbufRxRestart(uint32_t mbufMode);
+
+/* The RX interrupt path runs from RAM when .ramfunc is linked there
+   (ramfunc.h) */
+#pragma CODE_SECTION(linMbufRxIsActive, ".ramCode")
+#pragma CODE_SECTION(linMbufRxHandler, ".ramCode")
+#pragma CODE_SECTION(linMbufRxReadFrame, ".ramCode")
+
+/**
+ * @brief  Switches the LIN module into multi-buffer SCI reception.
+ * @param  lin          LIN/SCI module (linREG1 for SCI1).
+ * @param  frameLength  Bytes per RX interrupt, 1..LIN_MBUF_MAX_LEN.
+ * @param  callback     Called with every block of received bytes.
+ * @note   sciInit() must have run and SCI_RX_INT must be enabled.
+ */
+void linMbufRxInit(linBASE_t *lin, uint32_t frameLength, linMbufRxCallback_t callback)
+{
+    s_lin = lin;
+    s_callback = callback;
+    s_frameSeen = 0U;
+    s_idleMs = 0U;
+
+    linMbufRxSetFrameLength(frameLength);
+}
+
+/**
+ * @brief  Programs the number of bytes per RX interrupt.
+ * @param  frameLength  Bytes per frame, clamped to 1..LIN_MBUF_MAX_LEN.
+ * @note   The module passes through software reset, so call this only
+ *         while the line is idle.
+ */
+void linMbufRxSetFrameLength(uint32_t frameLength)
+{
+    if (frameLength == 0U)
+    {
+        frameLength = 1U;
+    }
+    else if (frameLength > LIN_MBUF_MAX_LEN)
+    {
+        frameLength = LIN_MBUF_MAX_LEN;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    s_frameLength = frameLength;
+
+    s_lin->GCR1 &= ~LIN_GCR1_SWNRST;
+    s_lin->FORMAT = (s_lin->FORMAT & ~LIN_FORMAT_LENGTH_MASK)
+                  | ((frameLength - 1U) << LIN_FORMAT_LENGTH_SHIFT);
+    linMbufRxRestart(1U);
+}
+
+/**
+ * @brief  Returns non-zero while multi-buffer reception owns the RX interrupt.
+ */
+uint32_t linMbufRxIsActive(void)
+{
+    return s_active;
+}
+
+/**
+ * @brief  RX interrupt handler for a completed frame.
+ *         Called from lin1HighLevelInterrupt() instead of the byte handler.
+ */
+void linMbufRxHandler(void)
+{
+    uint8_t frame[LIN_MBUF_MAX_LEN];
+
+    linMbufRxReadFrame(frame);
+
+    s_frameSeen = 1U;
+    s_idleMs = 0U;
+
+    s_callback(frame, s_frameLength);
+}
+
+/**
+ * @brief  1ms housekeeping, called from rtiNotification().
+ *         Flushes the partial frame once the line has gone idle after a
+ *         completed frame.
+ */
+void linMbufRxTick(void)
+{
+    if ((LIN_MBUF_FLUSH_MS != 0U) && (s_active != 0U) && (s_frameSeen != 0U))
+    {
+        s_idleMs++;
+        if (s_idleMs >= LIN_MBUF_FLUSH_MS)
+        {
+            linMbufRxFlush();
+        }
+    }
+}
+
+/**
+ * @brief  Delivers the bytes of a partially filled frame.
+ *
+ *         The receiver is put into digital loopback and one frame of
+ *         distinct pad bytes is sent. The partial frame completes part-way
+ *         through the pads and is read straight away; the pads that follow
+ *         start the next frame, so RD0 then holds pad number
+ *         (frameLength - pending), which gives the exact count of real
+ *         bytes. The leftover pads are dropped with a software reset.
+ *
+ * @note   Must run with IRQs masked (e.g. from rtiNotification()) and only
+ *         when the host is idle: the RX pin is ignored while the loopback
+ *         is active (one frame time, about 0.1 ms at 937500 baud).
+ */
+void linMbufRxFlush(void)
+{
+    uint8_t frame[LIN_MBUF_MAX_LEN];
+    uint32_t completed = 0U;
+    uint32_t pending = 0U;
+    uint32_t firstByte;
+
+    if (s_active == 0U)
+    {
+        return;
+    }
+
+    s_frameSeen = 0U;
+    s_idleMs = 0U;
+
+    s_lin->IODFTCTRL = LIN_IODFT_DIGITAL_LPBK;
+
+    /* Writing TD0 starts transmission of the whole pad frame */
+    LIN_TD1(s_lin) = LIN_MBUF_PAD_TD1;
+    LIN_TD0(s_lin) = LIN_MBUF_PAD_TD0;
+
+    /* The partial frame must be read before the next pad lands in RD0 */
+    while ((s_lin->FLR & LIN_FLR_TX_EMPTY) == 0U)
+    {
+        if ((completed == 0U) && ((s_lin->FLR & LIN_RX_INT) != 0U))
+        {
+            linMbufRxReadFrame(frame);
+            completed = 1U;
+        }
+    }
+    /* Receiver samples the last stop bit before TX empty is raised */
+    if ((completed == 0U) && ((s_lin->FLR & LIN_RX_INT) != 0U))
+    {
+        linMbufRxReadFrame(frame);
+        completed = 1U;
+    }
+
+    if (completed != 0U)
+    {
+        firstByte = (LIN_RD0(s_lin) >> 24U) & 0xFFU;
+        if (firstByte != LIN_MBUF_PAD_BASE)
+        {
+            pending = s_frameLength - (firstByte - LIN_MBUF_PAD_BASE);
+        }
+    }
+
+    s_lin->IODFTCTRL = LIN_IODFT_DISABLE;
+
+    /* Drop the pads left in the buffers */
+    s_lin->GCR1 &= ~LIN_GCR1_SWNRST;
+    linMbufRxRestart(1U);
+
+    if ((pending > 0U) && (pending < s_frameLength))
+    {
+        s_callback(frame, pending);
+    }
+}
+
+/**
+ * @brief  Leaves multi-buffer mode so single bytes can be sent through
+ *         sciSendByte(). Flush first, the software reset discards any
+ *         partial frame.
+ */
+void linMbufRxSuspend(void)
+{
+    s_lin->GCR1 &= ~LIN_GCR1_SWNRST;
+    linMbufRxRestart(0U);
+}
+
+/**
+ * @brief  Re-enters multi-buffer mode after linMbufRxSuspend().
+ */
+void linMbufRxResume(void)
+{
+    s_lin->GCR1 &= ~LIN_GCR1_SWNRST;
+    linMbufRxRestart(1U);
+}
+
+/**
+ * @brief  Reads a completed frame. RD0 is read last since it clears RXRDY.
+ * @param  frame  Destination, LIN_MBUF_MAX_LEN bytes.
+ */
+static void linMbufRxReadFrame(uint8_t *frame)
+{
+    uint32_t rd1 = LIN_RD1(s_lin);
+    uint32_t rd0 = LIN_RD0(s_lin);
+
+    frame[0U] = (uint8_t)(rd0 >> 24U);
+    frame[1U] = (uint8_t)(rd0 >> 16U);
+    frame[2U] = (uint8_t)(rd0 >> 8U);
+    frame[3U] = (uint8_t)rd0;
+    frame[4U] = (uint8_t)(rd1 >> 24U);
+    frame[5U] = (uint8_t)(rd1 >> 16U);
+    frame[6U] = (uint8_t)(rd1 >> 8U);
+    frame[7U] = (uint8_t)rd1;
+
+    s_lin->FLR = LIN_RX_INT;
+}
+
+/**
+ * @brief  Releases the module from software reset (caller cleared SWnRST),
+ *         selecting multi-buffer or single-buffer operation.
+ * @param  mbufMode  Non-zero for multi-buffer mode.
+ */
+static void linMbufRxRestart(uint32_t mbufMode)
+{
+    if (mbufMode != 0U)
+    {
+        s_lin->GCR1 |= LIN_GCR1_MBUF_MODE;
+    }
+    else
+    {
+        s_lin->GCR1 &= ~LIN_GCR1_MBUF_MODE;
+    }
+
+    /* Clear stale error flags left by the reset */
+    s_lin->FLR = LIN_OE_INT | LIN_FE_INT | LIN_PE_INT | LIN_RX_INT;
+    s_lin->GCR1 |= LIN_GCR1_SWNRST;
+
+    s_active = mbufMode;
+}
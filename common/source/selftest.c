@@ -0,0 +1,386 @@
+/**
+ ******************************************************************************
+ * @file    selftest.c
+ * @brief   SCI Loopback Self-Benchmark
+ *
+ * @details
+ *   - Runs the reception backend the project is built with (core_rx.h,
+ *     CORE_RX_BACKEND of core_cfg.h) on its port (CORE_RX_SCI) through
+ *     coreRxInit()/coreRxPoll(), so the code qualified is the code that
+ *     ships: the polling project (uart-crc32), the interrupt project
+ *     (uart-crc32-interrupt) and the DMA ring (uart-crc32-dma) each sweep
+ *     their own backend. The CPU sends the pattern and polls the backend
+ *     in one loop, as a main loop does; coreRxStop() ends each run.
+ *   - Every run sends the same SELFTEST_LEN byte pattern, including 0x00,
+ *     and times out after twice the nominal line time.
+ *   - The rx share is the time in the backend: coreRxPoll() calls, and
+ *     for the interrupt and LIN backends the callback run from the RX
+ *     interrupt (the driver's entry and exit are not seen).
+ *   - Cycle counts come from the PMU cycle counter.
+ *   - Projects without a command interpreter start the sweep with a
+ *     window that holds nothing but the line "ESC selftest":
+ *     selftestScan() sees every received byte, selftestRequested() at the
+ *     window end tells whether it was that line.
+ *
+ * @note
+ *   - IRQs and the backend's VIM channel must be enabled for the
+ *     interrupt and LIN backends.
+ *   - The DMA backends use the channel of the RX ring, so the project
+ *     stops its own reception with coreRxStop() first and sets it up
+ *     again afterwards.
+ *   - The report goes out on the same port at the configured baud rate
+ *     between runs, with loopback off.
+ *   - The callback of coreRxInit() is the self-test's own after a sweep;
+ *     the project starts its reception again.
+ ******************************************************************************
+ */
+#include "selftest.h"
+#include "core_rx.h"
+#include "crc32_kernel.h"
+#include "HL_system.h"
+#include "HL_sys_pmu.h"
+#include <string.h>
+#include <stdio.h>
+
+/* Port the backend receives on */
+#define SELFTEST_SCI            CORE_RX_SCI
+#define SELFTEST_ERR_FLAGS      (SCI_FE_INT | SCI_OE_INT | SCI_PE_INT)
+#define SELFTEST_FLR_TX_EMPTY   0x00000800U
+
+#define SELFTEST_GCLK_HZ        ((uint32_t)(GCLK_FREQ * 1000000.0F))
+#define SELFTEST_VCLK_HZ        ((uint32_t)(VCLK1_FREQ * 1000000.0F))
+
+/* States of the in-band request of a window */
+#define SELFTEST_CMD_MATCHING   0U
+#define SELFTEST_CMD_COMPLETE   1U
+#define SELFTEST_CMD_DATA       2U
+
+/* The callback runs from the RX interrupt, not from coreRxPoll() */
+#if ((CORE_RX_BACKEND == CORE_RX_INTERRUPT) || (CORE_RX_BACKEND == CORE_RX_LIN_MBUF))
+#define SELFTEST_RX_IN_ISR      1U
+#else
+#define SELFTEST_RX_IN_ISR      0U
+#endif
+
+static const uint32_t s_baudTable[SELFTEST_BAUD_COUNT] =
+{
+    117188U, 234375U, 468750U, 937500U, 1171875U, 2343750U, 4687500U
+};
+
+#pragma DATA_ALIGN(s_pattern, 32)
+static uint8_t s_pattern[SELFTEST_LEN];
+#pragma DATA_ALIGN(s_rxBuf, 32)
+static uint8_t s_rxBuf[SELFTEST_LEN];
+static uint32_t s_expectedCrc;
+static volatile uint32_t s_rxCount;
+static volatile uint32_t s_rxCycles;
+
+/* In-band request, SELFTEST_COMMAND then CR and/or LF */
+static const char s_command[] = SELFTEST_COMMAND;
+static volatile uint32_t s_cmdPos = 0U;
+static volatile uint32_t s_cmdState = SELFTEST_CMD_MATCHING;
+
+static void selftestStore(const uint8_t *data, uint32_t len);
+static void selftestPrepare(void);
+static uint32_t selftestLineBaud(void);
+static uint32_t selftestTimeout(void);
+static void selftestPump(uint32_t start, uint32_t timeout);
+static void selftestPrint(const char *text);
+static void selftestWaitTxEmpty(void);
+
+/* Runs in the RX interrupt of the interrupt backend (ramfunc.h) */
+#pragma CODE_SECTION(selftestScan, ".ramCode")
+
+/**
+ * @brief  Name of the backend under test, as in the report.
+ */
+const char *selftestBackendName(void)
+{
+#if (CORE_RX_BACKEND == CORE_RX_POLLING)
+    return "poll";
+#elif (CORE_RX_BACKEND == CORE_RX_INTERRUPT)
+    return "irq";
+#elif (CORE_RX_BACKEND == CORE_RX_LIN_MBUF)
+    return "lin-mbuf";
+#elif (CORE_RX_BACKEND == CORE_RX_DMA_SINGLE)
+    return "dma-single";
+#elif (CORE_RX_BACKEND == CORE_RX_DMA_RING)
+    return "dma-ring";
+#else
+    return "dma-pool";
+#endif
+}
+
+/**
+ * @brief  Sends the pattern through the loopback into the backend.
+ * @param  baud     Requested baud rate.
+ * @param  result   Filled with the outcome of the run.
+ * @note   Leaves SCI3 in loopback at the tested rate; selftestSweep()
+ *         restores the line afterwards.
+ */
+void selftestRun(uint32_t baud, selftestResult_t *result)
+{
+    uint32_t start, timeout, i;
+
+    memset(result, 0, sizeof(*result));
+    memset(s_rxBuf, 0, sizeof(s_rxBuf));
+    s_rxCount = 0U;
+    s_rxCycles = 0U;
+
+    /* Report text still on the line would loop back into the run */
+    selftestWaitTxEmpty();
+    sciSetBaudrate(SELFTEST_SCI, baud);
+    sciEnableLoopback(SELFTEST_SCI, Digital_Lbk);
+
+    /* Drop anything left from the previous run */
+    while (sciIsRxReady(SELFTEST_SCI) != 0U)
+    {
+        (void)sciReceiveByte(SELFTEST_SCI);
+    }
+    SELFTEST_SCI->FLR = SELFTEST_ERR_FLAGS;
+
+    result->baud = selftestLineBaud();
+    timeout = selftestTimeout();
+    start = _pmuGetCycleCount_();
+
+    selftestPump(start, timeout);
+
+    result->cycles = _pmuGetCycleCount_() - start;
+    result->received = s_rxCount;
+    result->rxCycles = s_rxCycles;
+    result->lineErrors = sciRxError(SELFTEST_SCI);
+
+    for (i = 0U; i < SELFTEST_LEN; i++)
+    {
+        if (s_rxBuf[i] != s_pattern[i])
+        {
+            result->mismatches++;
+        }
+    }
+
+    start = _pmuGetCycleCount_();
+    result->crc = crc32UpdateWord(CRC32_INIT, s_rxBuf, result->received) ^ CRC32_XOROUT;
+    result->crcCycles = _pmuGetCycleCount_() - start;
+
+    result->lossless = ((result->received == SELFTEST_LEN)
+                     && (result->mismatches == 0U)
+                     && (result->lineErrors == 0U)
+                     && (result->crc == s_expectedCrc)) ? 1U : 0U;
+}
+
+/**
+ * @brief  Runs the backend at increasing baud rates until the first lossy
+ *         run and prints one line per run plus a summary.
+ * @param  summary  Highest lossless rate, CRC throughput and rx share.
+ */
+void selftestSweep(selftestSummary_t *summary)
+{
+    selftestResult_t result;
+    uint32_t savedBrs = SELFTEST_SCI->BRS;
+    char line[112];
+    uint32_t r, rate, share;
+
+    memset(summary, 0, sizeof(*summary));
+    selftestPrepare();
+
+    sprintf(line, "\r\nSCI loopback self-test, %s backend, %u bytes per run\r\n",
+            selftestBackendName(), SELFTEST_LEN);
+    selftestPrint(line);
+    for (r = 0U; r < SELFTEST_BAUD_COUNT; r++)
+    {
+        selftestRun(s_baudTable[r], &result);
+
+        selftestWaitTxEmpty();
+        sciDisableLoopback(SELFTEST_SCI);
+        SELFTEST_SCI->BRS = savedBrs;
+
+        rate = (result.crcCycles == 0U) ? 0U
+             : (uint32_t)(((uint64_t)result.received * SELFTEST_GCLK_HZ) / result.crcCycles);
+        share = (result.cycles == 0U) ? 0U
+              : (uint32_t)(((uint64_t)result.rxCycles * 1000U) / result.cycles);
+
+        sprintf(line, "%7lu baud %s rx %4lu/%u err %02lX crc %6lu kB/s rx %3lu.%lu%%\r\n",
+                (unsigned long)result.baud,
+                (result.lossless != 0U) ? "ok  " : "LOSS",
+                (unsigned long)result.received, SELFTEST_LEN,
+                (unsigned long)(result.lineErrors >> 24U),
+                (unsigned long)(rate / 1000U),
+                (unsigned long)(share / 10U), (unsigned long)(share % 10U));
+        selftestPrint(line);
+
+        if (result.lossless == 0U)
+        {
+            break;
+        }
+        summary->maxBaud = result.baud;
+        summary->crcBytesPerSec = rate;
+        summary->rxPerMille = share;
+    }
+
+    sprintf(line, "%s max lossless %7lu baud, crc %6lu kB/s, rx %3lu.%lu%%\r\n",
+            selftestBackendName(),
+            (unsigned long)summary->maxBaud,
+            (unsigned long)(summary->crcBytesPerSec / 1000U),
+            (unsigned long)(summary->rxPerMille / 10U),
+            (unsigned long)(summary->rxPerMille % 10U));
+    selftestPrint(line);
+}
+
+/**
+ * @brief  Follows the bytes of a window for the in-band request.
+ * @param  data  Received bytes, in order.
+ * @param  len   Number of bytes.
+ * @note   Runs where the project's callback runs, the RX interrupt for
+ *         the interrupt backend: one compare per byte until the window
+ *         turns out to be data, nothing after that.
+ */
+void selftestScan(const uint8_t *data, uint32_t len)
+{
+    uint32_t i;
+    uint8_t c;
+
+    for (i = 0U; (i < len) && (s_cmdState != SELFTEST_CMD_DATA); i++)
+    {
+        c = data[i];
+        if (s_command[s_cmdPos] == '\0')
+        {
+            /* Command word complete, only line ends may follow */
+            s_cmdState = ((c == (uint8_t)'\r') || (c == (uint8_t)'\n'))
+                       ? SELFTEST_CMD_COMPLETE : SELFTEST_CMD_DATA;
+        }
+        else if (c == (uint8_t)s_command[s_cmdPos])
+        {
+            s_cmdPos++;
+        }
+        else
+        {
+            s_cmdState = SELFTEST_CMD_DATA;
+        }
+    }
+}
+
+/**
+ * @brief  Called at the end of every window: non-zero when the window
+ *         was the line "ESC selftest". Starts following the next window.
+ */
+uint32_t selftestRequested(void)
+{
+    uint32_t requested = (s_cmdState == SELFTEST_CMD_COMPLETE) ? 1U : 0U;
+
+    s_cmdPos = 0U;
+    s_cmdState = SELFTEST_CMD_MATCHING;
+    return requested;
+}
+
+/**
+ * @brief  Generates the pattern and its CRC and starts the cycle counter.
+ */
+static void selftestPrepare(void)
+{
+    uint32_t x = 0x2545F491U;
+    uint32_t i;
+
+    /* xorshift32, every byte value shows up including 0x00 */
+    for (i = 0U; i < SELFTEST_LEN; i++)
+    {
+        x ^= x << 13U;
+        x ^= x >> 17U;
+        x ^= x << 5U;
+        s_pattern[i] = (uint8_t)(x >> 24U);
+    }
+    s_expectedCrc = crc32UpdateWord(CRC32_INIT, s_pattern, SELFTEST_LEN) ^ CRC32_XOROUT;
+
+    _pmuInit_();
+    _pmuEnableCountersGlobal_();
+    _pmuStartCounters_(pmuCYCLE_COUNTER);
+}
+
+/**
+ * @brief  Returns the current line rate in baud from the prescaler.
+ */
+static uint32_t selftestLineBaud(void)
+{
+    return SELFTEST_VCLK_HZ / (16U * ((SELFTEST_SCI->BRS & 0x00FFFFFFU) + 1U));
+}
+
+/**
+ * @brief  Returns the run timeout in CPU cycles: twice the time the
+ *         pattern takes on the line with the current frame format.
+ */
+static uint32_t selftestTimeout(void)
+{
+    uint32_t bits = 1U + ((SELFTEST_SCI->FORMAT & 0x7U) + 1U);
+
+    bits += ((SELFTEST_SCI->GCR1 & 0x10U) != 0U) ? 2U : 1U;
+    bits += ((SELFTEST_SCI->GCR1 & 0x04U) != 0U) ? 1U : 0U;
+
+    return (uint32_t)((2ULL * SELFTEST_LEN * bits * SELFTEST_GCLK_HZ) / selftestLineBaud())
+         + (SELFTEST_GCLK_HZ / 1000U);
+}
+
+/**
+ * @brief  Sends whenever TD is free and polls the backend in between,
+ *         until the whole pattern is back or the run times out.
+ */
+static void selftestPump(uint32_t start, uint32_t timeout)
+{
+    uint32_t sent = 0U;
+    uint32_t entry;
+
+    coreRxInit(&selftestStore);
+    while ((s_rxCount < SELFTEST_LEN) && ((_pmuGetCycleCount_() - start) < timeout))
+    {
+        if ((sent < SELFTEST_LEN) && (sciIsTxReady(SELFTEST_SCI) != 0U))
+        {
+            sciSendByte(SELFTEST_SCI, s_pattern[sent]);
+            sent++;
+        }
+        entry = _pmuGetCycleCount_();
+        (void)coreRxPoll();
+        s_rxCycles += _pmuGetCycleCount_() - entry;
+    }
+    coreRxFlush();
+    coreRxStop();
+}
+
+/**
+ * @brief  Backend callback: appends the bytes to the receive block.
+ */
+static void selftestStore(const uint8_t *data, uint32_t len)
+{
+#if (SELFTEST_RX_IN_ISR == 1U)
+    uint32_t entry = _pmuGetCycleCount_();
+#endif
+    uint32_t n = SELFTEST_LEN - s_rxCount;
+
+    n = (len < n) ? len : n;
+    memcpy(&s_rxBuf[s_rxCount], data, n);
+    s_rxCount += n;
+#if (SELFTEST_RX_IN_ISR == 1U)
+    s_rxCycles += _pmuGetCycleCount_() - entry;
+#endif
+}
+
+/**
+ * @brief  Sends a null-terminated string on SCI3 using polling.
+ */
+static void selftestPrint(const char *text)
+{
+    uint32 length = strlen(text);
+
+    while (length--)
+    {
+        sciSendByte(SELFTEST_SCI, (uint8)*text++);
+    }
+}
+
+/**
+ * @brief  Waits until the last stop bit has left the shift register.
+ */
+static void selftestWaitTxEmpty(void)
+{
+    while ((SELFTEST_SCI->FLR & SELFTEST_FLR_TX_EMPTY) == 0U)
+    {
+        /* Wait */
+    }
+}
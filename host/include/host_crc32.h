@@ -0,0 +1,59 @@
+/**
+ ******************************************************************************
+ * @file    host_crc32.h
+ * @brief   Host CRC32 With Runtime CPU Dispatch
+ *
+ * @details
+ *   - The CRC32 of the boards (calc_crc32(), common/include/crc32_kernel.h):
+ *     reflected polynomial 0x04C11DB7, init and xorout 0xFFFFFFFF.
+ *     hostCrc32(0, data, len) equals calc_crc32(data, len); passing the
+ *     previous result instead of 0 continues it over the next span.
+ *   - Paths, each on the raw CRC state (no init or xorout):
+ *       * slice16  slice-by-16 tables, any CPU (host_crc32.c)
+ *       * pclmul   x86 SSE4.1 + PCLMULQDQ, folding 4 x 128 bits per step
+ *       * vpclmul  x86 AVX-512 + VPCLMULQDQ, folding 4 x 512 bits per step
+ *                  (both host_crc32_x86.c)
+ *       * armv8    aarch64 CRC32 instructions (host_crc32_arm.c)
+ *   - The first call picks the fastest path the CPU supports;
+ *     HOST_CRC32=<path> in the environment forces one if it is supported.
+ *   - hostCrc32Combine() joins the CRCs of two adjacent spans as zlib's
+ *     crc32_combine(), so spans can be computed apart (crcsum.c).
+ *     For many spans of one length, hostCrc32CombineGen() once and
+ *     hostCrc32CombineOp() per span costs a single multiplication.
+ *
+ * @note
+ *   - Thread-safe: the tables and the choice are set up once
+ *     (pthread_once()).
+ ******************************************************************************
+ */
+#ifndef HOST_CRC32_H_
+#define HOST_CRC32_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum
+{
+    HOST_CRC32_SLICE16 = 0,
+    HOST_CRC32_PCLMUL  = 1,
+    HOST_CRC32_VPCLMUL = 2,
+    HOST_CRC32_ARMV8   = 3,
+    HOST_CRC32_PATHS   = 4
+} hostCrc32Path_t;
+
+uint32_t hostCrc32(uint32_t crc, const void *data, size_t len);
+uint32_t hostCrc32With(hostCrc32Path_t path, uint32_t crc, const void *data, size_t len);
+int hostCrc32Supported(hostCrc32Path_t path);
+hostCrc32Path_t hostCrc32Active(void);
+const char *hostCrc32Name(hostCrc32Path_t path);
+uint32_t hostCrc32Combine(uint32_t crcA, uint32_t crcB, uint64_t lenB);
+uint32_t hostCrc32CombineGen(uint64_t lenB);
+uint32_t hostCrc32CombineOp(uint32_t crcA, uint32_t crcB, uint32_t op);
+
+/* Path kernels on the raw state, only those of the build's architecture */
+uint32_t hostCrc32Slice16(uint32_t state, const uint8_t *data, size_t len);
+uint32_t hostCrc32Pclmul(uint32_t state, const uint8_t *data, size_t len);
+uint32_t hostCrc32Vpclmul(uint32_t state, const uint8_t *data, size_t len);
+uint32_t hostCrc32Armv8(uint32_t state, const uint8_t *data, size_t len);
+
+#endif /* HOST_CRC32_H_ */
@@ -0,0 +1,33 @@
+/**
+ ******************************************************************************
+ * @file    host_serial.h
+ * @brief   POSIX Serial Port Access for the Host Tools
+ *
+ * @details
+ *   - Raw 8N2 mode (the board's frame format), reads with a timeout.
+ *     Flow control is off unless hostSerialSetFlow() turns it on.
+ *   - Standard rates go through cfsetspeed(); any other rate (the SCI
+ *     divider gives e.g. 937500 or 4687500) through the platform's custom
+ *     rate call (host_serial_custom.c).
+ ******************************************************************************
+ */
+#ifndef HOST_SERIAL_H_
+#define HOST_SERIAL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+int hostSerialOpen(const char *path, uint32_t baud);
+int hostSerialSetBaud(int fd, uint32_t baud);
+int hostSerialSetFlow(int fd, int xonXoff, int rtsCts);
+int hostSerialWrite(int fd, const void *data, size_t len);
+size_t hostSerialRead(int fd, void *buf, size_t len, uint32_t timeoutMs);
+int hostSerialReadLine(int fd, char *line, size_t size, uint32_t timeoutMs);
+void hostSerialFlushInput(int fd);
+void hostSerialDrain(int fd);
+void hostSerialClose(int fd);
+
+/* host_serial_custom.c, returns 0 on success */
+int hostSerialSetCustomBaud(int fd, uint32_t baud);
+
+#endif /* HOST_SERIAL_H_ */
@@ -0,0 +1,31 @@
+/**
+ ******************************************************************************
+ * @file    trace_export.h
+ * @brief   Chrome Trace JSON from a Board Event Trace
+ *
+ * @details
+ *   - Decodes the records of an "ESC trace" dump (uart-crc32-dma,
+ *     trace.h): two big-endian words each, the RTI time stamp and
+ *     (event << 24) | argument.
+ *   - Writes the Chrome trace event format, which chrome://tracing and
+ *     ui.perfetto.dev open: interrupt handlers, checksum spans and report
+ *     output as slices on their own tracks, ring wraps, window ends, SCI
+ *     errors and commands as instants, ring backlog and flow control as
+ *     counters.
+ *   - Time stamps are unwrapped (the counter wraps every 458 s at
+ *     9.375 MHz) and sorted, since a record claimed just before an
+ *     interrupt is stamped after the handler's records.
+ ******************************************************************************
+ */
+#ifndef TRACE_EXPORT_H_
+#define TRACE_EXPORT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define TRACE_EXPORT_RECORD_LEN 8U
+
+int traceExportChrome(FILE *out, const uint8_t *records, size_t count, uint32_t tickHz);
+
+#endif /* TRACE_EXPORT_H_ */
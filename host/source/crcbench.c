@@ -0,0 +1,212 @@
+/**
+ ******************************************************************************
+ * @file    crcbench.c
+ * @brief   Host CRC32 Paths: Check and Throughput
+ *
+ * @details
+ *   - Checks every path this CPU supports (host_crc32.h) against a
+ *     bitwise CRC32: the check value of "123456789" (0xCBF43926, what
+ *     calc_crc32() gives on the board), then random lengths, alignments
+ *     and split points, the second part chained on the first, and for
+ *     slice16 also computed apart and joined with hostCrc32Combine().
+ *   - Then times each path over one buffer and prints GB/s, with the
+ *     path hostCrc32() picked marked.
+ *
+ * @note
+ *   - Usage: crcbench [-s size] [-t seconds]. Default 16 MiB for 1 s per
+ *     path. Exit status 1 if a path gives a wrong CRC.
+ ******************************************************************************
+ */
+#include "host_crc32.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CRCBENCH_SIZE           (16UL * 1024UL * 1024UL)
+#define CRCBENCH_SECONDS        1.0
+#define CRCBENCH_CHECK_ROUNDS   4000U
+#define CRCBENCH_CHECK_MAX      4096U
+#define CRCBENCH_CHECK_ALIGN    64U
+#define CRCBENCH_CHECK_VALUE    0xCBF43926U
+
+static uint32_t s_rand = 0x2545F491U;
+
+static uint32_t crcbenchRand(void)
+{
+    s_rand ^= s_rand << 13U;
+    s_rand ^= s_rand >> 17U;
+    s_rand ^= s_rand << 5U;
+    return s_rand;
+}
+
+static double crcbenchNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief  Bitwise reference, same chaining as hostCrc32().
+ */
+static uint32_t crcbenchReference(uint32_t crc, const uint8_t *data, size_t len)
+{
+    uint32_t k;
+
+    crc ^= 0xFFFFFFFFU;
+    while (len > 0U)
+    {
+        crc ^= *data;
+        for (k = 0U; k < 8U; k++)
+        {
+            crc = (crc >> 1) ^ (((crc & 1U) != 0U) ? 0xEDB88320U : 0U);
+        }
+        data++;
+        len--;
+    }
+    return crc ^ 0xFFFFFFFFU;
+}
+
+/**
+ * @brief  Compares one path with the reference.
+ * @return Number of mismatches.
+ */
+static uint32_t crcbenchCheck(hostCrc32Path_t path, const uint8_t *buf)
+{
+    const uint8_t check[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    uint32_t bad = 0U;
+    uint32_t round;
+    size_t len, split, align;
+    uint32_t want, got;
+
+    if (hostCrc32With(path, 0U, check, sizeof(check)) != CRCBENCH_CHECK_VALUE)
+    {
+        fprintf(stderr, "%s: check value 0x%08lX\n", hostCrc32Name(path),
+                (unsigned long)hostCrc32With(path, 0U, check, sizeof(check)));
+        bad++;
+    }
+    for (round = 0U; round < CRCBENCH_CHECK_ROUNDS; round++)
+    {
+        len = (size_t)(crcbenchRand() % (CRCBENCH_CHECK_MAX + 1U));
+        align = (size_t)(crcbenchRand() % CRCBENCH_CHECK_ALIGN);
+        split = (size_t)(crcbenchRand() % (uint32_t)(len + 1U));
+        want = crcbenchReference(0U, &buf[align], len);
+        got = hostCrc32With(path, 0U, &buf[align], split);
+        got = hostCrc32With(path, got, &buf[align + split], len - split);
+        if ((got == want) && (path == HOST_CRC32_SLICE16))
+        {
+            /* Combine as crcsum does: the two parts computed apart */
+            got = hostCrc32Combine(hostCrc32With(path, 0U, &buf[align], split),
+                                   hostCrc32With(path, 0U, &buf[align + split], len - split),
+                                   len - split);
+        }
+        if (got != want)
+        {
+            if (bad < 8U)
+            {
+                fprintf(stderr, "%s: len %lu align %lu split %lu: 0x%08lX, want 0x%08lX\n",
+                        hostCrc32Name(path), (unsigned long)len, (unsigned long)align,
+                        (unsigned long)split, (unsigned long)got, (unsigned long)want);
+            }
+            bad++;
+        }
+    }
+    return bad;
+}
+
+/**
+ * @brief  Throughput of one path over the buffer.
+ * @return GB/s.
+ */
+static double crcbenchRun(hostCrc32Path_t path, const uint8_t *buf, size_t size, double seconds,
+                          uint32_t *crc)
+{
+    double t0 = crcbenchNow();
+    double t;
+    uint64_t bytes = 0U;
+
+    do
+    {
+        *crc = hostCrc32With(path, 0U, buf, size);
+        bytes += size;
+        t = crcbenchNow() - t0;
+    } while (t < seconds);
+    return (double)bytes / t / 1e9;
+}
+
+int main(int argc, char **argv)
+{
+    size_t size = CRCBENCH_SIZE;
+    double seconds = CRCBENCH_SECONDS;
+    uint8_t *buf;
+    uint32_t bad = 0U;
+    uint32_t crc, first = 0U;
+    size_t i;
+    int opt;
+    int p;
+
+    while ((opt = getopt(argc, argv, "s:t:")) != -1)
+    {
+        if (opt == 's')
+        {
+            size = (size_t)strtoul(optarg, NULL, 0);
+        }
+        else if (opt == 't')
+        {
+            seconds = strtod(optarg, NULL);
+        }
+        else
+        {
+            fprintf(stderr, "usage: crcbench [-s size] [-t seconds]\n");
+            return 2;
+        }
+    }
+    if (size < (CRCBENCH_CHECK_MAX + CRCBENCH_CHECK_ALIGN))
+    {
+        size = CRCBENCH_CHECK_MAX + CRCBENCH_CHECK_ALIGN;
+    }
+    buf = (uint8_t *)malloc(size);
+    if (buf == NULL)
+    {
+        perror("crcbench");
+        return 2;
+    }
+    for (i = 0U; i < size; i++)
+    {
+        buf[i] = (uint8_t)crcbenchRand();
+    }
+
+    for (p = 0; p < (int)HOST_CRC32_PATHS; p++)
+    {
+        if (hostCrc32Supported((hostCrc32Path_t)p) != 0)
+        {
+            bad += crcbenchCheck((hostCrc32Path_t)p, buf);
+        }
+    }
+    printf("check: %s\n", (bad == 0U) ? "ok" : "FAILED");
+
+    printf("%lu bytes, %.1f s per path\n", (unsigned long)size, seconds);
+    for (p = 0; p < (int)HOST_CRC32_PATHS; p++)
+    {
+        if (hostCrc32Supported((hostCrc32Path_t)p) == 0)
+        {
+            printf("  %-8s  unsupported\n", hostCrc32Name((hostCrc32Path_t)p));
+            continue;
+        }
+        printf("  %-8s  %7.2f GB/s", hostCrc32Name((hostCrc32Path_t)p),
+               crcbenchRun((hostCrc32Path_t)p, buf, size, seconds, &crc));
+        printf("  crc 0x%08lX%s\n", (unsigned long)crc,
+               (hostCrc32Active() == (hostCrc32Path_t)p) ? "  (active)" : "");
+        if ((p != 0) && (crc != first))
+        {
+            bad++;
+        }
+        first = (p == 0) ? crc : first;
+    }
+
+    free(buf);
+    return (bad == 0U) ? 0 : 1;
+}
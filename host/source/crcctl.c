@@ -0,0 +1,1061 @@
+/**
+ ******************************************************************************
+ * @file    crcctl.c
+ * @brief   Host Command-Line Tool for the uart-crc32-dma Board
+ *
+ * @details
+ *   - crcctl cmd <text>       Sends ESC <text> CR and prints the reply up
+ *                             to OK or ERR (command.h on the board).
+ *   - crcctl send <file>      Streams a file, waits for the idle report and
+ *                             compares the board's CRC32 with a local one.
+ *                             If the report has a block manifest (ESC
+ *                             manifest), the blocks that differ are listed,
+ *                             and with -R sent again one window each. With
+ *                             only a tree root (ESC tree), the bad blocks
+ *                             are found by querying nodes (ESC node) down
+ *                             from the root, one level per round trip.
+ *   - crcctl session <file>   Sends a file as a resumable session
+ *                             (uart-crc32-interrupt-largefiles, session.h):
+ *                             the board says where to continue, after a
+ *                             dropped transfer or a reset, and reports the
+ *                             CRC32 of the whole file at the end.
+ *   - crcctl trace <out.json> Dumps the board's event trace (ESC trace,
+ *                             trace.h) and writes it as Chrome trace JSON
+ *                             (trace_export.h), "-" for stdout.
+ *   - crcctl replay <out>     Reads back the board's SDRAM image (ESC
+ *                             replay, capture.h), checks it against the
+ *                             CRC32 the board kept while capturing and
+ *                             writes it to a file, "-" for stdout.
+ *   - crcctl baud <rate>...   Negotiates the fastest working rate: each
+ *                             proposed rate is tried in order with the
+ *                             handshake of baud.h until one verifies.
+ *
+ *   - -x / -r let the board throttle the transfer with XON/XOFF or RTS
+ *     (flow_control.h on the board), so send can run at the full rate.
+ *     replay reads binary and leaves XON/XOFF off; -r still applies.
+ *
+ * @note
+ *   - Rates the SCI divider cannot reach within 2.5 % are skipped without
+ *     asking the board, so are rates the local adapter refuses.
+ ******************************************************************************
+ */
+#include "host_crc32.h"
+#include "host_serial.h"
+#include "trace_export.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Board side, see uart-crc32-dma/include/baud.h */
+#define CRCCTL_VCLK_HZ          75000000U
+#define CRCCTL_MAX_ERROR        25
+#define CRCCTL_PATTERN_LEN      64U
+#define CRCCTL_ACK              0x06U
+#define CRCCTL_ACK_LEN          4U
+#define CRCCTL_SETTLE_MS        100U
+#define CRCCTL_VERIFY_MS        1000U
+#define CRCCTL_REVERT_MS        1000U
+
+#define CRCCTL_ESCAPE           0x1BU
+#define CRCCTL_DEFAULT_BAUD     26042U
+#define CRCCTL_LINE_MAX         256U
+/* File bytes that go into a session id, with the length */
+#define CRCCTL_SESSION_ID_LEN   65536U
+#define CRCCTL_CHUNK            65536U
+/* Quiet time that ends the lines of one report */
+#define CRCCTL_REPORT_GAP_MS    500U
+/* Deeper than any board tree (MANIFEST_MAX_BLOCKS leaves) */
+#define CRCCTL_TREE_DEPTH       32U
+
+static void crcctlUsage(void);
+static int crcctlCommand(int fd, int argc, char **argv, uint32_t waitMs);
+static int crcctlSend(int fd, const char *path, uint32_t baud, uint32_t waitMs, int resend);
+static int crcctlManifest(int fd, const uint8_t *data, size_t size, uint32_t waitMs, int resend);
+static int crcctlTree(int fd, const uint8_t *data, size_t size, unsigned long count,
+                      unsigned long blockLen, unsigned long levels, uint32_t root,
+                      uint32_t waitMs, int resend);
+static int crcctlQueryNode(int fd, unsigned long level, unsigned long index,
+                           uint32_t *children, uint32_t waitMs);
+static int crcctlResend(int fd, const uint8_t *data, size_t offset, size_t len, uint32_t waitMs);
+static int crcctlSession(int fd, const char *path, uint32_t baud, uint32_t waitMs);
+static int crcctlBoardCrc(const char *line, uint32_t local);
+static int crcctlTrace(int fd, const char *path, uint32_t baud, uint32_t waitMs);
+static int crcctlReplay(int fd, const char *path, uint32_t baud, uint32_t waitMs);
+static int crcctlBaud(int fd, uint32_t *baud, int argc, char **argv);
+static uint32_t crcctlTryBaud(int fd, uint32_t baud, uint32_t rate);
+static uint32_t crcctlPlan(uint32_t rate, int *errorPerMille);
+static uint8_t crcctlPatternByte(uint32_t index);
+static void crcctlSleepMs(uint32_t ms);
+static uint32_t crcctlLineMs(uint64_t len, uint32_t baud);
+
+int main(int argc, char **argv)
+{
+    const char *port = NULL;
+    uint32_t baud = CRCCTL_DEFAULT_BAUD;
+    uint32_t waitMs = 8000U;
+    int xonXoff = 0;
+    int rtsCts = 0;
+    int resend = 0;
+    int fd;
+    int rc;
+    int i = 1;
+
+    while ((i < argc) && (argv[i][0] == '-'))
+    {
+        if ((strcmp(argv[i], "-p") == 0) && ((i + 1) < argc))
+        {
+            port = argv[++i];
+        }
+        else if ((strcmp(argv[i], "-b") == 0) && ((i + 1) < argc))
+        {
+            baud = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if ((strcmp(argv[i], "-w") == 0) && ((i + 1) < argc))
+        {
+            waitMs = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "-x") == 0)
+        {
+            xonXoff = 1;
+        }
+        else if (strcmp(argv[i], "-r") == 0)
+        {
+            rtsCts = 1;
+        }
+        else if (strcmp(argv[i], "-R") == 0)
+        {
+            resend = 1;
+        }
+        else
+        {
+            crcctlUsage();
+            return 2;
+        }
+        i++;
+    }
+    if ((port == NULL) || (i >= argc))
+    {
+        crcctlUsage();
+        return 2;
+    }
+
+    fd = hostSerialOpen(port, baud);
+    if (fd < 0)
+    {
+        perror(port);
+        return 1;
+    }
+    if (((xonXoff != 0) || (rtsCts != 0)) && (hostSerialSetFlow(fd, xonXoff, rtsCts) != 0))
+    {
+        perror(port);
+        hostSerialClose(fd);
+        return 1;
+    }
+
+    if (strcmp(argv[i], "cmd") == 0)
+    {
+        rc = crcctlCommand(fd, argc - i - 1, &argv[i + 1], waitMs);
+    }
+    else if ((strcmp(argv[i], "send") == 0) && ((i + 1) < argc))
+    {
+        rc = crcctlSend(fd, argv[i + 1], baud, waitMs, resend);
+    }
+    else if ((strcmp(argv[i], "session") == 0) && ((i + 1) < argc))
+    {
+        rc = crcctlSession(fd, argv[i + 1], baud, waitMs);
+    }
+    else if ((strcmp(argv[i], "trace") == 0) && ((i + 1) < argc))
+    {
+        rc = crcctlTrace(fd, argv[i + 1], baud, waitMs);
+    }
+    else if ((strcmp(argv[i], "replay") == 0) && ((i + 1) < argc))
+    {
+        /* The image is binary: with IXON the tty would drop its 0x11 and
+         * 0x13 bytes. The board holds XON/XOFF back meanwhile */
+        if ((xonXoff != 0) && (hostSerialSetFlow(fd, 0, rtsCts) != 0))
+        {
+            perror(port);
+            rc = 1;
+        }
+        else
+        {
+            rc = crcctlReplay(fd, argv[i + 1], baud, waitMs);
+        }
+    }
+    else if (strcmp(argv[i], "baud") == 0)
+    {
+        rc = crcctlBaud(fd, &baud, argc - i - 1, &argv[i + 1]);
+    }
+    else
+    {
+        crcctlUsage();
+        rc = 2;
+    }
+
+    hostSerialClose(fd);
+    return rc;
+}
+
+static void crcctlUsage(void)
+{
+    fprintf(stderr,
+            "usage: crcctl -p <port> [-b <baud>] [-w <ms>] [-x] [-r] [-R] <command>\n"
+            "  cmd <text...>        send ESC <text> and print the reply\n"
+            "  send <file>          send a file and check the board's CRC32\n"
+            "  session <file>       same, resumable (largefiles board)\n"
+            "  trace <out.json>     dump the event trace as Chrome trace JSON\n"
+            "  replay <out>         read back and check the board's SDRAM capture\n"
+            "  baud <rate>...       switch to the first rate that verifies\n"
+            "  -b  current line rate (default %u)\n"
+            "  -w  reply timeout in ms, after the line time of the data (default 8000)\n"
+            "  -x  obey XON/XOFF from the board\n"
+            "  -r  obey RTS/CTS from the board\n"
+            "  -R  send: resend the blocks the manifest or tree shows as bad\n",
+            CRCCTL_DEFAULT_BAUD);
+}
+
+/**
+ * @brief  Sends one command line and prints the reply.
+ * @return 0 for OK, 1 for ERR or no reply.
+ */
+static int crcctlCommand(int fd, int argc, char **argv, uint32_t waitMs)
+{
+    char line[CRCCTL_LINE_MAX];
+    uint8_t esc = CRCCTL_ESCAPE;
+    int i;
+
+    if (argc < 1)
+    {
+        crcctlUsage();
+        return 2;
+    }
+    hostSerialWrite(fd, &esc, 1U);
+    for (i = 0; i < argc; i++)
+    {
+        hostSerialWrite(fd, argv[i], strlen(argv[i]));
+        hostSerialWrite(fd, (i + 1 < argc) ? " " : "\r", 1U);
+    }
+
+    while (hostSerialReadLine(fd, line, sizeof(line), waitMs) >= 0)
+    {
+        printf("%s\n", line);
+        if (strcmp(line, "OK") == 0)
+        {
+            return 0;
+        }
+        if (strcmp(line, "ERR") == 0)
+        {
+            return 1;
+        }
+    }
+    fprintf(stderr, "no reply\n");
+    return 1;
+}
+
+/**
+ * @brief  Streams a file and checks the CRC32 the board reports after the
+ *         idle timeout.
+ * @note   The write returns once the bytes are buffered, which for a pty
+ *         or a deep adapter FIFO is long before they are on the line, so
+ *         the reply wait starts with the line time of the file. Blocks
+ *         sent again are part of the file and fit in that wait too.
+ * @return 0 if the CRCs match.
+ */
+static int crcctlSend(int fd, const char *path, uint32_t baud, uint32_t waitMs, int resend)
+{
+    char line[CRCCTL_LINE_MAX];
+    uint8_t *data;
+    FILE *f = fopen(path, "rb");
+    long size;
+    uint32_t local;
+    int rc;
+    int mrc;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((size > 0) ? (size_t)size : 1U);
+    if ((data == NULL) || (fread(data, 1U, (size_t)size, f) != (size_t)size))
+    {
+        fclose(f);
+        free(data);
+        fprintf(stderr, "%s: read failed\n", path);
+        return 1;
+    }
+    fclose(f);
+
+    local = hostCrc32(0U, data, (size_t)size);
+    waitMs += crcctlLineMs((uint64_t)size, baud);
+    hostSerialFlushInput(fd);
+    hostSerialWrite(fd, data, (size_t)size);
+
+    while (hostSerialReadLine(fd, line, sizeof(line), waitMs) >= 0)
+    {
+        printf("%s\n", line);
+        rc = crcctlBoardCrc(line, local);
+        if (rc >= 0)
+        {
+            mrc = crcctlManifest(fd, data, (size_t)size, waitMs, resend);
+            if (mrc >= 0)
+            {
+                rc = mrc;
+            }
+            free(data);
+            return rc;
+        }
+    }
+    free(data);
+    fprintf(stderr, "no CRC reported (local CRC32 %08X)\n", local);
+    return 1;
+}
+
+/**
+ * @brief  Reads the manifest or tree root that may follow the CRC lines of
+ *         a report, lists the blocks whose CRC32 differs and optionally
+ *         sends each of them again as a window of its own.
+ * @return 0 if blocks differed and all verified when sent again, 1 if
+ *         blocks differ, -1 if there is no manifest or no block differs.
+ */
+static int crcctlManifest(int fd, const uint8_t *data, size_t size, uint32_t waitMs, int resend)
+{
+    char line[CRCCTL_LINE_MAX];
+    uint32_t *board;
+    char *p;
+    char *end;
+    unsigned long count = 0UL;
+    unsigned long blockLen = 0UL;
+    unsigned long got = 0UL;
+    unsigned long bad = 0UL;
+    unsigned long fixed = 0UL;
+    unsigned long levels;
+    unsigned long root;
+    unsigned long i;
+    size_t offset;
+    size_t len;
+    uint32_t local;
+
+    while (hostSerialReadLine(fd, line, sizeof(line), CRCCTL_REPORT_GAP_MS) >= 0)
+    {
+        if (sscanf(line, "Manifest: %lu blocks of %lu bytes", &count, &blockLen) == 2)
+        {
+            break;
+        }
+        if (sscanf(line, "Tree: %lu blocks of %lu bytes, %lu levels, root %lx", &count, &blockLen, &levels, &root) == 4)
+        {
+            return crcctlTree(fd, data, size, count, blockLen, levels, (uint32_t)root, waitMs, resend);
+        }
+    }
+    if ((count == 0UL) || (blockLen == 0UL))
+    {
+        return -1;
+    }
+    board = malloc(count * sizeof(uint32_t));
+    if (board == NULL)
+    {
+        return 1;
+    }
+    while ((got < count) && (hostSerialReadLine(fd, line, sizeof(line), CRCCTL_REPORT_GAP_MS) >= 0))
+    {
+        for (p = line; got < count; p = end)
+        {
+            board[got] = (uint32_t)strtoul(p, &end, 16);
+            if (end == p)
+            {
+                break;
+            }
+            got++;
+        }
+    }
+    if ((got != count) || (((size + blockLen - 1U) / blockLen) != count))
+    {
+        fprintf(stderr, "manifest of %lu blocks of %lu bytes (%lu read) does not fit %zu bytes\n",
+                count, blockLen, got, size);
+        free(board);
+        return 1;
+    }
+
+    for (i = 0UL; i < count; i++)
+    {
+        offset = (size_t)i * blockLen;
+        len = ((size - offset) < blockLen) ? (size - offset) : blockLen;
+        local = hostCrc32(0U, &data[offset], len);
+        if (board[i] == local)
+        {
+            continue;
+        }
+        bad++;
+        printf("block %lu at %zu: board %08X local %08X\n", i, offset, board[i], local);
+        if ((resend != 0) && (crcctlResend(fd, data, offset, len, waitMs) != 0))
+        {
+            fixed++;
+        }
+    }
+    free(board);
+
+    printf("%lu of %lu blocks of %lu bytes differ%s\n", bad, count, blockLen,
+           ((resend == 0) || (bad == 0UL)) ? "" : ((fixed == bad) ? ", all verified when resent" : ", resend failed"));
+    if (bad == 0UL)
+    {
+        return -1;
+    }
+    return ((resend != 0) && (fixed == bad)) ? 0 : 1;
+}
+
+/**
+ * @brief  Finds the bad blocks under a tree root that differs from the
+ *         local CRC32 of the file. Each query returns the CRCs of a node's
+ *         children; only the children that differ are followed, so a
+ *         single bad block costs one query per level. The bad blocks are
+ *         sent again only after the search, since new data replaces the
+ *         tree on the board.
+ * @return As crcctlManifest().
+ */
+static int crcctlTree(int fd, const uint8_t *data, size_t size, unsigned long count,
+                      unsigned long blockLen, unsigned long levels, uint32_t root,
+                      uint32_t waitMs, int resend)
+{
+    /* Nodes known to differ, searched depth first */
+    unsigned long stackLevel[2U * CRCCTL_TREE_DEPTH];
+    unsigned long stackIndex[2U * CRCCTL_TREE_DEPTH];
+    unsigned long *bad;
+    unsigned long badCount = 0UL;
+    unsigned long queries = 0UL;
+    unsigned long fixed = 0UL;
+    unsigned long level;
+    unsigned long index;
+    unsigned long child;
+    unsigned long first;
+    uint32_t children[2];
+    uint32_t depth = 0U;
+    size_t offset;
+    size_t len;
+    int n;
+
+    if ((levels >= CRCCTL_TREE_DEPTH) || (count == 0UL) || (((size + blockLen - 1U) / blockLen) != count))
+    {
+        fprintf(stderr, "tree of %lu blocks of %lu bytes does not fit %zu bytes\n", count, blockLen, size);
+        return 1;
+    }
+    if (root == hostCrc32(0U, data, size))
+    {
+        return -1;
+    }
+    bad = malloc(count * sizeof(unsigned long));
+    if (bad == NULL)
+    {
+        return 1;
+    }
+
+    stackLevel[0] = levels;
+    stackIndex[0] = 0UL;
+    depth = 1U;
+    while (depth > 0U)
+    {
+        depth--;
+        level = stackLevel[depth];
+        index = stackIndex[depth];
+        if (level == 0UL)
+        {
+            bad[badCount] = index;
+            badCount++;
+            continue;
+        }
+        n = crcctlQueryNode(fd, level, index, children, waitMs);
+        queries++;
+        if (n < 0)
+        {
+            fprintf(stderr, "no reply to node %lu %lu\n", level, index);
+            free(bad);
+            return 1;
+        }
+        /* Right child first on the stack, so blocks come out in order */
+        for (child = (unsigned long)n; child > 0UL; child--)
+        {
+            first = ((2UL * index) + child - 1UL) << (level - 1UL);
+            offset = (size_t)first * blockLen;
+            len = (size_t)blockLen << (level - 1UL);
+            if (len > (size - offset))
+            {
+                len = size - offset;
+            }
+            if (children[child - 1UL] != hostCrc32(0U, &data[offset], len))
+            {
+                stackLevel[depth] = level - 1UL;
+                stackIndex[depth] = (2UL * index) + child - 1UL;
+                depth++;
+            }
+        }
+    }
+
+    for (index = 0UL; index < badCount; index++)
+    {
+        offset = (size_t)bad[index] * blockLen;
+        len = ((size - offset) < blockLen) ? (size - offset) : blockLen;
+        printf("block %lu at %zu differs\n", bad[index], offset);
+        if ((resend != 0) && (crcctlResend(fd, data, offset, len, waitMs) != 0))
+        {
+            fixed++;
+        }
+    }
+    free(bad);
+
+    printf("%lu of %lu blocks of %lu bytes differ, %lu node queries%s\n", badCount, count, blockLen, queries,
+           ((resend == 0) || (badCount == 0UL)) ? "" : ((fixed == badCount) ? ", all verified when resent" : ", resend failed"));
+    if (badCount == 0UL)
+    {
+        return -1;
+    }
+    return ((resend != 0) && (fixed == badCount)) ? 0 : 1;
+}
+
+/**
+ * @brief  Asks the board for a tree node (ESC node) and reads the CRCs of
+ *         its children from the reply.
+ * @return Number of children (1 or 2), -1 on ERR or no reply.
+ */
+static int crcctlQueryNode(int fd, unsigned long level, unsigned long index,
+                           uint32_t *children, uint32_t waitMs)
+{
+    char line[CRCCTL_LINE_MAX];
+    unsigned long l;
+    unsigned long i;
+    unsigned long offset;
+    unsigned long len;
+    unsigned long crc;
+    unsigned long c0;
+    unsigned long c1;
+    int n = -1;
+    int fields;
+
+    snprintf(line, sizeof(line), "%cnode %lu %lu\r", CRCCTL_ESCAPE, level, index);
+    hostSerialWrite(fd, line, strlen(line));
+    while (hostSerialReadLine(fd, line, sizeof(line), waitMs) >= 0)
+    {
+        fields = sscanf(line, "NODE %lu %lu %lu %lu %lx %lx %lx", &l, &i, &offset, &len, &crc, &c0, &c1);
+        if ((fields >= 6) && (l == level) && (i == index))
+        {
+            children[0] = (uint32_t)c0;
+            children[1] = (uint32_t)c1;
+            n = fields - 5;
+        }
+        else if (strcmp(line, "OK") == 0)
+        {
+            return n;
+        }
+        else if (strcmp(line, "ERR") == 0)
+        {
+            return -1;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief  Sends a block again as a window of its own and checks the CRC32
+ *         the board reports for it.
+ * @return Non-zero if it verified.
+ */
+static int crcctlResend(int fd, const uint8_t *data, size_t offset, size_t len, uint32_t waitMs)
+{
+    char line[CRCCTL_LINE_MAX];
+    uint32_t local = hostCrc32(0U, &data[offset], len);
+    int rc = -1;
+
+    hostSerialWrite(fd, &data[offset], len);
+    while ((rc < 0) && (hostSerialReadLine(fd, line, sizeof(line), waitMs) >= 0))
+    {
+        rc = crcctlBoardCrc(line, local);
+    }
+    /* Skip the rest of that report, its manifest included */
+    while (hostSerialReadLine(fd, line, sizeof(line), CRCCTL_REPORT_GAP_MS) >= 0)
+    {
+    }
+    return (rc == 0) ? 1 : 0;
+}
+
+/**
+ * @brief  Streams a file as a resumable session. The id is the CRC32 of
+ *         the file's first CRCCTL_SESSION_ID_LEN bytes and its length, so
+ *         running the same command again continues the same session.
+ * @return 0 if the whole file went through and the CRCs match, 1 if the
+ *         board paused the session (run again to resume) or on error.
+ */
+static int crcctlSession(int fd, const char *path, uint32_t baud, uint32_t waitMs)
+{
+    char line[CRCCTL_LINE_MAX];
+    uint8_t *chunk;
+    uint8_t lenBytes[8];
+    FILE *f = fopen(path, "rb");
+    uint64_t size = 0U;
+    uint64_t offset = 0U;
+    uint64_t sent;
+    uint32_t local = 0U;
+    uint32_t id = 0U;
+    unsigned long long value;
+    size_t n;
+    int rc;
+    int i;
+
+    chunk = malloc(CRCCTL_CHUNK);
+    if ((f == NULL) || (chunk == NULL))
+    {
+        perror(path);
+        free(chunk);
+        if (f != NULL)
+        {
+            fclose(f);
+        }
+        return 1;
+    }
+
+    /* Whole-file CRC32, and the id from the first chunk */
+    while ((n = fread(chunk, 1U, CRCCTL_CHUNK, f)) > 0U)
+    {
+        if (size == 0U)
+        {
+            id = hostCrc32(0U, chunk, (n < CRCCTL_SESSION_ID_LEN) ? n : CRCCTL_SESSION_ID_LEN);
+        }
+        local = hostCrc32(local, chunk, n);
+        size += n;
+    }
+    for (i = 0; i < 8; i++)
+    {
+        lenBytes[i] = (uint8_t)(size >> (8 * i));
+    }
+    id = hostCrc32(id, lenBytes, sizeof(lenBytes));
+    if (id == 0U)
+    {
+        id = 1U;
+    }
+    if (size == 0U)
+    {
+        fprintf(stderr, "%s: empty\n", path);
+        free(chunk);
+        fclose(f);
+        return 1;
+    }
+
+    hostSerialFlushInput(fd);
+    n = (size_t)snprintf(line, sizeof(line), "%csession %08X %llX\r", CRCCTL_ESCAPE, id,
+                         (unsigned long long)size);
+    hostSerialWrite(fd, line, n);
+    rc = -1;
+    while ((rc < 0) && (hostSerialReadLine(fd, line, sizeof(line), waitMs) >= 0))
+    {
+        if ((sscanf(line, "RESUME %*8x %llx", &value) == 1) && ((uint64_t)value <= size))
+        {
+            offset = (uint64_t)value;
+            rc = 0;
+        }
+    }
+    if (rc < 0)
+    {
+        fprintf(stderr, "no RESUME from the board\n");
+        free(chunk);
+        fclose(f);
+        return 1;
+    }
+    printf("session %08X, %llu bytes, continuing at %llu\n", id,
+           (unsigned long long)size, (unsigned long long)offset);
+
+    if (fseeko(f, (off_t)offset, SEEK_SET) != 0)
+    {
+        perror(path);
+        free(chunk);
+        fclose(f);
+        return 1;
+    }
+    for (sent = offset; sent < size; sent += n)
+    {
+        n = fread(chunk, 1U, CRCCTL_CHUNK, f);
+        if ((n == 0U) || (hostSerialWrite(fd, chunk, n) != 0))
+        {
+            fprintf(stderr, "stopped at %llu\n", (unsigned long long)sent);
+            break;
+        }
+    }
+    free(chunk);
+    fclose(f);
+
+    /* The board is quiet while a session is arriving, and the last writes
+       may still be buffered ahead of the line */
+    waitMs += waitMs + crcctlLineMs(size - offset, baud);
+    while (hostSerialReadLine(fd, line, sizeof(line), waitMs) >= 0)
+    {
+        printf("%s\n", line);
+        if (strncmp(line, "PAUSED ", 7U) == 0)
+        {
+            fprintf(stderr, "paused, run again to resume\n");
+            return 1;
+        }
+        rc = crcctlBoardCrc(line, local);
+        if (rc >= 0)
+        {
+            return rc;
+        }
+    }
+    fprintf(stderr, "no CRC reported (local CRC32 %08X)\n", local);
+    return 1;
+}
+
+/**
+ * @brief  Compares the CRC32 in a report line with the local one.
+ * @return 0 for a match, 1 for a mismatch or a window the board's ring
+ *         overran, -1 if the line has no CRC.
+ */
+static int crcctlBoardCrc(const char *line, uint32_t local)
+{
+    static const char crcPrefix[] = "Updated CRC in Hex is : 0x";
+    static const char overrunPrefix[] = "Ring overrun";
+    uint32_t board;
+
+    if (strncmp(line, overrunPrefix, sizeof(overrunPrefix) - 1U) == 0)
+    {
+        printf("local CRC32 %08X, board %s\n", local, line);
+        return 1;
+    }
+    if (strncmp(line, crcPrefix, sizeof(crcPrefix) - 1U) != 0)
+    {
+        return -1;
+    }
+    board = (uint32_t)strtoul(&line[sizeof(crcPrefix) - 1U], NULL, 16);
+    printf("local CRC32 %08X, %s\n", local, (board == local) ? "match" : "MISMATCH");
+    return (board == local) ? 0 : 1;
+}
+
+/**
+ * @brief  Dumps the board's event trace and converts it.
+ * @param  path  Output file, "-" for stdout.
+ * @param  baud  Current line rate, for the transfer time of the records.
+ * @return 0 on success, 1 on ERR (tracing not built in), no reply or a
+ *         short dump.
+ */
+static int crcctlTrace(int fd, const char *path, uint32_t baud, uint32_t waitMs)
+{
+    char line[CRCCTL_LINE_MAX];
+    uint8_t *records;
+    FILE *out;
+    unsigned long count = 0UL;
+    unsigned long tickHz = 0UL;
+    size_t len;
+    size_t got;
+    uint32_t timeMs;
+    int rc;
+
+    snprintf(line, sizeof(line), "%ctrace\r", CRCCTL_ESCAPE);
+    hostSerialFlushInput(fd);
+    hostSerialWrite(fd, line, strlen(line));
+    while (hostSerialReadLine(fd, line, sizeof(line), waitMs) >= 0)
+    {
+        if (sscanf(line, "TRACE %lu %lu", &count, &tickHz) == 2)
+        {
+            break;
+        }
+        if (strcmp(line, "ERR") == 0)
+        {
+            fprintf(stderr, "board has no trace (TRACE_ENABLE in trace.h)\n");
+            return 1;
+        }
+    }
+    if (tickHz == 0UL)
+    {
+        fprintf(stderr, "no reply\n");
+        return 1;
+    }
+
+    len = (size_t)count * TRACE_EXPORT_RECORD_LEN;
+    records = malloc((len > 0U) ? len : 1U);
+    if (records == NULL)
+    {
+        return 1;
+    }
+    timeMs = waitMs + crcctlLineMs((uint64_t)len, baud);
+    /* The header ends in CR LF and the line reader stops at the CR */
+    got = hostSerialRead(fd, records, 1U, waitMs);
+    if ((got == 1U) && (records[0] == (uint8_t)'\n'))
+    {
+        got = 0U;
+    }
+    got += hostSerialRead(fd, &records[got], len - got, timeMs);
+    if (got != len)
+    {
+        fprintf(stderr, "trace dump cut short\n");
+        free(records);
+        return 1;
+    }
+    (void)hostSerialReadLine(fd, line, sizeof(line), waitMs);
+
+    out = (strcmp(path, "-") == 0) ? stdout : fopen(path, "w");
+    if (out == NULL)
+    {
+        perror(path);
+        free(records);
+        return 1;
+    }
+    rc = traceExportChrome(out, records, (size_t)count, (uint32_t)tickHz);
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+    free(records);
+    fprintf(stderr, "%lu events\n", count);
+    return (rc == 0) ? 0 : 1;
+}
+
+/**
+ * @brief  Reads back the board's SDRAM image.
+ * @param  path  Output file, "-" for stdout.
+ * @param  baud  Current line rate, for the transfer time of the image.
+ * @return 0 if the image arrived whole and matches the board's CRC32, 1 on
+ *         ERR (capture not built in), no reply, a short image or a
+ *         mismatch.
+ */
+static int crcctlReplay(int fd, const char *path, uint32_t baud, uint32_t waitMs)
+{
+    char line[CRCCTL_LINE_MAX];
+    uint8_t *image;
+    FILE *out;
+    unsigned long len = 0UL;
+    unsigned long crc = 0UL;
+    size_t got;
+    uint32_t local;
+    uint32_t timeMs;
+    int found = 0;
+    int rc = 0;
+
+    snprintf(line, sizeof(line), "%creplay\r", CRCCTL_ESCAPE);
+    hostSerialFlushInput(fd);
+    hostSerialWrite(fd, line, strlen(line));
+    while (hostSerialReadLine(fd, line, sizeof(line), waitMs) >= 0)
+    {
+        if (sscanf(line, "REPLAY %lu %lx", &len, &crc) == 2)
+        {
+            found = 1;
+            break;
+        }
+        if (strcmp(line, "ERR") == 0)
+        {
+            fprintf(stderr, "board has no capture (CAPTURE_ENABLE in capture.h)\n");
+            return 1;
+        }
+    }
+    if (found == 0)
+    {
+        fprintf(stderr, "no reply\n");
+        return 1;
+    }
+
+    image = malloc((len > 0UL) ? (size_t)len : 1U);
+    if (image == NULL)
+    {
+        return 1;
+    }
+    timeMs = waitMs + crcctlLineMs((uint64_t)len, baud);
+    /* The header ends in CR LF and the line reader stops at the CR */
+    got = hostSerialRead(fd, image, 1U, waitMs);
+    if ((got == 1U) && (image[0] == (uint8_t)'\n'))
+    {
+        got = 0U;
+    }
+    got += hostSerialRead(fd, &image[got], (size_t)len - got, timeMs);
+    if (got != (size_t)len)
+    {
+        fprintf(stderr, "replay cut short: %lu of %lu bytes\n", (unsigned long)got, len);
+        free(image);
+        return 1;
+    }
+    (void)hostSerialReadLine(fd, line, sizeof(line), waitMs);
+
+    local = hostCrc32(0U, image, (size_t)len);
+    fprintf(stderr, "%lu bytes, crc32 0x%08lX, board 0x%08lX: %s\n", len,
+            (unsigned long)local, crc, (local == (uint32_t)crc) ? "match" : "MISMATCH");
+    rc = (local == (uint32_t)crc) ? 0 : 1;
+
+    out = (strcmp(path, "-") == 0) ? stdout : fopen(path, "wb");
+    if (out == NULL)
+    {
+        perror(path);
+        free(image);
+        return 1;
+    }
+    if (fwrite(image, 1U, (size_t)len, out) != (size_t)len)
+    {
+        perror(path);
+        rc = 1;
+    }
+    if ((out != stdout) && (fclose(out) != 0))
+    {
+        rc = 1;
+    }
+    free(image);
+    return rc;
+}
+
+/**
+ * @brief  Tries the proposed rates in order and stays on the first one
+ *         that verifies.
+ * @return 0 if a new rate is in use.
+ */
+static int crcctlBaud(int fd, uint32_t *baud, int argc, char **argv)
+{
+    uint32_t rate;
+    uint32_t actual;
+    int err;
+    int i;
+
+    for (i = 0; i < argc; i++)
+    {
+        rate = (uint32_t)strtoul(argv[i], NULL, 10);
+        actual = crcctlPlan(rate, &err);
+        if (actual == 0U)
+        {
+            printf("%u: not reachable within %d.%d %%\n", rate,
+                   CRCCTL_MAX_ERROR / 10, CRCCTL_MAX_ERROR % 10);
+            continue;
+        }
+        /* Check the adapter takes the rate before asking the board */
+        if (hostSerialSetBaud(fd, actual) != 0)
+        {
+            printf("%u: adapter refuses %u\n", rate, actual);
+            hostSerialSetBaud(fd, *baud);
+            continue;
+        }
+        hostSerialSetBaud(fd, *baud);
+
+        actual = crcctlTryBaud(fd, *baud, rate);
+        if (actual != 0U)
+        {
+            printf("link at %u baud (%c%d.%d %%)\n", actual, (err < 0) ? '-' : '+',
+                   abs(err) / 10, abs(err) % 10);
+            *baud = actual;
+            return 0;
+        }
+        printf("%u: failed, back at %u\n", rate, *baud);
+    }
+    return 1;
+}
+
+/**
+ * @brief  Runs the handshake for one rate.
+ * @return New rate, 0 if the link is back on baud.
+ */
+static uint32_t crcctlTryBaud(int fd, uint32_t baud, uint32_t rate)
+{
+    char line[CRCCTL_LINE_MAX];
+    uint8_t pattern[CRCCTL_PATTERN_LEN];
+    uint8_t echo[CRCCTL_PATTERN_LEN];
+    uint8_t ack[CRCCTL_ACK_LEN];
+    uint32_t actual = 0U;
+    uint32_t i;
+    int n;
+
+    n = snprintf(line, sizeof(line), "%cbaud %u\r", CRCCTL_ESCAPE, rate);
+    hostSerialWrite(fd, line, (size_t)n);
+
+    while (hostSerialReadLine(fd, line, sizeof(line), 2000U) >= 0)
+    {
+        if (strncmp(line, "BAUD ", 5U) == 0)
+        {
+            actual = (uint32_t)strtoul(&line[5], NULL, 10);
+            break;
+        }
+        if ((strncmp(line, "RANGE ", 6U) == 0) || (strcmp(line, "ERR") == 0))
+        {
+            return 0U;
+        }
+    }
+    if ((actual == 0U) || (hostSerialSetBaud(fd, actual) != 0))
+    {
+        return 0U;
+    }
+
+    crcctlSleepMs(CRCCTL_SETTLE_MS);
+    hostSerialFlushInput(fd);
+    for (i = 0U; i < CRCCTL_PATTERN_LEN; i++)
+    {
+        pattern[i] = crcctlPatternByte(i);
+    }
+    hostSerialWrite(fd, pattern, sizeof(pattern));
+
+    if ((hostSerialRead(fd, echo, sizeof(echo), CRCCTL_VERIFY_MS + 200U) == sizeof(echo))
+     && (memcmp(echo, pattern, sizeof(echo)) == 0))
+    {
+        memset(ack, CRCCTL_ACK, sizeof(ack));
+        hostSerialWrite(fd, ack, sizeof(ack));
+        if ((hostSerialReadLine(fd, line, sizeof(line), CRCCTL_VERIFY_MS) >= 0)
+         && (strcmp(line, "OK") == 0))
+        {
+            return actual;
+        }
+    }
+
+    /* The board reverts after its timeout and answers ERR on the old rate */
+    hostSerialSetBaud(fd, baud);
+    hostSerialFlushInput(fd);
+    while (hostSerialReadLine(fd, line, sizeof(line), CRCCTL_VERIFY_MS + CRCCTL_REVERT_MS + 1000U) >= 0)
+    {
+        if (strcmp(line, "ERR") == 0)
+        {
+            break;
+        }
+    }
+    return 0U;
+}
+
+/**
+ * @brief  The board's divider computation (baudPlan() in baud.c).
+ * @return Rate the divider gives, 0 if out of range or too far off.
+ */
+static uint32_t crcctlPlan(uint32_t rate, int *errorPerMille)
+{
+    uint32_t divisor;
+    uint32_t actual;
+
+    if ((rate == 0U) || (rate > (CRCCTL_VCLK_HZ / 16U)))
+    {
+        return 0U;
+    }
+    divisor = (CRCCTL_VCLK_HZ + (8U * rate)) / (16U * rate);
+    actual = CRCCTL_VCLK_HZ / (16U * divisor);
+    *errorPerMille = (int)((((int64_t)actual - (int64_t)rate) * 1000) / (int64_t)rate);
+    if ((*errorPerMille > CRCCTL_MAX_ERROR) || (*errorPerMille < -CRCCTL_MAX_ERROR))
+    {
+        return 0U;
+    }
+    return actual;
+}
+
+/**
+ * @brief  Verification pattern, as baudPatternByte() on the board.
+ */
+static uint8_t crcctlPatternByte(uint32_t index)
+{
+    return (uint8_t)((index * 37U) ^ 0x55U);
+}
+
+static void crcctlSleepMs(uint32_t ms)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t)(ms / 1000U);
+    ts.tv_nsec = (long)(ms % 1000U) * 1000000L;
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * @brief  Time len bytes take on the line, 11 bits per byte (8N2).
+ */
+static uint32_t crcctlLineMs(uint64_t len, uint32_t baud)
+{
+    return (uint32_t)((len * 11U * 1000U) / ((baud != 0U) ? baud : 1U));
+}
@@ -0,0 +1,326 @@
+/**
+ ******************************************************************************
+ * @file    crcsum.c
+ * @brief   Expected CRC32 of Large Files on All Cores
+ *
+ * @details
+ *   - Maps the file and splits it into units of about CRCSUM_UNIT bytes
+ *     that worker threads take in turn; each unit's CRC32 is computed
+ *     with hostCrc32() and the units are joined in order with
+ *     hostCrc32Combine(), so the result is calc_crc32() of the file.
+ *   - -l writes the CRC32 of every block of -B bytes in the board's
+ *     manifest format ("Manifest: <n> blocks of <len> bytes", eight
+ *     per line), to compare with the report of ESC manifest <len>.
+ *     Units are whole blocks, so the block CRCs are computed once and
+ *     combined into the unit's.
+ *   - Prints the rate and how many times the fastest line
+ *     (CRCSUM_LINE_BAUD, 10 bits per byte) it is. -s runs the file again
+ *     with 1, 2, 4, ... threads up to -j and reports the scaling.
+ *
+ * @note
+ *   - Usage: crcsum [-j threads] [-B block] [-l list|-] [-s] <file>.
+ *     Default one thread per online CPU, 4096-byte blocks.
+ *   - -s times the page cache, not the disk: the first run reads the
+ *     file in, the scaling runs find it there.
+ ******************************************************************************
+ */
+#include "host_crc32.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define CRCSUM_UNIT             (8UL * 1024UL * 1024UL)
+#define CRCSUM_BLOCK            4096UL
+#define CRCSUM_MAX_THREADS      256U
+/* Fastest SCI rate, uart-crc32-dma/include/baud.h */
+#define CRCSUM_LINE_BAUD        4687500U
+#define CRCSUM_PER_LINE         8UL
+
+typedef struct
+{
+    const uint8_t *data;
+    size_t size;
+    size_t unit;
+    size_t units;
+    size_t block;
+    uint32_t blockOp;
+    uint32_t *unitCrc;
+    uint32_t *blockCrc;
+    size_t next;
+    pthread_mutex_t lock;
+} crcsumJob_t;
+
+static void crcsumUsage(void);
+static double crcsumRun(crcsumJob_t *job, unsigned threads, uint32_t *crc);
+static void *crcsumWorker(void *arg);
+static int crcsumList(const char *path, const crcsumJob_t *job);
+
+static double crcsumNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+int main(int argc, char **argv)
+{
+    crcsumJob_t job;
+    struct stat st;
+    const char *list = NULL;
+    unsigned threads = (unsigned)sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned n;
+    int scaling = 0;
+    int fd;
+    int opt;
+    int rc = 0;
+    double t, t1;
+    uint32_t crc;
+    void *map = NULL;
+
+    memset(&job, 0, sizeof(job));
+    job.block = CRCSUM_BLOCK;
+    while ((opt = getopt(argc, argv, "j:B:l:s")) != -1)
+    {
+        if (opt == 'j')
+        {
+            threads = (unsigned)strtoul(optarg, NULL, 0);
+        }
+        else if (opt == 'B')
+        {
+            job.block = (size_t)strtoul(optarg, NULL, 0);
+        }
+        else if (opt == 'l')
+        {
+            list = optarg;
+        }
+        else if (opt == 's')
+        {
+            scaling = 1;
+        }
+        else
+        {
+            crcsumUsage();
+            return 2;
+        }
+    }
+    if ((optind + 1 != argc) || (job.block == 0U))
+    {
+        crcsumUsage();
+        return 2;
+    }
+    threads = (threads == 0U) ? 1U : ((threads > CRCSUM_MAX_THREADS) ? CRCSUM_MAX_THREADS : threads);
+
+    fd = open(argv[optind], O_RDONLY);
+    if ((fd < 0) || (fstat(fd, &st) != 0) || !S_ISREG(st.st_mode))
+    {
+        fprintf(stderr, "%s: %s\n", argv[optind], (fd < 0) ? strerror(errno) : "not a regular file");
+        return 1;
+    }
+    job.size = (size_t)st.st_size;
+    if (job.size > 0U)
+    {
+        map = mmap(NULL, job.size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED)
+        {
+            perror(argv[optind]);
+            close(fd);
+            return 1;
+        }
+        (void)madvise(map, job.size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+
+    job.data = (const uint8_t *)map;
+    job.unit = ((CRCSUM_UNIT + job.block - 1U) / job.block) * job.block;
+    job.units = (job.size + job.unit - 1U) / job.unit;
+    job.blockOp = hostCrc32CombineGen(job.block);
+    job.unitCrc = malloc((job.units + 1U) * sizeof(uint32_t));
+    if (list != NULL)
+    {
+        job.blockCrc = malloc((((job.size + job.block - 1U) / job.block) + 1U) * sizeof(uint32_t));
+    }
+    if ((job.unitCrc == NULL) || ((list != NULL) && (job.blockCrc == NULL)))
+    {
+        perror("crcsum");
+        return 1;
+    }
+    pthread_mutex_init(&job.lock, NULL);
+
+    t = crcsumRun(&job, threads, &crc);
+    printf("%s: crc32 0x%08lX, %lu bytes, %u threads (%s), %.3f s, %.2f GB/s, %.0fx the line at %u baud\n",
+           argv[optind], (unsigned long)crc, (unsigned long)job.size, threads,
+           hostCrc32Name(hostCrc32Active()), t, (double)job.size / t / 1e9,
+           (double)job.size / t / ((double)CRCSUM_LINE_BAUD / 10.0), CRCSUM_LINE_BAUD);
+    if (list != NULL)
+    {
+        rc = crcsumList(list, &job);
+    }
+
+    if (scaling != 0)
+    {
+        printf("threads   GB/s  speedup  efficiency\n");
+        t1 = 0.0;
+        for (n = 1U; n <= threads; n = ((n * 2U) > threads) && (n < threads) ? threads : (n * 2U))
+        {
+            t = crcsumRun(&job, n, &crc);
+            t1 = (n == 1U) ? t : t1;
+            printf("%7u %7.2f %7.2fx %9.0f %%\n", n, (double)job.size / t / 1e9, t1 / t,
+                   (t1 / t) * 100.0 / (double)n);
+        }
+    }
+
+    pthread_mutex_destroy(&job.lock);
+    free(job.unitCrc);
+    free(job.blockCrc);
+    if (map != NULL)
+    {
+        munmap(map, job.size);
+    }
+    return rc;
+}
+
+static void crcsumUsage(void)
+{
+    fprintf(stderr,
+            "usage: crcsum [-j threads] [-B block] [-l list] [-s] <file>\n"
+            "  -j  worker threads (default: online CPUs)\n"
+            "  -B  block length of the list (default %lu)\n"
+            "  -l  write the block CRC32s as a board manifest, - for stdout\n"
+            "  -s  report the scaling from 1 thread to -j\n",
+            CRCSUM_BLOCK);
+}
+
+/**
+ * @brief  One pass over the file on a number of threads.
+ * @param  crc  CRC32 of the file.
+ * @return Wall time in seconds.
+ */
+static double crcsumRun(crcsumJob_t *job, unsigned threads, uint32_t *crc)
+{
+    pthread_t tid[CRCSUM_MAX_THREADS];
+    double t0 = crcsumNow();
+    uint32_t unitOp = hostCrc32CombineGen(job->unit);
+    unsigned started = 0U;
+    unsigned i;
+    size_t u;
+
+    job->next = 0U;
+    for (i = 1U; i < threads; i++)
+    {
+        if (pthread_create(&tid[started], NULL, &crcsumWorker, job) == 0)
+        {
+            started++;
+        }
+    }
+    /* The calling thread works too, and alone if no thread started */
+    (void)crcsumWorker(job);
+    for (i = 0U; i < started; i++)
+    {
+        pthread_join(tid[i], NULL);
+    }
+
+    *crc = 0U;
+    for (u = 0U; u < job->units; u++)
+    {
+        if (u == 0U)
+        {
+            *crc = job->unitCrc[0];
+        }
+        else if (u + 1U < job->units)
+        {
+            *crc = hostCrc32CombineOp(*crc, job->unitCrc[u], unitOp);
+        }
+        else
+        {
+            *crc = hostCrc32Combine(*crc, job->unitCrc[u], job->size - (u * job->unit));
+        }
+    }
+    return crcsumNow() - t0;
+}
+
+/**
+ * @brief  Worker: takes units until none is left.
+ */
+static void *crcsumWorker(void *arg)
+{
+    crcsumJob_t *job = (crcsumJob_t *)arg;
+    const uint8_t *p;
+    size_t u, off, len, b, blen;
+    uint32_t crc, c;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&job->lock);
+        u = job->next++;
+        pthread_mutex_unlock(&job->lock);
+        if (u >= job->units)
+        {
+            break;
+        }
+        off = u * job->unit;
+        len = ((job->size - off) < job->unit) ? (job->size - off) : job->unit;
+        p = &job->data[off];
+        if (job->blockCrc == NULL)
+        {
+            job->unitCrc[u] = hostCrc32(0U, p, len);
+            continue;
+        }
+
+        crc = 0U;
+        for (b = 0U; b < len; b += blen)
+        {
+            blen = ((len - b) < job->block) ? (len - b) : job->block;
+            c = hostCrc32(0U, &p[b], blen);
+            job->blockCrc[(off + b) / job->block] = c;
+            if (b == 0U)
+            {
+                crc = c;
+            }
+            else if (blen == job->block)
+            {
+                crc = hostCrc32CombineOp(crc, c, job->blockOp);
+            }
+            else
+            {
+                crc = hostCrc32Combine(crc, c, blen);
+            }
+        }
+        job->unitCrc[u] = crc;
+    }
+    return NULL;
+}
+
+/**
+ * @brief  Writes the block CRC32s in the board's manifest format.
+ * @return 0 on success.
+ */
+static int crcsumList(const char *path, const crcsumJob_t *job)
+{
+    FILE *f = (strcmp(path, "-") == 0) ? stdout : fopen(path, "w");
+    unsigned long count = (unsigned long)((job->size + job->block - 1U) / job->block);
+    unsigned long i;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return 1;
+    }
+    fprintf(f, "Manifest: %lu blocks of %lu bytes\n", count, (unsigned long)job->block);
+    for (i = 0UL; i < count; i++)
+    {
+        fprintf(f, "%s%08lX", ((i % CRCSUM_PER_LINE) == 0UL) ? "" : " ", (unsigned long)job->blockCrc[i]);
+        if ((((i + 1UL) % CRCSUM_PER_LINE) == 0UL) || ((i + 1UL) == count))
+        {
+            fprintf(f, "\n");
+        }
+    }
+    return ((f != stdout) && (fclose(f) != 0)) ? 1 : 0;
+}
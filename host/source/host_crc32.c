@@ -0,0 +1,298 @@
+/**
+ ******************************************************************************
+ * @file    host_crc32.c
+ * @brief   Host CRC32: Dispatch and the Slice-by-16 Path
+ *
+ * @details
+ *   - Slice-by-16: sixteen 256-entry tables, table k holding the CRC of a
+ *     byte followed by k zero bytes, so 16 input bytes take 16 lookups
+ *     and no dependency between them except the final XOR. Bytes are
+ *     read one by one, so the result does not depend on the host's byte
+ *     order or alignment.
+ *   - Combine: appending lenB bytes multiplies the CRC of the first span
+ *     by x^(8 lenB) mod P. The powers x^(2^k) mod P are tabled, so the
+ *     factor takes one multiplication per set bit of 8 lenB.
+ *   - The first call builds the tables and picks the path: vpclmul,
+ *     pclmul, armv8, slice16, the first the CPU supports, unless
+ *     HOST_CRC32 names another supported one.
+ ******************************************************************************
+ */
+#include "host_crc32.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__aarch64__) && defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif
+
+#define HOST_CRC32_POLY_REFL    0xEDB88320U
+#define HOST_CRC32_XOR          0xFFFFFFFFU
+#define HOST_CRC32_SLICES       16U
+
+/* x^(2^k) mod P, reflected */
+#define HOST_CRC32_X2N          64U
+/* x^0 and x^1 mod P, reflected */
+#define HOST_CRC32_ONE          0x80000000U
+#define HOST_CRC32_X1           0x40000000U
+
+static uint32_t s_table[HOST_CRC32_SLICES][256];
+static uint32_t s_x2n[HOST_CRC32_X2N];
+static hostCrc32Path_t s_active = HOST_CRC32_SLICE16;
+static pthread_once_t s_once = PTHREAD_ONCE_INIT;
+
+static const char * const s_name[HOST_CRC32_PATHS] =
+{
+    "slice16", "pclmul", "vpclmul", "armv8"
+};
+
+static void hostCrc32Setup(void);
+static uint32_t hostCrc32MulModP(uint32_t a, uint32_t b);
+
+/**
+ * @brief  CRC32 of a buffer on the active path.
+ * @param  crc   0 to start, or the result over the preceding data.
+ * @return CRC32 over everything so far, as calc_crc32().
+ */
+uint32_t hostCrc32(uint32_t crc, const void *data, size_t len)
+{
+    (void)pthread_once(&s_once, &hostCrc32Setup);
+    return hostCrc32With(s_active, crc, data, len);
+}
+
+/**
+ * @brief  CRC32 of a buffer on one path. An unsupported path runs
+ *         slice16.
+ */
+uint32_t hostCrc32With(hostCrc32Path_t path, uint32_t crc, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t state = crc ^ HOST_CRC32_XOR;
+
+    (void)pthread_once(&s_once, &hostCrc32Setup);
+    if (hostCrc32Supported(path) == 0)
+    {
+        path = HOST_CRC32_SLICE16;
+    }
+    switch (path)
+    {
+#if defined(__x86_64__) || defined(__i386__)
+    case HOST_CRC32_PCLMUL:
+        state = hostCrc32Pclmul(state, p, len);
+        break;
+    case HOST_CRC32_VPCLMUL:
+        state = hostCrc32Vpclmul(state, p, len);
+        break;
+#endif
+#if defined(__aarch64__)
+    case HOST_CRC32_ARMV8:
+        state = hostCrc32Armv8(state, p, len);
+        break;
+#endif
+    default:
+        state = hostCrc32Slice16(state, p, len);
+        break;
+    }
+    return state ^ HOST_CRC32_XOR;
+}
+
+/**
+ * @brief  Non-zero if this build and CPU can run a path.
+ */
+int hostCrc32Supported(hostCrc32Path_t path)
+{
+    int ok = 0;
+
+    if (path == HOST_CRC32_SLICE16)
+    {
+        ok = 1;
+    }
+#if defined(__x86_64__) || defined(__i386__)
+    else if (path == HOST_CRC32_PCLMUL)
+    {
+        ok = __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("pclmul");
+    }
+    else if (path == HOST_CRC32_VPCLMUL)
+    {
+        ok = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl")
+          && __builtin_cpu_supports("vpclmulqdq") && __builtin_cpu_supports("pclmul");
+    }
+#endif
+#if defined(__aarch64__)
+    else if (path == HOST_CRC32_ARMV8)
+    {
+#if defined(__linux__)
+        ok = ((getauxval(AT_HWCAP) & HWCAP_CRC32) != 0UL) ? 1 : 0;
+#else
+        /* Every Apple aarch64 core has them */
+        ok = 1;
+#endif
+    }
+#endif
+    else
+    {
+        /* Do Nothing */
+    }
+    return ok;
+}
+
+/**
+ * @brief  Path hostCrc32() uses.
+ */
+hostCrc32Path_t hostCrc32Active(void)
+{
+    (void)pthread_once(&s_once, &hostCrc32Setup);
+    return s_active;
+}
+
+const char *hostCrc32Name(hostCrc32Path_t path)
+{
+    return ((uint32_t)path < (uint32_t)HOST_CRC32_PATHS) ? s_name[path] : "?";
+}
+
+/**
+ * @brief  CRC32 of span A followed by span B, from the CRC of each.
+ * @param  lenB  Length of span B in bytes.
+ */
+uint32_t hostCrc32Combine(uint32_t crcA, uint32_t crcB, uint64_t lenB)
+{
+    return hostCrc32CombineOp(crcA, crcB, hostCrc32CombineGen(lenB));
+}
+
+/**
+ * @brief  Operator for hostCrc32CombineOp(): x^(8 lenB) mod P.
+ */
+uint32_t hostCrc32CombineGen(uint64_t lenB)
+{
+    uint32_t p = HOST_CRC32_ONE;
+    uint32_t k = 3U;
+
+    (void)pthread_once(&s_once, &hostCrc32Setup);
+    while (lenB != 0U)
+    {
+        if ((lenB & 1U) != 0U)
+        {
+            p = hostCrc32MulModP(s_x2n[k % HOST_CRC32_X2N], p);
+        }
+        lenB >>= 1;
+        k++;
+    }
+    return p;
+}
+
+/**
+ * @brief  hostCrc32Combine() with the operator of span B's length.
+ */
+uint32_t hostCrc32CombineOp(uint32_t crcA, uint32_t crcB, uint32_t op)
+{
+    return hostCrc32MulModP(op, crcA) ^ crcB;
+}
+
+/**
+ * @brief  Slice-by-16 on the raw state.
+ */
+uint32_t hostCrc32Slice16(uint32_t state, const uint8_t *data, size_t len)
+{
+    const uint32_t (*t)[256] = (const uint32_t (*)[256])s_table;
+    uint32_t a;
+
+    (void)pthread_once(&s_once, &hostCrc32Setup);
+    while (len >= HOST_CRC32_SLICES)
+    {
+        a = state ^ ((uint32_t)data[0] | ((uint32_t)data[1] << 8)
+                  | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24));
+        state = t[15][a & 0xFFU] ^ t[14][(a >> 8) & 0xFFU]
+              ^ t[13][(a >> 16) & 0xFFU] ^ t[12][a >> 24]
+              ^ t[11][data[4]] ^ t[10][data[5]] ^ t[9][data[6]] ^ t[8][data[7]]
+              ^ t[7][data[8]] ^ t[6][data[9]] ^ t[5][data[10]] ^ t[4][data[11]]
+              ^ t[3][data[12]] ^ t[2][data[13]] ^ t[1][data[14]] ^ t[0][data[15]];
+        data += HOST_CRC32_SLICES;
+        len -= HOST_CRC32_SLICES;
+    }
+    while (len > 0U)
+    {
+        state = t[0][(state ^ *data) & 0xFFU] ^ (state >> 8);
+        data++;
+        len--;
+    }
+    return state;
+}
+
+/**
+ * @brief  Builds the tables and picks the path, once.
+ */
+static void hostCrc32Setup(void)
+{
+    const char *env = getenv("HOST_CRC32");
+    uint32_t i, k, c;
+    int p;
+
+    for (i = 0U; i < 256U; i++)
+    {
+        c = i;
+        for (k = 0U; k < 8U; k++)
+        {
+            c = (c >> 1) ^ (((c & 1U) != 0U) ? HOST_CRC32_POLY_REFL : 0U);
+        }
+        s_table[0][i] = c;
+    }
+    for (k = 1U; k < HOST_CRC32_SLICES; k++)
+    {
+        for (i = 0U; i < 256U; i++)
+        {
+            c = s_table[k - 1U][i];
+            s_table[k][i] = (c >> 8) ^ s_table[0][c & 0xFFU];
+        }
+    }
+
+    s_x2n[0] = HOST_CRC32_X1;
+    for (k = 1U; k < HOST_CRC32_X2N; k++)
+    {
+        s_x2n[k] = hostCrc32MulModP(s_x2n[k - 1U], s_x2n[k - 1U]);
+    }
+
+    s_active = HOST_CRC32_SLICE16;
+    if (hostCrc32Supported(HOST_CRC32_ARMV8) != 0)
+    {
+        s_active = HOST_CRC32_ARMV8;
+    }
+    if (hostCrc32Supported(HOST_CRC32_PCLMUL) != 0)
+    {
+        s_active = HOST_CRC32_PCLMUL;
+    }
+    if (hostCrc32Supported(HOST_CRC32_VPCLMUL) != 0)
+    {
+        s_active = HOST_CRC32_VPCLMUL;
+    }
+    for (p = 0; (env != NULL) && (p < (int)HOST_CRC32_PATHS); p++)
+    {
+        if ((strcmp(env, s_name[p]) == 0) && (hostCrc32Supported((hostCrc32Path_t)p) != 0))
+        {
+            s_active = (hostCrc32Path_t)p;
+        }
+    }
+}
+
+/**
+ * @brief  a * b mod P, both reflected.
+ */
+static uint32_t hostCrc32MulModP(uint32_t a, uint32_t b)
+{
+    uint32_t m = HOST_CRC32_ONE;
+    uint32_t p = 0U;
+
+    while (m != 0U)
+    {
+        if ((a & m) != 0U)
+        {
+            p ^= b;
+            if ((a & (m - 1U)) == 0U)
+            {
+                break;
+            }
+        }
+        m >>= 1;
+        b = (b >> 1) ^ (((b & 1U) != 0U) ? HOST_CRC32_POLY_REFL : 0U);
+    }
+    return p;
+}
@@ -0,0 +1,53 @@
+/**
+ ******************************************************************************
+ * @file    host_crc32_arm.c
+ * @brief   Host CRC32: aarch64 CRC32 Instructions
+ *
+ * @details
+ *   - CRC32B and CRC32X (not the CRC32C forms) use the boards'
+ *     polynomial, reflected, on the raw state, so they drop straight in.
+ *   - Bytes up to an 8-byte boundary, then 8 bytes per instruction, then
+ *     the rest by byte.
+ *
+ * @note
+ *   - The target attribute enables the instructions for this function
+ *     only; host_crc32.c calls it only when HWCAP_CRC32 is set.
+ ******************************************************************************
+ */
+#if defined(__aarch64__)
+
+#include "host_crc32.h"
+#include <arm_acle.h>
+#include <string.h>
+
+/**
+ * @brief  ARMv8 CRC32 path on the raw state.
+ */
+__attribute__((target("+crc")))
+uint32_t hostCrc32Armv8(uint32_t state, const uint8_t *data, size_t len)
+{
+    uint64_t word;
+
+    while ((len > 0U) && (((uintptr_t)data & 7U) != 0U))
+    {
+        state = __crc32b(state, *data);
+        data++;
+        len--;
+    }
+    while (len >= 8U)
+    {
+        memcpy(&word, data, sizeof(word));
+        state = __crc32d(state, word);
+        data += 8U;
+        len -= 8U;
+    }
+    while (len > 0U)
+    {
+        state = __crc32b(state, *data);
+        data++;
+        len--;
+    }
+    return state;
+}
+
+#endif /* __aarch64__ */
@@ -0,0 +1,209 @@
+/**
+ ******************************************************************************
+ * @file    host_crc32_x86.c
+ * @brief   Host CRC32: x86 Carry-Less Multiply Folding (PCLMULQDQ, VPCLMULQDQ)
+ *
+ * @details
+ *   - Folding: a 128-bit block A at distance D bits ahead of block B
+ *     contributes A * x^D to it, so A.lo * (x^(D+32) mod P) XOR
+ *     A.hi * (x^(D-32) mod P) folded into B keeps the CRC (bit-reflected,
+ *     constants shifted left by one). Four independent accumulators hide
+ *     the multiplier latency, as in Intel's "Fast CRC Computation for
+ *     Generic Polynomials Using PCLMULQDQ" and the Linux crc32-pclmul.
+ *   - pclmul: 4 x 16 bytes per step (D = 512), folded to one block
+ *     (D = 128), reduced 128 -> 64 -> 32 bits and by Barrett.
+ *   - vpclmul: 4 x 64 bytes per step (D = 2048), folded to one zmm
+ *     (D = 512), its four lanes to one block (D = 384, 256, 128), then
+ *     the pclmul tail.
+ *   - Whole 16-byte blocks go through the folding; the remaining bytes
+ *     and buffers too short for one step through slice16.
+ *
+ * @note
+ *   - Each kernel carries its own target attribute, so the file builds
+ *     without -m flags; host_crc32.c calls them only on CPUs that
+ *     support them.
+ ******************************************************************************
+ */
+#if defined(__x86_64__) || defined(__i386__)
+
+#include "host_crc32.h"
+#include <immintrin.h>
+
+#define HOST_CRC32_PCLMUL_TARGET    __attribute__((target("sse4.1,pclmul")))
+#define HOST_CRC32_VPCLMUL_TARGET   __attribute__((target("sse4.1,pclmul,avx512f,avx512vl,vpclmulqdq")))
+
+/* Fold constants, {x^(D+32) mod P, x^(D-32) mod P} reflected, << 1 */
+#define HOST_CRC32_K2048_LO     0x011542778AULL
+#define HOST_CRC32_K2048_HI     0x01322D1430ULL
+#define HOST_CRC32_K512_LO      0x0154442BD4ULL
+#define HOST_CRC32_K512_HI      0x01C6E41596ULL
+#define HOST_CRC32_K384_LO      0x003DB1ECDCULL
+#define HOST_CRC32_K384_HI      0x0174359406ULL
+#define HOST_CRC32_K256_LO      0x00F1DA05AAULL
+#define HOST_CRC32_K256_HI      0x015A546366ULL
+#define HOST_CRC32_K128_LO      0x01751997D0ULL
+#define HOST_CRC32_K128_HI      0x00CCAA009EULL
+/* 64 -> 32 bits, and Barrett: P' and floor(x^64 / P), reflected */
+#define HOST_CRC32_K64          0x0163CD6124ULL
+#define HOST_CRC32_POLY         0x01DB710641ULL
+#define HOST_CRC32_MU           0x01F7011641ULL
+
+#define HOST_CRC32_STEP         64U
+#define HOST_CRC32_ZSTEP        256U
+#define HOST_CRC32_BLOCK        16U
+
+HOST_CRC32_PCLMUL_TARGET
+static inline __m128i hostCrc32Fold(__m128i x, __m128i k)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+/**
+ * @brief  Folds the remaining whole blocks into x, then reduces it to
+ *         the raw state.
+ */
+HOST_CRC32_PCLMUL_TARGET
+static uint32_t hostCrc32Reduce(__m128i x, const uint8_t *data, size_t blocks)
+{
+    const __m128i mask32 = _mm_setr_epi32(-1, 0, 0, 0);
+    __m128i k = _mm_set_epi64x((long long)HOST_CRC32_K128_HI, (long long)HOST_CRC32_K128_LO);
+    __m128i t;
+
+    while (blocks > 0U)
+    {
+        x = _mm_xor_si128(hostCrc32Fold(x, k), _mm_loadu_si128((const __m128i *)data));
+        data += HOST_CRC32_BLOCK;
+        blocks--;
+    }
+
+    /* 128 -> 64 bits */
+    t = _mm_clmulepi64_si128(x, k, 0x10);
+    x = _mm_xor_si128(_mm_srli_si128(x, 8), t);
+
+    /* 64 -> 32 bits */
+    k = _mm_set_epi64x(0, (long long)HOST_CRC32_K64);
+    t = _mm_srli_si128(x, 4);
+    x = _mm_clmulepi64_si128(_mm_and_si128(x, mask32), k, 0x00);
+    x = _mm_xor_si128(x, t);
+
+    /* Barrett */
+    k = _mm_set_epi64x((long long)HOST_CRC32_MU, (long long)HOST_CRC32_POLY);
+    t = x;
+    x = _mm_clmulepi64_si128(_mm_and_si128(x, mask32), k, 0x10);
+    x = _mm_clmulepi64_si128(_mm_and_si128(x, mask32), k, 0x00);
+    x = _mm_xor_si128(x, t);
+    return (uint32_t)_mm_extract_epi32(x, 1);
+}
+
+/**
+ * @brief  PCLMULQDQ path on the raw state.
+ */
+HOST_CRC32_PCLMUL_TARGET
+uint32_t hostCrc32Pclmul(uint32_t state, const uint8_t *data, size_t len)
+{
+    __m128i x0, x1, x2, x3, k;
+    size_t n;
+
+    if (len < HOST_CRC32_STEP)
+    {
+        return hostCrc32Slice16(state, data, len);
+    }
+    x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)data), _mm_cvtsi32_si128((int)state));
+    x1 = _mm_loadu_si128((const __m128i *)(data + 16));
+    x2 = _mm_loadu_si128((const __m128i *)(data + 32));
+    x3 = _mm_loadu_si128((const __m128i *)(data + 48));
+    data += HOST_CRC32_STEP;
+    n = len - HOST_CRC32_STEP;
+
+    k = _mm_set_epi64x((long long)HOST_CRC32_K512_HI, (long long)HOST_CRC32_K512_LO);
+    while (n >= HOST_CRC32_STEP)
+    {
+        x0 = _mm_xor_si128(hostCrc32Fold(x0, k), _mm_loadu_si128((const __m128i *)data));
+        x1 = _mm_xor_si128(hostCrc32Fold(x1, k), _mm_loadu_si128((const __m128i *)(data + 16)));
+        x2 = _mm_xor_si128(hostCrc32Fold(x2, k), _mm_loadu_si128((const __m128i *)(data + 32)));
+        x3 = _mm_xor_si128(hostCrc32Fold(x3, k), _mm_loadu_si128((const __m128i *)(data + 48)));
+        data += HOST_CRC32_STEP;
+        n -= HOST_CRC32_STEP;
+    }
+
+    k = _mm_set_epi64x((long long)HOST_CRC32_K128_HI, (long long)HOST_CRC32_K128_LO);
+    x0 = _mm_xor_si128(hostCrc32Fold(x0, k), x1);
+    x0 = _mm_xor_si128(hostCrc32Fold(x0, k), x2);
+    x0 = _mm_xor_si128(hostCrc32Fold(x0, k), x3);
+
+    state = hostCrc32Reduce(x0, data, n / HOST_CRC32_BLOCK);
+    data += n & ~(size_t)(HOST_CRC32_BLOCK - 1U);
+    return hostCrc32Slice16(state, data, n & (HOST_CRC32_BLOCK - 1U));
+}
+
+HOST_CRC32_VPCLMUL_TARGET
+static inline __m512i hostCrc32FoldZ(__m512i z, __m512i k, __m512i next)
+{
+    /* 0x96: three-way XOR */
+    return _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(z, k, 0x00),
+                                     _mm512_clmulepi64_epi128(z, k, 0x11), next, 0x96);
+}
+
+/**
+ * @brief  VPCLMULQDQ path on the raw state.
+ */
+HOST_CRC32_VPCLMUL_TARGET
+uint32_t hostCrc32Vpclmul(uint32_t state, const uint8_t *data, size_t len)
+{
+    __m512i z0, z1, z2, z3, k;
+    __m128i x;
+    size_t n;
+
+    if (len < HOST_CRC32_ZSTEP)
+    {
+        return hostCrc32Pclmul(state, data, len);
+    }
+    z0 = _mm512_loadu_si512((const void *)data);
+    z0 = _mm512_xor_si512(z0, _mm512_zextsi128_si512(_mm_cvtsi32_si128((int)state)));
+    z1 = _mm512_loadu_si512((const void *)(data + 64));
+    z2 = _mm512_loadu_si512((const void *)(data + 128));
+    z3 = _mm512_loadu_si512((const void *)(data + 192));
+    data += HOST_CRC32_ZSTEP;
+    n = len - HOST_CRC32_ZSTEP;
+
+    k = _mm512_broadcast_i32x4(_mm_set_epi64x((long long)HOST_CRC32_K2048_HI,
+                                              (long long)HOST_CRC32_K2048_LO));
+    while (n >= HOST_CRC32_ZSTEP)
+    {
+        z0 = hostCrc32FoldZ(z0, k, _mm512_loadu_si512((const void *)data));
+        z1 = hostCrc32FoldZ(z1, k, _mm512_loadu_si512((const void *)(data + 64)));
+        z2 = hostCrc32FoldZ(z2, k, _mm512_loadu_si512((const void *)(data + 128)));
+        z3 = hostCrc32FoldZ(z3, k, _mm512_loadu_si512((const void *)(data + 192)));
+        data += HOST_CRC32_ZSTEP;
+        n -= HOST_CRC32_ZSTEP;
+    }
+
+    k = _mm512_broadcast_i32x4(_mm_set_epi64x((long long)HOST_CRC32_K512_HI,
+                                              (long long)HOST_CRC32_K512_LO));
+    z0 = hostCrc32FoldZ(z0, k, z1);
+    z0 = hostCrc32FoldZ(z0, k, z2);
+    z0 = hostCrc32FoldZ(z0, k, z3);
+    while (n >= HOST_CRC32_STEP)
+    {
+        z0 = hostCrc32FoldZ(z0, k, _mm512_loadu_si512((const void *)data));
+        data += HOST_CRC32_STEP;
+        n -= HOST_CRC32_STEP;
+    }
+
+    /* Lanes 0..2 are 384, 256 and 128 bits ahead of lane 3 */
+    k = _mm512_set_epi64(0, 0,
+                         (long long)HOST_CRC32_K128_HI, (long long)HOST_CRC32_K128_LO,
+                         (long long)HOST_CRC32_K256_HI, (long long)HOST_CRC32_K256_LO,
+                         (long long)HOST_CRC32_K384_HI, (long long)HOST_CRC32_K384_LO);
+    z0 = _mm512_mask_xor_epi64(z0, 0x3FU,
+                               _mm512_clmulepi64_epi128(z0, k, 0x00),
+                               _mm512_clmulepi64_epi128(z0, k, 0x11));
+    x = _mm_xor_si128(_mm_xor_si128(_mm512_extracti32x4_epi32(z0, 0), _mm512_extracti32x4_epi32(z0, 1)),
+                      _mm_xor_si128(_mm512_extracti32x4_epi32(z0, 2), _mm512_extracti32x4_epi32(z0, 3)));
+
+    state = hostCrc32Reduce(x, data, n / HOST_CRC32_BLOCK);
+    data += n & ~(size_t)(HOST_CRC32_BLOCK - 1U);
+    return hostCrc32Slice16(state, data, n & (HOST_CRC32_BLOCK - 1U));
+}
+
+#endif /* __x86_64__ || __i386__ */
@@ -0,0 +1,270 @@
+/**
+ ******************************************************************************
+ * @file    host_serial.c
+ * @brief   POSIX Serial Port Access for the Host Tools
+ ******************************************************************************
+ */
+#include "host_serial.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct
+{
+    uint32_t baud;
+    speed_t speed;
+} hostSerialSpeed_t;
+
+static const hostSerialSpeed_t s_speeds[] =
+{
+    { 9600U, B9600 }, { 19200U, B19200 }, { 38400U, B38400 },
+    { 57600U, B57600 }, { 115200U, B115200 }, { 230400U, B230400 },
+#ifdef B460800
+    { 460800U, B460800 },
+#endif
+#ifdef B921600
+    { 921600U, B921600 },
+#endif
+#ifdef B1000000
+    { 1000000U, B1000000 },
+#endif
+#ifdef B2000000
+    { 2000000U, B2000000 },
+#endif
+#ifdef B3000000
+    { 3000000U, B3000000 },
+#endif
+#ifdef B4000000
+    { 4000000U, B4000000 },
+#endif
+};
+
+static uint64_t hostSerialNowMs(void);
+
+/**
+ * @brief  Opens a port in raw 8N2 mode.
+ * @return File descriptor, -1 on error.
+ */
+int hostSerialOpen(const char *path, uint32_t baud)
+{
+    struct termios tio;
+    int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+    if (tcgetattr(fd, &tio) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD | CSTOPB;
+    tio.c_cflag &= ~(PARENB | CRTSCTS);
+    tio.c_iflag &= ~(IXON | IXOFF | IXANY);
+    tio.c_cc[VMIN] = 0;
+    tio.c_cc[VTIME] = 0;
+    if (tcsetattr(fd, TCSANOW, &tio) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    if (hostSerialSetBaud(fd, baud) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    hostSerialFlushInput(fd);
+    return fd;
+}
+
+/**
+ * @brief  Changes the line rate, waiting for pending output first.
+ * @return 0 on success.
+ */
+int hostSerialSetBaud(int fd, uint32_t baud)
+{
+    struct termios tio;
+    size_t i;
+
+    hostSerialDrain(fd);
+    for (i = 0U; i < (sizeof(s_speeds) / sizeof(s_speeds[0])); i++)
+    {
+        if (s_speeds[i].baud == baud)
+        {
+            if ((tcgetattr(fd, &tio) != 0) || (cfsetspeed(&tio, s_speeds[i].speed) != 0))
+            {
+                return -1;
+            }
+            return tcsetattr(fd, TCSANOW, &tio);
+        }
+    }
+    return hostSerialSetCustomBaud(fd, baud);
+}
+
+/**
+ * @brief  Lets the board pause output: XON/XOFF received from it and/or
+ *         its RTS on the adapter's CTS input.
+ * @param  xonXoff  Non-zero to obey XON/XOFF (IXON).
+ * @param  rtsCts   Non-zero to obey CTS (CRTSCTS).
+ * @return 0 on success.
+ */
+int hostSerialSetFlow(int fd, int xonXoff, int rtsCts)
+{
+    struct termios tio;
+
+    if (tcgetattr(fd, &tio) != 0)
+    {
+        return -1;
+    }
+    tio.c_iflag &= ~(IXON | IXOFF | IXANY);
+    tio.c_cflag &= ~CRTSCTS;
+    if (xonXoff != 0)
+    {
+        tio.c_iflag |= IXON;
+    }
+    if (rtsCts != 0)
+    {
+        tio.c_cflag |= CRTSCTS;
+    }
+    return tcsetattr(fd, TCSANOW, &tio);
+}
+
+/**
+ * @brief  Writes all bytes.
+ * @return 0 on success.
+ */
+int hostSerialWrite(int fd, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    struct pollfd pfd;
+    ssize_t n;
+
+    while (len > 0U)
+    {
+        n = write(fd, p, len);
+        if (n > 0)
+        {
+            p += n;
+            len -= (size_t)n;
+        }
+        else if ((n < 0) && (errno != EAGAIN) && (errno != EINTR))
+        {
+            return -1;
+        }
+        else
+        {
+            pfd.fd = fd;
+            pfd.events = POLLOUT;
+            (void)poll(&pfd, 1, 100);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief  Reads up to len bytes, returning early only on timeout.
+ * @return Bytes read.
+ */
+size_t hostSerialRead(int fd, void *buf, size_t len, uint32_t timeoutMs)
+{
+    uint8_t *p = (uint8_t *)buf;
+    uint64_t end = hostSerialNowMs() + timeoutMs;
+    uint64_t now;
+    struct pollfd pfd;
+    size_t got = 0U;
+    ssize_t n;
+
+    while (got < len)
+    {
+        now = hostSerialNowMs();
+        if (now >= end)
+        {
+            break;
+        }
+        pfd.fd = fd;
+        pfd.events = POLLIN;
+        if (poll(&pfd, 1, (int)(end - now)) <= 0)
+        {
+            continue;
+        }
+        n = read(fd, &p[got], len - got);
+        if (n > 0)
+        {
+            got += (size_t)n;
+        }
+    }
+    return got;
+}
+
+/**
+ * @brief  Reads one line, without CR/LF. Empty lines are skipped.
+ * @return Line length, -1 on timeout.
+ */
+int hostSerialReadLine(int fd, char *line, size_t size, uint32_t timeoutMs)
+{
+    uint64_t end = hostSerialNowMs() + timeoutMs;
+    uint64_t now;
+    size_t len = 0U;
+    char c;
+
+    while (1)
+    {
+        now = hostSerialNowMs();
+        if ((now >= end) || (hostSerialRead(fd, &c, 1U, (uint32_t)(end - now)) == 0U))
+        {
+            return -1;
+        }
+        if ((c == '\r') || (c == '\n'))
+        {
+            if (len > 0U)
+            {
+                line[len] = '\0';
+                return (int)len;
+            }
+        }
+        else if (len < (size - 1U))
+        {
+            line[len] = c;
+            len++;
+        }
+        else
+        {
+            /* Too long, keep the start */
+        }
+    }
+}
+
+/**
+ * @brief  Discards received bytes not read yet.
+ */
+void hostSerialFlushInput(int fd)
+{
+    (void)tcflush(fd, TCIFLUSH);
+}
+
+/**
+ * @brief  Waits until everything written has been sent.
+ */
+void hostSerialDrain(int fd)
+{
+    (void)tcdrain(fd);
+}
+
+void hostSerialClose(int fd)
+{
+    (void)close(fd);
+}
+
+static uint64_t hostSerialNowMs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000U) + ((uint64_t)ts.tv_nsec / 1000000U);
+}
@@ -0,0 +1,54 @@
+/**
+ ******************************************************************************
+ * @file    host_serial_custom.c
+ * @brief   Non-Standard Line Rates
+ *
+ * @details
+ *   - Linux: termios2 with BOTHER. Kept apart from host_serial.c because
+ *     <asm/termbits.h> clashes with <termios.h>.
+ *   - macOS: IOSSIOSPEED.
+ *   - Elsewhere only the standard rates are available.
+ ******************************************************************************
+ */
+#include "host_serial.h"
+
+#if defined(__linux__)
+#include <asm/termbits.h>
+#include <sys/ioctl.h>
+
+int hostSerialSetCustomBaud(int fd, uint32_t baud)
+{
+    struct termios2 tio;
+
+    if (ioctl(fd, TCGETS2, &tio) != 0)
+    {
+        return -1;
+    }
+    tio.c_cflag &= ~CBAUD;
+    tio.c_cflag |= BOTHER;
+    tio.c_ispeed = baud;
+    tio.c_ospeed = baud;
+    return ioctl(fd, TCSETS2, &tio);
+}
+
+#elif defined(__APPLE__)
+#include <IOKit/serial/ioss.h>
+#include <sys/ioctl.h>
+
+int hostSerialSetCustomBaud(int fd, uint32_t baud)
+{
+    speed_t speed = (speed_t)baud;
+
+    return ioctl(fd, IOSSIOSPEED, &speed);
+}
+
+#else
+
+int hostSerialSetCustomBaud(int fd, uint32_t baud)
+{
+    (void)fd;
+    (void)baud;
+    return -1;
+}
+
+#endif
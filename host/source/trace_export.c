@@ -0,0 +1,197 @@
+/**
+ ******************************************************************************
+ * @file    trace_export.c
+ * @brief   Chrome Trace JSON from a Board Event Trace
+ *
+ * @details
+ *   - Event codes and sources as in uart-crc32-dma/include/trace.h.
+ *   - Tracks (tid): 1 interrupts, 2 main loop, 3 SCI transmit.
+ ******************************************************************************
+ */
+#include "trace_export.h"
+#include <stdlib.h>
+
+/* Board side, see uart-crc32-dma/include/trace.h */
+#define TRACE_ISR_ENTER         1U
+#define TRACE_ISR_EXIT          2U
+#define TRACE_DMA_BTC           3U
+#define TRACE_RING_PEAK         4U
+#define TRACE_SCI_ERROR         5U
+#define TRACE_CRC_BEGIN         6U
+#define TRACE_CRC_END           7U
+#define TRACE_WINDOW_END        8U
+#define TRACE_TX_BEGIN          9U
+#define TRACE_TX_END            10U
+#define TRACE_FLOW              11U
+#define TRACE_COMMAND           12U
+#define TRACE_SRC_RTI           0U
+
+#define TRACE_TID_ISR           1
+#define TRACE_TID_MAIN          2
+#define TRACE_TID_TX            3
+
+typedef struct
+{
+    uint64_t time;      /* Unwrapped counts */
+    uint32_t event;
+    uint32_t arg;
+    size_t order;       /* Position in the dump, keeps the sort stable */
+} traceEvent_t;
+
+static uint32_t traceWord(const uint8_t *p);
+static int traceCompare(const void *a, const void *b);
+static void traceEmit(FILE *out, const traceEvent_t *ev, double us);
+
+/**
+ * @brief  Writes the records as a Chrome trace JSON object.
+ * @param  out      Output stream.
+ * @param  records  count records of TRACE_EXPORT_RECORD_LEN bytes.
+ * @param  count    Number of records.
+ * @param  tickHz   Time stamp counts per second, from the dump header.
+ * @return 0 on success, -1 if out of memory or tickHz is 0.
+ */
+int traceExportChrome(FILE *out, const uint8_t *records, size_t count, uint32_t tickHz)
+{
+    traceEvent_t *events;
+    uint32_t prev = 0U;
+    uint32_t stamp;
+    uint32_t info;
+    uint64_t time = 0U;
+    size_t i;
+
+    if (tickHz == 0U)
+    {
+        return -1;
+    }
+    events = malloc(((count > 0U) ? count : 1U) * sizeof(traceEvent_t));
+    if (events == NULL)
+    {
+        return -1;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        stamp = traceWord(&records[i * TRACE_EXPORT_RECORD_LEN]);
+        info = traceWord(&records[(i * TRACE_EXPORT_RECORD_LEN) + 4U]);
+        /* Forward steps below half the range are elapsed time, anything
+         * else is a record stamped slightly before its predecessor */
+        if (i == 0U)
+        {
+            time = (uint64_t)1U << 32U;
+        }
+        else if ((uint32_t)(stamp - prev) < 0x80000000U)
+        {
+            time += (uint32_t)(stamp - prev);
+        }
+        else
+        {
+            time -= (uint32_t)(prev - stamp);
+        }
+        prev = stamp;
+        events[i].time = time;
+        events[i].event = info >> 24U;
+        events[i].arg = info & 0x00FFFFFFU;
+        events[i].order = i;
+    }
+    qsort(events, count, sizeof(traceEvent_t), traceCompare);
+
+    fprintf(out, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    fprintf(out, "{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\",\"args\":{\"name\":\"uart-crc32-dma\"}},\n");
+    fprintf(out, "{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":\"interrupts\"}},\n", TRACE_TID_ISR);
+    fprintf(out, "{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":\"main loop\"}},\n", TRACE_TID_MAIN);
+    fprintf(out, "{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":\"SCI3 transmit\"}}", TRACE_TID_TX);
+    for (i = 0U; i < count; i++)
+    {
+        traceEmit(out, &events[i], ((double)(events[i].time - events[0].time) * 1.0e6) / (double)tickHz);
+    }
+    fprintf(out, "\n]}\n");
+
+    free(events);
+    return 0;
+}
+
+/**
+ * @brief  Big-endian word.
+ */
+static uint32_t traceWord(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24U) | ((uint32_t)p[1] << 16U) | ((uint32_t)p[2] << 8U) | (uint32_t)p[3];
+}
+
+/**
+ * @brief  qsort() order: time, then position in the dump.
+ */
+static int traceCompare(const void *a, const void *b)
+{
+    const traceEvent_t *x = a;
+    const traceEvent_t *y = b;
+
+    if (x->time != y->time)
+    {
+        return (x->time < y->time) ? -1 : 1;
+    }
+    return (x->order < y->order) ? -1 : ((x->order > y->order) ? 1 : 0);
+}
+
+/**
+ * @brief  Writes one trace event, after the ones before it; unknown codes
+ *         are skipped.
+ * @param  us  Time since the first record in microseconds.
+ */
+static void traceEmit(FILE *out, const traceEvent_t *ev, double us)
+{
+    const char *sep = ",\n";
+
+    switch (ev->event)
+    {
+    case TRACE_ISR_ENTER:
+    case TRACE_ISR_EXIT:
+        fprintf(out, "%s{\"ph\":\"%s\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":\"%s\"}",
+                sep, (ev->event == TRACE_ISR_ENTER) ? "B" : "E", TRACE_TID_ISR, us,
+                (ev->arg == TRACE_SRC_RTI) ? "RTI tick" : "DMA BTC");
+        break;
+    case TRACE_DMA_BTC:
+        fprintf(out, "%s{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":\"ring wrap\",\"args\":{\"channel\":%u}}",
+                sep, TRACE_TID_ISR, us, (unsigned)ev->arg);
+        break;
+    case TRACE_RING_PEAK:
+        fprintf(out, "%s{\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"name\":\"ring backlog\",\"args\":{\"bytes\":%u}}",
+                sep, us, (unsigned)ev->arg);
+        break;
+    case TRACE_SCI_ERROR:
+        fprintf(out, "%s{\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":\"SCI error%s%s%s\"}",
+                sep, TRACE_TID_MAIN, us,
+                ((ev->arg & 2U) != 0U) ? " overrun" : "",
+                ((ev->arg & 4U) != 0U) ? " framing" : "",
+                ((ev->arg & 1U) != 0U) ? " parity" : "");
+        break;
+    case TRACE_CRC_BEGIN:
+        fprintf(out, "%s{\"ph\":\"B\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":\"checksum\",\"args\":{\"bytes\":%u}}",
+                sep, TRACE_TID_MAIN, us, (unsigned)ev->arg);
+        break;
+    case TRACE_CRC_END:
+    case TRACE_TX_END:
+        fprintf(out, "%s{\"ph\":\"E\",\"pid\":1,\"tid\":%d,\"ts\":%.3f}",
+                sep, (ev->event == TRACE_CRC_END) ? TRACE_TID_MAIN : TRACE_TID_TX, us);
+        break;
+    case TRACE_WINDOW_END:
+        fprintf(out, "%s{\"ph\":\"i\",\"s\":\"p\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":\"window\",\"args\":{\"bytes\":%u}}",
+                sep, TRACE_TID_MAIN, us, (unsigned)ev->arg);
+        break;
+    case TRACE_TX_BEGIN:
+        fprintf(out, "%s{\"ph\":\"B\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":\"transmit\",\"args\":{\"bytes\":%u}}",
+                sep, TRACE_TID_TX, us, (unsigned)ev->arg);
+        break;
+    case TRACE_FLOW:
+        fprintf(out, "%s{\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"name\":\"host stopped\",\"args\":{\"stopped\":%u}}",
+                sep, us, (unsigned)ev->arg);
+        break;
+    case TRACE_COMMAND:
+        fprintf(out, "%s{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"name\":\"command\",\"args\":{\"id\":%u}}",
+                sep, TRACE_TID_MAIN, us, (unsigned)ev->arg);
+        break;
+    default:
+        /* Not from this firmware version */
+        break;
+    }
+}
@@ -0,0 +1,49 @@
+/**
+ ******************************************************************************
+ * @file    ti_fee.h
+ * @brief   TI FEE Driver Interface of the Simulator Checkpoint Check
+ *
+ * @details
+ *   - Shadows the HALCoGen ti_fee.h for the ckpt binary (the Makefile puts
+ *     sim/include/fee first on its include path). The project's copy needs
+ *     the fee_cfg.h that HALCoGen only generates with the FEE driver
+ *     enabled; this one has the types and the functions
+ *     fee_checkpoint.c calls, with the same names and signatures, and
+ *     sim_fee.c implements them.
+ ******************************************************************************
+ */
+#ifndef TI_FEE_H
+#define TI_FEE_H
+
+#include "HL_sys_common.h"
+
+/* ti_fee_types.h */
+typedef enum
+{
+   UNINIT,
+   IDLE,
+   BUSY,
+   BUSY_INTERNAL
+}TI_FeeModuleStatusType;
+
+typedef enum
+{
+    JOB_OK,
+    JOB_FAILED,
+    JOB_PENDING,
+    JOB_CANCELLED,
+    BLOCK_INCONSISTENT,
+    BLOCK_INVALID
+}TI_FeeJobResultType;
+
+extern TI_FeeModuleStatusType TI_Fee_GetStatus(uint8 u8EEPIndex);
+extern void TI_Fee_Init(void);
+extern Std_ReturnType TI_Fee_Read(uint16 BlockNumber,
+                               uint16 BlockOffset,
+                               uint8* DataBufferPtr,
+                               uint16 Length);
+extern Std_ReturnType TI_Fee_WriteAsync(uint16 BlockNumber, uint8* DataBufferPtr);
+extern void TI_Fee_MainFunction(void);
+extern TI_FeeJobResultType TI_Fee_GetJobResult(uint8 u8EEPIndex);
+
+#endif /* TI_FEE_H */
@@ -0,0 +1,26 @@
+/**
+ ******************************************************************************
+ * @file    core_cfg.h
+ * @brief   Shared Core Configuration of the Simulator RX Check
+ *
+ * @details
+ *   - Shadows the firmware's core_cfg.h for the rx and window binaries
+ *     (the Makefile puts sim/include/rx first on their include path); the
+ *     board binary uses the firmware's own. The backend is set per binary by the Makefile
+ *     (-DCORE_RX_BACKEND=...); the default is the DMA ring.
+ *   - Reception on SCI3 in digital loopback, the only port with RX DMA.
+ ******************************************************************************
+ */
+#ifndef CORE_CFG_H_
+#define CORE_CFG_H_
+
+#ifndef CORE_RX_BACKEND
+#define CORE_RX_BACKEND         CORE_RX_DMA_RING
+#endif
+#define CORE_UART               sciREG3
+#define CORE_WINDOW_MODE        CORE_WINDOW_IDLE
+
+#define CORE_RX_RING_SIZE       4096U
+#define CORE_RX_DMA_CH          DMA_CH1
+
+#endif /* CORE_CFG_H_ */
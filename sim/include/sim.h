@@ -0,0 +1,240 @@
+/**
+ ******************************************************************************
+ * @file    sim.h
+ * @brief   Host Simulator of the TMS570LC43x Peripherals Used by the Firmware
+ *
+ * @details
+ *   - Firmware sources are compiled unchanged for the host. sim_hal.h is
+ *     force-included ahead of them and points sciREGx, dmaREG, dmaRAMREG,
+ *     crcREGx, rtiREG1 and emifREG at simulated register blocks and PTR
+ *     at the simulated SDRAM; the HALCoGen driver functions the
+ *     firmware calls are provided by the models.
+ *   - The models are brought up to date on every register access through
+ *     the base macros and on every driver call (simSync()), so firmware
+ *     polling loops see the line progress.
+ *   - Time is discrete-event by default: CPU time is charged from a cycle
+ *     cost model (sim_cost.c) and a firmware that only polls jumps to the
+ *     next scheduled event, so runs are deterministic and idle time is
+ *     free. SIM_CLOCK=wall selects
+ *     the host wall clock instead (sim_core.c).
+ *   - Interrupts are delivered synchronously from simSync(), at the point
+ *     the event occurs, so an ISR preempts the code that was polling.
+ *
+ * @note
+ *   - Registers with side effects on write (SETINT/CLEARINT, W1C flags, TD)
+ *     are decoded at the next sync. Side effects on read (RD clearing
+ *     RXRDY) only happen through the driver functions.
+ *   - Code that polls a register through a cached pointer, rather than
+ *     through the base macro or a driver call, never sees it change.
+ ******************************************************************************
+ */
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdint.h>
+#include "HL_sys_common.h"
+#include "HL_reg_sci.h"
+#include "HL_reg_dma.h"
+#include "HL_reg_crc.h"
+#include "HL_reg_rti.h"
+#include "HL_reg_emif.h"
+
+/* Clock tree of the HALCoGen configuration (HL_system.h) */
+#define SIM_GCLK_HZ             300000000U
+#define SIM_VCLK_HZ             75000000U
+
+/* Number of SCI/LIN modules (sciREG1..sciREG4) */
+#define SIM_SCI_COUNT           4U
+/* Reserved flag bit that is always set in published W1C flag registers,
+ * so a firmware write is always seen as a change */
+#define SIM_W1C_MARK            0x80000000U
+/* Value TD reads back between firmware writes */
+#define SIM_TD_IDLE             0xFFFFFFFFU
+
+/* SDRAM on EMIF CS0, the HDK's IS42S16400J (sim_emif.c) */
+#define SIM_EMIF_SDRAM_SIZE     0x00800000U
+
+/* FEE blocks of the checkpoint check, HALCoGen FEE tab (sim_fee.c) */
+#define SIM_FEE_BLOCKS          4U
+#define SIM_FEE_BLOCK_SIZE      32U
+
+/* Clocks (simSetClock()) */
+#define SIM_CLOCK_EVENT         0U
+#define SIM_CLOCK_WALL          1U
+#define SIM_CLOCK_UNSET         0xFFFFFFFFU
+
+typedef void (*simSciTxSink_t)(uint32_t index, uint8_t data);
+typedef void (*simHostHook_t)(void);
+/* Next byte on an SCI RX pin: returns 0 when the line stays idle (until
+ * simSciRxKick()), else the byte and the idle time before its start bit */
+typedef uint32_t (*simSciRxSource_t)(uint32_t index, uint64_t *idleNs, uint8_t *data);
+
+/* sim_core.c */
+void simSetClock(uint32_t clock);
+uint32_t simClock(void);
+uint64_t simNowNs(void);
+uint64_t simTimeNs(void);
+void simSync(void);
+void simSyncWait(const char *what);
+void simSetHostHook(simHostHook_t hook, uint64_t periodNs);
+void simBusy(void);
+void simCharge(double cycles);
+void simIsrBegin(void);
+double simIsrEnd(void);
+uint32_t simInSync(void);
+void simFatal(const char *msg);
+
+/* sim_sci.c */
+sciBASE_t *simSciRegs(uint32_t index);
+void simSciSetTxSink(simSciTxSink_t sink);
+void simSciSetRxSource(uint32_t index, simSciRxSource_t source);
+void simSciRxKick(uint32_t index);
+uint32_t simSciOverruns(uint32_t index);
+uint32_t simSciBaud(uint32_t index);
+uint64_t simSciCharNs(uint32_t index);
+void simSciApplyWrites(void);
+uint64_t simSciNextEventNs(void);
+void simSciRunEvent(void);
+uint32_t simSciIrqAsserted(uint32_t request);
+uint32_t simSciDmaAsserted(uint32_t request);
+uint32_t simSciDmaRead(uint32_t addr, uint32_t *value);
+uint32_t simSciDmaWrite(uint32_t addr, uint32_t value);
+void lin1HighLevelInterrupt(void);
+void sci3HighLevelInterrupt(void);
+
+/* sim_dma.c */
+dmaBASE_t *simDmaRegs(void);
+dmaRAMBASE_t *simDmaRamRegs(void);
+void simDmaApplyWrites(void);
+void simDmaService(void);
+uint32_t simDmaIrqAsserted(uint32_t request);
+void *simHostAddr(uint32_t addr);
+uint32_t simTargetAddr(const volatile void *ptr);
+
+/* sim_crc.c */
+crcBASE_t *simCrcRegs(uint32_t index);
+void simCrcApplyWrites(void);
+uint32_t simCrcDmaWrite(uint32_t addr, const uint8_t *data, uint32_t size);
+
+/* sim_emif.c */
+emifBASE_t *simEmifRegs(void);
+volatile uint32 *simEmifSdram(void);
+void simEmifApplyWrites(void);
+uint32_t simEmifDmaCheck(uint32_t addr, uint32_t size);
+void simEmifChargeRead(const void *data, uint32_t len);
+
+/* sim_fee.c, with the TI_Fee functions of include/fee/ti_fee.h */
+void simFeeErase(void);
+void simFeeFailNext(void);
+void simFeeCorrupt(uint32_t block, uint32_t offset);
+
+/* sim_rti.c */
+rtiBASE_t *simRtiRegs(void);
+void simRtiApplyWrites(void);
+uint64_t simRtiNextEventNs(void);
+void simRtiRunEvent(void);
+uint32_t simRtiIrqAsserted(uint32_t request);
+void rtiCompare0Interrupt(void);
+void rtiCompare1Interrupt(void);
+void rtiCompare2Interrupt(void);
+void rtiCompare3Interrupt(void);
+
+/* sim_traffic.c */
+typedef struct
+{
+    uint32_t seed;          /* Non-zero */
+    uint64_t durationNs;    /* No new burst starts after this time */
+    uint32_t maxBurst;      /* Bytes per burst, 1..maxBurst */
+    uint32_t windowMs;      /* Idle timeout that closes a window */
+    uint32_t maxIdleMs;     /* Longest gap between windows */
+} simTrafficCfg_t;
+
+void simTrafficInit(const simTrafficCfg_t *cfg);
+uint32_t simTrafficNext(uint32_t index, uint64_t *idleNs, uint8_t *data);
+uint32_t simTrafficPop(uint32_t *bytes, uint32_t *crc);
+uint32_t simTrafficDone(void);
+uint32_t simTrafficCrc(uint32_t crc, uint8_t data);
+
+/* sim_line.c */
+typedef struct
+{
+    uint32_t bytes;         /* Payload length */
+    uint32_t seed;          /* Fault seed, 0 for a clean line */
+    uint32_t faultOdds;     /* One fault per faultOdds bytes on average */
+} simLineCfg_t;
+
+typedef struct
+{
+    uint32_t sent;          /* Bytes put on the line */
+    uint32_t flips;         /* Bytes with a bit inverted */
+    uint32_t drops;         /* Payload bytes that never reached the line */
+    uint32_t gaps;          /* Pauses between two bytes */
+    uint32_t payloadCrc;    /* CRC32 of the payload */
+    uint32_t lineCrc;       /* CRC32 of what was on the line */
+    uint64_t firstNs;       /* Start bit of the first byte */
+    uint64_t lastNs;        /* End of the last frame */
+} simLineStats_t;
+
+void simLineInit(const simLineCfg_t *cfg);
+uint32_t simLineNext(uint32_t index, uint64_t *idleNs, uint8_t *data);
+uint32_t simLineDone(void);
+uint32_t simLineArrival(uint64_t *ns);
+void simLineStats(simLineStats_t *stats);
+
+/* sim_pty.c */
+const char *simPtyOpen(uint32_t index, uint32_t strict);
+
+/* sim_vim.c */
+uint32_t simVimDispatch(void);
+uint32_t simVimPending(void);
+uint32_t simVimIsrStats(uint32_t channel, double *maxCycles);
+void simVimClearIsrStats(void);
+
+/* sim_cost.c, CPU cycle costs of the event clock */
+typedef struct
+{
+    double periph;          /* Peripheral access or driver call, per sync */
+    double isrEntry;        /* IRQ latency, vector fetch, prologue */
+    double isrExit;         /* Epilogue and return */
+    double flashWs;         /* Wait states per flash access */
+    double ramWs;           /* Wait states per RAM access */
+    double sdramWs;         /* Cycles per 32-bit data read from the EMIF SDRAM */
+    uint32_t cache;         /* 1: accesses hit the cache */
+    uint32_t codeInRam;     /* 1: kernels and tables in RAM (RAMFUNC_IN_RAM) */
+} simCostCfg_t;
+
+/* Wrapped CRC kernels (sim_cost_crc.c), then the wrapped ISR and
+   consumer bodies (sim_cost_body.c) */
+typedef enum
+{
+    SIM_COST_UPDATE_CRC32     = 0U,
+    SIM_COST_CALC_CRC32       = 1U,
+    SIM_COST_CRC32_TABLE      = 2U,
+    SIM_COST_CRC32_WORD       = 3U,
+    SIM_COST_CRC32_BURST      = 4U,
+    SIM_COST_KERNELS          = 5U,
+    SIM_COST_SCI_NOTIFICATION = 5U,
+    SIM_COST_CORE_ADD         = 6U,
+    SIM_COST_CHECKSUM_UPDATE  = 7U,
+    SIM_COST_FUNCS            = 8U
+} simCostKernel_t;
+
+typedef struct
+{
+    const char *name;
+    double call;            /* Cycles per call at zero wait states */
+    double byte;            /* Cycles per byte at zero wait states */
+    double callAcc;         /* Memory accesses per call */
+    double byteAcc;         /* Memory accesses per byte */
+    uint64_t calls;         /* Calls since simCostClearStats() */
+    uint64_t bytes;
+} simCostKernelCost_t;
+
+const simCostCfg_t *simCostCfg(void);
+const simCostKernelCost_t *simCostKernel(simCostKernel_t kernel);
+double simCostPerByte(simCostKernel_t kernel);
+double simCostPerCall(simCostKernel_t kernel);
+void simCostKernelCall(simCostKernel_t kernel, uint32_t len);
+void simCostClearStats(void);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,57 @@
+/**
+ ******************************************************************************
+ * @file    sim_hal.h
+ * @brief   Prelude Force-Included (-include) Into Every Simulator Build Unit
+ *
+ * @details
+ *   - Pulls in the project's own HALCoGen headers first, so their include
+ *     guards are set and the types and prototypes are the real ones.
+ *   - Replaces the fixed register base addresses (SCI, DMA, CRC, RTI,
+ *     EMIF) with calls into the models, which sync the simulation before
+ *     returning the block, and the EMIF CS0 base (PTR) with the SDRAM
+ *     model's buffer.
+ ******************************************************************************
+ */
+#ifndef SIM_HAL_H_
+#define SIM_HAL_H_
+
+#include "HL_sys_common.h"
+#include "HL_sci.h"
+#include "HL_sys_dma.h"
+#include "HL_sys_vim.h"
+#include "HL_sys_pmu.h"
+#include "HL_sys_core.h"
+#include "HL_system.h"
+#include "HL_crc.h"
+#include "HL_rti.h"
+#include "HL_emif.h"
+#include "sim.h"
+
+#undef sciREG1
+#undef sciREG2
+#undef sciREG3
+#undef sciREG4
+#define sciREG1     (simSciRegs(0U))
+#define sciREG2     (simSciRegs(1U))
+#define sciREG3     (simSciRegs(2U))
+#define sciREG4     (simSciRegs(3U))
+
+#undef dmaREG
+#undef dmaRAMREG
+#define dmaREG      (simDmaRegs())
+#define dmaRAMREG   (simDmaRamRegs())
+
+#undef crcREG1
+#undef crcREG2
+#define crcREG1     (simCrcRegs(0U))
+#define crcREG2     (simCrcRegs(1U))
+
+#undef rtiREG1
+#define rtiREG1     (simRtiRegs())
+
+#undef emifREG
+#undef PTR
+#define emifREG     (simEmifRegs())
+#define PTR         (simEmifSdram())
+
+#endif /* SIM_HAL_H_ */
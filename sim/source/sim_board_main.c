@@ -0,0 +1,92 @@
+/**
+ ******************************************************************************
+ * @file    sim_board_main.c
+ * @brief   The uart-crc32-dma Application on a Virtual Serial Port
+ *
+ * @details
+ *   - Runs main() of uart-crc32-dma/source/uart_dma_crc_main.c, compiled
+ *     unchanged as simFirmwareMain() (Makefile), with SCI3 bridged to a
+ *     pty (sim_pty.c) on the wall clock.
+ *   - Usage: sim_board [-s] [-l <link>]. The slave path is printed on
+ *     stderr; -l also makes a symlink to it (removed on SIGINT/SIGTERM),
+ *     -s drops bytes while the host port is set to the wrong rate.
+ *   - Terminals and host/build/crcctl open the slave like the LaunchPad's
+ *     USB-UART port: 26042 baud after start-up, ESC commands, baud rate
+ *     negotiation and XON/XOFF flow control behave as on the board.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* SCI index of sciREG3, the USB-UART port of the application */
+#define SIM_BOARD_SCI           2U
+
+/* uart_dma_crc_main.c */
+void simFirmwareMain(void);
+
+static const char *s_link = NULL;
+
+static void simBoardStop(int sig);
+
+int main(int argc, char **argv)
+{
+    const char *name;
+    uint32_t strict = 0U;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "sl:")) != -1)
+    {
+        if (opt == 's')
+        {
+            strict = 1U;
+        }
+        else if (opt == 'l')
+        {
+            s_link = optarg;
+        }
+        else
+        {
+            fprintf(stderr, "usage: sim_board [-s] [-l <link>]\n");
+            return 2;
+        }
+    }
+
+    simSetClock(SIM_CLOCK_WALL);
+    vimInit();
+    name = simPtyOpen(SIM_BOARD_SCI, strict);
+    if (name == NULL)
+    {
+        perror("sim: pty");
+        return 1;
+    }
+    if (s_link != NULL)
+    {
+        (void)unlink(s_link);
+        if (symlink(name, s_link) != 0)
+        {
+            perror("sim: symlink");
+            return 1;
+        }
+    }
+    (void)signal(SIGINT, &simBoardStop);
+    (void)signal(SIGTERM, &simBoardStop);
+    fprintf(stderr, "sim: board on %s%s%s\n", name,
+            (s_link != NULL) ? ", linked as " : "", (s_link != NULL) ? s_link : "");
+
+    simFirmwareMain();
+    return 0;
+}
+
+static void simBoardStop(int sig)
+{
+    (void)sig;
+    if (s_link != NULL)
+    {
+        (void)unlink(s_link);
+    }
+    _exit(0);
+}
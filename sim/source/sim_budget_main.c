@@ -0,0 +1,219 @@
+/**
+ ******************************************************************************
+ * @file    sim_budget_main.c
+ * @brief   Cycle Budget Check and Max Baud Prediction on the Cost Model
+ *
+ * @details
+ *   - Builds once per backend (include/rx/core_cfg.h, CORE_RX_BACKEND from
+ *     the Makefile) with the shared core's backend source, as sim_rx and
+ *     sim_case do, and hands every byte to the core's consumer coreAdd().
+ *   - A run streams a clean payload (sim_line.c) into SCI3 at one rate,
+ *     while the main loop polls the backend and spends a fixed number of
+ *     cycles on other work per pass, as sim_case does. It is lossless
+ *     when every byte reaches coreAdd(), the CRC matches the line and no
+ *     overrun was counted. The host keeps sending whatever the CPU does,
+ *     so a slower RX interrupt, consumer or main loop shows up as loss.
+ *   - Checks each path against the character time at the target rate:
+ *       * the longest RX interrupt of the interrupt backend (the
+ *         generated driver, sciNotification() and coreAdd(), entry and
+ *         exit included), measured on a run at that rate
+ *       * the cycles per byte of each CRC kernel
+ *       * the cycles of one call on one byte of each wrapped body
+ *         (sim_cost_body.c), the most a byte can cost from an interrupt
+ *       * the predicted rate: the highest lossless one among the exact
+ *         VCLK / (16 * n) divisors, down to SIM_BUDGET_MIN_BAUD
+ *   - Usage: sim_budget_<backend> [baud] [work cycles], default 937500 and
+ *     1000. Exit status 1 when a path is over budget, so a change that
+ *     pushes one over fails the build.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "core.h"
+#include "core_rx.h"
+#include "crc32_kernel.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SIM_BUDGET_BAUD         937500U
+#define SIM_BUDGET_WORK_CYCLES  1000U
+/* Lowest rate tried, the end of the search */
+#define SIM_BUDGET_MIN_BAUD     115200U
+/* Payload of a run: more than two turns of the DMA ring */
+#define SIM_BUDGET_BYTES        ((2U * CORE_RX_RING_SIZE) + 123U)
+/* Simulated time allowed for the backend to hand on the last bytes */
+#define SIM_BUDGET_DRAIN_NS     10000000ULL
+/* SCI3 level 0 (sci3HighLevelInterrupt()), the interrupt backend's */
+#define SIM_BUDGET_RX_CH        64U
+
+static uint32_t simBudgetRun(uint32_t baud, uint32_t work);
+static double simBudgetCharCycles(uint32_t baud);
+static const char *simBudgetVerdict(uint32_t over);
+
+static const char *simBudgetBackendName(void)
+{
+#if (CORE_RX_BACKEND == CORE_RX_POLLING)
+    return "polling";
+#elif (CORE_RX_BACKEND == CORE_RX_INTERRUPT)
+    return "interrupt";
+#elif (CORE_RX_BACKEND == CORE_RX_DMA_SINGLE)
+    return "dma-single";
+#elif (CORE_RX_BACKEND == CORE_RX_DMA_RING)
+    return "dma-ring";
+#elif (CORE_RX_BACKEND == CORE_RX_DMA_POOL)
+    return "dma-pool";
+#else
+    return "unknown";
+#endif
+}
+
+int main(int argc, char **argv)
+{
+    const simCostCfg_t *cfg;
+    uint32_t target = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : SIM_BUDGET_BAUD;
+    uint32_t work = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : SIM_BUDGET_WORK_CYCLES;
+    uint32_t b, n, baud, maxBaud, over;
+    uint32_t failed = 0U;
+    double charCycles, perByte, perCall;
+#if (CORE_RX_BACKEND == CORE_RX_INTERRUPT)
+    double isrMax;
+#endif
+
+    if (target == 0U)
+    {
+        fprintf(stderr, "usage: sim_budget_<backend> [baud] [work cycles]\n");
+        return 2;
+    }
+    simSetClock(SIM_CLOCK_EVENT);
+    vimInit();
+    sciInit();
+#if (CORE_RX_BACKEND == CORE_RX_INTERRUPT)
+    vimEnableInterrupt(SIM_BUDGET_RX_CH, SYS_IRQ);
+#endif
+    _enable_interrupt_();
+    coreInit();
+
+    cfg = simCostCfg();
+    charCycles = simBudgetCharCycles(target);
+    printf("%s, cost model: periph %.0f, isr entry %.0f exit %.0f, %s, cache %s, %s ws %.0f\r\n",
+           simBudgetBackendName(), cfg->periph, cfg->isrEntry, cfg->isrExit,
+           (cfg->codeInRam != 0U) ? "kernels in RAM" : "kernels in flash",
+           (cfg->cache != 0U) ? "on" : "off",
+           (cfg->codeInRam != 0U) ? "ram" : "flash",
+           (cfg->codeInRam != 0U) ? cfg->ramWs : cfg->flashWs);
+    printf("budget at %lu baud: %.0f cycles per character, main loop work %lu\r\n",
+           (unsigned long)target, charCycles, (unsigned long)work);
+
+#if (CORE_RX_BACKEND == CORE_RX_INTERRUPT)
+    /* RX interrupt of the interrupt backend */
+    (void)simBudgetRun(target, work);
+    (void)simVimIsrStats(SIM_BUDGET_RX_CH, &isrMax);
+    over = (isrMax > charCycles) ? 1U : 0U;
+    failed |= over;
+    printf("rx isr            %8.0f cycles max      %s\r\n", isrMax, simBudgetVerdict(over));
+#endif
+
+    /* CRC kernels, one byte per character at most */
+    for (b = 0U; b < (uint32_t)SIM_COST_KERNELS; b++)
+    {
+        perByte = simCostPerByte((simCostKernel_t)b);
+        over = (perByte > charCycles) ? 1U : 0U;
+        failed |= over;
+        printf("%-17s %8.2f cycles/byte    %s\r\n",
+               simCostKernel((simCostKernel_t)b)->name, perByte, simBudgetVerdict(over));
+    }
+
+    /* Interrupt and consumer bodies, one call per character at most */
+    for (b = (uint32_t)SIM_COST_KERNELS; b < (uint32_t)SIM_COST_FUNCS; b++)
+    {
+        perCall = simCostPerCall((simCostKernel_t)b);
+        over = (perCall > charCycles) ? 1U : 0U;
+        failed |= over;
+        printf("%-17s %8.2f cycles/call    %s\r\n",
+               simCostKernel((simCostKernel_t)b)->name, perCall, simBudgetVerdict(over));
+    }
+
+    /* Highest lossless divisor */
+    maxBaud = 0U;
+    for (n = 1U; maxBaud == 0U; n++)
+    {
+        baud = SIM_VCLK_HZ / (16U * n);
+        if (baud < SIM_BUDGET_MIN_BAUD)
+        {
+            break;
+        }
+        if (simBudgetRun(baud, work) != 0U)
+        {
+            maxBaud = simSciBaud(2U);
+        }
+    }
+    over = (maxBaud < target) ? 1U : 0U;
+    failed |= over;
+    printf("%-10s max lossless %8lu baud   %s\r\n",
+           simBudgetBackendName(), (unsigned long)maxBaud, simBudgetVerdict(over));
+
+    return (failed != 0U) ? 1 : 0;
+}
+
+/**
+ * @brief  Streams one payload at a rate into a restarted backend.
+ * @return 1 if it was received lossless.
+ */
+static uint32_t simBudgetRun(uint32_t baud, uint32_t work)
+{
+    simLineCfg_t cfg;
+    simLineStats_t line;
+    uint32_t overruns;
+    uint64_t deadline;
+
+    coreRxStop();
+    sciSetBaudrate(CORE_RX_SCI, baud);
+    coreInit();
+    simVimClearIsrStats();
+    simCostClearStats();
+    overruns = simSciOverruns(2U);
+    coreRxInit(&coreAdd);
+
+    cfg.bytes = SIM_BUDGET_BYTES;
+    cfg.seed = 0U;
+    cfg.faultOdds = 0U;
+    simLineInit(&cfg);
+    simSciSetRxSource(2U, &simLineNext);
+
+    /* The interrupt backend's poll touches no peripheral: simSync() lets
+       the clock apply the work and deliver the RX interrupts */
+    while (simLineDone() == 0U)
+    {
+        (void)coreRxPoll();
+        simCharge((double)work);
+        simSync();
+    }
+    deadline = simTimeNs() + SIM_BUDGET_DRAIN_NS;
+    while (simTimeNs() < deadline)
+    {
+        (void)coreRxPoll();
+        simSync();
+    }
+    coreRxFlush();
+
+    simLineStats(&line);
+    return ((coreCount() == line.sent) && ((coreCrcState() ^ CRC32_XOROUT) == line.lineCrc)
+            && (simSciOverruns(2U) == overruns)) ? 1U : 0U;
+}
+
+/**
+ * @brief  GCLK cycles per character at a rate, from the SCI3 frame
+ *         format.
+ */
+static double simBudgetCharCycles(uint32_t baud)
+{
+    uint32_t bits = 1U + ((sciREG3->FORMAT & 0x7U) + 1U);
+
+    bits += ((sciREG3->GCR1 & 0x10U) != 0U) ? 2U : 1U;
+    bits += ((sciREG3->GCR1 & 0x04U) != 0U) ? 1U : 0U;
+    return ((double)bits * (double)SIM_GCLK_HZ) / (double)baud;
+}
+
+static const char *simBudgetVerdict(uint32_t over)
+{
+    return (over != 0U) ? "OVER" : "ok";
+}
@@ -0,0 +1,185 @@
+/**
+ ******************************************************************************
+ * @file    sim_case_main.c
+ * @brief   One Simulated Board: a Shared Core RX Backend Against a Payload
+ *
+ * @details
+ *   - Builds once per backend like sim_rx_main.c (include/rx/core_cfg.h,
+ *     CORE_RX_BACKEND from the Makefile). The host sends a seeded payload
+ *     on SCI3 with injected line faults (sim_line.c); the main loop polls
+ *     the backend and spends a fixed number of cycles on other work per
+ *     pass, as a project main loop does with its reports and commands.
+ *   - Prints one result line of key=value pairs for sim_farm: bytes on
+ *     the line and handed on, overruns, faults, the CRC verdict, the
+ *     throughput from the first start bit to the last byte handed on,
+ *     the mean and worst latency from the end of a frame until the
+ *     backend hands the byte on, and the simulated and host run time.
+ *   - The CRC verdict compares the core's CRC with the payload and with
+ *     the line: ok (clean and complete), caught (faults or loss, CRC
+ *     differs), missed (faults, yet the CRC matches the payload).
+ *
+ * @note
+ *   - Usage: sim_case_<backend> <baud> <bytes> <seed> [fault odds] [work
+ *     cycles]. Seed 0 is a clean line. Exit status 1 on a missed fault,
+ *     2 on a simulator error; loss is a result, not a failure.
+ *   - Runs on the event clock, so a case always gives the same line.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "core.h"
+#include "core_rx.h"
+#include "crc32_kernel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SIM_CASE_FAULT_ODDS     4096U
+#define SIM_CASE_WORK_CYCLES    1000U
+/* Simulated time allowed for the backend to hand on the last bytes */
+#define SIM_CASE_DRAIN_NS       10000000ULL
+/* SCI3 level 0 (sci3HighLevelInterrupt()), the interrupt backend's */
+#define SIM_CASE_RX_CH          64U
+
+/* The interrupt backend's poll touches no peripheral: the loop syncs, so
+ * the clock applies the work and delivers the RX interrupts */
+#if (CORE_RX_BACKEND == CORE_RX_INTERRUPT)
+#define SIM_CASE_SYNC()         simSync()
+#else
+#define SIM_CASE_SYNC()
+#endif
+
+static uint32_t s_received = 0U;
+static uint64_t s_lastNs = 0U;
+static uint64_t s_latSumNs = 0U;
+static uint64_t s_latMaxNs = 0U;
+static uint32_t s_latCount = 0U;
+
+static void simCaseAdd(const uint8_t *data, uint32_t len);
+
+static const char *simCaseBackendName(void)
+{
+#if (CORE_RX_BACKEND == CORE_RX_POLLING)
+    return "polling";
+#elif (CORE_RX_BACKEND == CORE_RX_INTERRUPT)
+    return "interrupt";
+#elif (CORE_RX_BACKEND == CORE_RX_DMA_SINGLE)
+    return "dma-single";
+#elif (CORE_RX_BACKEND == CORE_RX_DMA_RING)
+    return "dma-ring";
+#elif (CORE_RX_BACKEND == CORE_RX_DMA_POOL)
+    return "dma-pool";
+#else
+    return "unknown";
+#endif
+}
+
+int main(int argc, char **argv)
+{
+    simLineCfg_t cfg;
+    simLineStats_t line;
+    struct timespec t0, t1;
+    const char *verdict;
+    uint32_t baud, work, crc, faults;
+    uint64_t deadline, spanNs;
+
+    if (argc < 4)
+    {
+        fprintf(stderr, "usage: sim_case_<backend> <baud> <bytes> <seed> [fault odds] [work cycles]\n");
+        return 2;
+    }
+    baud = (uint32_t)strtoul(argv[1], NULL, 0);
+    cfg.bytes = (uint32_t)strtoul(argv[2], NULL, 0);
+    cfg.seed = (uint32_t)strtoul(argv[3], NULL, 0);
+    cfg.faultOdds = (argc > 4) ? (uint32_t)strtoul(argv[4], NULL, 0) : SIM_CASE_FAULT_ODDS;
+    work = (argc > 5) ? (uint32_t)strtoul(argv[5], NULL, 0) : SIM_CASE_WORK_CYCLES;
+
+    simSetClock(SIM_CLOCK_EVENT);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    vimInit();
+    sciInit();
+    sciSetBaudrate(CORE_RX_SCI, baud);
+#if (CORE_RX_BACKEND == CORE_RX_INTERRUPT)
+    vimEnableInterrupt(SIM_CASE_RX_CH, SYS_IRQ);
+#endif
+    _enable_interrupt_();
+    coreInit();
+    coreRxInit(&simCaseAdd);
+    simLineInit(&cfg);
+    simSciSetRxSource(2U, &simLineNext);
+
+    while (simLineDone() == 0U)
+    {
+        (void)coreRxPoll();
+        simCharge((double)work);
+        SIM_CASE_SYNC();
+    }
+    deadline = simTimeNs() + SIM_CASE_DRAIN_NS;
+    while (simTimeNs() < deadline)
+    {
+        (void)coreRxPoll();
+        SIM_CASE_SYNC();
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    simLineStats(&line);
+    crc = coreCrcState() ^ CRC32_XOROUT;
+    faults = line.flips + line.drops;
+    if ((faults != 0U) && (crc == line.payloadCrc))
+    {
+        verdict = "missed";
+    }
+    else if ((faults != 0U) || (s_received != line.sent) || (crc != line.lineCrc))
+    {
+        verdict = "caught";
+    }
+    else
+    {
+        verdict = "ok";
+    }
+    spanNs = (s_lastNs > line.firstNs) ? (s_lastNs - line.firstNs) : 1U;
+
+    printf("backend=%s baud=%lu bytes=%lu seed=%lu sent=%lu received=%lu lost=%lu overruns=%lu "
+           "flips=%lu drops=%lu gaps=%lu lossless=%u crc=%s kbps=%.1f lat_us=%.2f lat_max_us=%.2f "
+           "sim_ms=%.3f host_ms=%.3f\n",
+           simCaseBackendName(), (unsigned long)simSciBaud(2U), (unsigned long)cfg.bytes,
+           (unsigned long)cfg.seed, (unsigned long)line.sent, (unsigned long)s_received,
+           (unsigned long)((line.sent > s_received) ? (line.sent - s_received) : 0U),
+           (unsigned long)simSciOverruns(2U), (unsigned long)line.flips,
+           (unsigned long)line.drops, (unsigned long)line.gaps,
+           ((s_received == line.sent) && (crc == line.lineCrc)) ? 1U : 0U, verdict,
+           ((double)s_received * 1e6) / (double)spanNs,
+           (s_latCount != 0U) ? ((double)s_latSumNs / (double)s_latCount / 1e3) : 0.0,
+           (double)s_latMaxNs / 1e3, (double)simTimeNs() / 1e6,
+           ((double)(t1.tv_sec - t0.tv_sec) * 1e3) + ((double)(t1.tv_nsec - t0.tv_nsec) * 1e-6));
+
+    return ((faults != 0U) && (crc == line.payloadCrc)) ? 1 : 0;
+}
+
+/**
+ * @brief  Backend callback: takes the latency of every byte handed on,
+ *         then adds the block to the window.
+ */
+static void simCaseAdd(const uint8_t *data, uint32_t len)
+{
+    uint64_t now = simNowNs();
+    uint64_t arrival, lat;
+    uint32_t i;
+
+    for (i = 0U; i < len; i++)
+    {
+        if (simLineArrival(&arrival) != 0U)
+        {
+            lat = (now > arrival) ? (now - arrival) : 0U;
+            s_latSumNs += lat;
+            s_latCount++;
+            if (lat > s_latMaxNs)
+            {
+                s_latMaxNs = lat;
+            }
+        }
+    }
+    s_received += len;
+    s_lastNs = now;
+    coreAdd(data, len);
+}
@@ -0,0 +1,186 @@
+/**
+ ******************************************************************************
+ * @file    sim_ckpt_main.c
+ * @brief   Checks the FEE Session Checkpoints Across Simulated Resets
+ *
+ * @details
+ *   - Builds uart-crc32-interrupt-largefiles/source/fee_checkpoint.c with
+ *     CKPT_ENABLE set, against the FEE model of sim_fee.c, which the
+ *     target cannot do until HALCoGen generates the FEE driver.
+ *   - Every boot is a child process: it starts the driver with ckptInit()
+ *     and sees only what an earlier boot left in the model's flash.
+ *     - Boot 1: blank flash, no checkpoint; a save replaced before it was
+ *       written, a save made while a write is in progress, a failed write.
+ *     - Boot 2: the last written checkpoint is found and the one whose
+ *       write failed is not; ckptErase() is written.
+ *     - Boot 3: nothing to resume after the erase; a new checkpoint is
+ *       written, then one bit of it is flipped in flash.
+ *     - Boot 4: the check word rejects the damaged record.
+ *   - Exit status is 0 when every boot passes.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "fee_checkpoint.h"
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#if (CKPT_RECORD_SIZE != SIM_FEE_BLOCK_SIZE)
+#error "The FEE block of the model has to hold one ckptRecord_t"
+#endif
+
+#define SIM_CKPT_SESSION        0x5E55100DU
+#define SIM_CKPT_LENGTH         0x123456789ULL
+/* ckptService() calls after which a write has to be done */
+#define SIM_CKPT_SERVICE_MAX    64U
+
+static int s_errors = 0;
+
+static void simCkptExpect(const char *what, uint32_t ok)
+{
+    if (ok == 0U)
+    {
+        printf("  %s: FAILED\n", what);
+        s_errors++;
+    }
+}
+
+/**
+ * @brief  Runs ckptService() until the write counters stop changing.
+ */
+static void simCkptSettle(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_CKPT_SERVICE_MAX; i++)
+    {
+        ckptService();
+    }
+}
+
+/**
+ * @brief  Checks that the stored checkpoint of the session is at offset.
+ */
+static void simCkptExpectAt(const char *what, uint64 offset, uint32_t crc)
+{
+    ckptRecord_t record;
+    uint32_t found = ckptLoad(SIM_CKPT_SESSION, &record);
+
+    simCkptExpect(what, (found != 0U)
+                     && (record.lengthHigh == (uint32_t)(SIM_CKPT_LENGTH >> 32U))
+                     && (record.lengthLow == (uint32_t)SIM_CKPT_LENGTH)
+                     && (record.offsetHigh == (uint32_t)(offset >> 32U))
+                     && (record.offsetLow == (uint32_t)offset)
+                     && (record.crc == crc));
+}
+
+static void simCkptBoot1(void)
+{
+    ckptRecord_t record;
+    ckptStats_t stats;
+    uint32_t i;
+
+    ckptInit();
+    simCkptExpect("blank flash has no checkpoint", (ckptLoad(SIM_CKPT_SESSION, &record) == 0U) ? 1U : 0U);
+
+    /* Two saves before the main loop runs: only the second is written */
+    ckptSave(SIM_CKPT_SESSION, SIM_CKPT_LENGTH, 0x100000U, 0x11111111U);
+    ckptSave(SIM_CKPT_SESSION, SIM_CKPT_LENGTH, 0x200000U, 0x22222222U);
+    simCkptSettle();
+    simCkptExpectAt("newest save written", 0x200000U, 0x22222222U);
+
+    /* A save while the write of the previous one is in progress */
+    ckptSave(SIM_CKPT_SESSION, SIM_CKPT_LENGTH, 0x300000U, 0x33333333U);
+    for (i = 0U; i < 4U; i++)
+    {
+        ckptService();
+    }
+    ckptSave(SIM_CKPT_SESSION, SIM_CKPT_LENGTH, 0x100000000ULL, 0x44444444U);
+    simCkptSettle();
+    simCkptExpectAt("save during a write", 0x100000000ULL, 0x44444444U);
+
+    simFeeFailNext();
+    ckptSave(SIM_CKPT_SESSION, SIM_CKPT_LENGTH, 0x100100000ULL, 0x55555555U);
+    simCkptSettle();
+    simCkptExpectAt("failed write keeps the stored one", 0x100000000ULL, 0x44444444U);
+
+    ckptGetStats(&stats);
+    printf("  saves %lu writes %lu replaced %lu failures %lu\n", (unsigned long)stats.saves,
+           (unsigned long)stats.writes, (unsigned long)stats.replaced, (unsigned long)stats.failures);
+    simCkptExpect("counters", ((stats.saves == 5U) && (stats.writes == 3U)
+                            && (stats.replaced == 1U) && (stats.failures == 1U)) ? 1U : 0U);
+}
+
+static void simCkptBoot2(void)
+{
+    ckptRecord_t record;
+
+    ckptInit();
+    simCkptExpectAt("resumed after reset", 0x100000000ULL, 0x44444444U);
+    simCkptExpect("other session", (ckptLoad(SIM_CKPT_SESSION + 1U, &record) == 0U) ? 1U : 0U);
+
+    ckptErase();
+    simCkptSettle();
+    simCkptExpect("erased", (ckptLoad(SIM_CKPT_SESSION, &record) == 0U) ? 1U : 0U);
+}
+
+static void simCkptBoot3(void)
+{
+    ckptRecord_t record;
+
+    ckptInit();
+    simCkptExpect("nothing after erase", (ckptLoad(SIM_CKPT_SESSION, &record) == 0U) ? 1U : 0U);
+    ckptSave(SIM_CKPT_SESSION, SIM_CKPT_LENGTH, 0x400000U, 0x66666666U);
+    simCkptSettle();
+    simCkptExpectAt("written", 0x400000U, 0x66666666U);
+    /* A byte of offsetLow */
+    simFeeCorrupt(CKPT_FEE_BLOCK, 23U);
+}
+
+static void simCkptBoot4(void)
+{
+    ckptRecord_t record;
+
+    ckptInit();
+    simCkptExpect("damaged record rejected", (ckptLoad(SIM_CKPT_SESSION, &record) == 0U) ? 1U : 0U);
+}
+
+/**
+ * @brief  Runs one boot in a child process.
+ * @return Non-zero if it failed.
+ */
+static int simCkptRun(const char *name, void (*boot)(void))
+{
+    pid_t pid;
+    int status = 0;
+
+    printf("%s\n", name);
+    fflush(stdout);
+    pid = fork();
+    if (pid < 0)
+    {
+        simFatal("ckpt: fork failed");
+    }
+    if (pid == 0)
+    {
+        boot();
+        fflush(stdout);
+        _exit((s_errors == 0) ? 0 : 1);
+    }
+    (void)waitpid(pid, &status, 0);
+    return ((WIFEXITED(status) != 0) && (WEXITSTATUS(status) == 0)) ? 0 : 1;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    simFeeErase();
+    failed += simCkptRun("boot 1: saves and writes", &simCkptBoot1);
+    failed += simCkptRun("boot 2: resume and erase", &simCkptBoot2);
+    failed += simCkptRun("boot 3: after the erase", &simCkptBoot3);
+    failed += simCkptRun("boot 4: damaged record", &simCkptBoot4);
+
+    printf("checkpoints %s\n", (failed == 0) ? "ok" : "FAILED");
+    return (failed == 0) ? 0 : 1;
+}
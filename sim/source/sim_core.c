@@ -0,0 +1,466 @@
+/**
+ ******************************************************************************
+ * @file    sim_core.c
+ * @brief   Simulator Time Base, Sync and Core (IRQ mask) Functions
+ *
+ * @details
+ *   - simSync() decodes pending register writes, runs the SCI and RTI
+ *     events that are due in time order and services DMA requests and
+ *     interrupts after each of them.
+ *   - A host hook (simSetHostHook(), e.g. the pty bridge) runs from the
+ *     sync at most once per period of simulated time.
+ *   - Nested calls (driver calls made from an ISR that runs inside the
+ *     sync) return immediately, so an ISR sees the state at the moment of
+ *     its event.
+ *   - Two clocks (SIM_CLOCK in the environment, or simSetClock()):
+ *       * event (default): discrete-event time. CPU time comes from the
+ *         cost model (sim_cost.c): every sync charges a peripheral access,
+ *         the CRC kernels their cycle budget (simCharge()), and an
+ *         interrupt handler its entry, body and exit cycles, during which
+ *         the interrupted code stands still and no other handler starts.
+ *         Once the firmware has synced
+ *         SIM_IDLE_SYNCS times in a row without an event, an interrupt, a
+ *         register write or a configuring driver call (simBusy()), it is
+ *         only polling and can only be waiting for the next event, so time
+ *         jumps straight to it (byte arrival, end of a frame, RTI compare
+ *         match). Runs are deterministic and idle gaps cost no host time.
+ *       * wall: time follows the host wall clock but advances at most
+ *         SIM_MAX_STEP_NS per sync. When the host deschedules the process
+ *         the excess is dropped instead of being replayed as one burst of
+ *         events that polling code could never have kept up with.
+ *         Firmware that spins on memory alone (wait_ms() on a tick counter
+ *         of the RTI handler) never syncs, so a timer signal every
+ *         SIM_PREEMPT_NS runs the sync itself once the firmware has not
+ *         synced for SIM_PREEMPT_TICKS of them, as the RTI interrupt
+ *         would, and lets it catch up with the wall clock in one step.
+ *
+ * @note
+ *   - The sync of the timer signal interrupts the firmware at any point,
+ *     like a real interrupt, and calls no more of the C library than an
+ *     ordinary sync. The firmware it interrupts only spins on memory.
+ *   - In event time, code between two syncs that is not charged takes no
+ *     time. A loop that times itself with the PMU cycle counter alone sees
+ *     it advance by one peripheral access per read, or jump to the next
+ *     event when one is pending.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Largest simulated time step between two syncs (wall clock) */
+#define SIM_MAX_STEP_NS         1000U
+/* Syncs without an event or interrupt before time skips ahead */
+#define SIM_IDLE_SYNCS          4U
+/* Wall clock: period of the timer signal, and its periods without a sync
+ * before it syncs itself */
+#define SIM_PREEMPT_NS          1000000U
+#define SIM_PREEMPT_TICKS       2U
+
+static uint32_t s_clock = SIM_CLOCK_UNSET;
+static uint64_t s_startNs = 0U;
+static uint64_t s_timeNs = 0U;
+/* Wall-clock time not passed on to the simulation */
+static uint64_t s_droppedNs = 0U;
+static uint32_t s_syncDepth = 0U;
+static uint32_t s_idleSyncs = 0U;
+/* Firmware did work (a register write or configuration) since the last sync */
+static uint32_t s_busy = 0U;
+/* Event clock: CPU cycles charged since the last sync, not yet in s_timeNs */
+static double s_pendCycles = 0.0;
+/* Handler being charged: start time and cycles so far */
+static uint32_t s_inIsr = 0U;
+static uint64_t s_isrStartNs = 0U;
+static double s_isrCycles = 0.0;
+/* The CPU runs a handler until then, no other handler starts before */
+static uint64_t s_cpuFreeNs = 0U;
+/* Handler time of the current sync, added to the interrupted code */
+static uint64_t s_stolenNs = 0U;
+static simHostHook_t s_hook = NULL;
+static uint64_t s_hookPeriodNs = 0U;
+static uint64_t s_hookNextNs = 0U;
+/* Wall clock: syncs counted for the timer signal, its quiet periods */
+static volatile sig_atomic_t s_syncCount = 0;
+static sig_atomic_t s_preemptSeen = 0;
+static uint32_t s_preemptQuiet = 0U;
+static uint32_t s_catchUp = 0U;
+
+static uint64_t simMonotonicNs(void);
+static void simPreemptStart(void);
+static void simPreempt(int sig);
+static uint64_t simNextEventNs(void);
+static uint32_t simRunEvents(uint64_t target);
+static uint32_t simDispatch(void);
+static uint64_t simCyclesNs(double cycles);
+
+/**
+ * @brief  Selects the clock. Call before the first sync; the default is
+ *         SIM_CLOCK from the environment ("wall" or "event"), else event.
+ * @param  clock  SIM_CLOCK_EVENT or SIM_CLOCK_WALL.
+ */
+void simSetClock(uint32_t clock)
+{
+    s_clock = clock;
+}
+
+/**
+ * @brief  Returns the clock in use.
+ */
+uint32_t simClock(void)
+{
+    if (s_clock == SIM_CLOCK_UNSET)
+    {
+        const char *env = getenv("SIM_CLOCK");
+
+        s_clock = ((env != NULL) && (strcmp(env, "wall") == 0)) ? SIM_CLOCK_WALL : SIM_CLOCK_EVENT;
+    }
+    return s_clock;
+}
+
+/**
+ * @brief  Returns the time the models may run up to, in ns. Event clock:
+ *         the simulated time plus the CPU time charged since (the handler
+ *         time inside an interrupt handler). Wall clock: host time since the first call,
+ *         less the time dropped by simSync(); never behind simTimeNs().
+ */
+uint64_t simNowNs(void)
+{
+    if (simClock() == SIM_CLOCK_EVENT)
+    {
+        if (s_inIsr != 0U)
+        {
+            return s_isrStartNs + simCyclesNs(s_isrCycles);
+        }
+        return s_timeNs + simCyclesNs(s_pendCycles);
+    }
+    if (s_startNs == 0U)
+    {
+        s_startNs = simMonotonicNs();
+        simPreemptStart();
+    }
+    return simMonotonicNs() - s_startNs - s_droppedNs;
+}
+
+/**
+ * @brief  Returns the simulated time: the time of the event being
+ *         processed inside simSync(), otherwise the time of the last sync.
+ */
+uint64_t simTimeNs(void)
+{
+    return s_timeNs;
+}
+
+/**
+ * @brief  Brings all models up to the current time.
+ */
+void simSync(void)
+{
+    uint64_t target, next, cpuNs;
+    uint32_t activity;
+
+    s_syncCount++;
+    if (s_syncDepth != 0U)
+    {
+        /* A driver call of the handler */
+        simCharge(simCostCfg()->periph);
+        return;
+    }
+    s_syncDepth = 1U;
+
+    if ((s_hook != NULL) && (s_timeNs >= s_hookNextNs))
+    {
+        s_hookNextNs = s_timeNs + s_hookPeriodNs;
+        s_hook();
+    }
+    simSciApplyWrites();
+    simDmaApplyWrites();
+    simCrcApplyWrites();
+    simRtiApplyWrites();
+    simEmifApplyWrites();
+    simDmaService();
+    activity = simDispatch() + s_busy;
+    s_busy = 0U;
+
+    if (simClock() == SIM_CLOCK_EVENT)
+    {
+        s_pendCycles += simCostCfg()->periph;
+        cpuNs = simCyclesNs(s_pendCycles);
+        s_pendCycles -= ((double)cpuNs * (double)SIM_GCLK_HZ) / 1e9;
+        target = s_timeNs + cpuNs;
+        if (s_idleSyncs >= SIM_IDLE_SYNCS)
+        {
+            /* Nothing but polling until the next event: skip to it */
+            next = simNextEventNs();
+            if ((next != UINT64_MAX) && (next > target))
+            {
+                target = next;
+            }
+        }
+    }
+    else
+    {
+        target = simNowNs();
+        if ((s_catchUp == 0U) && (target > (s_timeNs + SIM_MAX_STEP_NS)))
+        {
+            s_droppedNs += target - (s_timeNs + SIM_MAX_STEP_NS);
+            target = s_timeNs + SIM_MAX_STEP_NS;
+        }
+    }
+    s_stolenNs = 0U;
+    activity += simRunEvents(target);
+    /* The interrupted code resumes after the handlers */
+    target += s_stolenNs;
+    s_timeNs = (s_cpuFreeNs > target) ? s_cpuFreeNs : target;
+
+    s_idleSyncs = (activity != 0U) ? 0U : (s_idleSyncs + 1U);
+    s_syncDepth = 0U;
+}
+
+/**
+ * @brief  Installs a function the sync calls at most once per period,
+ *         to exchange data with the host. NULL removes it.
+ * @param  hook      Called with the models at the time of the sync.
+ * @param  periodNs  Simulated time between two calls.
+ */
+void simSetHostHook(simHostHook_t hook, uint64_t periodNs)
+{
+    s_hook = hook;
+    s_hookPeriodNs = periodNs;
+    s_hookNextNs = s_timeNs;
+}
+
+/**
+ * @brief  Sync step of a driver busy-wait. Waiting inside an ISR would
+ *         never end, since the models only move between syncs.
+ * @param  what  Name of the waiting function, for the error message.
+ */
+void simSyncWait(const char *what)
+{
+    if (s_syncDepth != 0U)
+    {
+        fprintf(stderr, "sim: %s waits inside an ISR\n", what);
+        simFatal("blocking wait in interrupt context");
+    }
+    simSync();
+}
+
+/**
+ * @brief  Marks firmware work: the next sync does not count as polling.
+ *         Called by the models on register writes and configuring driver
+ *         calls.
+ */
+void simBusy(void)
+{
+    s_busy = 1U;
+}
+
+/**
+ * @brief  Charges CPU cycles to the code running: the interrupt handler
+ *         inside one, otherwise the code before the next sync. Only the
+ *         event clock counts them.
+ * @param  cycles  GCLK cycles.
+ */
+void simCharge(double cycles)
+{
+    if (s_inIsr != 0U)
+    {
+        s_isrCycles += cycles;
+    }
+    else
+    {
+        s_pendCycles += cycles;
+    }
+}
+
+/**
+ * @brief  Starts charging an interrupt handler (simVimDispatch()). It
+ *         starts at the current event, or once the CPU is done with the
+ *         previous handler.
+ */
+void simIsrBegin(void)
+{
+    s_inIsr = 1U;
+    s_isrStartNs = (s_cpuFreeNs > s_timeNs) ? s_cpuFreeNs : s_timeNs;
+    s_isrCycles = simCostCfg()->isrEntry;
+}
+
+/**
+ * @brief  Ends an interrupt handler: the CPU is busy with it until its
+ *         cycles have passed, and the interrupted code loses them.
+ * @return Cycles of the handler, entry and exit included.
+ */
+double simIsrEnd(void)
+{
+    uint64_t ns;
+
+    s_isrCycles += simCostCfg()->isrExit;
+    s_inIsr = 0U;
+    if (simClock() == SIM_CLOCK_EVENT)
+    {
+        ns = simCyclesNs(s_isrCycles);
+        s_cpuFreeNs = s_isrStartNs + ns;
+        s_stolenNs += ns;
+    }
+    return s_isrCycles;
+}
+
+/**
+ * @brief  Returns non-zero while simSync() runs (i.e. inside an ISR).
+ */
+uint32_t simInSync(void)
+{
+    return s_syncDepth;
+}
+
+/**
+ * @brief  Stops the simulation on a modelling error.
+ */
+void simFatal(const char *msg)
+{
+    fprintf(stderr, "sim: fatal: %s\n", msg);
+    exit(2);
+}
+
+static uint64_t simMonotonicNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief  Starts the timer signal of the wall clock.
+ */
+static void simPreemptStart(void)
+{
+    struct sigaction sa;
+    struct sigevent sev;
+    struct itimerspec its;
+    timer_t timer;
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = &simPreempt;
+    sa.sa_flags = SA_RESTART;
+    (void)sigemptyset(&sa.sa_mask);
+    memset(&sev, 0, sizeof(sev));
+    sev.sigev_notify = SIGEV_SIGNAL;
+    sev.sigev_signo = SIGALRM;
+    its.it_value.tv_sec = 0;
+    its.it_value.tv_nsec = SIM_PREEMPT_NS;
+    its.it_interval = its.it_value;
+    if ((sigaction(SIGALRM, &sa, NULL) != 0)
+     || (timer_create(CLOCK_MONOTONIC, &sev, &timer) != 0)
+     || (timer_settime(timer, 0, &its, NULL) != 0))
+    {
+        simFatal("no wall clock timer");
+    }
+}
+
+/**
+ * @brief  Timer signal: syncs, catching up with the wall clock, when the
+ *         firmware has not synced for SIM_PREEMPT_TICKS periods.
+ */
+static void simPreempt(int sig)
+{
+    (void)sig;
+
+    if (s_syncCount != s_preemptSeen)
+    {
+        s_preemptSeen = s_syncCount;
+        s_preemptQuiet = 0U;
+        return;
+    }
+    s_preemptQuiet++;
+    if ((s_preemptQuiet >= SIM_PREEMPT_TICKS) && (s_syncDepth == 0U))
+    {
+        s_catchUp = 1U;
+        simSync();
+        s_catchUp = 0U;
+        s_preemptSeen = s_syncCount;
+    }
+}
+
+/**
+ * @brief  Time of the earliest pending event of any model.
+ */
+static uint64_t simNextEventNs(void)
+{
+    uint64_t sci = simSciNextEventNs();
+    uint64_t rti = simRtiNextEventNs();
+    uint64_t next = (rti < sci) ? rti : sci;
+
+    /* A request waiting for the CPU to leave a handler */
+    if ((s_cpuFreeNs > s_timeNs) && (s_cpuFreeNs < next) && (simVimPending() != 0U))
+    {
+        next = s_cpuFreeNs;
+    }
+    return next;
+}
+
+/**
+ * @brief  Dispatches the asserted interrupts unless the CPU is still in a
+ *         handler (event clock).
+ * @return Number of handlers run.
+ */
+static uint32_t simDispatch(void)
+{
+    if (s_timeNs < s_cpuFreeNs)
+    {
+        return 0U;
+    }
+    return simVimDispatch();
+}
+
+/**
+ * @brief  Converts GCLK cycles to whole ns.
+ */
+static uint64_t simCyclesNs(double cycles)
+{
+    return (uint64_t)((cycles * 1e9) / (double)SIM_GCLK_HZ);
+}
+
+/**
+ * @brief  Runs all events up to target in time order, with DMA service
+ *         and interrupt dispatch after each.
+ * @return Number of events run.
+ */
+static uint32_t simRunEvents(uint64_t target)
+{
+    uint64_t sci, rti, wake;
+    uint32_t n = 0U;
+
+    for (;;)
+    {
+        sci = simSciNextEventNs();
+        rti = simRtiNextEventNs();
+        wake = ((s_cpuFreeNs > s_timeNs) && (simVimPending() != 0U)) ? s_cpuFreeNs : UINT64_MAX;
+        /* Handlers push the end of the step out */
+        if ((sci > (target + s_stolenNs)) && (rti > (target + s_stolenNs))
+            && (wake > (target + s_stolenNs)))
+        {
+            break;
+        }
+        if ((wake <= sci) && (wake <= rti))
+        {
+            s_timeNs = wake;
+        }
+        else if (rti < sci)
+        {
+            s_timeNs = rti;
+            simRtiRunEvent();
+        }
+        else
+        {
+            s_timeNs = sci;
+            simSciRunEvent();
+        }
+        simDmaService();
+        (void)simDispatch();
+        n++;
+    }
+    return n;
+}
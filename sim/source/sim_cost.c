@@ -0,0 +1,331 @@
+/**
+ ******************************************************************************
+ * @file    sim_cost.c
+ * @brief   CPU Cycle Cost Model of the Event Clock
+ *
+ * @details
+ *   - The event clock (sim_core.c) charges CPU time in GCLK cycles:
+ *       * periph     per sync: a peripheral register access or driver
+ *                    call and the code around it
+ *       * isr_entry  per handler: IRQ latency, VIM vector and prologue
+ *       * isr_exit   per handler: epilogue and return
+ *       * the CRC kernels, wrapped at link time (sim_cost_crc.c), their
+ *         budget per call and per byte
+ *       * the bodies of the RX interrupt and the consumers
+ *         (sciNotification, coreAdd, checksumUpdate), wrapped the same
+ *         way (sim_cost_body.c); a body's budget covers its own code,
+ *         the syncs and kernels it calls are charged as above
+ *       * sdram_ws   per 32-bit word a kernel reads from the EMIF SDRAM
+ *                    (sim_emif.c), on top of its budget
+ *   - A kernel budget is cycles at zero wait states plus memory accesses
+ *     (instruction fetches and table reads) that each pay the wait states
+ *     of where the kernel lives: none with the cache on (cache=1), else
+ *     flash_ws from flash or ram_ws from RAM (code=flash|ram, the
+ *     RAMFUNC_IN_RAM choice of HL_sys_link.cmd). flash_ws defaults to the
+ *     RWAIT that HL_system.c programs into FRDCNTL.
+ *   - The cache functions of HL_sys_core.h switch the cache entry, and
+ *     ramfuncInRam() answers from the code entry, so crc32_bench.c
+ *     measures the cases it would on the device.
+ *   - SIM_COST in the environment overrides entries as comma separated
+ *     key=value pairs; the kernel and body budgets as <name>.call,
+ *     .byte, .call_acc and .byte_acc, e.g.
+ *     SIM_COST="cache=1,crc32UpdateBurst.byte=3.1,sciNotification.call=30".
+ *
+ * @note
+ *   - The kernel budgets are estimates from the instruction and read
+ *     counts of crc32_kernel.c and crc32_kernel_r5.asm. Calibrate them
+ *     with the cycles and reads per byte crc32_bench.c (CRC_BENCHMARK)
+ *     prints on the LaunchPad. The body budgets are estimates of the
+ *     same kind; the board's PMU cycle counter around them calibrates
+ *     them.
+ *   - Code outside the syncs, kernels and bodies (a main loop's other
+ *     work) is charged by its caller with simCharge(). DMA cycle
+ *     stealing and bus contention are not modelled.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "ramfunc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Longest SIM_COST entry */
+#define SIM_COST_ENTRY_LEN      64U
+
+static simCostCfg_t s_cfg =
+{
+    20.0,   /* periph */
+    40.0,   /* isrEntry */
+    20.0,   /* isrExit */
+    3.0,    /* flashWs */
+    0.0,    /* ramWs */
+    12.0,   /* sdramWs: EMIF at VCLK3, CAS latency 2, no burst */
+    0U,     /* cache: off, as the DMA backends need */
+    1U      /* codeInRam */
+};
+
+static simCostKernelCost_t s_kernel[SIM_COST_FUNCS] =
+{
+    /* name               call   byte  callAcc byteAcc */
+    { "update_crc32",     0.0,   44.0, 0.0,    12.0, 0U, 0U },
+    { "calc_crc32",       12.0,  40.0, 4.0,    12.0, 0U, 0U },
+    { "crc32UpdateTable", 10.0,  7.0,  4.0,    3.0,  0U, 0U },
+    { "crc32UpdateWord",  24.0,  4.5,  8.0,    1.75, 0U, 0U },
+    { "crc32UpdateBurst", 30.0,  3.25, 10.0,   1.25, 0U, 0U },
+    /* Bodies only: the syncs and kernels they call are charged apart */
+    { "sciNotification",  12.0,  0.0,  6.0,    0.0,  0U, 0U },
+    { "coreAdd",          14.0,  0.0,  6.0,    0.0,  0U, 0U },
+    { "checksumUpdate",   40.0,  9.0,  14.0,   2.5,  0U, 0U }
+};
+static uint32_t s_loaded = 0U;
+
+static void simCostLoad(void);
+static void simCostSet(const char *key, const char *value);
+static double simCostWaitStates(void);
+
+/**
+ * @brief  Returns the cost table, SIM_COST applied.
+ */
+const simCostCfg_t *simCostCfg(void)
+{
+    if (s_loaded == 0U)
+    {
+        simCostLoad();
+    }
+    return &s_cfg;
+}
+
+/**
+ * @brief  Returns the budget and the call counts of a kernel.
+ */
+const simCostKernelCost_t *simCostKernel(simCostKernel_t kernel)
+{
+    (void)simCostCfg();
+    return &s_kernel[kernel];
+}
+
+/**
+ * @brief  Cycles per byte of a kernel in the steady state, wait states
+ *         included.
+ */
+double simCostPerByte(simCostKernel_t kernel)
+{
+    const simCostKernelCost_t *k = simCostKernel(kernel);
+
+    return k->byte + (k->byteAcc * simCostWaitStates());
+}
+
+/**
+ * @brief  Cycles of a call on one byte, wait states included.
+ */
+double simCostPerCall(simCostKernel_t kernel)
+{
+    const simCostKernelCost_t *k = simCostKernel(kernel);
+
+    return k->call + (k->callAcc * simCostWaitStates()) + simCostPerByte(kernel);
+}
+
+/**
+ * @brief  Charges one kernel or body call (sim_cost_crc.c,
+ *         sim_cost_body.c).
+ * @param  kernel  Kernel called.
+ * @param  len     Bytes it processes.
+ */
+void simCostKernelCall(simCostKernel_t kernel, uint32_t len)
+{
+    simCostKernelCost_t *k = &s_kernel[kernel];
+    double ws = simCostWaitStates();
+
+    k->calls++;
+    k->bytes += len;
+    simCharge(k->call + (k->callAcc * ws) + ((double)len * (k->byte + (k->byteAcc * ws))));
+}
+
+/**
+ * @brief  Clears the call counts of the kernels and bodies.
+ */
+void simCostClearStats(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < (uint32_t)SIM_COST_FUNCS; i++)
+    {
+        s_kernel[i].calls = 0U;
+        s_kernel[i].bytes = 0U;
+    }
+}
+
+void _cacheEnable_(void)
+{
+    (void)simCostCfg();
+    s_cfg.cache = 1U;
+    simBusy();
+}
+
+void _cacheDisable_(void)
+{
+    (void)simCostCfg();
+    s_cfg.cache = 0U;
+    simBusy();
+}
+
+void _dCacheClean_(void)
+{
+}
+
+uint32_t ramfuncInRam(void)
+{
+    return simCostCfg()->codeInRam;
+}
+
+/**
+ * @brief  Applies SIM_COST from the environment.
+ */
+static void simCostLoad(void)
+{
+    const char *env = getenv("SIM_COST");
+    char entry[SIM_COST_ENTRY_LEN];
+    const char *end;
+    char *eq;
+    size_t len;
+
+    s_loaded = 1U;
+    while ((env != NULL) && (*env != '\0'))
+    {
+        end = strchr(env, ',');
+        len = (end != NULL) ? (size_t)(end - env) : strlen(env);
+        if (len >= SIM_COST_ENTRY_LEN)
+        {
+            simFatal("SIM_COST entry too long");
+        }
+        memcpy(entry, env, len);
+        entry[len] = '\0';
+
+        eq = strchr(entry, '=');
+        if (eq == NULL)
+        {
+            fprintf(stderr, "sim: SIM_COST entry '%s' is not key=value\n", entry);
+            simFatal("bad SIM_COST");
+        }
+        *eq = '\0';
+        simCostSet(entry, eq + 1);
+
+        env = (end != NULL) ? (end + 1) : NULL;
+    }
+}
+
+/**
+ * @brief  Sets one entry of the cost table.
+ */
+static void simCostSet(const char *key, const char *value)
+{
+    const char *dot = strchr(key, '.');
+    char *end;
+    double v = strtod(value, &end);
+    simCostKernelCost_t *k = NULL;
+    uint32_t i;
+
+    if ((strcmp(key, "code") == 0) && ((strcmp(value, "ram") == 0) || (strcmp(value, "flash") == 0)))
+    {
+        s_cfg.codeInRam = (strcmp(value, "ram") == 0) ? 1U : 0U;
+        return;
+    }
+    if ((end == value) || (*end != '\0') || (v < 0.0))
+    {
+        fprintf(stderr, "sim: SIM_COST %s=%s is not a number of cycles\n", key, value);
+        simFatal("bad SIM_COST");
+    }
+
+    if (dot != NULL)
+    {
+        for (i = 0U; i < (uint32_t)SIM_COST_FUNCS; i++)
+        {
+            if ((strlen(s_kernel[i].name) == (size_t)(dot - key))
+                && (strncmp(s_kernel[i].name, key, (size_t)(dot - key)) == 0))
+            {
+                k = &s_kernel[i];
+            }
+        }
+        if (k == NULL)
+        {
+            /* Not a kernel or body */
+        }
+        else if (strcmp(dot, ".call") == 0)
+        {
+            k->call = v;
+            return;
+        }
+        else if (strcmp(dot, ".byte") == 0)
+        {
+            k->byte = v;
+            return;
+        }
+        else if (strcmp(dot, ".call_acc") == 0)
+        {
+            k->callAcc = v;
+            return;
+        }
+        else if (strcmp(dot, ".byte_acc") == 0)
+        {
+            k->byteAcc = v;
+            return;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else if (strcmp(key, "periph") == 0)
+    {
+        s_cfg.periph = v;
+        return;
+    }
+    else if (strcmp(key, "isr_entry") == 0)
+    {
+        s_cfg.isrEntry = v;
+        return;
+    }
+    else if (strcmp(key, "isr_exit") == 0)
+    {
+        s_cfg.isrExit = v;
+        return;
+    }
+    else if (strcmp(key, "flash_ws") == 0)
+    {
+        s_cfg.flashWs = v;
+        return;
+    }
+    else if (strcmp(key, "ram_ws") == 0)
+    {
+        s_cfg.ramWs = v;
+        return;
+    }
+    else if (strcmp(key, "sdram_ws") == 0)
+    {
+        s_cfg.sdramWs = v;
+        return;
+    }
+    else if (strcmp(key, "cache") == 0)
+    {
+        s_cfg.cache = (v != 0.0) ? 1U : 0U;
+        return;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    fprintf(stderr, "sim: SIM_COST key '%s' is unknown\n", key);
+    simFatal("bad SIM_COST");
+}
+
+/**
+ * @brief  Wait states of a kernel memory access.
+ */
+static double simCostWaitStates(void)
+{
+    if (s_cfg.cache != 0U)
+    {
+        return 0.0;
+    }
+    return (s_cfg.codeInRam != 0U) ? s_cfg.ramWs : s_cfg.flashWs;
+}
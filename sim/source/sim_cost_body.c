@@ -0,0 +1,66 @@
+/**
+ ******************************************************************************
+ * @file    sim_cost_body.c
+ * @brief   Cycle Charging Wrappers of the RX Interrupt and Consumer Bodies
+ *
+ * @details
+ *   - Linked with -Wl,--wrap=<function> (Makefile) as sim_cost_crc.c is:
+ *     calls from other files reach __wrap_<function>, which charges the
+ *     body's budget (simCostKernelCall()) and runs the real one. The
+ *     driver calls, syncs and kernels inside a body charge their own.
+ *       * sciNotification, the SCI RX completion of the interrupt
+ *         backend (core_rx_interrupt.c), called by the level 0 handler
+ *         of sim_sci.c
+ *       * coreAdd, the shared core's consumer, when a backend hands on
+ *         bytes to it
+ *       * checksumUpdate, the uart-crc32-dma checksum engine
+ *   - Holds the default sciNotification() for builds without one. It is
+ *     here, not in sim_sci.c, because --wrap only reaches references to
+ *     a symbol another file defines.
+ *
+ * @note
+ *   - The real coreAdd() and checksumUpdate() are weak references: not
+ *     every binary links core.c or checksum.c, and one that does not
+ *     never calls them.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "HL_sci.h"
+#include "core.h"
+#include "checksum.h"
+
+void __real_sciNotification(sciBASE_t *sci, uint32 flags);
+__attribute__((weak)) void __real_coreAdd(const uint8_t *data, uint32_t len);
+__attribute__((weak)) void __real_checksumUpdate(checksumCtx_t *ctx, const uint8_t *data, uint32_t len);
+
+void __wrap_sciNotification(sciBASE_t *sci, uint32 flags);
+void __wrap_coreAdd(const uint8_t *data, uint32_t len);
+void __wrap_checksumUpdate(checksumCtx_t *ctx, const uint8_t *data, uint32_t len);
+
+/**
+ * @brief  Default notification for builds without one.
+ */
+__attribute__((weak)) void sciNotification(sciBASE_t *sci, uint32 flags)
+{
+    (void)sci;
+    (void)flags;
+}
+
+void __wrap_sciNotification(sciBASE_t *sci, uint32 flags)
+{
+    simCostKernelCall(SIM_COST_SCI_NOTIFICATION, 0U);
+    __real_sciNotification(sci, flags);
+}
+
+void __wrap_coreAdd(const uint8_t *data, uint32_t len)
+{
+    simCostKernelCall(SIM_COST_CORE_ADD, len);
+    __real_coreAdd(data, len);
+}
+
+void __wrap_checksumUpdate(checksumCtx_t *ctx, const uint8_t *data, uint32_t len)
+{
+    simCostKernelCall(SIM_COST_CHECKSUM_UPDATE, len);
+    simEmifChargeRead(data, len);
+    __real_checksumUpdate(ctx, data, len);
+}
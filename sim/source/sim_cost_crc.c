@@ -0,0 +1,63 @@
+/**
+ ******************************************************************************
+ * @file    sim_cost_crc.c
+ * @brief   Cycle Charging Wrappers of the CRC32 Kernels
+ *
+ * @details
+ *   - Linked with -Wl,--wrap=<kernel> (Makefile): calls from other files
+ *     reach __wrap_<kernel>, which charges the kernel's budget
+ *     (simCostKernelCall()) and runs the real kernel. Calls inside
+ *     crc32_kernel.c itself are not wrapped.
+ *   - Kernels reading from the SDRAM model also pay its wait states
+ *     (simEmifChargeRead()).
+ *   - Only linked into the binaries that contain the kernels.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "crc32_kernel.h"
+
+uint32_t __real_update_crc32(uint32_t crc, uint8_t data);
+uint32_t __real_calc_crc32(uint8_t *data, uint32_t len);
+uint32_t __real_crc32UpdateTable(uint32_t crc, const uint8_t *data, uint32_t len);
+uint32_t __real_crc32UpdateWord(uint32_t crc, const uint8_t *data, uint32_t len);
+uint32_t __real_crc32UpdateBurst(uint32_t crc, const uint8_t *data, uint32_t len);
+
+uint32_t __wrap_update_crc32(uint32_t crc, uint8_t data);
+uint32_t __wrap_calc_crc32(uint8_t *data, uint32_t len);
+uint32_t __wrap_crc32UpdateTable(uint32_t crc, const uint8_t *data, uint32_t len);
+uint32_t __wrap_crc32UpdateWord(uint32_t crc, const uint8_t *data, uint32_t len);
+uint32_t __wrap_crc32UpdateBurst(uint32_t crc, const uint8_t *data, uint32_t len);
+
+uint32_t __wrap_update_crc32(uint32_t crc, uint8_t data)
+{
+    simCostKernelCall(SIM_COST_UPDATE_CRC32, 1U);
+    return __real_update_crc32(crc, data);
+}
+
+uint32_t __wrap_calc_crc32(uint8_t *data, uint32_t len)
+{
+    simCostKernelCall(SIM_COST_CALC_CRC32, len);
+    simEmifChargeRead(data, len);
+    return __real_calc_crc32(data, len);
+}
+
+uint32_t __wrap_crc32UpdateTable(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    simCostKernelCall(SIM_COST_CRC32_TABLE, len);
+    simEmifChargeRead(data, len);
+    return __real_crc32UpdateTable(crc, data, len);
+}
+
+uint32_t __wrap_crc32UpdateWord(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    simCostKernelCall(SIM_COST_CRC32_WORD, len);
+    simEmifChargeRead(data, len);
+    return __real_crc32UpdateWord(crc, data, len);
+}
+
+uint32_t __wrap_crc32UpdateBurst(uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    simCostKernelCall(SIM_COST_CRC32_BURST, len);
+    simEmifChargeRead(data, len);
+    return __real_crc32UpdateBurst(crc, data, len);
+}
@@ -0,0 +1,143 @@
+/**
+ ******************************************************************************
+ * @file    sim_crc.c
+ * @brief   CRC Controller (MCRC) PSA Model
+ *
+ * @details
+ *   - Models the PSA signature of channels 1 and 2 of crcREG1/crcREG2.
+ *     64-bit DMA writes to PSA_SIGREGLx are compressed into the signature
+ *     in full-CPU and semi-CPU mode; in data capture mode (CTRL2 mode 0)
+ *     the word is stored as is.
+ *   - simCrcCompress() follows the hardware description bit by bit: for
+ *     each data bit, MSB first, the new bit 0 is bit 63 xor the data bit,
+ *     bits 1, 3 and 4 also take bit 63 xor the data bit on top of the
+ *     shift, every other bit is a plain shift. It shares no code with
+ *     psaSoftwareSign() in the firmware, so the two check each other.
+ *   - CH1_PSA_SWREST/CH2_PSA_SWREST in CTRL0 clear the signature.
+ *   - The signature is published as on the BE32 device: PSA_SIGREGLx holds
+ *     the upper and PSA_SIGREGHx the lower 32 bits. A data word is the
+ *     eight written bytes in big-endian order.
+ *
+ * @note
+ *   - CPU writes to PSA_SIGREGLx are not compressed, only DMA writes.
+ *   - Pattern/sector counters, timeouts and AUTO mode compare are not
+ *     modelled.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "HL_crc.h"
+
+#define SIM_CRC_MODULES         2U
+#define SIM_CRC_CHANNELS        2U
+/* CTRL0 CHx_PSA_SWREST bits */
+#define SIM_CRC_CH1_SWREST      0x00000001U
+#define SIM_CRC_CH2_SWREST      0x00000100U
+
+static crcBASE_t s_crc[SIM_CRC_MODULES];
+static uint64_t s_sig[SIM_CRC_MODULES][SIM_CRC_CHANNELS];
+
+static uint64_t simCrcCompress(uint64_t crc, uint64_t data);
+static void simCrcPublish(uint32_t m);
+
+crcBASE_t *simCrcRegs(uint32_t index)
+{
+    simSync();
+    return (crcBASE_t *)&s_crc[index];
+}
+
+/**
+ * @brief  Decodes firmware writes to CTRL0 (signature resets).
+ */
+void simCrcApplyWrites(void)
+{
+    uint32_t m;
+
+    for (m = 0U; m < SIM_CRC_MODULES; m++)
+    {
+        if ((s_crc[m].CTRL0 & SIM_CRC_CH1_SWREST) != 0U)
+        {
+            s_sig[m][0U] = 0U;
+        }
+        if ((s_crc[m].CTRL0 & SIM_CRC_CH2_SWREST) != 0U)
+        {
+            s_sig[m][1U] = 0U;
+        }
+        simCrcPublish(m);
+    }
+}
+
+/**
+ * @brief  DMA write into a CRC module.
+ * @return Non-zero when addr is a PSA signature register (write consumed).
+ */
+uint32_t simCrcDmaWrite(uint32_t addr, const uint8_t *data, uint32_t size)
+{
+    uint32_t m, ch, mode, i;
+    uint64_t word = 0U;
+
+    for (m = 0U; m < SIM_CRC_MODULES; m++)
+    {
+        for (ch = 0U; ch < SIM_CRC_CHANNELS; ch++)
+        {
+            volatile uint32 *reg = (ch == 0U) ? &s_crc[m].PSA_SIGREGL1 : &s_crc[m].PSA_SIGREGL2;
+
+            if (addr != simTargetAddr(reg))
+            {
+                continue;
+            }
+            if (size != 8U)
+            {
+                simFatal("PSA signature register written with a non 64-bit element");
+            }
+            for (i = 0U; i < 8U; i++)
+            {
+                word = (word << 8U) | (uint64_t)data[i];
+            }
+            mode = (s_crc[m].CTRL2 >> (ch * 8U)) & 3U;
+            s_sig[m][ch] = (mode == 0U) ? word : simCrcCompress(s_sig[m][ch], word);
+            simCrcPublish(m);
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/*---------------------------------------------------------------------------*/
+
+/**
+ * @brief  One PSA compression step, written out per bit as the hardware
+ *         description does.
+ */
+static uint64_t simCrcCompress(uint64_t crc, uint64_t data)
+{
+    uint64_t next;
+    uint64_t fb;
+    int32_t i;
+    uint32_t j;
+
+    for (i = 63; i >= 0; i--)
+    {
+        fb = ((crc >> 63U) ^ (data >> (uint32_t)i)) & 1U;
+        next = fb;
+        for (j = 1U; j < 64U; j++)
+        {
+            uint64_t bit = (crc >> (j - 1U)) & 1U;
+
+            if ((j == 1U) || (j == 3U) || (j == 4U))
+            {
+                bit ^= fb;
+            }
+            next |= bit << j;
+        }
+        crc = next;
+    }
+    return crc;
+}
+
+static void simCrcPublish(uint32_t m)
+{
+    s_crc[m].PSA_SIGREGL1 = (uint32_t)(s_sig[m][0U] >> 32U);
+    s_crc[m].PSA_SIGREGH1 = (uint32_t)s_sig[m][0U];
+    s_crc[m].PSA_SIGREGL2 = (uint32_t)(s_sig[m][1U] >> 32U);
+    s_crc[m].PSA_SIGREGH2 = (uint32_t)s_sig[m][1U];
+}
@@ -0,0 +1,418 @@
+/**
+ ******************************************************************************
+ * @file    sim_dma.c
+ * @brief   DMA Controller Model and DMA Driver Functions
+ *
+ * @details
+ *   - Control packets are written to the simulated PCP RAM by
+ *     dmaSetCtrlPacket() exactly as the HALCoGen driver does, and are
+ *     decoded from there when a channel first runs. Progress is published
+ *     in the WCP (CSADDR, CDADDR, CTCOUNT).
+ *   - A hardware channel performs one frame (FRAME_TRANSFER) or the whole
+ *     block (BLOCK_TRANSFER) per request while its request line is
+ *     asserted. Software-triggered channels run the whole block at once.
+ *   - FTC, HBC and BTC flags are kept; AUTOINIT reloads the packet at the
+ *     end of the block, otherwise the channel disables itself.
+ *   - The BTC interrupt of group A is modelled: a channel enabled with
+ *     dmaEnableInterrupt() raises VIM request 40 while its BTC flag is
+ *     set. Handlers clear it by writing BTCFLAG; reading BTCAOFFSET does
+ *     not clear it here.
+ *   - Addresses in a packet are 32 bit. They are mapped back onto the
+ *     SCI RD/TD registers, the CRC PSA signature registers or onto host
+ *     memory (simHostAddr()), checked against the SDRAM model when they
+ *     fall into it (sim_emif.c). Elements are moved as raw bytes, up to 64
+ *     bit.
+ *
+ * @note
+ *   - Read and write element sizes must be equal; packing is not modelled.
+ *   - BTCFLAG/FTCFLAG/HBCFLAG read with SIM_W1C_MARK set, so channel 31
+ *     cannot be used.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "HL_sys_dma.h"
+#include <string.h>
+
+#define SIM_DMA_CHANNELS        32U
+#define SIM_DMA_NONE            0xFFFFFFFFU
+/* Frames one request may move before the model gives up on a stuck line */
+#define SIM_DMA_MAX_FRAMES      0x10000U
+/* VIM request of the group A block transfer complete interrupt */
+#define SIM_DMA_VIM_BTCA        40U
+
+static dmaBASE_t s_dma;
+static dmaRAMBASE_t s_dmaRam;
+
+static uint32_t s_enabled = 0U;
+static uint32_t s_hwEnabled = 0U;
+static uint32_t s_loaded = 0U;
+static uint32_t s_btc = 0U;
+static uint32_t s_ftc = 0U;
+static uint32_t s_hbc = 0U;
+/* Channels whose BTC interrupt is enabled on group A */
+static uint32_t s_btcIntA = 0U;
+static uint32_t s_chReq[SIM_DMA_CHANNELS];
+static uint32_t s_reqInit = 0U;
+
+static void simDmaPublish(void);
+static void simDmaW1c(volatile uint32 *reg, uint32_t *flags);
+static void simDmaLoad(uint32_t ch);
+static uint32_t simDmaFrame(uint32_t ch);
+static void simDmaReadElement(uint32_t addr, uint32_t size, uint8_t *element);
+static void simDmaWriteElement(uint32_t addr, uint32_t size, const uint8_t *element);
+static void simDmaInitReq(void);
+
+dmaBASE_t *simDmaRegs(void)
+{
+    simSync();
+    return (dmaBASE_t *)&s_dma;
+}
+
+dmaRAMBASE_t *simDmaRamRegs(void)
+{
+    simSync();
+    return (dmaRAMBASE_t *)&s_dmaRam;
+}
+
+/**
+ * @brief  Decodes firmware writes to the flag registers.
+ */
+void simDmaApplyWrites(void)
+{
+    simDmaW1c(&s_dma.BTCFLAG, &s_btc);
+    simDmaW1c(&s_dma.FTCFLAG, &s_ftc);
+    simDmaW1c(&s_dma.HBCFLAG, &s_hbc);
+    simDmaPublish();
+}
+
+/**
+ * @brief  Serves every enabled hardware channel whose request is asserted.
+ */
+void simDmaService(void)
+{
+    uint32_t ch, n, pending;
+
+    if ((s_enabled == 0U) || (s_hwEnabled == 0U))
+    {
+        return;
+    }
+    simDmaInitReq();
+
+    /* Enabled channels only, lowest first */
+    pending = s_hwEnabled;
+    while (pending != 0U)
+    {
+        ch = (uint32_t)__builtin_ctz(pending);
+        pending &= pending - 1U;
+        for (n = 0U; n < SIM_DMA_MAX_FRAMES; n++)
+        {
+            if ((((s_hwEnabled >> ch) & 1U) == 0U) || (s_chReq[ch] == SIM_DMA_NONE)
+             || (simSciDmaAsserted(s_chReq[ch]) == 0U))
+            {
+                break;
+            }
+            (void)simDmaFrame(ch);
+        }
+    }
+    simDmaPublish();
+}
+
+/**
+ * @brief  Level of the group A BTC request, with the handler's flag
+ *         writes applied first.
+ */
+uint32_t simDmaIrqAsserted(uint32_t request)
+{
+    if (request != SIM_DMA_VIM_BTCA)
+    {
+        return 0U;
+    }
+    simDmaW1c(&s_dma.BTCFLAG, &s_btc);
+    simDmaPublish();
+    return ((s_btc & s_btcIntA) != 0U) ? 1U : 0U;
+}
+
+/**
+ * @brief  Maps a 32-bit target address onto host memory. Firmware buffers
+ *         and the simulator share one image, so they share the upper half
+ *         of their host addresses.
+ */
+void *simHostAddr(uint32_t addr)
+{
+    uintptr_t base = (uintptr_t)&s_dmaRam;
+
+    base &= ~(uintptr_t)0xFFFFFFFFU;
+    return (void *)(base | (uintptr_t)addr);
+}
+
+/**
+ * @brief  32-bit address the firmware computes for a host pointer.
+ */
+uint32_t simTargetAddr(const volatile void *ptr)
+{
+    return (uint32_t)(uintptr_t)ptr;
+}
+
+/*---------------------------------------------------------------------------*/
+/* Driver functions (HL_sys_dma.h)                                           */
+
+void dmaEnable(void)
+{
+    s_enabled = 1U;
+    s_dma.GCTRL = 0x00010000U;
+    simBusy();
+    simSync();
+}
+
+void dmaDisable(void)
+{
+    s_enabled = 0U;
+    s_dma.GCTRL = 0U;
+    simBusy();
+}
+
+void dmaReqAssign(dmaChannel_t channel, dmaRequest_t reqline)
+{
+    simDmaInitReq();
+    s_chReq[channel] = (uint32_t)reqline;
+    simBusy();
+}
+
+uint32 dmaGetReq(dmaChannel_t channel)
+{
+    simDmaInitReq();
+    return s_chReq[channel];
+}
+
+void dmaSetCtrlPacket(dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT)
+{
+    s_dmaRam.PCP[channel].ISADDR  = g_dmaCTRLPKT.SADD;
+    s_dmaRam.PCP[channel].IDADDR  = g_dmaCTRLPKT.DADD;
+    s_dmaRam.PCP[channel].ITCOUNT = (g_dmaCTRLPKT.FRCNT << 16U) | g_dmaCTRLPKT.ELCNT;
+    s_dmaRam.PCP[channel].CHCTRL  = (g_dmaCTRLPKT.RDSIZE << 14U) | (g_dmaCTRLPKT.WRSIZE << 12U)
+                                  | (g_dmaCTRLPKT.TTYPE << 8U) | (g_dmaCTRLPKT.ADDMODERD << 3U)
+                                  | (g_dmaCTRLPKT.ADDMODEWR << 1U) | g_dmaCTRLPKT.AUTOINIT
+                                  | (g_dmaCTRLPKT.CHCTRL << 16U);
+    s_dmaRam.PCP[channel].EIOFF   = (g_dmaCTRLPKT.ELDOFFSET << 16U) | g_dmaCTRLPKT.ELSOFFSET;
+    s_dmaRam.PCP[channel].FIOFF   = (g_dmaCTRLPKT.FRDOFFSET << 16U) | g_dmaCTRLPKT.FRSOFFSET;
+
+    if ((g_dmaCTRLPKT.RDSIZE != g_dmaCTRLPKT.WRSIZE))
+    {
+        simFatal("DMA element packing (RDSIZE != WRSIZE) is not modelled");
+    }
+    simBusy();
+}
+
+void dmaSetChEnable(dmaChannel_t channel, dmaTriggerType_t type)
+{
+    uint32_t bit = (uint32_t)1U << channel;
+    uint32_t n;
+
+    s_loaded &= ~bit;
+    simBusy();
+    if (type == DMA_HW)
+    {
+        s_hwEnabled |= bit;
+        simSync();
+    }
+    else
+    {
+        for (n = 0U; n < SIM_DMA_MAX_FRAMES; n++)
+        {
+            if (simDmaFrame(channel) != 0U)
+            {
+                break;
+            }
+        }
+        simDmaPublish();
+    }
+}
+
+void dmaEnableInterrupt(dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group)
+{
+    if ((inttype != BTC) || (group != DMA_INTA))
+    {
+        simFatal("only the group A BTC interrupt of the DMA is modelled");
+    }
+    s_btcIntA |= (uint32_t)1U << channel;
+    simBusy();
+    simSync();
+}
+
+void dmaDisableInterrupt(dmaChannel_t channel, dmaInterrupt_t inttype)
+{
+    if (inttype == BTC)
+    {
+        s_btcIntA &= ~((uint32_t)1U << channel);
+    }
+    simBusy();
+}
+
+boolean dmaIsChannelActive(dmaChannel_t channel)
+{
+    simSync();
+    return (((s_hwEnabled >> channel) & 1U) != 0U) ? TRUE : FALSE;
+}
+
+boolean dmaGetInterruptStatus(dmaChannel_t channel, dmaInterrupt_t inttype)
+{
+    uint32_t flags;
+
+    simSync();
+    switch (inttype)
+    {
+    case FTC: flags = s_ftc; break;
+    case HBC: flags = s_hbc; break;
+    case BTC: flags = s_btc; break;
+    default:  flags = 0U;    break;
+    }
+    return (((flags >> channel) & 1U) != 0U) ? TRUE : FALSE;
+}
+
+/*---------------------------------------------------------------------------*/
+
+static void simDmaPublish(void)
+{
+    s_dma.BTCFLAG = s_btc | SIM_W1C_MARK;
+    s_dma.FTCFLAG = s_ftc | SIM_W1C_MARK;
+    s_dma.HBCFLAG = s_hbc | SIM_W1C_MARK;
+    s_dma.HWCHENAS = s_hwEnabled;
+}
+
+static void simDmaW1c(volatile uint32 *reg, uint32_t *flags)
+{
+    if (*reg != (*flags | SIM_W1C_MARK))
+    {
+        *flags &= ~(*reg & ~SIM_W1C_MARK);
+        simBusy();
+    }
+}
+
+/**
+ * @brief  Copies the control packet into the working packet.
+ */
+static void simDmaLoad(uint32_t ch)
+{
+    s_dmaRam.WCP[ch].CSADDR  = s_dmaRam.PCP[ch].ISADDR;
+    s_dmaRam.WCP[ch].CDADDR  = s_dmaRam.PCP[ch].IDADDR;
+    s_dmaRam.WCP[ch].CTCOUNT = s_dmaRam.PCP[ch].ITCOUNT;
+    s_loaded |= (uint32_t)1U << ch;
+}
+
+/**
+ * @brief  Moves one frame (or the whole block in block mode).
+ * @return Non-zero when the block completed.
+ */
+static uint32_t simDmaFrame(uint32_t ch)
+{
+    uint32_t bit = (uint32_t)1U << ch;
+    uint32_t chctrl = s_dmaRam.PCP[ch].CHCTRL;
+    uint32_t size = (uint32_t)1U << ((chctrl >> 14U) & 3U);
+    uint32_t block = (chctrl >> 8U) & 1U;
+    uint32_t amRd = (chctrl >> 3U) & 3U;
+    uint32_t amWr = (chctrl >> 1U) & 3U;
+    uint32_t elcnt = s_dmaRam.PCP[ch].ITCOUNT & 0x1FFFU;
+    uint32_t frTotal = (s_dmaRam.PCP[ch].ITCOUNT >> 16U) & 0x1FFFU;
+    int32_t eiSrc = (int32_t)((s_dmaRam.PCP[ch].EIOFF << 19U)) >> 19;
+    int32_t eiDst = (int32_t)((s_dmaRam.PCP[ch].EIOFF >> 16U) << 19U) >> 19;
+    int32_t fiSrc = (int32_t)((s_dmaRam.PCP[ch].FIOFF << 19U)) >> 19;
+    int32_t fiDst = (int32_t)((s_dmaRam.PCP[ch].FIOFF >> 16U) << 19U) >> 19;
+    uint32_t src, dst, frames, e;
+    uint8_t element[8U];
+
+    if (((s_loaded >> ch) & 1U) == 0U)
+    {
+        simDmaLoad(ch);
+    }
+    src = s_dmaRam.WCP[ch].CSADDR;
+    dst = s_dmaRam.WCP[ch].CDADDR;
+    frames = (s_dmaRam.WCP[ch].CTCOUNT >> 16U) & 0x1FFFU;
+
+    do
+    {
+        for (e = 0U; e < elcnt; e++)
+        {
+            uint32_t last = (e == (elcnt - 1U)) ? 1U : 0U;
+
+            simDmaReadElement(src, size, element);
+            simDmaWriteElement(dst, size, element);
+
+            /* Offset mode uses the frame offset after the last element */
+            src += (amRd == (uint32_t)ADDR_INC1) ? size
+                 : (amRd == (uint32_t)ADDR_OFFSET) ? (uint32_t)(last ? fiSrc : eiSrc) : 0U;
+            dst += (amWr == (uint32_t)ADDR_INC1) ? size
+                 : (amWr == (uint32_t)ADDR_OFFSET) ? (uint32_t)(last ? fiDst : eiDst) : 0U;
+        }
+        frames--;
+        s_ftc |= bit;
+        if (frames == (frTotal / 2U))
+        {
+            s_hbc |= bit;
+        }
+    } while ((block != 0U) && (frames > 0U));
+
+    s_dmaRam.WCP[ch].CSADDR = src;
+    s_dmaRam.WCP[ch].CDADDR = dst;
+    s_dmaRam.WCP[ch].CTCOUNT = (frames << 16U) | elcnt;
+
+    if (frames != 0U)
+    {
+        return 0U;
+    }
+
+    s_btc |= bit;
+    if ((chctrl & 1U) != 0U)
+    {
+        simDmaLoad(ch);
+    }
+    else
+    {
+        s_hwEnabled &= ~bit;
+        s_loaded &= ~bit;
+    }
+    return 1U;
+}
+
+static void simDmaReadElement(uint32_t addr, uint32_t size, uint8_t *element)
+{
+    uint32_t value = 0U;
+
+    if (simSciDmaRead(addr, &value) != 0U)
+    {
+        (void)memcpy(element, &value, sizeof(value));
+        return;
+    }
+    (void)simEmifDmaCheck(addr, size);
+    (void)memcpy(element, simHostAddr(addr), size);
+}
+
+static void simDmaWriteElement(uint32_t addr, uint32_t size, const uint8_t *element)
+{
+    uint32_t value = 0U;
+
+    if (simCrcDmaWrite(addr, element, size) != 0U)
+    {
+        return;
+    }
+    (void)memcpy(&value, element, (size < sizeof(value)) ? size : sizeof(value));
+    if (simSciDmaWrite(addr, value) != 0U)
+    {
+        return;
+    }
+    (void)simEmifDmaCheck(addr, size);
+    (void)memcpy(simHostAddr(addr), element, size);
+}
+
+static void simDmaInitReq(void)
+{
+    uint32_t ch;
+
+    if (s_reqInit == 0U)
+    {
+        for (ch = 0U; ch < SIM_DMA_CHANNELS; ch++)
+        {
+            s_chReq[ch] = SIM_DMA_NONE;
+        }
+        s_reqInit = 1U;
+    }
+}
@@ -0,0 +1,173 @@
+/**
+ ******************************************************************************
+ * @file    sim_echo_main.c
+ * @brief   Loopback Check of the uart-dma Pool Echo
+ *
+ * @details
+ *   - Runs main() of uart-dma/source/uart_dma_main.c, built with
+ *     ECHO_LOOPBACK_TEST=1 and renamed simFirmwareMain() (Makefile), on
+ *     the event clock. Its loopback test circulates a seed through the
+ *     echo for LOOPBACK_TEST_MS: every span goes out by TX DMA straight
+ *     from its pool block and is released at the TX block complete, and
+ *     the RX channel is re-armed into the next block at each block end.
+ *   - A re-arm later than one character time shows up as an SCI3
+ *     overrun and a short stream, a span sent twice or out of order as a
+ *     mismatch in loopback_check(), a block never released as a stuck
+ *     echo or an exhausted pool, an unbalanced release as a block count
+ *     other than 1 once the echo queue is dropped.
+ *   - sciInit() is wrapped (-Wl,--wrap=sciInit) to move SCI3 to the rate
+ *     of the command line after the generated set-up.
+ *   - Once the firmware's report line is out, checks it: no mismatch, no
+ *     overrun, no exhausted pool, only the RX block in use and at least
+ *     SIM_ECHO_MIN_PERMILLE of the line rate echoed.
+ *   - Usage: sim_echo [baud], default the HALCoGen rate. Exit status 1
+ *     on any failed check, or when no report comes within
+ *     SIM_ECHO_LIMIT_S, so make sim_echo fails the build.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "core_pool.h"
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* SCI index of sciREG3, the port of the echo */
+#define SIM_ECHO_SCI            2U
+/* Share of the line rate the echo has to sustain, per mille */
+#define SIM_ECHO_MIN_PERMILLE   950UL
+/* Host seconds allowed for start-up, test and report. A wall clock
+   limit: firmware stuck waiting for a DMA that never completes also
+   stops simulated time */
+#define SIM_ECHO_LIMIT_S        60U
+
+/* uart_dma_main.c */
+void simFirmwareMain(void);
+extern uint32_t loopback_errors;
+
+void __real_sciInit(void);
+void __wrap_sciInit(void);
+
+static uint32_t s_baud = 0U;
+static char s_line[128];
+static uint32_t s_len = 0U;
+
+static void simEchoSink(uint32_t index, uint8_t data);
+static void simEchoCheck(const char *line);
+static void simEchoLimit(int sig);
+
+int main(int argc, char **argv)
+{
+    s_baud = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 0U;
+
+    simSetClock(SIM_CLOCK_EVENT);
+    vimInit();
+    simSciSetTxSink(&simEchoSink);
+    (void)signal(SIGALRM, &simEchoLimit);
+    (void)alarm(SIM_ECHO_LIMIT_S);
+
+    simFirmwareMain();
+    return 1;
+}
+
+/**
+ * @brief  The generated set-up, then the rate under test.
+ */
+void __wrap_sciInit(void)
+{
+    __real_sciInit();
+    if (s_baud != 0U)
+    {
+        sciSetBaudrate(sciREG3, s_baud);
+    }
+}
+
+/**
+ * @brief  Collects the firmware's text lines and checks the report.
+ */
+static void simEchoSink(uint32_t index, uint8_t data)
+{
+    (void)index;
+    putchar((int)data);
+    if (data == (uint8_t)'\n')
+    {
+        s_line[s_len] = '\0';
+        s_len = 0U;
+        if (strncmp(s_line, "Loopback: ", 10U) == 0)
+        {
+            simEchoCheck(s_line);
+        }
+    }
+    else if (s_len < (sizeof(s_line) - 1U))
+    {
+        s_line[s_len++] = (char)data;
+    }
+    else
+    {
+        /* Longer than any report, not a line of interest */
+    }
+}
+
+/**
+ * @brief  Checks the report line and ends the run.
+ */
+static void simEchoCheck(const char *line)
+{
+    const corePoolStats_t *pool = corePoolGetStats();
+    unsigned long bytes, ms, rate, lineRate, errors;
+    uint32_t overruns = simSciOverruns(SIM_ECHO_SCI);
+    uint32_t failed = 0U;
+
+    fflush(stdout);
+    if (sscanf(line, "Loopback: %lu bytes in %lu ms, %lu B/s (line %lu B/s), errors %lu",
+               &bytes, &ms, &rate, &lineRate, &errors) != 5)
+    {
+        fprintf(stderr, "sim_echo: unreadable report\n");
+        exit(1);
+    }
+    if ((errors != 0UL) || (loopback_errors != 0U))
+    {
+        fprintf(stderr, "sim_echo: %lu mismatching bytes\n", errors);
+        failed = 1U;
+    }
+    if (overruns != 0U)
+    {
+        fprintf(stderr, "sim_echo: %u SCI3 overruns\n", overruns);
+        failed = 1U;
+    }
+    if (pool->inUse != 1U)
+    {
+        /* The echo queue is dropped before the report, only the block the
+           RX channel fills is left */
+        fprintf(stderr, "sim_echo: %u blocks in use after the test, not 1\n", pool->inUse);
+        failed = 1U;
+    }
+    if (pool->exhausted != 0U)
+    {
+        fprintf(stderr, "sim_echo: pool exhausted %u times\n", pool->exhausted);
+        failed = 1U;
+    }
+    if ((rate * 1000UL) < (lineRate * SIM_ECHO_MIN_PERMILLE))
+    {
+        fprintf(stderr, "sim_echo: %lu B/s echoed, below %lu.%lu%% of the line\n", rate,
+                SIM_ECHO_MIN_PERMILLE / 10UL, SIM_ECHO_MIN_PERMILLE % 10UL);
+        failed = 1U;
+    }
+    printf("sim_echo: %lu baud, pool peak %u of %u blocks, %s\n",
+           (unsigned long)simSciBaud(SIM_ECHO_SCI), pool->peak, CORE_POOL_BLOCKS,
+           (failed != 0U) ? "FAILED" : "ok");
+    exit((failed != 0U) ? 1 : 0);
+}
+
+/**
+ * @brief  SIGALRM after SIM_ECHO_LIMIT_S: the report never came.
+ */
+static void simEchoLimit(int sig)
+{
+    static const char msg[] = "sim_echo: no report, the echo is stuck\n";
+
+    (void)sig;
+    (void)write(STDERR_FILENO, msg, sizeof(msg) - 1U);
+    _exit(1);
+}
@@ -0,0 +1,127 @@
+/**
+ ******************************************************************************
+ * @file    sim_emif.c
+ * @brief   EMIF SDRAM Model (Chip Select 0)
+ *
+ * @details
+ *   - The SDRAM of EMIF CS0 is a host buffer of SIM_EMIF_SDRAM_SIZE bytes,
+ *     the HDK's IS42S16400J. sim_hal.h points PTR of HL_emif.h (the CS0
+ *     base) at it, so firmware reaches it through that macro as on the
+ *     device, and DMA packets carry its 32-bit address like any other
+ *     buffer (simHostAddr()).
+ *   - The SDRAM answers once SDCR has been written after SDTIMR and SDRCR,
+ *     with the geometry SDCR gives: 16-bit bus (NM), 1 to 4 banks
+ *     (IBANK), 256 to 2048 columns (PAGESIZE) and SIM_EMIF_ROWS rows. A DMA
+ *     element before that or past the end stops the simulation; a
+ *     configuration the device cannot have does too.
+ *   - CRC kernels reading from the SDRAM pay sdram_ws cycles per 32-bit
+ *     word on top of their budget (sim_cost.c).
+ *
+ * @note
+ *   - CPU accesses through PTR are plain host accesses and are not
+ *     checked. Refresh, self-refresh, power-down and the asynchronous chip
+ *     selects are not modelled.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include <stdint.h>
+
+/* SDCR fields */
+#define SIM_EMIF_SDCR_NM        0x00004000U
+#define SIM_EMIF_SDCR_IBANK(v)  (((v) >> 4U) & 7U)
+#define SIM_EMIF_SDCR_PAGE(v)   ((v) & 7U)
+/* 4 banks x 4096 rows x 256 columns x 16 bit */
+#define SIM_EMIF_ROWS           4096U
+
+static emifBASE_t s_emif;
+/* SDCR as last decoded, and the bytes that answer since */
+static uint32_t s_sdcr = 0U;
+static uint32_t s_size = 0U;
+static uint32_t s_sdram[SIM_EMIF_SDRAM_SIZE / 4U];
+
+emifBASE_t *simEmifRegs(void)
+{
+    simSync();
+    return (emifBASE_t *)&s_emif;
+}
+
+/**
+ * @brief  Base of the SDRAM, the PTR of HL_emif.h.
+ */
+volatile uint32 *simEmifSdram(void)
+{
+    return (volatile uint32 *)s_sdram;
+}
+
+/**
+ * @brief  Decodes an SDCR write: starts the SDRAM with its geometry.
+ */
+void simEmifApplyWrites(void)
+{
+    uint32_t sdcr = s_emif.SDCR;
+    uint32_t size;
+
+    if (sdcr == s_sdcr)
+    {
+        return;
+    }
+    s_sdcr = sdcr;
+    if ((s_emif.SDTIMR == 0U) || (s_emif.SDRCR == 0U))
+    {
+        simFatal("EMIF: SDCR written before SDTIMR and SDRCR");
+    }
+    if ((sdcr & SIM_EMIF_SDCR_NM) == 0U)
+    {
+        simFatal("EMIF: the SDRAM has a 16-bit bus, SDCR needs NM");
+    }
+    if ((SIM_EMIF_SDCR_IBANK(sdcr) > 2U) || (SIM_EMIF_SDCR_PAGE(sdcr) > 3U))
+    {
+        simFatal("EMIF: reserved IBANK or PAGESIZE in SDCR");
+    }
+    size = (1U << SIM_EMIF_SDCR_IBANK(sdcr)) * (256U << SIM_EMIF_SDCR_PAGE(sdcr)) * SIM_EMIF_ROWS * 2U;
+    if (size > SIM_EMIF_SDRAM_SIZE)
+    {
+        simFatal("EMIF: SDCR geometry is larger than the SDRAM");
+    }
+    s_size = size;
+    simBusy();
+}
+
+/**
+ * @brief  Checks a DMA element against the SDRAM.
+ * @param  addr  32-bit address of the element.
+ * @param  size  Element size in bytes.
+ * @return Non-zero if the element is in the SDRAM.
+ */
+uint32_t simEmifDmaCheck(uint32_t addr, uint32_t size)
+{
+    uint32_t offset = addr - (uint32_t)(uintptr_t)s_sdram;
+
+    if (offset >= SIM_EMIF_SDRAM_SIZE)
+    {
+        return 0U;
+    }
+    if (s_size == 0U)
+    {
+        simFatal("EMIF: SDRAM accessed by DMA before SDCR started it");
+    }
+    if ((offset + size) > s_size)
+    {
+        simFatal("EMIF: DMA access beyond the SDRAM");
+    }
+    return 1U;
+}
+
+/**
+ * @brief  Charges the SDRAM wait states of a kernel reading len bytes
+ *         from data; nothing if data is not in the SDRAM.
+ */
+void simEmifChargeRead(const void *data, uint32_t len)
+{
+    uintptr_t offset = (uintptr_t)data - (uintptr_t)s_sdram;
+
+    if (offset < SIM_EMIF_SDRAM_SIZE)
+    {
+        simCharge((double)((len + 3U) / 4U) * simCostCfg()->sdramWs);
+    }
+}
@@ -0,0 +1,516 @@
+/**
+ ******************************************************************************
+ * @file    sim_farm.c
+ * @brief   Runs Many Simulated Boards in Parallel and Aggregates Them
+ *
+ * @details
+ *   - Builds the case matrix backend x baud x payload x fault seed and
+ *     runs every case as its own sim_case_<backend> process (next to this
+ *     binary), at most -j at a time. The models keep their state in
+ *     globals, one board per process, so the pool is a process pool:
+ *     fork, exec, and a pipe for the result line.
+ *   - Aggregates per backend and rate over payloads and seeds: cases,
+ *     lossless cases, bytes lost, overruns, faults caught, throughput and
+ *     latency. Cases that crashed or missed a fault are listed and make
+ *     the exit status 1.
+ *   - Scaling: the CPU time of all cases (the serial run time) against
+ *     the wall time of the pool gives speedup and efficiency. -S runs the
+ *     matrix again at 1, 2, 4, ... workers up to -j and prints the
+ *     measured speedup of each over one worker.
+ *
+ * @note
+ *   - Usage: sim_farm [-j workers] [-B backends] [-b rates] [-p payloads]
+ *     [-n seeds] [-f fault odds] [-w work cycles] [-S] [-v]. Lists are
+ *     comma separated; seeds run from 0 (a clean line) to n - 1.
+ *   - A host program: it links none of the models.
+ ******************************************************************************
+ */
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SIM_FARM_MAX_LIST       16U
+#define SIM_FARM_LINE           512U
+#define SIM_FARM_PATH           256U
+#define SIM_FARM_BACKENDS       "polling,interrupt,dma_single,dma_ring,dma_pool"
+#define SIM_FARM_BAUDS          "115200,468750,937500,2343750,4687500"
+#define SIM_FARM_PAYLOADS       "4096,65536,1048576"
+#define SIM_FARM_SEEDS          4U
+#define SIM_FARM_FAULT_ODDS     4096U
+#define SIM_FARM_WORK_CYCLES    1000U
+
+typedef struct
+{
+    uint32_t backend;           /* Index into the backend list */
+    uint32_t baud;
+    uint32_t bytes;
+    uint32_t seed;
+    pid_t pid;
+    int fd;                     /* Read end of the result pipe */
+    double startS;
+    int status;                 /* Exit status, -1 if killed */
+    char line[SIM_FARM_LINE];
+} simFarmCase_t;
+
+typedef struct
+{
+    uint32_t cases;
+    uint32_t lossless;
+    uint32_t caught;
+    uint32_t failed;
+    double sent;
+    double lost;
+    double overruns;
+    double kbps;
+    double latUs;
+    double latMaxUs;
+} simFarmAgg_t;
+
+static char s_backend[SIM_FARM_MAX_LIST][32];
+static uint32_t s_backends = 0U;
+static uint32_t s_baud[SIM_FARM_MAX_LIST];
+static uint32_t s_bauds = 0U;
+static uint32_t s_payload[SIM_FARM_MAX_LIST];
+static uint32_t s_payloads = 0U;
+static uint32_t s_seeds = SIM_FARM_SEEDS;
+static uint32_t s_faultOdds = SIM_FARM_FAULT_ODDS;
+static uint32_t s_work = SIM_FARM_WORK_CYCLES;
+static uint32_t s_verbose = 0U;
+static char s_dir[SIM_FARM_PATH];
+
+static simFarmCase_t *s_case = NULL;
+static uint32_t s_count = 0U;
+
+static uint32_t simFarmList(const char *arg, uint32_t *list);
+static uint32_t simFarmNames(const char *arg);
+static double simFarmRun(uint32_t jobs, double *cpuS);
+static void simFarmStart(simFarmCase_t *c);
+static void simFarmReap(void);
+static void simFarmReport(uint32_t jobs, double wallS, double cpuS);
+static double simFarmValue(const char *line, const char *key);
+static double simFarmNowS(void);
+static double simFarmChildCpuS(void);
+
+int main(int argc, char **argv)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t jobs = (cpus > 0) ? (uint32_t)cpus : 1U;
+    uint32_t scaling = 0U;
+    uint32_t b, r, p, s, j;
+    double wallS, cpuS, wall1S = 0.0;
+    const char *slash;
+    int opt;
+    int failed = 0;
+
+    (void)simFarmNames(SIM_FARM_BACKENDS);
+    s_bauds = simFarmList(SIM_FARM_BAUDS, s_baud);
+    s_payloads = simFarmList(SIM_FARM_PAYLOADS, s_payload);
+    while ((opt = getopt(argc, argv, "j:B:b:p:n:f:w:Sv")) != -1)
+    {
+        if (opt == 'j')
+        {
+            jobs = (uint32_t)strtoul(optarg, NULL, 0);
+        }
+        else if (opt == 'B')
+        {
+            s_backends = simFarmNames(optarg);
+        }
+        else if (opt == 'b')
+        {
+            s_bauds = simFarmList(optarg, s_baud);
+        }
+        else if (opt == 'p')
+        {
+            s_payloads = simFarmList(optarg, s_payload);
+        }
+        else if (opt == 'n')
+        {
+            s_seeds = (uint32_t)strtoul(optarg, NULL, 0);
+        }
+        else if (opt == 'f')
+        {
+            s_faultOdds = (uint32_t)strtoul(optarg, NULL, 0);
+        }
+        else if (opt == 'w')
+        {
+            s_work = (uint32_t)strtoul(optarg, NULL, 0);
+        }
+        else if (opt == 'S')
+        {
+            scaling = 1U;
+        }
+        else if (opt == 'v')
+        {
+            s_verbose = 1U;
+        }
+        else
+        {
+            fprintf(stderr, "usage: sim_farm [-j workers] [-B backends] [-b rates] [-p payloads] "
+                            "[-n seeds] [-f fault odds] [-w work cycles] [-S] [-v]\n");
+            return 2;
+        }
+    }
+    if ((jobs == 0U) || (s_backends == 0U) || (s_bauds == 0U) || (s_payloads == 0U) || (s_seeds == 0U))
+    {
+        fprintf(stderr, "sim_farm: empty matrix or no workers\n");
+        return 2;
+    }
+
+    /* Workers live next to this binary */
+    slash = strrchr(argv[0], '/');
+    (void)snprintf(s_dir, sizeof(s_dir), "%.*s", (slash != NULL) ? (int)(slash - argv[0]) : 1,
+                   (slash != NULL) ? argv[0] : ".");
+
+    s_count = s_backends * s_bauds * s_payloads * s_seeds;
+    s_case = calloc(s_count, sizeof(simFarmCase_t));
+    if (s_case == NULL)
+    {
+        perror("sim_farm");
+        return 2;
+    }
+    for (b = 0U; b < s_backends; b++)
+    {
+        for (r = 0U; r < s_bauds; r++)
+        {
+            for (p = 0U; p < s_payloads; p++)
+            {
+                for (s = 0U; s < s_seeds; s++)
+                {
+                    simFarmCase_t *c = &s_case[(((((b * s_bauds) + r) * s_payloads) + p) * s_seeds) + s];
+
+                    c->backend = b;
+                    c->baud = s_baud[r];
+                    c->bytes = s_payload[p];
+                    c->seed = s;
+                }
+            }
+        }
+    }
+
+    printf("sim farm: %lu cases (%lu backends x %lu rates x %lu payloads x %lu seeds), "
+           "fault odds 1/%lu, main loop work %lu cycles\n",
+           (unsigned long)s_count, (unsigned long)s_backends, (unsigned long)s_bauds,
+           (unsigned long)s_payloads, (unsigned long)s_seeds, (unsigned long)s_faultOdds,
+           (unsigned long)s_work);
+    if (scaling != 0U)
+    {
+        printf("workers   wall s  speedup  efficiency\n");
+        for (j = 1U; j < jobs; j *= 2U)
+        {
+            wallS = simFarmRun(j, &cpuS);
+            if (j == 1U)
+            {
+                wall1S = wallS;
+            }
+            printf("%7lu %8.2f %8.2f %9.0f %%\n", (unsigned long)j, wallS, wall1S / wallS,
+                   (100.0 * wall1S) / (wallS * (double)j));
+        }
+    }
+    wallS = simFarmRun(jobs, &cpuS);
+    if (scaling != 0U)
+    {
+        if (jobs == 1U)
+        {
+            wall1S = wallS;
+        }
+        printf("%7lu %8.2f %8.2f %9.0f %%\n\n", (unsigned long)jobs, wallS, wall1S / wallS,
+               (100.0 * wall1S) / (wallS * (double)jobs));
+    }
+    simFarmReport(jobs, wallS, cpuS);
+
+    for (s = 0U; s < s_count; s++)
+    {
+        if (s_case[s].status != 0)
+        {
+            failed = 1;
+        }
+    }
+    free(s_case);
+    return failed;
+}
+
+/**
+ * @brief  Parses a comma separated list of numbers.
+ * @return Entries read.
+ */
+static uint32_t simFarmList(const char *arg, uint32_t *list)
+{
+    uint32_t n = 0U;
+    char *end;
+
+    while ((*arg != '\0') && (n < SIM_FARM_MAX_LIST))
+    {
+        list[n] = (uint32_t)strtoul(arg, &end, 0);
+        if ((end == arg) || (list[n] == 0U))
+        {
+            fprintf(stderr, "sim_farm: bad list entry '%s'\n", arg);
+            exit(2);
+        }
+        n++;
+        arg = (*end == ',') ? (end + 1) : end;
+    }
+    return n;
+}
+
+/**
+ * @brief  Parses the comma separated backend names.
+ * @return Entries read.
+ */
+static uint32_t simFarmNames(const char *arg)
+{
+    size_t len;
+
+    s_backends = 0U;
+    while ((*arg != '\0') && (s_backends < SIM_FARM_MAX_LIST))
+    {
+        len = strcspn(arg, ",");
+        if ((len == 0U) || (len >= sizeof(s_backend[0])))
+        {
+            fprintf(stderr, "sim_farm: bad backend '%s'\n", arg);
+            exit(2);
+        }
+        memcpy(s_backend[s_backends], arg, len);
+        s_backend[s_backends][len] = '\0';
+        s_backends++;
+        arg += len;
+        if (*arg == ',')
+        {
+            arg++;
+        }
+    }
+    return s_backends;
+}
+
+/**
+ * @brief  Runs every case with at most jobs workers.
+ * @param  cpuS  CPU time of all workers.
+ * @return Wall time of the run.
+ */
+static double simFarmRun(uint32_t jobs, double *cpuS)
+{
+    double startS = simFarmNowS();
+    double startCpuS = simFarmChildCpuS();
+    uint32_t next = 0U;
+    uint32_t running = 0U;
+
+    while ((next < s_count) || (running > 0U))
+    {
+        while ((running < jobs) && (next < s_count))
+        {
+            simFarmStart(&s_case[next]);
+            next++;
+            running++;
+        }
+        simFarmReap();
+        running--;
+    }
+
+    *cpuS = simFarmChildCpuS() - startCpuS;
+    return simFarmNowS() - startS;
+}
+
+/**
+ * @brief  Forks the worker of one case, its stdout into a pipe.
+ */
+static void simFarmStart(simFarmCase_t *c)
+{
+    char path[SIM_FARM_PATH + 48];
+    char arg[5][16];
+    int fd[2];
+
+    (void)snprintf(path, sizeof(path), "%s/sim_case_%s", s_dir, s_backend[c->backend]);
+    (void)snprintf(arg[0], sizeof(arg[0]), "%lu", (unsigned long)c->baud);
+    (void)snprintf(arg[1], sizeof(arg[1]), "%lu", (unsigned long)c->bytes);
+    (void)snprintf(arg[2], sizeof(arg[2]), "%lu", (unsigned long)c->seed);
+    (void)snprintf(arg[3], sizeof(arg[3]), "%lu", (unsigned long)s_faultOdds);
+    (void)snprintf(arg[4], sizeof(arg[4]), "%lu", (unsigned long)s_work);
+
+    fflush(stdout);
+    if (pipe(fd) != 0)
+    {
+        perror("sim_farm: pipe");
+        exit(2);
+    }
+    c->startS = simFarmNowS();
+    c->pid = fork();
+    if (c->pid < 0)
+    {
+        perror("sim_farm: fork");
+        exit(2);
+    }
+    if (c->pid == 0)
+    {
+        (void)dup2(fd[1], STDOUT_FILENO);
+        (void)close(fd[0]);
+        (void)close(fd[1]);
+        (void)execl(path, path, arg[0], arg[1], arg[2], arg[3], arg[4], (char *)NULL);
+        perror(path);
+        _exit(127);
+    }
+    (void)close(fd[1]);
+    c->fd = fd[0];
+    c->line[0] = '\0';
+}
+
+/**
+ * @brief  Waits for the next worker to finish and collects its result.
+ *         A result line fits the pipe, so a worker never blocks on it.
+ */
+static void simFarmReap(void)
+{
+    simFarmCase_t *c = NULL;
+    ssize_t n;
+    size_t len = 0U;
+    int status;
+    pid_t pid;
+    uint32_t i;
+
+    pid = waitpid(-1, &status, 0);
+    if (pid < 0)
+    {
+        perror("sim_farm: wait");
+        exit(2);
+    }
+    for (i = 0U; (i < s_count) && (c == NULL); i++)
+    {
+        if (s_case[i].pid == pid)
+        {
+            c = &s_case[i];
+        }
+    }
+    if (c == NULL)
+    {
+        return;
+    }
+    c->pid = 0;
+    c->status = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+
+    while ((len < (sizeof(c->line) - 1U))
+        && ((n = read(c->fd, &c->line[len], sizeof(c->line) - 1U - len)) > 0))
+    {
+        len += (size_t)n;
+    }
+    (void)close(c->fd);
+    c->line[len] = '\0';
+    c->line[strcspn(c->line, "\n")] = '\0';
+    if (s_verbose != 0U)
+    {
+        printf("%s (%.2f s)\n", c->line, simFarmNowS() - c->startS);
+    }
+}
+
+/**
+ * @brief  Prints the aggregate per backend and rate, the failed cases and
+ *         the scaling of the run.
+ */
+static void simFarmReport(uint32_t jobs, double wallS, double cpuS)
+{
+    simFarmAgg_t agg;
+    const simFarmCase_t *c;
+    uint32_t b, r, i;
+    double received;
+
+    printf("backend     baud    cases lossless  lost %%   overruns caught   kB/s    lat us  max us\n");
+    for (b = 0U; b < s_backends; b++)
+    {
+        for (r = 0U; r < s_bauds; r++)
+        {
+            memset(&agg, 0, sizeof(agg));
+            for (i = 0U; i < s_count; i++)
+            {
+                c = &s_case[i];
+                if ((c->backend != b) || (c->baud != s_baud[r]))
+                {
+                    continue;
+                }
+                agg.cases++;
+                if ((c->status != 0) || (strstr(c->line, " crc=") == NULL))
+                {
+                    agg.failed++;
+                    continue;
+                }
+                received = simFarmValue(c->line, "received");
+                agg.lossless += (simFarmValue(c->line, "lossless") != 0.0) ? 1U : 0U;
+                agg.caught += (strstr(c->line, " crc=caught") != NULL) ? 1U : 0U;
+                agg.sent += simFarmValue(c->line, "sent");
+                agg.lost += simFarmValue(c->line, "lost");
+                agg.overruns += simFarmValue(c->line, "overruns");
+                agg.kbps += simFarmValue(c->line, "kbps");
+                /* Mean latency weighted by the bytes handed on */
+                agg.latUs += simFarmValue(c->line, "lat_us") * received;
+                if (simFarmValue(c->line, "lat_max_us") > agg.latMaxUs)
+                {
+                    agg.latMaxUs = simFarmValue(c->line, "lat_max_us");
+                }
+            }
+            i = agg.cases - agg.failed;
+            printf("%-10s %8lu %5lu %8lu %8.4f %10.0f %6lu %8.1f %9.2f %7.2f%s\n",
+                   s_backend[b], (unsigned long)s_baud[r], (unsigned long)agg.cases,
+                   (unsigned long)agg.lossless,
+                   (agg.sent > 0.0) ? ((100.0 * agg.lost) / agg.sent) : 0.0, agg.overruns,
+                   (unsigned long)agg.caught, (i != 0U) ? (agg.kbps / (double)i) : 0.0,
+                   ((agg.sent - agg.lost) > 0.0) ? (agg.latUs / (agg.sent - agg.lost)) : 0.0,
+                   agg.latMaxUs, (agg.failed != 0U) ? "  FAILED" : "");
+        }
+    }
+
+    for (i = 0U; i < s_count; i++)
+    {
+        c = &s_case[i];
+        if (c->status != 0)
+        {
+            printf("failed (status %d): sim_case_%s %lu %lu %lu: %s\n", c->status,
+                   s_backend[c->backend], (unsigned long)c->baud, (unsigned long)c->bytes,
+                   (unsigned long)c->seed, (c->line[0] != '\0') ? c->line : "no result");
+        }
+    }
+
+    printf("host: %lu workers, wall %.2f s, cpu %.2f s: speedup %.2f, efficiency %.0f %%\n",
+           (unsigned long)jobs, wallS, cpuS, cpuS / wallS, (100.0 * cpuS) / (wallS * (double)jobs));
+}
+
+/**
+ * @brief  Value of key=value in a result line, 0 if absent.
+ */
+static double simFarmValue(const char *line, const char *key)
+{
+    size_t len = strlen(key);
+    const char *p = line;
+
+    while ((p = strstr(p, key)) != NULL)
+    {
+        if (((p == line) || (p[-1] == ' ')) && (p[len] == '='))
+        {
+            return strtod(&p[len + 1U], NULL);
+        }
+        p += len;
+    }
+    return 0.0;
+}
+
+static double simFarmNowS(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+/**
+ * @brief  User and system time of all workers reaped so far.
+ */
+static double simFarmChildCpuS(void)
+{
+    struct rusage ru;
+
+    (void)getrusage(RUSAGE_CHILDREN, &ru);
+    return (double)ru.ru_utime.tv_sec + ((double)ru.ru_utime.tv_usec * 1e-6)
+         + (double)ru.ru_stime.tv_sec + ((double)ru.ru_stime.tv_usec * 1e-6);
+}
@@ -0,0 +1,208 @@
+/**
+ ******************************************************************************
+ * @file    sim_fee.c
+ * @brief   TI FEE Driver Model (Bank 7 Data Flash)
+ *
+ * @details
+ *   - Implements the TI_Fee functions of include/fee/ti_fee.h for the
+ *     checkpoint check: blocks 1..SIM_FEE_BLOCKS of SIM_FEE_BLOCK_SIZE
+ *     bytes, one job at a time, and the job states of the driver: a read
+ *     or write is accepted while IDLE, stays BUSY / JOB_PENDING for a few
+ *     TI_Fee_MainFunction() calls, then ends JOB_OK, JOB_FAILED or
+ *     BLOCK_INVALID (never written).
+ *   - A write takes the data from the caller's buffer when the job ends,
+ *     as the driver reads it while programming, so a buffer changed in
+ *     between shows up in the flash.
+ *   - The flash is a shared mapping created before the first fork(): a
+ *     child process is one boot of the firmware, the driver state dies
+ *     with it and the flash contents survive, as across a reset.
+ *
+ * @note
+ *   - No virtual sectors, copy or erase cycles; simFeeFailNext() makes the
+ *     next write fail instead.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "ti_fee.h"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/* MainFunction() calls a job takes; a write programs the flash */
+#define SIM_FEE_READ_CALLS      2U
+#define SIM_FEE_WRITE_CALLS     16U
+
+#define SIM_FEE_JOB_NONE        0U
+#define SIM_FEE_JOB_READ        1U
+#define SIM_FEE_JOB_WRITE       2U
+
+typedef struct
+{
+    uint8_t data[SIM_FEE_BLOCKS][SIM_FEE_BLOCK_SIZE];
+    uint32_t written[SIM_FEE_BLOCKS];
+} simFeeFlash_t;
+
+static simFeeFlash_t *s_flash = NULL;
+static TI_FeeModuleStatusType s_status = UNINIT;
+static TI_FeeJobResultType s_result = JOB_OK;
+static uint32_t s_job = SIM_FEE_JOB_NONE;
+static uint32_t s_calls = 0U;
+static uint32_t s_block = 0U;
+static uint32_t s_offset = 0U;
+static uint32_t s_len = 0U;
+static uint8 *s_buf = NULL;
+static uint32_t s_failNext = 0U;
+
+static simFeeFlash_t *simFeeFlash(void);
+static Std_ReturnType simFeeStart(uint32_t job, uint16 block, uint32_t offset, uint8 *buf, uint32_t len);
+
+/**
+ * @brief  Erases the whole flash (every block reads BLOCK_INVALID). Call
+ *         before the first fork(), so the children share it.
+ */
+void simFeeErase(void)
+{
+    memset(simFeeFlash(), 0xFF, sizeof(simFeeFlash_t));
+    memset(simFeeFlash()->written, 0, sizeof(simFeeFlash()->written));
+}
+
+/**
+ * @brief  Makes the next write end JOB_FAILED without touching the flash.
+ */
+void simFeeFailNext(void)
+{
+    s_failNext = 1U;
+}
+
+/**
+ * @brief  Flips one bit of a written block, as a torn or disturbed
+ *         program would.
+ */
+void simFeeCorrupt(uint32_t block, uint32_t offset)
+{
+    simFeeFlash()->data[block - 1U][offset] ^= 0x01U;
+}
+
+void TI_Fee_Init(void)
+{
+    (void)simFeeFlash();
+    s_job = SIM_FEE_JOB_NONE;
+    s_result = JOB_OK;
+    s_status = IDLE;
+}
+
+TI_FeeModuleStatusType TI_Fee_GetStatus(uint8 u8EEPIndex)
+{
+    (void)u8EEPIndex;
+    return s_status;
+}
+
+TI_FeeJobResultType TI_Fee_GetJobResult(uint8 u8EEPIndex)
+{
+    (void)u8EEPIndex;
+    return s_result;
+}
+
+Std_ReturnType TI_Fee_Read(uint16 BlockNumber, uint16 BlockOffset, uint8 *DataBufferPtr, uint16 Length)
+{
+    return simFeeStart(SIM_FEE_JOB_READ, BlockNumber, BlockOffset, DataBufferPtr, Length);
+}
+
+Std_ReturnType TI_Fee_WriteAsync(uint16 BlockNumber, uint8 *DataBufferPtr)
+{
+    return simFeeStart(SIM_FEE_JOB_WRITE, BlockNumber, 0U, DataBufferPtr, SIM_FEE_BLOCK_SIZE);
+}
+
+/**
+ * @brief  Advances the job; ends it after its number of calls.
+ */
+void TI_Fee_MainFunction(void)
+{
+    simFeeFlash_t *flash = simFeeFlash();
+    uint32_t index = s_block - 1U;
+
+    if (s_job == SIM_FEE_JOB_NONE)
+    {
+        return;
+    }
+    s_calls--;
+    if (s_calls != 0U)
+    {
+        return;
+    }
+
+    if (s_job == SIM_FEE_JOB_READ)
+    {
+        if (flash->written[index] != 0U)
+        {
+            memcpy(s_buf, &flash->data[index][s_offset], s_len);
+            s_result = JOB_OK;
+        }
+        else
+        {
+            s_result = BLOCK_INVALID;
+        }
+    }
+    else if (s_failNext != 0U)
+    {
+        s_failNext = 0U;
+        s_result = JOB_FAILED;
+    }
+    else
+    {
+        memcpy(flash->data[index], s_buf, SIM_FEE_BLOCK_SIZE);
+        flash->written[index] = 1U;
+        s_result = JOB_OK;
+    }
+    s_job = SIM_FEE_JOB_NONE;
+    s_status = IDLE;
+}
+
+/**
+ * @brief  The flash, mapped on first use. A shared mapping of /dev/zero,
+ *         MAP_ANONYMOUS is not in _XOPEN_SOURCE 600.
+ */
+static simFeeFlash_t *simFeeFlash(void)
+{
+    void *map = MAP_FAILED;
+    int fd;
+
+    if (s_flash == NULL)
+    {
+        fd = open("/dev/zero", O_RDWR);
+        if (fd >= 0)
+        {
+            map = mmap(NULL, sizeof(simFeeFlash_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            (void)close(fd);
+        }
+        if (map == MAP_FAILED)
+        {
+            simFatal("FEE: cannot map the flash");
+        }
+        s_flash = (simFeeFlash_t *)map;
+    }
+    return s_flash;
+}
+
+/**
+ * @brief  Accepts a job while the driver is idle and the range is inside
+ *         a configured block.
+ */
+static Std_ReturnType simFeeStart(uint32_t job, uint16 block, uint32_t offset, uint8 *buf, uint32_t len)
+{
+    if ((s_status != IDLE) || (block == 0U) || (block > SIM_FEE_BLOCKS)
+     || ((offset + len) > SIM_FEE_BLOCK_SIZE))
+    {
+        return E_NOT_OK;
+    }
+    s_job = job;
+    s_calls = (job == SIM_FEE_JOB_READ) ? SIM_FEE_READ_CALLS : SIM_FEE_WRITE_CALLS;
+    s_block = block;
+    s_offset = offset;
+    s_len = len;
+    s_buf = buf;
+    s_status = BUSY;
+    s_result = JOB_PENDING;
+    return E_OK;
+}
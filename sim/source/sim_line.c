@@ -0,0 +1,183 @@
+/**
+ ******************************************************************************
+ * @file    sim_line.c
+ * @brief   Seeded Payload on an SCI RX Pin, With Injected Line Faults
+ *
+ * @details
+ *   - simLineNext() is a simSciRxSource_t that sends a payload back to
+ *     back at the line rate. The payload depends on its length only, so
+ *     runs with different fault seeds carry the same data.
+ *   - A non-zero seed injects one fault per faultOdds bytes on average,
+ *     each one of:
+ *       * flip  one bit of the byte inverted (noise on the line)
+ *       * drop  the byte never reaches the line (lost in the adapter)
+ *       * gap   1..SIM_LINE_MAX_GAP character times of idle line before
+ *               the byte (host scheduling)
+ *   - The CRC32 of the payload and of what actually was on the line are
+ *     kept, so a run shows both whether the board lost bytes (its CRC
+ *     against the line) and whether the faults were caught (against the
+ *     payload).
+ *   - The end time of every frame is queued; simLineArrival() hands them
+ *     out in order, for the latency of the bytes the backend hands on.
+ *
+ * @note
+ *   - The arrival queue holds SIM_LINE_QUEUE frames. Bytes the board
+ *     loses are never popped, so latencies are only exact on lossless
+ *     runs.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "crc32_kernel.h"
+
+/* Frames queued for simLineArrival(), a power of two */
+#define SIM_LINE_QUEUE          8192U
+#define SIM_LINE_QUEUE_MASK     (SIM_LINE_QUEUE - 1U)
+/* Longest injected gap, in character times */
+#define SIM_LINE_MAX_GAP        32U
+/* Start of the payload generator, as sim_rx_main.c */
+#define SIM_LINE_PAYLOAD_SEED   0x9E3779B9U
+
+/* Fault kinds, drawn evenly */
+#define SIM_LINE_FLIP           0U
+#define SIM_LINE_DROP           1U
+#define SIM_LINE_GAP            2U
+#define SIM_LINE_KINDS          3U
+
+static simLineCfg_t s_cfg;
+static simLineStats_t s_stats;
+static uint32_t s_payload;
+static uint32_t s_rand;
+static uint32_t s_pos = 0U;
+static uint32_t s_started = 0U;
+static uint64_t s_queue[SIM_LINE_QUEUE];
+static uint32_t s_head = 0U;
+static uint32_t s_tail = 0U;
+
+static uint32_t simLineRand(uint32_t *state);
+
+/**
+ * @brief  Starts a new run. Connect simLineNext() afterwards.
+ */
+void simLineInit(const simLineCfg_t *cfg)
+{
+    s_cfg = *cfg;
+    if (s_cfg.faultOdds == 0U)
+    {
+        s_cfg.faultOdds = 1U;
+    }
+    s_payload = SIM_LINE_PAYLOAD_SEED;
+    s_rand = cfg->seed;
+    s_pos = 0U;
+    s_started = 0U;
+    s_head = 0U;
+    s_tail = 0U;
+    s_stats.sent = 0U;
+    s_stats.flips = 0U;
+    s_stats.drops = 0U;
+    s_stats.gaps = 0U;
+    s_stats.payloadCrc = CRC32_INIT;
+    s_stats.lineCrc = CRC32_INIT;
+    s_stats.firstNs = 0U;
+    s_stats.lastNs = 0U;
+}
+
+/**
+ * @brief  RX source: the next byte of the payload, faults applied.
+ * @return 0 once the payload has been sent.
+ */
+uint32_t simLineNext(uint32_t index, uint64_t *idleNs, uint8_t *data)
+{
+    uint64_t charNs = simSciCharNs(index);
+    uint64_t idle = 0U;
+    uint32_t kind;
+    uint8_t byte;
+
+    while (s_pos < s_cfg.bytes)
+    {
+        byte = (uint8_t)simLineRand(&s_payload);
+        s_stats.payloadCrc = simTrafficCrc(s_stats.payloadCrc, byte);
+        s_pos++;
+
+        if ((s_cfg.seed != 0U) && ((simLineRand(&s_rand) % s_cfg.faultOdds) == 0U))
+        {
+            kind = simLineRand(&s_rand) % SIM_LINE_KINDS;
+            if (kind == SIM_LINE_FLIP)
+            {
+                byte ^= (uint8_t)(1U << (simLineRand(&s_rand) % 8U));
+                s_stats.flips++;
+            }
+            else if (kind == SIM_LINE_DROP)
+            {
+                s_stats.drops++;
+                continue;
+            }
+            else
+            {
+                idle += charNs * (1U + (simLineRand(&s_rand) % SIM_LINE_MAX_GAP));
+                s_stats.gaps++;
+            }
+        }
+
+        s_stats.lineCrc = simTrafficCrc(s_stats.lineCrc, byte);
+        s_stats.sent++;
+        if (s_started == 0U)
+        {
+            s_started = 1U;
+            s_stats.firstNs = simTimeNs() + idle;
+        }
+        /* The source is asked when the previous frame ends */
+        s_stats.lastNs = simTimeNs() + idle + charNs;
+        if ((s_head - s_tail) == SIM_LINE_QUEUE)
+        {
+            s_tail++;
+        }
+        s_queue[s_head & SIM_LINE_QUEUE_MASK] = s_stats.lastNs;
+        s_head++;
+
+        *idleNs = idle;
+        *data = byte;
+        return 1U;
+    }
+    return 0U;
+}
+
+/**
+ * @brief  Non-zero once the last frame of the payload is complete.
+ */
+uint32_t simLineDone(void)
+{
+    return ((s_pos >= s_cfg.bytes) && (simTimeNs() >= s_stats.lastNs)) ? 1U : 0U;
+}
+
+/**
+ * @brief  End time of the oldest frame not yet popped.
+ * @return 0 if none is queued.
+ */
+uint32_t simLineArrival(uint64_t *ns)
+{
+    if (s_tail == s_head)
+    {
+        return 0U;
+    }
+    *ns = s_queue[s_tail & SIM_LINE_QUEUE_MASK];
+    s_tail++;
+    return 1U;
+}
+
+/**
+ * @brief  Counts and CRCs of the run so far, final XOR applied.
+ */
+void simLineStats(simLineStats_t *stats)
+{
+    *stats = s_stats;
+    stats->payloadCrc ^= CRC32_XOROUT;
+    stats->lineCrc ^= CRC32_XOROUT;
+}
+
+static uint32_t simLineRand(uint32_t *state)
+{
+    *state ^= *state << 13U;
+    *state ^= *state >> 17U;
+    *state ^= *state << 5U;
+    return *state;
+}
@@ -0,0 +1,99 @@
+/**
+ ******************************************************************************
+ * @file    sim_pmu.c
+ * @brief   PMU Driver Functions (HL_sys_pmu.h) on the Simulated Clock
+ *
+ * @details
+ *   - The cycle counter counts GCLK cycles of simNowNs(): on the event
+ *     clock the simulated time with the CPU cycles of the cost model
+ *     (inside a handler, the handler's own), on the wall clock the host
+ *     time credited to the simulation, so cycle budgets in the firmware
+ *     keep their meaning (SIM_GCLK_HZ).
+ *   - Event counters are not modelled and read as zero.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "HL_sys_pmu.h"
+
+static uint32_t s_running = 0U;
+static uint64_t s_baseNs = 0U;
+static uint32_t s_frozen = 0U;
+
+static uint32_t simPmuCycles(void);
+
+void _pmuInit_(void)
+{
+    s_running = 0U;
+    s_frozen = 0U;
+    s_baseNs = simNowNs();
+}
+
+void _pmuEnableCountersGlobal_(void)
+{
+}
+
+void _pmuDisableCountersGlobal_(void)
+{
+}
+
+void _pmuResetCycleCounter_(void)
+{
+    s_baseNs = simNowNs();
+    s_frozen = 0U;
+}
+
+void _pmuResetEventCounters_(void)
+{
+}
+
+void _pmuResetCounters_(void)
+{
+    _pmuResetCycleCounter_();
+}
+
+void _pmuStartCounters_(uint32 counters)
+{
+    if (((counters & pmuCYCLE_COUNTER) != 0U) && (s_running == 0U))
+    {
+        /* Continue from the frozen value */
+        s_baseNs = simNowNs() - (((uint64_t)s_frozen * 1000000000ULL) / SIM_GCLK_HZ);
+        s_running = 1U;
+    }
+}
+
+void _pmuStopCounters_(uint32 counters)
+{
+    if (((counters & pmuCYCLE_COUNTER) != 0U) && (s_running != 0U))
+    {
+        s_frozen = simPmuCycles();
+        s_running = 0U;
+    }
+}
+
+void _pmuSetCountEvent_(uint32 counter, uint32 event)
+{
+    (void)counter;
+    (void)event;
+}
+
+uint32 _pmuGetCycleCount_(void)
+{
+    simSync();
+    return (s_running != 0U) ? simPmuCycles() : s_frozen;
+}
+
+uint32 _pmuGetEventCount_(uint32 counter)
+{
+    (void)counter;
+    return 0U;
+}
+
+uint32 _pmuGetOverflow_(void)
+{
+    return 0U;
+}
+
+static uint32_t simPmuCycles(void)
+{
+    return (uint32_t)(((simNowNs() - s_baseNs) * (SIM_GCLK_HZ / 1000000U)) / 1000U);
+}
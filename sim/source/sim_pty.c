@@ -0,0 +1,283 @@
+/**
+ ******************************************************************************
+ * @file    sim_pty.c
+ * @brief   Pseudo-Terminal Bridge: an SCI of the Model as a Linux Serial Port
+ *
+ * @details
+ *   - simPtyOpen() creates a pty; its slave (/dev/pts/N, or a symlink to
+ *     it) is the board's virtual COM port for terminals and host/crcctl.
+ *   - Host to board: bytes written to the slave are read from the master
+ *     into a FIFO that is the RX source of the SCI, so they arrive at the
+ *     SCI's own rate (BRS) like on the wire. The master is only read while
+ *     the FIFO has room, so a host sending faster than the line blocks in
+ *     write() instead of losing data, as behind a USB-UART adapter.
+ *   - Board to host: bytes leave the TX sink when their frame completes
+ *     and are written to the master in batches.
+ *   - The bridge runs as the host hook of the sync (simSetHostHook()),
+ *     every SIM_PTY_PERIOD_NS, on the wall clock so the host sees real
+ *     time. Overruns of the SCI are reported on stderr as they happen.
+ *   - The slave starts at the SCI rate. The rate the host set on it
+ *     (termios2) is compared with the SCI rate, with each batch of bytes
+ *     from the host and every SIM_PTY_BAUD_POLLS hook calls. A mismatch is reported; in strict mode the bytes are also
+ *     dropped in both directions, as a receiver at the wrong rate only
+ *     sees framing errors, so a failed baud switch fails like on the wire.
+ *
+ * @note
+ *   - Linux only (termios2). The bridge keeps the slave open itself, so the
+ *     port survives host tools closing and reopening it.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include <asm/termbits.h>
+#include <sys/ioctl.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Host hook period: about two characters at 937500 baud */
+#define SIM_PTY_PERIOD_NS       20000U
+/* Host rate checks, every SIM_PTY_BAUD_POLLS hook calls (about 10 ms) */
+#define SIM_PTY_BAUD_POLLS      500U
+/* Buffers of both directions, powers of two */
+#define SIM_PTY_FIFO_LEN        4096U
+#define SIM_PTY_FIFO_MASK       (SIM_PTY_FIFO_LEN - 1U)
+/* Rates further apart than this (per mille) garble every character */
+#define SIM_PTY_BAUD_TOL        30U
+
+static int s_master = -1;
+static int s_slave = -1;
+static uint32_t s_index = 0U;
+static uint32_t s_strict = 0U;
+static char s_name[64];
+
+static uint8_t s_rx[SIM_PTY_FIFO_LEN];
+static uint32_t s_rxHead = 0U;
+static uint32_t s_rxTail = 0U;
+static uint8_t s_tx[SIM_PTY_FIFO_LEN];
+static uint32_t s_txHead = 0U;
+static uint32_t s_txTail = 0U;
+
+static uint32_t s_polls = 0U;
+static uint32_t s_hostBaud = 0U;
+static uint32_t s_boardBaud = 0U;
+static uint32_t s_mismatch = 0U;
+static uint32_t s_overruns = 0U;
+static uint32_t s_txDropped = 0U;
+static uint32_t s_garbled = 0U;
+static uint32_t s_lostReported = 0U;
+
+static void simPtyService(void);
+static uint32_t simPtyRxNext(uint32_t index, uint64_t *idleNs, uint8_t *data);
+static void simPtyTxSink(uint32_t index, uint8_t data);
+static void simPtyCheckBaud(void);
+static void simPtyRaw(void);
+
+/**
+ * @brief  Creates the pty and connects it to an SCI: its RX pin, its TX
+ *         sink and the host hook. Call after simSetClock(SIM_CLOCK_WALL).
+ * @param  index   SCI index (2 = sciREG3).
+ * @param  strict  Non-zero to drop bytes while the host rate is wrong.
+ * @return Path of the slave, NULL on failure (errno set).
+ */
+const char *simPtyOpen(uint32_t index, uint32_t strict)
+{
+    int n = 0;
+
+    s_master = open("/dev/ptmx", O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if ((s_master < 0)
+     || (ioctl(s_master, TIOCSPTLCK, &n) != 0)
+     || (ioctl(s_master, TIOCGPTN, &n) != 0))
+    {
+        return NULL;
+    }
+    (void)snprintf(s_name, sizeof(s_name), "/dev/pts/%d", n);
+    s_slave = open(s_name, O_RDWR | O_NOCTTY);
+    if (s_slave < 0)
+    {
+        return NULL;
+    }
+    s_index = index;
+    s_strict = strict;
+    simPtyRaw();
+
+    simSciSetTxSink(&simPtyTxSink);
+    simSciSetRxSource(index, &simPtyRxNext);
+    simSetHostHook(&simPtyService, SIM_PTY_PERIOD_NS);
+    return s_name;
+}
+
+/**
+ * @brief  Host hook: moves bytes between the pty and the FIFOs and
+ *         reports line problems.
+ */
+static void simPtyService(void)
+{
+    uint32_t end, room, overruns;
+    ssize_t n;
+
+    /* Host to board, only as much as the FIFO holds */
+    room = SIM_PTY_FIFO_LEN - (s_rxHead - s_rxTail);
+    if (room != 0U)
+    {
+        end = s_rxHead & SIM_PTY_FIFO_MASK;
+        if ((end + room) > SIM_PTY_FIFO_LEN)
+        {
+            room = SIM_PTY_FIFO_LEN - end;
+        }
+        n = read(s_master, &s_rx[end], room);
+        if (n > 0)
+        {
+            /* At the rate the host sent them with */
+            simPtyCheckBaud();
+            s_rxHead += (uint32_t)n;
+            simSciRxKick(s_index);
+        }
+    }
+
+    /* Board to host */
+    while (s_txHead != s_txTail)
+    {
+        end = s_txTail & SIM_PTY_FIFO_MASK;
+        room = s_txHead - s_txTail;
+        if ((end + room) > SIM_PTY_FIFO_LEN)
+        {
+            room = SIM_PTY_FIFO_LEN - end;
+        }
+        n = write(s_master, &s_tx[end], room);
+        if (n <= 0)
+        {
+            /* Nobody reads the slave, keep the bytes until the FIFO is full */
+            break;
+        }
+        s_txTail += (uint32_t)n;
+    }
+
+    overruns = simSciOverruns(s_index);
+    if (overruns != s_overruns)
+    {
+        fprintf(stderr, "sim: SCI%u overrun, %u bytes lost so far\n",
+                (unsigned)(s_index + 1U), (unsigned)overruns);
+        s_overruns = overruns;
+    }
+
+    s_polls++;
+    if ((s_polls % SIM_PTY_BAUD_POLLS) == 0U)
+    {
+        simPtyCheckBaud();
+    }
+}
+
+/**
+ * @brief  RX source of the SCI: the next byte from the host, back to back.
+ */
+static uint32_t simPtyRxNext(uint32_t index, uint64_t *idleNs, uint8_t *data)
+{
+    (void)index;
+
+    while (s_rxHead != s_rxTail)
+    {
+        *data = s_rx[s_rxTail & SIM_PTY_FIFO_MASK];
+        s_rxTail++;
+        if ((s_strict == 0U) || (s_mismatch == 0U))
+        {
+            *idleNs = 0U;
+            return 1U;
+        }
+        s_garbled++;
+    }
+    return 0U;
+}
+
+/**
+ * @brief  TX sink: bytes of the bridged SCI go to the host, the others to
+ *         stdout.
+ */
+static void simPtyTxSink(uint32_t index, uint8_t data)
+{
+    if (index != s_index)
+    {
+        (void)putchar(data);
+    }
+    else if ((s_strict != 0U) && (s_mismatch != 0U))
+    {
+        s_garbled++;
+    }
+    else if ((s_txHead - s_txTail) < SIM_PTY_FIFO_LEN)
+    {
+        s_tx[s_txHead & SIM_PTY_FIFO_MASK] = data;
+        s_txHead++;
+    }
+    else
+    {
+        s_txDropped++;
+    }
+}
+
+/**
+ * @brief  Compares the rate the host set on the slave with the SCI rate
+ *         and reports changes.
+ */
+static void simPtyCheckBaud(void)
+{
+    struct termios2 tio;
+    uint32_t host, board, diff, changed;
+
+    if (ioctl(s_slave, TCGETS2, &tio) != 0)
+    {
+        return;
+    }
+    board = simSciBaud(s_index);
+    if (s_boardBaud == 0U)
+    {
+        /* First check, the SCI is set up: the port starts at its rate */
+        tio.c_cflag &= ~CBAUD;
+        tio.c_cflag |= BOTHER;
+        tio.c_ispeed = board;
+        tio.c_ospeed = board;
+        (void)ioctl(s_slave, TCSETS2, &tio);
+    }
+    host = (uint32_t)tio.c_ospeed;
+    changed = ((host != s_hostBaud) || (board != s_boardBaud)) ? 1U : 0U;
+    if ((changed == 0U) && ((s_garbled + s_txDropped) == s_lostReported))
+    {
+        return;
+    }
+    s_hostBaud = host;
+    s_boardBaud = board;
+
+    diff = (host > board) ? (host - board) : (board - host);
+    s_mismatch = (((uint64_t)diff * 1000U) > ((uint64_t)board * SIM_PTY_BAUD_TOL)) ? 1U : 0U;
+    if ((s_mismatch != 0U) && (changed != 0U))
+    {
+        fprintf(stderr, "sim: host port at %u baud, board at %u baud%s\n",
+                (unsigned)host, (unsigned)board, (s_strict != 0U) ? ", bytes dropped" : "");
+    }
+    if ((s_garbled + s_txDropped) != s_lostReported)
+    {
+        s_lostReported = s_garbled + s_txDropped;
+        fprintf(stderr, "sim: %u bytes lost to the rate mismatch, %u not read by the host\n",
+                (unsigned)s_garbled, (unsigned)s_txDropped);
+    }
+}
+
+/**
+ * @brief  Raw 8N1 on the slave, as a freshly plugged-in adapter looks to a
+ *         terminal program that sets its own mode anyway.
+ */
+static void simPtyRaw(void)
+{
+    struct termios2 tio;
+
+    if (ioctl(s_slave, TCGETS2, &tio) != 0)
+    {
+        return;
+    }
+    tio.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
+    tio.c_oflag &= ~OPOST;
+    tio.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+    tio.c_cflag &= ~(CSIZE | PARENB);
+    tio.c_cflag |= CS8;
+    (void)ioctl(s_slave, TCSETS2, &tio);
+}
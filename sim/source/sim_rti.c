@@ -0,0 +1,432 @@
+/**
+ ******************************************************************************
+ * @file    sim_rti.c
+ * @brief   RTI Model and RTI Driver Functions
+ *
+ * @details
+ *   - Two counter blocks: the free running counter FRCx counts RTICLK
+ *     (VCLK) divided by CPUCx + 1. FRCx is computed from the simulated
+ *     time whenever the block is accessed, so it costs no events.
+ *   - Four compares, each on the block COMPCTRL selects. A match sets its
+ *     INTFLAG bit and adds UDCPx to COMPx, as on the device. Only compares
+ *     with their interrupt enabled are scheduled as events; the flags of
+ *     the others are not kept, and enabling one first adds the UDCPx steps
+ *     it missed meanwhile.
+ *   - Compare x raises VIM request 2 + x. The handlers clear the flag and
+ *     call rtiNotification(), like the HALCoGen ones.
+ *   - rtiInit() loads the HALCoGen configuration of the projects: both
+ *     blocks at RTICLK / 8, compare 0 every 1 ms on block 0.
+ *
+ * @note
+ *   - Capture, the timebase, the up counter and the watchdog are not
+ *     modelled; UCx reads as zero.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "HL_rti.h"
+
+#define SIM_RTI_BLOCKS          2U
+#define SIM_RTI_COMPARES        4U
+/* VIM request of compare 0 */
+#define SIM_RTI_VIM_REQ0        2U
+/* Compare interrupt enables and flags */
+#define SIM_RTI_CMP_MASK        0x0000000FU
+
+typedef struct
+{
+    uint32_t running;
+    uint64_t frcBase;       /* Unwrapped FRC at timeBase */
+    uint64_t timeBase;
+} simRtiBlock_t;
+
+static rtiBASE_t s_rti;
+static simRtiBlock_t s_block[SIM_RTI_BLOCKS];
+static uint32_t s_comp[SIM_RTI_COMPARES];
+static uint32_t s_intEna = 0U;
+static uint32_t s_intFlag = 0U;
+/* Next match time of each compare, valid while its bit is set */
+static uint64_t s_matchNs[SIM_RTI_COMPARES];
+static uint32_t s_matchValid = 0U;
+/* RTICLK / 1 GHz as num / den, reduced so the products stay in 64 bit */
+static uint64_t s_clkNum = 0U;
+static uint64_t s_clkDen = 0U;
+
+static uint32_t simRtiBlockOf(uint32_t compare);
+static uint64_t simRtiFrc(uint32_t block, uint64_t now);
+static uint64_t simRtiMatchNs(uint32_t compare);
+static void simRtiCatchUp(uint32_t compare);
+static void simRtiPublish(void);
+static void simRtiCompareInterrupt(uint32_t compare);
+
+/**
+ * @brief  Register block of RTI1, synced to now, with FRCx up to date.
+ */
+rtiBASE_t *simRtiRegs(void)
+{
+    uint32_t i;
+
+    simSync();
+    for (i = 0U; i < SIM_RTI_BLOCKS; i++)
+    {
+        s_rti.CNT[i].FRCx = (uint32)simRtiFrc(i, simTimeNs());
+    }
+    return &s_rti;
+}
+
+/**
+ * @brief  Decodes firmware writes to INTFLAG (write 1 to clear).
+ */
+void simRtiApplyWrites(void)
+{
+    if (s_rti.INTFLAG != (s_intFlag | SIM_W1C_MARK))
+    {
+        s_intFlag &= ~s_rti.INTFLAG;
+        simBusy();
+    }
+    simRtiPublish();
+}
+
+/**
+ * @brief  Time of the earliest compare match with its interrupt enabled,
+ *         UINT64_MAX if none.
+ */
+uint64_t simRtiNextEventNs(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint64_t t;
+    uint32_t c;
+
+    for (c = 0U; c < SIM_RTI_COMPARES; c++)
+    {
+        t = simRtiMatchNs(c);
+        if (t < next)
+        {
+            next = t;
+        }
+    }
+    return next;
+}
+
+/**
+ * @brief  Runs the earliest compare match.
+ */
+void simRtiRunEvent(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint32_t c, hit = SIM_RTI_COMPARES;
+
+    for (c = 0U; c < SIM_RTI_COMPARES; c++)
+    {
+        uint64_t t = simRtiMatchNs(c);
+
+        if (t < next)
+        {
+            next = t;
+            hit = c;
+        }
+    }
+    if (hit == SIM_RTI_COMPARES)
+    {
+        return;
+    }
+    s_intFlag |= (uint32_t)1U << hit;
+    s_comp[hit] += s_rti.CMP[hit].UDCPx;
+    s_matchValid = 0U;
+    simRtiPublish();
+}
+
+/**
+ * @brief  Level of a VIM request line driven by the RTI.
+ */
+uint32_t simRtiIrqAsserted(uint32_t request)
+{
+    uint32_t c = request - SIM_RTI_VIM_REQ0;
+
+    if (c >= SIM_RTI_COMPARES)
+    {
+        return 0U;
+    }
+    return ((s_intFlag & s_intEna) >> c) & 1U;
+}
+
+void rtiCompare0Interrupt(void)
+{
+    simRtiCompareInterrupt(0U);
+}
+
+void rtiCompare1Interrupt(void)
+{
+    simRtiCompareInterrupt(1U);
+}
+
+void rtiCompare2Interrupt(void)
+{
+    simRtiCompareInterrupt(2U);
+}
+
+void rtiCompare3Interrupt(void)
+{
+    simRtiCompareInterrupt(3U);
+}
+
+/**
+ * @brief  Default notification for builds without one.
+ */
+__attribute__((weak)) void rtiNotification(rtiBASE_t *rtiREG, uint32 notification)
+{
+    (void)rtiREG;
+    (void)notification;
+}
+
+/*---------------------------------------------------------------------------*/
+/* Driver functions (HL_rti.h)                                               */
+
+void rtiInit(void)
+{
+    uint64_t a = SIM_VCLK_HZ, b = 1000000000ULL, r;
+    uint32_t i;
+
+    /* Greatest common divisor of RTICLK and 1 GHz */
+    while (b != 0U)
+    {
+        r = a % b;
+        a = b;
+        b = r;
+    }
+    s_clkNum = SIM_VCLK_HZ / a;
+    s_clkDen = 1000000000ULL / a;
+
+    s_rti.GCTRL = (uint32)((uint32)0x5U << 16U);
+    s_rti.COMPCTRL = 0x00001000U | 0x00000100U;
+    for (i = 0U; i < SIM_RTI_BLOCKS; i++)
+    {
+        s_block[i].running = 0U;
+        s_block[i].frcBase = 0U;
+        s_block[i].timeBase = simTimeNs();
+        s_rti.CNT[i].CPUCx = 7U;
+        s_rti.CNT[i].UCx = 0U;
+    }
+    s_rti.CMP[0U].UDCPx = 9375U;
+    s_rti.CMP[1U].UDCPx = 46875U;
+    s_rti.CMP[2U].UDCPx = 75000U;
+    s_rti.CMP[3U].UDCPx = 93750U;
+    for (i = 0U; i < SIM_RTI_COMPARES; i++)
+    {
+        s_comp[i] = s_rti.CMP[i].UDCPx;
+    }
+    s_intFlag = 0U;
+    s_intEna = 0U;
+    s_matchValid = 0U;
+    simRtiPublish();
+    simBusy();
+}
+
+void rtiStartCounter(rtiBASE_t *rtiREG, uint32 counter)
+{
+    simRtiBlock_t *b = &s_block[counter & 1U];
+
+    (void)rtiREG;
+    simSync();
+    simBusy();
+    if (b->running == 0U)
+    {
+        b->timeBase = simTimeNs();
+        b->running = 1U;
+        s_rti.GCTRL |= (uint32)1U << (counter & 1U);
+        s_matchValid = 0U;
+    }
+    simRtiPublish();
+}
+
+void rtiStopCounter(rtiBASE_t *rtiREG, uint32 counter)
+{
+    simRtiBlock_t *b = &s_block[counter & 1U];
+
+    (void)rtiREG;
+    simSync();
+    simBusy();
+    if (b->running != 0U)
+    {
+        b->frcBase = simRtiFrc(counter & 1U, simTimeNs());
+        b->running = 0U;
+        s_rti.GCTRL &= ~((uint32)1U << (counter & 1U));
+        s_matchValid = 0U;
+    }
+    simRtiPublish();
+}
+
+uint32 rtiResetCounter(rtiBASE_t *rtiREG, uint32 counter)
+{
+    simRtiBlock_t *b = &s_block[counter & 1U];
+
+    (void)rtiREG;
+    simSync();
+    simBusy();
+    if (b->running != 0U)
+    {
+        return 0U;
+    }
+    b->frcBase = 0U;
+    s_matchValid = 0U;
+    simRtiPublish();
+    return 1U;
+}
+
+void rtiSetPeriod(rtiBASE_t *rtiREG, uint32 compare, uint32 period)
+{
+    (void)rtiREG;
+    simSync();
+    simBusy();
+    s_rti.CMP[compare & 3U].UDCPx = period;
+    s_matchValid = 0U;
+}
+
+uint32 rtiGetPeriod(rtiBASE_t *rtiREG, uint32 compare)
+{
+    (void)rtiREG;
+    simSync();
+    return s_rti.CMP[compare & 3U].UDCPx;
+}
+
+uint32 rtiGetCurrentTick(rtiBASE_t *rtiREG, uint32 compare)
+{
+    (void)rtiREG;
+    simSync();
+    return (uint32)simRtiFrc(simRtiBlockOf(compare & 3U), simTimeNs())
+         - (s_comp[compare & 3U] - s_rti.CMP[compare & 3U].UDCPx);
+}
+
+void rtiEnableNotification(rtiBASE_t *rtiREG, uint32 notification)
+{
+    uint32_t i;
+
+    (void)rtiREG;
+    simSync();
+    simBusy();
+    for (i = 0U; i < SIM_RTI_COMPARES; i++)
+    {
+        if ((((notification & ~s_intEna) >> i) & 1U) != 0U)
+        {
+            simRtiCatchUp(i);
+        }
+    }
+    s_intFlag &= ~(notification & SIM_RTI_CMP_MASK);
+    s_intEna |= notification & SIM_RTI_CMP_MASK;
+    s_matchValid = 0U;
+    simRtiPublish();
+    simSync();
+}
+
+void rtiDisableNotification(rtiBASE_t *rtiREG, uint32 notification)
+{
+    (void)rtiREG;
+    simSync();
+    simBusy();
+    s_intEna &= ~(notification & SIM_RTI_CMP_MASK);
+    s_matchValid = 0U;
+    simRtiPublish();
+}
+
+/*---------------------------------------------------------------------------*/
+
+static uint32_t simRtiBlockOf(uint32_t compare)
+{
+    return ((s_rti.COMPCTRL >> (compare * 4U)) & 1U);
+}
+
+/**
+ * @brief  Unwrapped FRC of a block at a given time.
+ */
+static uint64_t simRtiFrc(uint32_t block, uint64_t now)
+{
+    const simRtiBlock_t *b = &s_block[block];
+    uint64_t div = s_clkDen * ((uint64_t)s_rti.CNT[block].CPUCx + 1U);
+
+    if ((b->running == 0U) || (div == 0U))
+    {
+        return b->frcBase;
+    }
+    return b->frcBase + (((now - b->timeBase) * s_clkNum) / div);
+}
+
+/**
+ * @brief  Time of the next match of a compare, UINT64_MAX if its block is
+ *         stopped or its interrupt is disabled. Kept until the RTI state
+ *         changes.
+ */
+static uint64_t simRtiMatchNs(uint32_t compare)
+{
+    uint32_t block = simRtiBlockOf(compare);
+    const simRtiBlock_t *b = &s_block[block];
+    uint64_t div = s_clkDen * ((uint64_t)s_rti.CNT[block].CPUCx + 1U);
+    uint64_t frc, ticks;
+    uint32_t delta;
+
+    if (((s_matchValid >> compare) & 1U) != 0U)
+    {
+        return s_matchNs[compare];
+    }
+    s_matchValid |= (uint32_t)1U << compare;
+    s_matchNs[compare] = UINT64_MAX;
+    if ((b->running == 0U) || (((s_intEna >> compare) & 1U) == 0U))
+    {
+        return UINT64_MAX;
+    }
+    frc = simRtiFrc(block, simTimeNs());
+    delta = s_comp[compare] - (uint32_t)frc;
+    if (delta == 0U)
+    {
+        /* Already matched at this count, next one after a wrap */
+        delta = 0xFFFFFFFFU;
+    }
+    /* First time at which FRC reaches frc + delta */
+    ticks = (frc - b->frcBase) + delta;
+    s_matchNs[compare] = b->timeBase + (((ticks * div) + s_clkNum - 1U) / s_clkNum);
+    return s_matchNs[compare];
+}
+
+/**
+ * @brief  Adds to a compare the UDCPx steps of the matches it missed while
+ *         its interrupt was disabled, as the device did meanwhile, so the
+ *         next match is the one at or after the current count.
+ */
+static void simRtiCatchUp(uint32_t compare)
+{
+    uint32_t block = simRtiBlockOf(compare);
+    uint32_t period = s_rti.CMP[compare].UDCPx;
+    uint32_t behind;
+
+    if ((s_block[block].running == 0U) || (period == 0U))
+    {
+        return;
+    }
+    behind = (uint32_t)simRtiFrc(block, simTimeNs()) - s_comp[compare];
+    if (behind < 0x80000000U)
+    {
+        s_comp[compare] += ((behind / period) + 1U) * period;
+    }
+}
+
+/**
+ * @brief  Copies the model state into the register block the firmware
+ *         reads. FRCx is only computed on access (simRtiRegs()).
+ */
+static void simRtiPublish(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_RTI_COMPARES; i++)
+    {
+        s_rti.CMP[i].COMPx = s_comp[i];
+    }
+    s_rti.SETINTENA = s_intEna;
+    s_rti.CLEARINTENA = s_intEna;
+    s_rti.INTFLAG = s_intFlag | SIM_W1C_MARK;
+}
+
+static void simRtiCompareInterrupt(uint32_t compare)
+{
+    s_intFlag &= ~((uint32_t)1U << compare);
+    simRtiPublish();
+    rtiNotification(&s_rti, (uint32)1U << compare);
+}
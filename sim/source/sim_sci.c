@@ -0,0 +1,781 @@
+/**
+ ******************************************************************************
+ * @file    sim_sci.c
+ * @brief   SCI Model and SCI Driver Functions
+ *
+ * @details
+ *   - Double-buffered transmitter (TD + shift register). A byte leaves the
+ *     shift register one frame time after it entered; the frame time
+ *     follows BRS, FORMAT and the stop/parity bits in GCR1.
+ *   - In digital loopback (IODFTCTRL key 0xA) the byte is received when
+ *     its frame completes; otherwise it goes to the TX sink (stdout by
+ *     default).
+ *   - RXRDY, TXRDY, TX EMPTY and the OE flag behave as on the device. A
+ *     byte arriving while RXRDY is set overwrites RD and sets OE.
+ *   - RX/TX DMA requests and the level 0/1 interrupt lines are level
+ *     signals evaluated by the DMA and VIM models.
+ *   - An RX source (simSciSetRxSource()) drives the RX pin: each byte is
+ *     received one frame time after its start bit, at the SCI's own baud
+ *     rate. The RX pin is ignored in loopback, as on the device. A source
+ *     that ran dry is asked again by simSciRxKick().
+ *   - Overruns are counted per SCI (simSciOverruns()), also once the
+ *     firmware has cleared OE.
+ *   - sciReceive() works as the HALCoGen driver: with SCI_RX_INT enabled
+ *     it only arms the transfer, and the level 0 handlers
+ *     (lin1HighLevelInterrupt(), sci3HighLevelInterrupt(), installed by
+ *     vimInit()) store each byte and call sciNotification() once the
+ *     transfer is complete (the default for builds without one is in
+ *     sim_cost_body.c).
+ *
+ * @note
+ *   - Only SCI1 (LIN1) and SCI3 have their VIM and DMA request numbers
+ *     wired.
+ *   - Interrupt-mode sciSend() is not modelled; a TX interrupt left
+ *     enabled never clears and stops the simulation.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "HL_sci.h"
+#include <stdio.h>
+
+#define SIM_SCI_GCR1_ASYNC      0x00000002U
+#define SIM_SCI_GCR1_PARITY     0x00000004U
+#define SIM_SCI_GCR1_STOP2      0x00000010U
+#define SIM_SCI_GCR1_SWNRST     0x00000080U
+#define SIM_SCI_GCR1_RXENA      0x01000000U
+#define SIM_SCI_GCR1_TXENA      0x02000000U
+
+#define SIM_SCI_FLR_TXRDY       0x00000100U
+#define SIM_SCI_FLR_RXRDY       0x00000200U
+#define SIM_SCI_FLR_TXEMPTY     0x00000800U
+/* Flags a firmware write of 1 clears */
+#define SIM_SCI_FLR_W1C         0x7F0002F3U
+
+#define SIM_SCI_INT_TXDMA       0x00010000U
+#define SIM_SCI_INT_RXDMA       0x00020000U
+/* Interrupt enables that map 1:1 onto FLR flags */
+#define SIM_SCI_INT_FLAGS       0x07000303U
+
+#define SIM_SCI_LOOPBACK_KEY    0x00000A00U
+#define SIM_SCI_NONE            0xFFFFFFFFU
+
+typedef struct
+{
+    sciBASE_t regs;
+    uint32_t flr;
+    uint32_t setint;
+    uint32_t setintlvl;
+    uint32_t tdFull;
+    uint8_t  tdByte;
+    uint32_t shiftBusy;
+    uint8_t  shiftByte;
+    uint64_t shiftEnd;
+    simSciRxSource_t rxSource;
+    uint32_t rxBusy;
+    uint8_t  rxByte;
+    uint64_t rxEnd;
+    uint64_t rxFree;        /* End of the last frame on the RX pin */
+    uint32_t overruns;
+    uint32_t vimReq[2U];    /* Level 0, level 1 */
+    uint32_t dmaReqRx;
+    uint32_t dmaReqTx;
+    uint32_t rxLength;      /* Interrupt-mode sciReceive() transfer */
+    uint8_t *rxData;
+} simSci_t;
+
+static simSci_t s_sci[SIM_SCI_COUNT] =
+{
+    { .vimReq = { 13U, 27U },                   .dmaReqRx = 28U,           .dmaReqTx = 29U },
+    { .vimReq = { SIM_SCI_NONE, SIM_SCI_NONE }, .dmaReqRx = SIM_SCI_NONE,  .dmaReqTx = SIM_SCI_NONE },
+    { .vimReq = { 64U, 74U },                   .dmaReqRx = 30U,           .dmaReqTx = 31U },
+    { .vimReq = { SIM_SCI_NONE, SIM_SCI_NONE }, .dmaReqRx = SIM_SCI_NONE,  .dmaReqTx = SIM_SCI_NONE },
+};
+
+static void simSciStdoutSink(uint32_t index, uint8_t data);
+static simSciTxSink_t s_txSink = &simSciStdoutSink;
+
+static simSci_t *simSciFind(const sciBASE_t *sci);
+static void simSciPublish(simSci_t *s);
+static uint64_t simSciFrameNs(const simSci_t *s);
+static void simSciWriteTd(simSci_t *s, uint8_t data, uint64_t now);
+static uint32_t simSciReadRd(simSci_t *s);
+static void simSciReceive(simSci_t *s, uint8_t data);
+static void simSciReset(simSci_t *s);
+static void simSciRxNext(simSci_t *s, uint64_t lineFree);
+static uint64_t simSciEventNs(const simSci_t *s);
+static void simSciHighLevelInterrupt(uint32_t index);
+
+/**
+ * @brief  Register block of SCI index (0 = sciREG1), synced to now.
+ */
+sciBASE_t *simSciRegs(uint32_t index)
+{
+    simSync();
+    return &s_sci[index].regs;
+}
+
+/**
+ * @brief  Sets where bytes transmitted outside loopback go.
+ */
+void simSciSetTxSink(simSciTxSink_t sink)
+{
+    s_txSink = (sink != NULL) ? sink : &simSciStdoutSink;
+}
+
+/**
+ * @brief  Connects a source to the RX pin of SCI index and schedules its
+ *         first byte. NULL leaves the pin idle.
+ */
+void simSciSetRxSource(uint32_t index, simSciRxSource_t source)
+{
+    simSci_t *s = &s_sci[index];
+
+    simSync();
+    s->rxSource = source;
+    s->rxBusy = 0U;
+    simSciRxNext(s, simTimeNs());
+}
+
+/**
+ * @brief  Asks the RX source of SCI index for a byte again after it ran
+ *         dry; the byte starts now, or once the previous frame has ended.
+ *         Nothing happens while a frame is on the pin.
+ */
+void simSciRxKick(uint32_t index)
+{
+    simSci_t *s = &s_sci[index];
+
+    if (s->rxBusy == 0U)
+    {
+        simSciRxNext(s, (s->rxFree > simTimeNs()) ? s->rxFree : simTimeNs());
+    }
+}
+
+/**
+ * @brief  Bytes SCI index lost to overruns since start-up.
+ */
+uint32_t simSciOverruns(uint32_t index)
+{
+    return s_sci[index].overruns;
+}
+
+/**
+ * @brief  Current line rate of SCI index in baud, from BRS.
+ */
+uint32_t simSciBaud(uint32_t index)
+{
+    const simSci_t *s = &s_sci[index];
+
+    return (uint32_t)((uint64_t)SIM_VCLK_HZ
+         / ((((s->regs.GCR1 & SIM_SCI_GCR1_ASYNC) != 0U) ? 16U : 1U) * ((uint64_t)(s->regs.BRS & 0x00FFFFFFU) + 1U)));
+}
+
+/**
+ * @brief  Duration of one frame of SCI index in ns, from BRS/FORMAT/GCR1.
+ */
+uint64_t simSciCharNs(uint32_t index)
+{
+    return simSciFrameNs(&s_sci[index]);
+}
+
+/**
+ * @brief  Decodes firmware writes made since the last sync.
+ */
+void simSciApplyWrites(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_SCI_COUNT; i++)
+    {
+        simSci_t *s = &s_sci[i];
+
+        if (s->regs.SETINT != s->setint)
+        {
+            s->setint |= s->regs.SETINT;
+            simBusy();
+        }
+        if (s->regs.CLEARINT != 0U)
+        {
+            s->setint &= ~s->regs.CLEARINT;
+            simBusy();
+        }
+        if (s->regs.SETINTLVL != s->setintlvl)
+        {
+            s->setintlvl |= s->regs.SETINTLVL;
+            simBusy();
+        }
+        if (s->regs.CLEARINTLVL != 0U)
+        {
+            s->setintlvl &= ~s->regs.CLEARINTLVL;
+            simBusy();
+        }
+        if (s->regs.FLR != (s->flr | SIM_W1C_MARK))
+        {
+            s->flr &= ~(s->regs.FLR & SIM_SCI_FLR_W1C);
+            simBusy();
+        }
+        if ((s->regs.GCR1 & SIM_SCI_GCR1_SWNRST) == 0U)
+        {
+            simSciReset(s);
+        }
+        if (s->regs.TD != SIM_TD_IDLE)
+        {
+            simSciWriteTd(s, (uint8_t)s->regs.TD, simTimeNs());
+            simBusy();
+        }
+        simSciPublish(s);
+    }
+}
+
+/**
+ * @brief  Time of the earliest pending SCI event, UINT64_MAX if none.
+ */
+uint64_t simSciNextEventNs(void)
+{
+    uint64_t next = UINT64_MAX;
+    uint32_t i;
+
+    for (i = 0U; i < SIM_SCI_COUNT; i++)
+    {
+        uint64_t t = simSciEventNs(&s_sci[i]);
+
+        if (t < next)
+        {
+            next = t;
+        }
+    }
+    return next;
+}
+
+/**
+ * @brief  Runs the earliest pending SCI event: the frame in a shift
+ *         register is complete, or a frame on the RX pin.
+ */
+void simSciRunEvent(void)
+{
+    simSci_t *next = NULL;
+    uint64_t when = UINT64_MAX;
+    uint32_t i;
+    uint8_t data;
+
+    for (i = 0U; i < SIM_SCI_COUNT; i++)
+    {
+        uint64_t t = simSciEventNs(&s_sci[i]);
+
+        if (t < when)
+        {
+            when = t;
+            next = &s_sci[i];
+        }
+    }
+    if (next == NULL)
+    {
+        return;
+    }
+
+    if ((next->rxBusy != 0U) && (next->rxEnd == when)
+     && ((next->shiftBusy == 0U) || (next->shiftEnd != when)))
+    {
+        /* Frame on the RX pin is complete */
+        data = next->rxByte;
+        next->rxBusy = 0U;
+        next->rxFree = when;
+        if ((next->regs.IODFTCTRL & 0x00000F00U) != SIM_SCI_LOOPBACK_KEY)
+        {
+            simSciReceive(next, data);
+        }
+        simSciRxNext(next, when);
+        simSciPublish(next);
+        return;
+    }
+
+    /* Frame on the line is complete */
+    data = next->shiftByte;
+    if (next->tdFull != 0U)
+    {
+        next->shiftByte = next->tdByte;
+        next->shiftEnd += simSciFrameNs(next);
+        next->tdFull = 0U;
+        next->flr |= SIM_SCI_FLR_TXRDY;
+    }
+    else
+    {
+        next->shiftBusy = 0U;
+        next->flr |= SIM_SCI_FLR_TXEMPTY;
+    }
+
+    if ((next->regs.IODFTCTRL & 0x00000F00U) == SIM_SCI_LOOPBACK_KEY)
+    {
+        simSciReceive(next, data);
+    }
+    else
+    {
+        s_txSink((uint32_t)(next - s_sci), data);
+    }
+
+    simSciPublish(next);
+}
+
+/**
+ * @brief  Level of a VIM request line driven by an SCI.
+ */
+uint32_t simSciIrqAsserted(uint32_t request)
+{
+    uint32_t i, lvl, pending;
+
+    for (i = 0U; i < SIM_SCI_COUNT; i++)
+    {
+        simSci_t *s = &s_sci[i];
+
+        for (lvl = 0U; lvl < 2U; lvl++)
+        {
+            if (s->vimReq[lvl] != request)
+            {
+                continue;
+            }
+            pending = s->flr & s->setint & SIM_SCI_INT_FLAGS;
+            pending &= (lvl == 0U) ? ~s->setintlvl : s->setintlvl;
+            if (pending != 0U)
+            {
+                return 1U;
+            }
+        }
+    }
+    return 0U;
+}
+
+/**
+ * @brief  Level of a DMA request line driven by an SCI.
+ */
+uint32_t simSciDmaAsserted(uint32_t request)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_SCI_COUNT; i++)
+    {
+        simSci_t *s = &s_sci[i];
+
+        if ((request == s->dmaReqRx) && ((s->setint & SIM_SCI_INT_RXDMA) != 0U)
+         && ((s->flr & SIM_SCI_FLR_RXRDY) != 0U))
+        {
+            return 1U;
+        }
+        if ((request == s->dmaReqTx) && ((s->setint & SIM_SCI_INT_TXDMA) != 0U)
+         && ((s->flr & SIM_SCI_FLR_TXRDY) != 0U))
+        {
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/**
+ * @brief  DMA read of an SCI RD register (byte or word address).
+ * @return Non-zero if addr belongs to an RD register.
+ */
+uint32_t simSciDmaRead(uint32_t addr, uint32_t *value)
+{
+    uint32_t i, rd;
+
+    for (i = 0U; i < SIM_SCI_COUNT; i++)
+    {
+        rd = simTargetAddr(&s_sci[i].regs.RD);
+        if ((addr >= rd) && (addr < (rd + 4U)))
+        {
+            *value = simSciReadRd(&s_sci[i]);
+            simSciPublish(&s_sci[i]);
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/**
+ * @brief  DMA write of an SCI TD register (byte or word address).
+ * @return Non-zero if addr belongs to a TD register.
+ */
+uint32_t simSciDmaWrite(uint32_t addr, uint32_t value)
+{
+    uint32_t i, td;
+
+    for (i = 0U; i < SIM_SCI_COUNT; i++)
+    {
+        td = simTargetAddr(&s_sci[i].regs.TD);
+        if ((addr >= td) && (addr < (td + 4U)))
+        {
+            simSciWriteTd(&s_sci[i], (uint8_t)value, simTimeNs());
+            simSciPublish(&s_sci[i]);
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/*---------------------------------------------------------------------------*/
+/* Driver functions (HL_sci.h)                                               */
+
+void sciInit(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_SCI_COUNT; i++)
+    {
+        simSci_t *s = &s_sci[i];
+
+        s->regs.GCR0 = 1U;
+        s->regs.GCR1 = SIM_SCI_GCR1_TXENA | SIM_SCI_GCR1_RXENA | 0x20U
+                     | SIM_SCI_GCR1_STOP2 | SIM_SCI_GCR1_ASYNC;
+        s->regs.BRS = 179U;             /* 26042 baud */
+        s->regs.FORMAT = 8U - 1U;
+        s->regs.IODFTCTRL = 0U;
+        s->setint = 0U;
+        s->setintlvl = 0U;
+        s->regs.SETINT = 0U;
+        s->regs.SETINTLVL = 0U;
+        s->regs.CLEARINT = 0U;
+        s->regs.CLEARINTLVL = 0U;
+        simSciReset(s);
+        s->regs.GCR1 |= SIM_SCI_GCR1_SWNRST;
+        simSciPublish(s);
+    }
+    simBusy();
+}
+
+void sciSetBaudrate(sciBASE_t *sci, uint32 baud)
+{
+    uint32_t f = ((sci->GCR1 & SIM_SCI_GCR1_ASYNC) != 0U) ? 16U : 1U;
+    uint64_t div = (uint64_t)f * baud;
+
+    simSync();
+    simBusy();
+    sci->BRS = (uint32)(((SIM_VCLK_HZ + (div / 2U)) / div) - 1U) & 0x00FFFFFFU;
+}
+
+uint32 sciIsTxReady(sciBASE_t *sci)
+{
+    simSync();
+    return simSciFind(sci)->flr & SIM_SCI_FLR_TXRDY;
+}
+
+void sciSendByte(sciBASE_t *sci, uint8 byte)
+{
+    simSci_t *s = simSciFind(sci);
+
+    simSync();
+    while ((s->flr & SIM_SCI_FLR_TXRDY) == 0U)
+    {
+        simSyncWait("sciSendByte");
+    }
+    simSciWriteTd(s, byte, simTimeNs());
+    simSciPublish(s);
+    simBusy();
+    simSync();
+}
+
+void sciSend(sciBASE_t *sci, uint32 length, uint8 *data)
+{
+    while (length > 0U)
+    {
+        sciSendByte(sci, *data);
+        data++;
+        length--;
+    }
+}
+
+uint32 sciIsRxReady(sciBASE_t *sci)
+{
+    simSync();
+    return simSciFind(sci)->flr & SIM_SCI_FLR_RXRDY;
+}
+
+uint32 sciIsIdleDetected(sciBASE_t *sci)
+{
+    simSync();
+    return simSciFind(sci)->flr & SCI_IDLE;
+}
+
+uint32 sciRxError(sciBASE_t *sci)
+{
+    simSync();
+    return simSciFind(sci)->flr & (SCI_FE_INT | SCI_OE_INT | SCI_PE_INT);
+}
+
+uint32 sciReceiveByte(sciBASE_t *sci)
+{
+    simSci_t *s = simSciFind(sci);
+    uint32_t data;
+
+    simSync();
+    while ((s->flr & SIM_SCI_FLR_RXRDY) == 0U)
+    {
+        simSyncWait("sciReceiveByte");
+    }
+    data = simSciReadRd(s);
+    simSciPublish(s);
+    simBusy();
+    return data & 0xFFU;
+}
+
+void sciReceive(sciBASE_t *sci, uint32 length, uint8 *data)
+{
+    simSci_t *s = simSciFind(sci);
+
+    simSync();
+    if ((s->setint & SCI_RX_INT) != 0U)
+    {
+        /* Interrupt mode: clear the error flags and arm the transfer */
+        s->flr &= ~(SCI_FE_INT | SCI_OE_INT | SCI_PE_INT);
+        s->rxLength = length;
+        s->rxData = data;
+        simSciPublish(s);
+        simBusy();
+        return;
+    }
+    while (length > 0U)
+    {
+        *data = (uint8)sciReceiveByte(sci);
+        data++;
+        length--;
+    }
+}
+
+void sciEnableNotification(sciBASE_t *sci, uint32 flags)
+{
+    simSci_t *s = simSciFind(sci);
+
+    simSync();
+    s->setint |= flags;
+    simSciPublish(s);
+    simBusy();
+    simSync();
+}
+
+void sciDisableNotification(sciBASE_t *sci, uint32 flags)
+{
+    simSci_t *s = simSciFind(sci);
+
+    simSync();
+    s->setint &= ~flags;
+    simSciPublish(s);
+    simBusy();
+}
+
+void sciEnableLoopback(sciBASE_t *sci, loopBackType_t Loopbacktype)
+{
+    simSync();
+    simBusy();
+    sci->IODFTCTRL = SIM_SCI_LOOPBACK_KEY | ((uint32)Loopbacktype << 1U);
+}
+
+void sciDisableLoopback(sciBASE_t *sci)
+{
+    simSync();
+    simBusy();
+    sci->IODFTCTRL = 0x00000500U;
+}
+
+void lin1HighLevelInterrupt(void)
+{
+    simSciHighLevelInterrupt(0U);
+}
+
+void sci3HighLevelInterrupt(void)
+{
+    simSciHighLevelInterrupt(2U);
+}
+
+void sciEnterResetState(sciBASE_t *sci)
+{
+    simSync();
+    simBusy();
+    sci->GCR1 &= ~SIM_SCI_GCR1_SWNRST;
+    simSync();
+}
+
+void sciExitResetState(sciBASE_t *sci)
+{
+    simSync();
+    simBusy();
+    sci->GCR1 |= SIM_SCI_GCR1_SWNRST;
+}
+
+/*---------------------------------------------------------------------------*/
+
+static void simSciStdoutSink(uint32_t index, uint8_t data)
+{
+    (void)index;
+    (void)fputc((int)data, stdout);
+    if (data == (uint8_t)'\n')
+    {
+        (void)fflush(stdout);
+    }
+}
+
+static simSci_t *simSciFind(const sciBASE_t *sci)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_SCI_COUNT; i++)
+    {
+        if (sci == &s_sci[i].regs)
+        {
+            return &s_sci[i];
+        }
+    }
+    simFatal("unknown SCI base address");
+    return NULL;
+}
+
+/**
+ * @brief  Copies the model state into the register block the firmware
+ *         reads.
+ */
+static void simSciPublish(simSci_t *s)
+{
+    s->regs.FLR = s->flr | SIM_W1C_MARK;
+    s->regs.SETINT = s->setint;
+    s->regs.CLEARINT = 0U;
+    s->regs.SETINTLVL = s->setintlvl;
+    s->regs.CLEARINTLVL = 0U;
+    s->regs.TD = SIM_TD_IDLE;
+}
+
+static uint64_t simSciFrameNs(const simSci_t *s)
+{
+    uint32_t gcr1 = s->regs.GCR1;
+    uint32_t bits = 1U + ((s->regs.FORMAT & 0x7U) + 1U);
+    uint64_t baud;
+
+    bits += ((gcr1 & SIM_SCI_GCR1_STOP2) != 0U) ? 2U : 1U;
+    bits += ((gcr1 & SIM_SCI_GCR1_PARITY) != 0U) ? 1U : 0U;
+    baud = simSciBaud((uint32_t)(s - s_sci));
+
+    return ((uint64_t)bits * 1000000000ULL) / baud;
+}
+
+static void simSciWriteTd(simSci_t *s, uint8_t data, uint64_t now)
+{
+    if (((s->regs.GCR1 & SIM_SCI_GCR1_TXENA) == 0U) || ((s->regs.GCR1 & SIM_SCI_GCR1_SWNRST) == 0U))
+    {
+        return;
+    }
+
+    if (s->shiftBusy == 0U)
+    {
+        s->shiftBusy = 1U;
+        s->shiftByte = data;
+        s->shiftEnd = now + simSciFrameNs(s);
+        s->flr &= ~SIM_SCI_FLR_TXEMPTY;
+    }
+    else
+    {
+        /* A write while TD is still full replaces the byte, as on the device */
+        s->tdFull = 1U;
+        s->tdByte = data;
+        s->flr &= ~SIM_SCI_FLR_TXRDY;
+    }
+}
+
+static uint32_t simSciReadRd(simSci_t *s)
+{
+    s->flr &= ~SIM_SCI_FLR_RXRDY;
+    return s->regs.RD;
+}
+
+static void simSciReceive(simSci_t *s, uint8_t data)
+{
+    if ((s->regs.GCR1 & SIM_SCI_GCR1_RXENA) == 0U)
+    {
+        return;
+    }
+    if ((s->flr & SIM_SCI_FLR_RXRDY) != 0U)
+    {
+        s->flr |= SCI_OE_INT;
+        s->overruns++;
+    }
+    s->regs.RD = data;
+    s->flr |= SIM_SCI_FLR_RXRDY;
+}
+
+/**
+ * @brief  Fetches the next byte of the RX source.
+ * @param  lineFree  Time the previous frame ended.
+ */
+static void simSciRxNext(simSci_t *s, uint64_t lineFree)
+{
+    uint64_t idle = 0U;
+    uint8_t data = 0U;
+
+    if ((s->rxSource == NULL) || (s->rxSource((uint32_t)(s - s_sci), &idle, &data) == 0U))
+    {
+        return;
+    }
+    s->rxByte = data;
+    s->rxEnd = lineFree + idle + simSciFrameNs(s);
+    s->rxBusy = 1U;
+}
+
+/**
+ * @brief  Level 0 interrupt of the generated driver: a received byte goes
+ *         into the armed transfer, sciNotification() is called once it is
+ *         complete. Other flags are cleared as phantom interrupts.
+ */
+static void simSciHighLevelInterrupt(uint32_t index)
+{
+    simSci_t *s = &s_sci[index];
+    uint32_t pending;
+    uint8_t byte;
+
+    simSync();
+    pending = s->flr & s->setint & ~s->setintlvl & SIM_SCI_INT_FLAGS;
+    if ((pending & SCI_RX_INT) != 0U)
+    {
+        byte = (uint8_t)simSciReadRd(s);
+        simSciPublish(s);
+        simBusy();
+        if (s->rxLength > 0U)
+        {
+            *s->rxData = byte;
+            s->rxData++;
+            s->rxLength--;
+            if (s->rxLength == 0U)
+            {
+                sciNotification(&s->regs, SCI_RX_INT);
+            }
+        }
+    }
+    else
+    {
+        s->flr &= ~(pending & SIM_SCI_FLR_W1C);
+        simSciPublish(s);
+        simBusy();
+    }
+}
+
+/**
+ * @brief  Time of the earliest pending event of one SCI.
+ */
+static uint64_t simSciEventNs(const simSci_t *s)
+{
+    uint64_t t = UINT64_MAX;
+
+    if (s->shiftBusy != 0U)
+    {
+        t = s->shiftEnd;
+    }
+    if ((s->rxBusy != 0U) && (s->rxEnd < t))
+    {
+        t = s->rxEnd;
+    }
+    return t;
+}
+
+/**
+ * @brief  Software reset: empties both buffers and clears the flags.
+ */
+static void simSciReset(simSci_t *s)
+{
+    s->tdFull = 0U;
+    s->shiftBusy = 0U;
+    s->flr = SIM_SCI_FLR_TXRDY | SIM_SCI_FLR_TXEMPTY;
+}
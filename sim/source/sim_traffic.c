@@ -0,0 +1,183 @@
+/**
+ ******************************************************************************
+ * @file    sim_traffic.c
+ * @brief   Seeded Host Traffic With Idle Gaps, for an SCI RX Source
+ *
+ * @details
+ *   - simTrafficNext() is a simSciRxSource_t. Bytes come in bursts of
+ *     1..maxBurst bytes, back to back at the line rate. A burst is
+ *     followed either by a short pause (up to half the window timeout,
+ *     the window stays open) or by a long gap (twice the timeout up to
+ *     maxIdleMs, the window closes).
+ *   - The generator keeps the byte count and CRC32 of every window it
+ *     closes; simTrafficPop() hands them out in order, for comparison
+ *     with what the firmware reports. The CRC is computed bit by bit
+ *     here, not with the firmware kernels, which the cost model charges
+ *     as firmware time (sim_cost.c).
+ *   - Everything derives from the seed (xorshift32), so a run is
+ *     reproducible with the event clock.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "crc32_kernel.h"
+
+/* Closed windows not yet popped */
+#define SIM_TRAFFIC_FIFO        8U
+/* One burst in SIM_TRAFFIC_PAUSE_ODDS is followed by a short pause */
+#define SIM_TRAFFIC_PAUSE_ODDS  4U
+
+typedef struct
+{
+    uint32_t bytes;
+    uint32_t crc;
+} simTrafficWindow_t;
+
+static simTrafficCfg_t s_cfg;
+static uint32_t s_rand;
+static uint32_t s_left = 0U;
+static uint64_t s_gapNs = 0U;
+static uint32_t s_stopped = 0U;
+static uint32_t s_count = 0U;
+static uint32_t s_crc = CRC32_INIT;
+static simTrafficWindow_t s_fifo[SIM_TRAFFIC_FIFO];
+static uint32_t s_head = 0U;
+static uint32_t s_tail = 0U;
+
+static uint32_t simTrafficRand(void);
+static uint32_t simTrafficRange(uint32_t lo, uint32_t hi);
+static void simTrafficClose(void);
+
+/**
+ * @brief  Starts a new traffic run.
+ */
+void simTrafficInit(const simTrafficCfg_t *cfg)
+{
+    s_cfg = *cfg;
+    s_rand = (cfg->seed != 0U) ? cfg->seed : 1U;
+    s_left = 0U;
+    s_gapNs = 0U;
+    s_stopped = 0U;
+    s_count = 0U;
+    s_crc = CRC32_INIT;
+    s_head = 0U;
+    s_tail = 0U;
+}
+
+/**
+ * @brief  RX source: the next byte and the idle time before it.
+ * @return 0 once the run is over.
+ */
+uint32_t simTrafficNext(uint32_t index, uint64_t *idleNs, uint8_t *data)
+{
+    (void)index;
+
+    if (s_stopped != 0U)
+    {
+        return 0U;
+    }
+    if (s_left == 0U)
+    {
+        if (simTimeNs() >= s_cfg.durationNs)
+        {
+            simTrafficClose();
+            s_stopped = 1U;
+            return 0U;
+        }
+        s_left = simTrafficRange(1U, s_cfg.maxBurst);
+        *idleNs = s_gapNs;
+    }
+    else
+    {
+        *idleNs = 0U;
+    }
+
+    *data = (uint8_t)simTrafficRand();
+    s_crc = simTrafficCrc(s_crc, *data);
+    s_count++;
+    s_left--;
+
+    if (s_left == 0U)
+    {
+        /* Pause inside the window, or a gap that closes it */
+        if ((simTrafficRand() % SIM_TRAFFIC_PAUSE_ODDS) == 0U)
+        {
+            s_gapNs = (uint64_t)simTrafficRange(0U, s_cfg.windowMs / 2U) * 1000000ULL;
+        }
+        else
+        {
+            s_gapNs = (uint64_t)simTrafficRange(2U * s_cfg.windowMs, s_cfg.maxIdleMs) * 1000000ULL;
+            simTrafficClose();
+        }
+    }
+    return 1U;
+}
+
+/**
+ * @brief  Oldest closed window.
+ * @return 0 if none is waiting.
+ */
+uint32_t simTrafficPop(uint32_t *bytes, uint32_t *crc)
+{
+    if (s_tail == s_head)
+    {
+        return 0U;
+    }
+    *bytes = s_fifo[s_tail % SIM_TRAFFIC_FIFO].bytes;
+    *crc = s_fifo[s_tail % SIM_TRAFFIC_FIFO].crc;
+    s_tail++;
+    return 1U;
+}
+
+/**
+ * @brief  Non-zero once the run is over and every window was popped.
+ */
+uint32_t simTrafficDone(void)
+{
+    return ((s_stopped != 0U) && (s_tail == s_head)) ? 1U : 0U;
+}
+
+static uint32_t simTrafficRand(void)
+{
+    s_rand ^= s_rand << 13U;
+    s_rand ^= s_rand >> 17U;
+    s_rand ^= s_rand << 5U;
+    return s_rand;
+}
+
+static uint32_t simTrafficRange(uint32_t lo, uint32_t hi)
+{
+    return lo + (simTrafficRand() % ((hi - lo) + 1U));
+}
+
+/**
+ * @brief  Adds one byte to a reflected CRC32 state, bit by bit. Also the
+ *         reference of the line model (sim_line.c).
+ */
+uint32_t simTrafficCrc(uint32_t crc, uint8_t data)
+{
+    uint32_t i;
+
+    crc ^= data;
+    for (i = 0U; i < 8U; i++)
+    {
+        crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ CRC32_POLYNOMIAL_REFL) : (crc >> 1U);
+    }
+    return crc;
+}
+
+static void simTrafficClose(void)
+{
+    if (s_count == 0U)
+    {
+        return;
+    }
+    if ((s_head - s_tail) >= SIM_TRAFFIC_FIFO)
+    {
+        simFatal("traffic windows are not being reported");
+    }
+    s_fifo[s_head % SIM_TRAFFIC_FIFO].bytes = s_count;
+    s_fifo[s_head % SIM_TRAFFIC_FIFO].crc = s_crc ^ CRC32_XOROUT;
+    s_head++;
+    s_count = 0U;
+    s_crc = CRC32_INIT;
+}
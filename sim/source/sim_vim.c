@@ -0,0 +1,231 @@
+/**
+ ******************************************************************************
+ * @file    sim_vim.c
+ * @brief   VIM Model and CPU IRQ Mask
+ *
+ * @details
+ *   - vimChannelMap() binds a request line to a channel and its handler,
+ *     vimEnableInterrupt()/vimDisableInterrupt() gate the channel.
+ *   - Request lines are level sensitive and asked from the peripheral
+ *     models. The lowest asserted channel number wins, as on the VIM.
+ *   - Handlers run to completion with IRQs masked, no nesting. Each is
+ *     charged its entry and exit cycles (sim_cost.c); the cycles of every
+ *     channel are kept for the budget check (simVimIsrStats()).
+ *   - vimInit() installs the RTI compare handlers on channels 2..5 and
+ *     enables channel 2, as the HALCoGen configuration of the projects
+ *     does. The SCI1 and SCI3 level 0 handlers are installed on channels
+ *     13 and 64 but left disabled: a build with an interrupt backend
+ *     enables its channel, as a project whose HALCoGen configuration
+ *     has it.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "HL_sys_vim.h"
+#include "HL_sys_core.h"
+#include <stdio.h>
+
+#define SIM_VIM_CHANNELS        128U
+/* Stops a handler that does not clear its source from hanging the host */
+#define SIM_VIM_MAX_DISPATCH    1000U
+
+static t_isrFuncPTR s_handler[SIM_VIM_CHANNELS];
+static uint32_t s_request[SIM_VIM_CHANNELS];
+static uint32_t s_enabled[SIM_VIM_CHANNELS / 32U];
+static uint32_t s_irqEnabled = 0U;
+static uint32_t s_inIsr = 0U;
+/* Handlers run and their longest run in GCLK cycles, per channel */
+static uint32_t s_isrCount[SIM_VIM_CHANNELS];
+static double s_isrMax[SIM_VIM_CHANNELS];
+
+static uint32_t simVimAsserted(uint32_t request);
+static uint32_t simVimFirstAsserted(void);
+
+void vimInit(void)
+{
+    uint32_t ch;
+
+    for (ch = 0U; ch < SIM_VIM_CHANNELS; ch++)
+    {
+        s_handler[ch] = NULL;
+        s_request[ch] = ch;
+    }
+    for (ch = 0U; ch < (SIM_VIM_CHANNELS / 32U); ch++)
+    {
+        s_enabled[ch] = 0U;
+    }
+    s_handler[2U] = &rtiCompare0Interrupt;
+    s_handler[3U] = &rtiCompare1Interrupt;
+    s_handler[4U] = &rtiCompare2Interrupt;
+    s_handler[5U] = &rtiCompare3Interrupt;
+    s_handler[13U] = &lin1HighLevelInterrupt;
+    s_handler[64U] = &sci3HighLevelInterrupt;
+    s_enabled[0U] = (uint32_t)1U << 2U;
+}
+
+void vimChannelMap(uint32 request, uint32 channel, t_isrFuncPTR handler)
+{
+    if (channel < SIM_VIM_CHANNELS)
+    {
+        s_request[channel] = request;
+        s_handler[channel] = handler;
+    }
+    simBusy();
+}
+
+void vimEnableInterrupt(uint32 channel, systemInterrupt_t inttype)
+{
+    if (inttype != SYS_IRQ)
+    {
+        simFatal("FIQ channels are not modelled");
+    }
+    if (channel < SIM_VIM_CHANNELS)
+    {
+        s_enabled[channel / 32U] |= (uint32_t)1U << (channel % 32U);
+    }
+    simBusy();
+    simSync();
+}
+
+void vimDisableInterrupt(uint32 channel)
+{
+    if (channel < SIM_VIM_CHANNELS)
+    {
+        s_enabled[channel / 32U] &= ~((uint32_t)1U << (channel % 32U));
+    }
+    simBusy();
+}
+
+void _enable_interrupt_(void)
+{
+    s_irqEnabled = 1U;
+    simBusy();
+    simSync();
+}
+
+void _enable_IRQ_interrupt_(void)
+{
+    s_irqEnabled = 1U;
+    simBusy();
+    simSync();
+}
+
+void _disable_IRQ_interrupt_(void)
+{
+    s_irqEnabled = 0U;
+}
+
+/**
+ * @brief  Runs the handlers of all asserted, enabled channels, highest
+ *         priority (lowest channel) first, until no line is asserted.
+ * @return Number of handlers run.
+ */
+uint32_t simVimDispatch(void)
+{
+    uint32_t n, ch;
+    double cycles;
+
+    if ((s_irqEnabled == 0U) || (s_inIsr != 0U))
+    {
+        return 0U;
+    }
+
+    for (n = 0U; n < SIM_VIM_MAX_DISPATCH; n++)
+    {
+        ch = simVimFirstAsserted();
+        if (ch == SIM_VIM_CHANNELS)
+        {
+            return n;
+        }
+        if (s_handler[ch] == NULL)
+        {
+            fprintf(stderr, "sim: VIM channel %u has no handler\n", (unsigned)ch);
+            simFatal("unhandled interrupt");
+        }
+
+        s_inIsr = 1U;
+        simIsrBegin();
+        s_handler[ch]();
+        cycles = simIsrEnd();
+        s_inIsr = 0U;
+
+        s_isrCount[ch]++;
+        if (cycles > s_isrMax[ch])
+        {
+            s_isrMax[ch] = cycles;
+        }
+    }
+    simFatal("interrupt source never cleared by its handler");
+    return n;
+}
+
+/**
+ * @brief  Non-zero when a handler would run if the CPU were free.
+ */
+uint32_t simVimPending(void)
+{
+    if ((s_irqEnabled == 0U) || (s_inIsr != 0U))
+    {
+        return 0U;
+    }
+    return (simVimFirstAsserted() != SIM_VIM_CHANNELS) ? 1U : 0U;
+}
+
+/**
+ * @brief  Handler runs of a channel since the last simVimClearIsrStats().
+ * @param  channel    VIM channel.
+ * @param  maxCycles  Longest run in GCLK cycles, entry and exit included.
+ * @return Number of runs.
+ */
+uint32_t simVimIsrStats(uint32_t channel, double *maxCycles)
+{
+    if (channel >= SIM_VIM_CHANNELS)
+    {
+        *maxCycles = 0.0;
+        return 0U;
+    }
+    *maxCycles = s_isrMax[channel];
+    return s_isrCount[channel];
+}
+
+/**
+ * @brief  Clears the handler runs of all channels.
+ */
+void simVimClearIsrStats(void)
+{
+    uint32_t ch;
+
+    for (ch = 0U; ch < SIM_VIM_CHANNELS; ch++)
+    {
+        s_isrCount[ch] = 0U;
+        s_isrMax[ch] = 0.0;
+    }
+}
+
+/**
+ * @brief  Lowest enabled channel whose request is asserted, only visiting
+ *         the enabled ones; SIM_VIM_CHANNELS if none.
+ */
+static uint32_t simVimFirstAsserted(void)
+{
+    uint32_t w, bits, ch;
+
+    for (w = 0U; w < (SIM_VIM_CHANNELS / 32U); w++)
+    {
+        bits = s_enabled[w];
+        while (bits != 0U)
+        {
+            ch = (w * 32U) + (uint32_t)__builtin_ctz(bits);
+            if (simVimAsserted(s_request[ch]) != 0U)
+            {
+                return ch;
+            }
+            bits &= bits - 1U;
+        }
+    }
+    return SIM_VIM_CHANNELS;
+}
+
+static uint32_t simVimAsserted(uint32_t request)
+{
+    return simSciIrqAsserted(request) | simRtiIrqAsserted(request) | simDmaIrqAsserted(request);
+}
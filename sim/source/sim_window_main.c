@@ -0,0 +1,179 @@
+/**
+ ******************************************************************************
+ * @file    sim_window_main.c
+ * @brief   Hours of Idle-Window Traffic Through the Shared Core
+ *
+ * @details
+ *   - The shared core (common/source/core.c) with the DMA ring backend
+ *     receives seeded host traffic (sim_traffic.c) on SCI3 at 937500 baud,
+ *     with the RTI compare 0 tick and the 5000 ms idle window of the
+ *     projects. The main loop is the one of a project: poll until the
+ *     window is due, then report.
+ *   - The report lines the firmware sends on SCI3 are parsed from the TX
+ *     line; every "Bytes received" / "Updated CRC" pair is compared with
+ *     the window the generator closed.
+ *   - Runs on the event clock: the gaps of up to two minutes between
+ *     windows are skipped, so an hour of traffic takes seconds, and the
+ *     same seed always gives the same summary line.
+ *
+ * @note
+ *   - Usage: sim_window [seed] [hours]. Exit status is 0 when every
+ *     window matched. The host run time goes to stderr.
+ ******************************************************************************
+ */
+#include "sim.h"
+#include "core.h"
+#include "core_rx.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SIM_WIN_BAUD            937500U
+#define SIM_WIN_MAX_BURST       (3U * CORE_RX_RING_SIZE)
+#define SIM_WIN_MAX_IDLE_MS     120000U
+#define SIM_WIN_LINE            96U
+
+static char s_line[SIM_WIN_LINE];
+static uint32_t s_lineLen = 0U;
+static uint32_t s_reported = 0U;
+static uint32_t s_windows = 0U;
+static uint32_t s_empty = 0U;
+static uint32_t s_errors = 0U;
+static uint64_t s_bytes = 0U;
+/* Folds the CRCs of all windows, a fingerprint of the run */
+static uint32_t s_digest = 0U;
+
+static void simWinSink(uint32_t index, uint8_t data);
+static void simWinLine(const char *line);
+
+void rtiNotification(rtiBASE_t *rtiREG, uint32 notification)
+{
+    if ((rtiREG == rtiREG1) && (notification == rtiNOTIFICATION_COMPARE0))
+    {
+        coreTick();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    simTrafficCfg_t cfg;
+    struct timespec t0, t1;
+    double hours = (argc > 2) ? atof(argv[2]) : 1.0;
+
+    cfg.seed = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 1U;
+    cfg.durationNs = (uint64_t)(hours * 3600.0 * 1e9);
+    cfg.maxBurst = SIM_WIN_MAX_BURST;
+    cfg.windowMs = CORE_TIMEOUT_MS;
+    cfg.maxIdleMs = SIM_WIN_MAX_IDLE_MS;
+
+    simSetClock(SIM_CLOCK_EVENT);
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+    vimInit();
+    sciInit();
+    rtiInit();
+    sciSetBaudrate(CORE_UART, SIM_WIN_BAUD);
+    simSciSetTxSink(&simWinSink);
+    simTrafficInit(&cfg);
+    simSciSetRxSource(2U, &simTrafficNext);
+
+    rtiEnableNotification(rtiREG1, rtiNOTIFICATION_COMPARE0);
+    rtiStartCounter(rtiREG1, rtiCOUNTER_BLOCK0);
+    _enable_interrupt_();
+
+    coreInit();
+    coreRxInit(&coreAdd);
+
+    while (simTrafficDone() == 0U)
+    {
+        while (coreWindowDue() == 0U)
+        {
+            (void)coreRxPoll();
+        }
+        coreReport();
+        /* Let the report leave the line before checking it */
+        while ((CORE_UART->FLR & 0x800U) == 0U)
+        {
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    printf("seed %lu: %.2f h simulated, %lu windows, %llu bytes, %lu empty reports, "
+           "digest %08lX, %lu errors\n",
+           (unsigned long)cfg.seed, (double)simTimeNs() / 3.6e12, (unsigned long)s_windows,
+           (unsigned long long)s_bytes, (unsigned long)s_empty, (unsigned long)s_digest,
+           (unsigned long)s_errors);
+    fprintf(stderr, "host time %.2f s\n",
+            (double)(t1.tv_sec - t0.tv_sec) + ((double)(t1.tv_nsec - t0.tv_nsec) * 1e-9));
+
+    return (s_errors == 0U) ? 0 : 1;
+}
+
+/**
+ * @brief  TX sink of SCI3: collects the report lines.
+ */
+static void simWinSink(uint32_t index, uint8_t data)
+{
+    (void)index;
+
+    if ((data == (uint8_t)'\r') || (data == (uint8_t)'\n'))
+    {
+        if (s_lineLen != 0U)
+        {
+            s_line[s_lineLen] = '\0';
+            simWinLine(s_line);
+            s_lineLen = 0U;
+        }
+    }
+    else if (s_lineLen < (SIM_WIN_LINE - 1U))
+    {
+        s_line[s_lineLen] = (char)data;
+        s_lineLen++;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+static void simWinLine(const char *line)
+{
+    unsigned long value;
+    uint32_t bytes, crc;
+
+    if (sscanf(line, "Bytes received: %lu", &value) == 1)
+    {
+        s_reported = (uint32_t)value;
+    }
+    else if (sscanf(line, "Updated CRC in Hex is : 0x%lx", &value) == 1)
+    {
+        if (simTrafficPop(&bytes, &crc) == 0U)
+        {
+            printf("window %lu: reported but never sent\n", (unsigned long)s_windows);
+            s_errors++;
+        }
+        else if ((bytes != s_reported) || (crc != (uint32_t)value))
+        {
+            printf("window %lu: %lu bytes CRC %08lX, sent %lu bytes CRC %08lX\n",
+                   (unsigned long)s_windows, (unsigned long)s_reported, value,
+                   (unsigned long)bytes, (unsigned long)crc);
+            s_errors++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        s_windows++;
+        s_bytes += s_reported;
+        s_digest = ((s_digest << 1U) | (s_digest >> 31U)) ^ (uint32_t)value;
+    }
+    else if (strncmp(line, "No Data Received", 16U) == 0)
+    {
+        s_empty++;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
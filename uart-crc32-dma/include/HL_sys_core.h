@@ -338,6 +338,10 @@ void _iCacheInvalidate_(void);
 
 
 /* USER CODE BEGIN (1) */
+/** @fn void _dCacheClean_(void)
+*   @brief Clean DCache (dcache_clean.asm), call before _cacheDisable_().
+*/
+void _dCacheClean_(void);
 /* USER CODE END */
 
 /**@}*/
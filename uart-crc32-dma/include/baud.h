@@ -0,0 +1,57 @@
+/**
+ ******************************************************************************
+ * @file    baud.h
+ * @brief   Runtime Baud-Rate Negotiation (SCI3)
+ *
+ * @details
+ *   - baudPlan() works out the SCI prescaler for a proposed rate, the rate
+ *     it really gives and the error, so the board can refuse rates the
+ *     VCLK / (16 * (P + 1)) divider cannot hit closely enough.
+ *   - The handshake, started by "ESC baud <rate>" (command.h):
+ *
+ *       host  -> board   ESC baud <rate> CR              (old rate)
+ *       board -> host    BAUD <actual> <error> CR LF     (old rate), or
+ *                        RANGE <actual> <error> CR LF ERR CR LF if refused
+ *       both switch, the board drops what arrives in the first
+ *       BAUD_SETTLE_MS
+ *       host  -> board   BAUD_PATTERN_LEN pattern bytes  (new rate)
+ *       board -> host    the same pattern back
+ *       host  -> board   BAUD_ACK_LEN x BAUD_ACK
+ *       board -> host    OK CR LF                        (new rate)
+ *
+ *   - If the pattern or the acknowledge does not arrive intact within
+ *     BAUD_VERIFY_MS, the board goes back to the old rate, waits
+ *     BAUD_REVERT_MS so the host has reverted too, and answers ERR.
+ *
+ * @note
+ *   - Pattern byte i is (i * 37) ^ 0x55, which covers 0x00, 0xFF and
+ *     alternating bit runs. host/source/crcctl.c uses the same formula.
+ ******************************************************************************
+ */
+#ifndef BAUD_H_
+#define BAUD_H_
+
+#include "HL_sys_common.h"
+
+/* Largest error accepted, in tenths of a percent */
+#define BAUD_MAX_ERROR_PERMILLE 25
+#define BAUD_PATTERN_LEN        64U
+#define BAUD_ACK                0x06U
+#define BAUD_ACK_LEN            4U
+#define BAUD_SETTLE_MS          50U
+#define BAUD_VERIFY_MS          1000U
+#define BAUD_REVERT_MS          1000U
+
+typedef struct
+{
+    uint32_t requested;
+    uint32_t prescaler;     /* BRS value */
+    uint32_t actual;        /* VCLK / (16 * (prescaler + 1)) */
+    int32_t errorPerMille;  /* (actual - requested) / requested */
+    uint32_t usable;        /* Non-zero if in range and within the error limit */
+} baudPlan_t;
+
+void baudPlan(uint32_t vclkHz, uint32_t requested, baudPlan_t *plan);
+uint8_t baudPatternByte(uint32_t index);
+
+#endif /* BAUD_H_ */
@@ -0,0 +1,76 @@
+/**
+ ******************************************************************************
+ * @file    capture.h
+ * @brief   Capture of Received Windows into External SDRAM (EMIF)
+ *
+ * @details
+ *   - While a capture is on (ESC capture on), every data window is also
+ *     copied from the RX ring into the SDRAM on EMIF chip select 0, one
+ *     window after the other, until CAPTURE_SDRAM_SIZE bytes are held.
+ *     The copy is a software-triggered DMA block transfer per ring span,
+ *     started before the span is checksummed, so the ring read and the
+ *     SDRAM write overlap the CRC instead of adding a CPU pass.
+ *   - The CRC32 of the image is kept while streaming without touching the
+ *     data again: the caller cuts its spans at the end of the SDRAM
+ *     (captureSpan()) and passes the window's running CRC32 after each
+ *     span (captureAdvance()); at the window end that CRC is joined to the
+ *     image's with manifestCombine().
+ *   - Afterwards the image can be checked and used at memory speed without
+ *     a host resend: captureVerify() runs the checksum engine over the
+ *     SDRAM (any CHECKSUM_* set, CRC32 always, to compare with the
+ *     streamed value) and times it with the PMU; ESC replay sends the
+ *     image back on the line.
+ *
+ * @note
+ *   - Needs SDRAM on EMIF CS0 (the HDK's 8 MB IS42S16400J); the LaunchPad
+ *     has none, so CAPTURE_ENABLE is off by default. HALCoGen's EMIF
+ *     driver is not generated in this project (no HL_emif.c), so
+ *     captureInit() programs the SDRAM registers itself; the EMIF balls
+ *     are already muxed in HL_pinmux.c.
+ *   - MPU region 6 covers 0x80000000; with the cache disabled (as the DMA
+ *     needs) its attributes do not matter.
+ *   - A DMA copy reads the ring after captureCopy() returns. It completes
+ *     long before the RX DMA can wrap back onto the span.
+ *   - Not locked, use from the main loop only.
+ ******************************************************************************
+ */
+#ifndef CAPTURE_H_
+#define CAPTURE_H_
+
+#include "HL_sys_common.h"
+#include "checksum.h"
+
+/* Set to 1 on a board with SDRAM on EMIF CS0 */
+#ifndef CAPTURE_ENABLE
+#define CAPTURE_ENABLE          0
+#endif
+/* 4 banks x 4096 rows x 256 columns x 16 bit */
+#define CAPTURE_SDRAM_SIZE      0x00800000U
+#define CAPTURE_DMA_CH          DMA_CH3
+/* Shorter spans (held command bytes, ring wrap leftovers) are copied by
+ * the CPU */
+#define CAPTURE_DMA_MIN         32U
+
+typedef struct
+{
+    uint32_t active;        /* Windows are being captured */
+    uint32_t len;           /* Bytes in the image */
+    uint32_t crc;           /* CRC32 of the image, from the stream */
+    uint32_t windows;       /* Windows in the image, the last may be cut */
+    uint32_t dropped;       /* Bytes that did not fit */
+} captureInfo_t;
+
+#if (CAPTURE_ENABLE == 1)
+uint32_t captureInit(void);
+uint32_t captureStart(void);
+void captureStop(void);
+uint32_t captureSpan(uint32_t len);
+void captureCopy(const uint8_t *data, uint32_t len);
+void captureAdvance(uint32_t crc);
+void captureWindowEnd(void);
+void captureGetInfo(captureInfo_t *info);
+const uint8_t *captureImage(void);
+uint32_t captureVerify(uint32_t set, checksumDigest_t *digest);
+#endif
+
+#endif /* CAPTURE_H_ */
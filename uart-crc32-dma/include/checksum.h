@@ -0,0 +1,72 @@
+/**
+ ******************************************************************************
+ * @file    checksum.h
+ * @brief   Single-Pass Multi-Checksum Engine
+ *
+ * @details
+ *   - Computes any set of CRC32, CRC32C (Castagnoli), Adler-32 and
+ *     Fletcher-32 over the same data in one pass. Each 32-byte block is
+ *     loaded once and every selected kernel works on the loaded words.
+ *   - A set of CRC32 alone goes straight to crc32UpdateBurst().
+ *   - The state can be updated with spans of any length and alignment;
+ *     checksumFinal() does not change it.
+ *
+ * @note
+ *   - CRC32 and CRC32C: reflected, init and xorout 0xFFFFFFFF
+ *     ("123456789" gives 0xCBF43926 / 0xE3069283).
+ *   - Adler-32: RFC 1950 ("123456789" gives 0x091E01DE).
+ *   - Fletcher-32: sums modulo 65535 over 16-bit little-endian words, an
+ *     odd last byte is padded with zero ("abcde" gives 0xF04FC729).
+ ******************************************************************************
+ */
+#ifndef CHECKSUM_H_
+#define CHECKSUM_H_
+
+#include "HL_sys_common.h"
+#include "crc32_kernel.h"
+
+/* Digest index of each algorithm */
+#define CHECKSUM_IDX_CRC32      0U
+#define CHECKSUM_IDX_CRC32C     1U
+#define CHECKSUM_IDX_ADLER32    2U
+#define CHECKSUM_IDX_FLETCHER32 3U
+#define CHECKSUM_COUNT          4U
+
+/* Selection masks */
+#define CHECKSUM_CRC32          (1U << CHECKSUM_IDX_CRC32)
+#define CHECKSUM_CRC32C         (1U << CHECKSUM_IDX_CRC32C)
+#define CHECKSUM_ADLER32        (1U << CHECKSUM_IDX_ADLER32)
+#define CHECKSUM_FLETCHER32     (1U << CHECKSUM_IDX_FLETCHER32)
+#define CHECKSUM_ALL            ((1U << CHECKSUM_COUNT) - 1U)
+
+/* Bytes per shared block load */
+#define CHECKSUM_BLOCK_LEN      32U
+
+typedef struct
+{
+    uint32_t set;
+    uint32_t crc32;         /* reflected state, as crc32UpdateWord() */
+    uint32_t crc32c;
+    uint32_t adlerA;
+    uint32_t adlerB;
+    uint32_t fletcher0;
+    uint32_t fletcher1;
+    uint32_t fletcherLow;   /* first byte of an unfinished 16-bit word */
+    uint32_t fletcherOdd;   /* non-zero while fletcherLow is pending */
+} checksumCtx_t;
+
+typedef struct
+{
+    uint32_t set;
+    uint32_t value[CHECKSUM_COUNT];
+} checksumDigest_t;
+
+/* Slice-by-4 CRC32C tables, byte swapped on big-endian builds (crc32c_table.c) */
+extern const uint32_t crc32c_table[4][256];
+
+void checksumInit(checksumCtx_t *ctx, uint32_t set);
+void checksumUpdate(checksumCtx_t *ctx, const uint8_t *data, uint32_t len);
+void checksumFinal(const checksumCtx_t *ctx, checksumDigest_t *digest);
+const char *checksumName(uint32_t index);
+
+#endif /* CHECKSUM_H_ */
@@ -0,0 +1,105 @@
+/**
+ ******************************************************************************
+ * @file    command.h
+ * @brief   In-Band Command Interpreter
+ *
+ * @details
+ *   - A window (the bytes between two idle reports) that starts with
+ *     CMD_ESCAPE (0x1B) and holds a known command terminated by CR or LF
+ *     within CMD_LINE_MAX bytes is taken as a command instead of data:
+ *
+ *         ESC reset                  restart the checksum, forget the last
+ *                                    result and zero the counters
+ *         ESC stats                  print the counters and settings
+ *         ESC idle <ms>              set the idle timeout
+ *         ESC preset <name>[+name]   crc32, crc32c, adler32, fletcher32,
+ *                                    all or a hex CHECKSUM_* mask
+ *         ESC format <name>          text, compact or raw
+ *         ESC bench                  PMU benchmark of the kernels
+ *         ESC selftest               SCI3 loopback self-benchmark
+ *         ESC baud <rate>            negotiate a new line rate (baud.h)
+ *         ESC manifest <len>         report a CRC32 per block of len bytes
+ *                                    with each window, 0 turns it off
+ *                                    (manifest.h)
+ *         ESC tree <len>             same blocks, but report only the root
+ *                                    of their hash tree
+ *         ESC node <level> <index>   print a node of the last window's tree
+ *                                    and the CRCs of its two children
+ *         ESC trace                  dump and clear the event trace
+ *                                    (trace.h, ERR if not built in)
+ *         ESC capture on|off         start a new SDRAM image of the
+ *                                    following windows, or stop adding
+ *                                    to it (capture.h, ERR if not built
+ *                                    in or no SDRAM)
+ *         ESC verify [preset]        checksum the image from SDRAM and
+ *                                    check it against the streamed CRC32,
+ *                                    with the current or the given preset
+ *         ESC replay                 send the image back after a
+ *                                    "REPLAY <len> <crc32>" line
+ *
+ *   - Commands are only recognised at the start of a window, so they always
+ *     act between windows. Only the first byte of a window is inspected, so data costs nothing
+ *     extra unless it starts with ESC. Such a window is held back (at most
+ *     CMD_LINE_MAX bytes) until it is known not to be a command, then
+ *     handed back to the checksum unchanged.
+ ******************************************************************************
+ */
+#ifndef COMMAND_H_
+#define COMMAND_H_
+
+#include "HL_sys_common.h"
+
+#define CMD_ESCAPE              0x1BU
+/* Longest command line, including the escape and the terminator */
+#define CMD_LINE_MAX            32U
+
+/* Report formats (ESC format) */
+#define CMD_FORMAT_TEXT         0U      /* One line per checksum (default) */
+#define CMD_FORMAT_COMPACT      1U      /* Count and all checksums on one line */
+#define CMD_FORMAT_RAW          2U      /* 4 bytes per checksum, big-endian */
+/* Set in the raw byte count of a window the ring overran: the bytes lost
+ * follow instead of the checksums */
+#define CMD_RAW_OVERRUN         0x80000000U
+
+typedef enum
+{
+    CMD_NONE     = 0U,
+    CMD_RESET    = 1U,
+    CMD_STATS    = 2U,
+    CMD_IDLE     = 3U,
+    CMD_PRESET   = 4U,
+    CMD_FORMAT   = 5U,
+    CMD_BENCH    = 6U,
+    CMD_SELFTEST = 7U,
+    CMD_BAUD     = 8U,
+    CMD_MANIFEST = 9U,
+    CMD_TREE     = 10U,
+    CMD_NODE     = 11U,
+    CMD_TRACE    = 12U,
+    CMD_CAPTURE  = 13U,
+    CMD_VERIFY   = 14U,
+    CMD_REPLAY   = 15U
+} cmdId_t;
+
+typedef struct
+{
+    cmdId_t id;
+    uint32_t arg;
+    uint32_t arg2;      /* Second argument (ESC node) */
+} cmd_t;
+
+typedef enum
+{
+    CMD_SCAN_DATA = 0U,     /* Not a command, *used bytes were taken and are in cmdHeld() */
+    CMD_SCAN_MORE = 1U,     /* All bytes taken, line not complete yet */
+    CMD_SCAN_LINE = 2U      /* Line complete, *used bytes taken (terminator included) */
+} cmdScan_t;
+
+cmdScan_t cmdScan(const uint8_t *data, uint32_t len, uint32_t *used);
+uint32_t cmdCollecting(void);
+uint32_t cmdParse(cmd_t *cmd);
+const uint8_t *cmdHeld(uint32_t *len);
+void cmdRelease(void);
+const char *cmdFormatName(uint32_t format);
+
+#endif /* COMMAND_H_ */
@@ -0,0 +1,35 @@
+/**
+ ******************************************************************************
+ * @file    core_cfg.h
+ * @brief   Shared Core Configuration of uart-crc32-dma
+ *
+ * @details
+ *   - SCI3 into the circular DMA ring, consumed in place by the main loop
+ *     (commands, checksum engine, manifest); the window ends after 5 s
+ *     without data, ESC idle changes the timeout.
+ *   - Report output keeps the flow control running between characters and
+ *     is traced (trace.h).
+ ******************************************************************************
+ */
+#ifndef CORE_CFG_H_
+#define CORE_CFG_H_
+
+#include "trace.h"
+
+#define CORE_RX_BACKEND         CORE_RX_DMA_RING
+#define CORE_UART               sciREG3
+#define CORE_TIMEOUT_MS         5000U
+#define CORE_WINDOW_MODE        CORE_WINDOW_IDLE
+/* Receive ring, power of two (DMA frame count is limited to 8191) */
+#define CORE_RX_RING_SIZE       4096U
+#define CORE_RX_DMA_CH          DMA_CH1
+
+/* Reports are slow next to the line, keep throttling meanwhile */
+#define CORE_TX_BEGIN(len)      TRACE(TRACE_TX_BEGIN, (len))
+#define CORE_TX_CHAR()          flow_service()
+#define CORE_TX_END()           TRACE(TRACE_TX_END, 0U)
+
+/* uart_dma_crc_main.c */
+void flow_service(void);
+
+#endif /* CORE_CFG_H_ */
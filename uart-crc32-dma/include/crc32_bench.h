@@ -0,0 +1,46 @@
+/**
+ ******************************************************************************
+ * @file    crc32_bench.h
+ * @brief   PMU Benchmark of the CRC32 Kernels
+ *
+ * @details
+ *   - Runs each kernel over the same 32-byte aligned buffer, 4 KB and
+ *     64 KB long, and reports CPU cycles, cycles per byte and
+ *     architecturally executed data reads and writes, as counted by the
+ *     Cortex-R5 PMU.
+ *   - checksumBenchmark() compares one pass of the multi-checksum engine
+ *     over all four algorithms with four separate single-algorithm passes.
+ ******************************************************************************
+ */
+#ifndef CRC32_BENCH_H_
+#define CRC32_BENCH_H_
+
+#include "HL_sys_common.h"
+#include "HL_sci.h"
+
+#define CRC32_BENCH_LEN         4096U
+#define CRC32_BENCH_LEN_LARGE   65536U
+
+typedef enum
+{
+    CRC32_KERNEL_BITWISE = 0U,
+    CRC32_KERNEL_TABLE   = 1U,
+    CRC32_KERNEL_WORD    = 2U,
+    CRC32_KERNEL_BURST   = 3U,
+    CRC32_KERNEL_COUNT   = 4U
+} crc32Kernel_t;
+
+typedef struct
+{
+    uint32_t cycles;
+    uint32_t dataReads;
+    uint32_t dataWrites;
+    uint32_t crc;
+} crc32BenchResult_t;
+
+void crc32BenchRun(crc32Kernel_t kernel, uint32_t len, crc32BenchResult_t *result);
+void crc32Benchmark(sciBASE_t *sci);
+void checksumBenchRun(uint32_t set, uint32_t len, crc32BenchResult_t *result);
+void checksumBenchmark(sciBASE_t *sci);
+
+#endif /* CRC32_BENCH_H_ */
@@ -0,0 +1,59 @@
+/**
+ ******************************************************************************
+ * @file    flow_control.h
+ * @brief   Back-Pressure Flow Control from RX Ring Occupancy
+ *
+ * @details
+ *   - flowService() is given the number of unread bytes in the RX ring.
+ *     At FLOW_HIGH_WATER or more it stops the host (XOFF and/or RTS
+ *     deasserted), at FLOW_LOW_WATER or less it lets it go again (XON
+ *     and/or RTS asserted). The gap between the two is the hysteresis.
+ *   - The time spent stopped, the number of stops and the highest
+ *     occupancy seen are kept for the stats command.
+ *   - RTS is an ordinary GIO output (the SCI has no RTS pin), active low
+ *     like an RS-232 RTS, to be wired to the adapter's CTS input.
+ *
+ * @note
+ *   - Called from the main loop only, between consumer passes and between
+ *     characters of the report text, so XON/XOFF never collide with other
+ *     output on TD.
+ *   - XON/XOFF values can appear in the raw report format; use RTS with it.
+ *     Around a long binary transfer (the SDRAM replay) flowBinary() holds
+ *     XON/XOFF back and sends the pending state once it is over; RTS
+ *     keeps following the ring.
+ *   - The high watermark has to leave room for what the host still sends
+ *     after the stop: up to one consumer pass plus the adapter latency
+ *     (an FTDI latency timer of 16 ms is 7 KB at 4687500 baud).
+ ******************************************************************************
+ */
+#ifndef FLOW_CONTROL_H_
+#define FLOW_CONTROL_H_
+
+#include "HL_sys_common.h"
+#include "HL_sci.h"
+
+/* Software flow control: XOFF at the high, XON at the low watermark */
+#define FLOW_USE_XONXOFF        1
+/* Hardware flow control on a GIO pin */
+#define FLOW_USE_RTS            0
+#define FLOW_RTS_PORT           gioPORTB
+#define FLOW_RTS_PIN            2U
+
+#define FLOW_XON                0x11U
+#define FLOW_XOFF               0x13U
+
+typedef struct
+{
+    uint32_t stops;         /* Times the host was stopped */
+    uint32_t stallMs;       /* Total time stopped, including a stop in progress */
+    uint32_t peak;          /* Highest occupancy seen */
+} flowStats_t;
+
+void flowInit(sciBASE_t *sci, uint32_t highWater, uint32_t lowWater);
+void flowService(uint32_t occupancy, uint32_t nowMs);
+void flowBinary(uint32_t active);
+uint32_t flowStopped(void);
+void flowGetStats(uint32_t nowMs, flowStats_t *stats);
+void flowResetStats(void);
+
+#endif /* FLOW_CONTROL_H_ */
@@ -0,0 +1,53 @@
+/**
+ ******************************************************************************
+ * @file    manifest.h
+ * @brief   Block CRC32 Manifest of a Window
+ *
+ * @details
+ *   - Splits the window into blocks of a fixed power-of-two length and
+ *     keeps the CRC32 of each block on its own, so the host can tell which
+ *     blocks of a large transfer differ and resend only those.
+ *   - The block CRCs come from the running CRC32 of the window: the caller
+ *     cuts its spans at block boundaries (manifestSpan()) and passes the
+ *     running value at each boundary (manifestAdvance()). With
+ *     crc(A|B) = crc(A) * x^(8|B|) + crc(B) over GF(2), the CRC of a block
+ *     is the running value at its end plus the value at its start shifted
+ *     by the block length. One 32-step carry-less multiply per block, no
+ *     second pass over the data.
+ *   - At most MANIFEST_MAX_BLOCKS are kept. When the table is full,
+ *     neighbouring blocks are merged with the same identity and the block
+ *     length doubles, so memory stays fixed for any window size. The
+ *     reported block length is the one in use at the end of the window.
+ *   - The last block may be shorter than the block length.
+ *   - The blocks are also the leaves of a binary hash tree (Merkle tree)
+ *     whose nodes are the CRC32 of the bytes they span, so a parent is the
+ *     GF(2) combination of its children and the root is the CRC32 of the
+ *     window. Reporting only the root and answering node queries
+ *     (manifestNode()) lets the host find a bad block in manifestLevels()
+ *     round trips of one short line each, instead of reading every block
+ *     CRC over the link. Only the leaves are kept, so the memory is the
+ *     same fixed table whatever the window size; a leaf of a very large
+ *     window is correspondingly long.
+ *   - manifestCombine() applies the same identity to any two CRCs, for
+ *     joining windows (the SDRAM capture, capture.h).
+ ******************************************************************************
+ */
+#ifndef MANIFEST_H_
+#define MANIFEST_H_
+
+#include "HL_sys_common.h"
+
+#define MANIFEST_MAX_BLOCKS     1024U
+#define MANIFEST_MIN_LEN        256U
+#define MANIFEST_MAX_LEN        0x01000000U
+
+uint32_t manifestStart(uint32_t blockLen);
+uint32_t manifestSpan(uint32_t len);
+void manifestAdvance(uint32_t len, uint32_t crc);
+uint32_t manifestFinish(uint32_t crc, uint32_t *blockLen);
+uint32_t manifestBlock(uint32_t index);
+uint32_t manifestCombine(uint32_t crcA, uint32_t crcB, uint32_t lenB);
+uint32_t manifestLevels(void);
+uint32_t manifestNode(uint32_t level, uint32_t index, uint32_t *offset, uint32_t *len, uint32_t *crc);
+
+#endif /* MANIFEST_H_ */
@@ -0,0 +1,50 @@
+/**
+ ******************************************************************************
+ * @file    psa_offload.h
+ * @brief   Hardware Signature of Received Blocks (MCRC PSA, fed by DMA)
+ *
+ * @details
+ *   - Channel 1 of the CRC controller (crcREG1) runs in full-CPU mode: every
+ *     64-bit write to PSA_SIGREGL1 is compressed into the PSA signature.
+ *     Instead of the CPU, a software-triggered DMA block transfer performs
+ *     those writes, so a block is signed without any CPU load.
+ *   - The signature is not reset between blocks, so after the last block it
+ *     covers the whole transfer; the value after each block is kept as that
+ *     block's signature (psaOffloadBlockSignature()).
+ *   - The PSA works on 64-bit words. A transfer that does not end on a
+ *     word boundary is padded with zero bytes (psaOffloadFeedTail()).
+ *   - Data that is not 8-byte aligned or wraps around a ring is staged
+ *     through an aligned buffer first (psaOffloadFeedRing()), at the cost
+ *     of one CPU copy.
+ *   - psaSoftwareSign() computes the same signature in software, for
+ *     checking the hardware result.
+ *
+ * @note
+ *   - Polynomial x^64 + x^4 + x^3 + x + 1, shifted MSB first; each 64-bit
+ *     data word is taken in big-endian byte order, as the BE32 device
+ *     writes it to the register.
+ ******************************************************************************
+ */
+#ifndef PSA_OFFLOAD_H_
+#define PSA_OFFLOAD_H_
+
+#include "HL_sys_common.h"
+
+/* Bytes per signed block, a multiple of 8 that divides the RX ring */
+#define PSA_BLOCK_LEN           512U
+/* Largest tail psaOffloadFeedTail() / psaOffloadFeedRing() accept */
+#define PSA_TAIL_MAX            PSA_BLOCK_LEN
+#define PSA_DMA_CH              DMA_CH2
+
+void psaOffloadInit(void);
+void psaOffloadReset(void);
+uint32_t psaOffloadBusy(void);
+void psaOffloadFeed(const uint8_t *block, uint32_t len);
+void psaOffloadFeedTail(const uint8_t *data, uint32_t len);
+void psaOffloadFeedRing(const uint8_t *ring, uint32_t mask, uint32_t start, uint32_t len);
+uint64 psaOffloadSignature(void);
+uint64 psaOffloadBlockSignature(void);
+uint32_t psaOffloadBlocks(void);
+uint64 psaSoftwareSign(uint64 sig, const uint8_t *data, uint32_t len);
+
+#endif /* PSA_OFFLOAD_H_ */
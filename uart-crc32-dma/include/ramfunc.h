@@ -0,0 +1,28 @@
+/**
+ ******************************************************************************
+ * @file    ramfunc.h
+ * @brief   Code and Tables Executed from RAM
+ *
+ * @details
+ *   - Functions tagged with #pragma CODE_SECTION(fn, ".ramCode") and data
+ *     tagged with #pragma DATA_SECTION(obj, ".ramConst") are collected in
+ *     the .ramfunc output section (HL_sys_link.cmd, USER CODE (6)).
+ *   - With RAMFUNC_IN_RAM set to 1 in the linker command file the section
+ *     is loaded in flash and runs from RAM; ramfuncCopy(), called from
+ *     _c_int00() before main(), copies it. With 0 it runs in place from
+ *     flash and ramfuncCopy() does nothing, which gives the flash baseline
+ *     for crc32Benchmark().
+ *   - Tagged: the CRC32 kernels and their tables (crc32_kernel.c,
+ *     crc32_kernel_r5.asm, crc32_table.c), the checksum engines
+ *     (checksum.c) and the shared consumer coreAdd() (core.c).
+ ******************************************************************************
+ */
+#ifndef RAMFUNC_H_
+#define RAMFUNC_H_
+
+#include "HL_sys_common.h"
+
+void ramfuncCopy(void);
+uint32_t ramfuncInRam(void);
+
+#endif /* RAMFUNC_H_ */
@@ -0,0 +1,75 @@
+/**
+ ******************************************************************************
+ * @file    trace.h
+ * @brief   Timestamped Event Trace in RAM
+ *
+ * @details
+ *   - TRACE(event, arg) appends an 8-byte record to a ring of TRACE_DEPTH
+ *     records: the RTI free-running counter 0 (RTI_FREQ / 8, 9.375 MHz,
+ *     107 ns per count) and the event with a 24-bit argument. When the
+ *     ring is full the oldest records are overwritten.
+ *   - Recording is lock-free: a slot is claimed with LDREX/STREX on the
+ *     head index (trace_reserve.asm), so interrupt handlers and the main
+ *     loop can record without masking interrupts. An interrupt between
+ *     the claim and the write of a main-loop record leaves the records
+ *     out of time order, the host sorts them.
+ *   - traceDump() sends the ring over SCI: a text line
+ *     "TRACE <count> <counts per second>", then <count> records of two
+ *     big-endian words each, oldest first. Recording is paused meanwhile,
+ *     so the dump does not trace itself. host/build/crcctl trace turns
+ *     it into Chrome trace JSON (chrome://tracing, Perfetto).
+ *
+ * @note
+ *   - With TRACE_ENABLE at 0, TRACE() expands to nothing and trace.c is
+ *     empty, so the instrumented code is unchanged.
+ *   - The counter starts with rtiStartCounter(rtiCOUNTER_BLOCK0); events
+ *     before that are stamped 0. It wraps every 458 s, the host unwraps.
+ ******************************************************************************
+ */
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include "HL_sys_common.h"
+
+/* Set to 1 to record events */
+#define TRACE_ENABLE            0
+/* Records in the ring, a power of two (8 bytes each) */
+#define TRACE_DEPTH             2048U
+/* Counts per second of the time stamp: RTI_FREQ / (CPUC0 + 1) */
+#define TRACE_TICK_HZ           9375000U
+
+/* Events, the argument is in brackets */
+#define TRACE_ISR_ENTER         1U      /* Handler entered (TRACE_SRC_*) */
+#define TRACE_ISR_EXIT          2U      /* Handler left (TRACE_SRC_*) */
+#define TRACE_DMA_BTC           3U      /* Ring wrapped, block transfer complete (channel) */
+#define TRACE_RING_PEAK         4U      /* New highest ring backlog in the window (bytes) */
+#define TRACE_SCI_ERROR         5U      /* SCI3 receive error (FLR bits >> 24: PE 1, OE 2, FE 4) */
+#define TRACE_CRC_BEGIN         6U      /* Checksum of a ring span started (bytes) */
+#define TRACE_CRC_END           7U      /* Checksum of the span done */
+#define TRACE_WINDOW_END        8U      /* Idle timeout, window finalized (bytes) */
+#define TRACE_TX_BEGIN          9U      /* Polled transmit started (bytes) */
+#define TRACE_TX_END            10U     /* Polled transmit done */
+#define TRACE_FLOW              11U     /* Host stopped (1) or released (0) */
+#define TRACE_COMMAND           12U     /* Command executed (cmdId_t) */
+
+/* Interrupt sources of TRACE_ISR_ENTER / TRACE_ISR_EXIT */
+#define TRACE_SRC_RTI           0U
+#define TRACE_SRC_DMA           1U
+
+#if (TRACE_ENABLE == 1)
+
+#include "HL_sci.h"
+
+#define TRACE(event, arg)       traceRecord((uint32_t)(event), (uint32_t)(arg))
+
+void traceRecord(uint32_t event, uint32_t arg);
+void traceClear(void);
+void traceDump(sciBASE_t *sci);
+
+#else
+
+#define TRACE(event, arg)
+
+#endif
+
+#endif /* TRACE_H_ */
@@ -55,6 +55,7 @@
 #include "HL_sys_vim.h"
 
 /* USER CODE BEGIN (1) */
+#include "trace.h"
 /* USER CODE END */
 
 /* SourceId : RTI_SourceId_001 */
@@ -786,12 +787,14 @@ void rtiGetConfigValue(rti_config_reg_t *config_reg, config_value_type_t type)
 void rtiCompare0Interrupt(void)
 {
 /* USER CODE BEGIN (43) */
+    TRACE(TRACE_ISR_ENTER, TRACE_SRC_RTI);
 /* USER CODE END */
 
     rtiREG1->INTFLAG = 1U;
     rtiNotification(rtiREG1,rtiNOTIFICATION_COMPARE0);
 
 /* USER CODE BEGIN (44) */
+    TRACE(TRACE_ISR_EXIT, TRACE_SRC_RTI);
 /* USER CODE END */
 }
 
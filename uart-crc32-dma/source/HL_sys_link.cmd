@@ -68,6 +68,10 @@ MEMORY
 }
 
 /* USER CODE BEGIN (4) */
+/* 1: CRC kernels and CRC tables (.ramCode/.ramConst) are
+ *    loaded in flash and run from RAM, copied by ramfuncCopy().
+ * 0: they run in place from flash. */
+#define RAMFUNC_IN_RAM 1
 /* USER CODE END */
 
 
@@ -90,6 +94,19 @@ SECTIONS
 	
 
 /* USER CODE BEGIN (6) */
+    /* SCI3 RX DMA ring, kept apart so it can be mapped non-cacheable */
+    .rxRing  align(32) : {} > RAM
+#if (RAMFUNC_IN_RAM == 1)
+    .ramfunc align(32) : { *(.ramCode) *(.ramConst) }
+                         load = FLASH0 | FLASH1, run = RAM,
+                         LOAD_START(ramfuncLoadStart), RUN_START(ramfuncRunStart),
+                         SIZE(ramfuncSize)
+#else
+    .ramfunc align(32) : { *(.ramCode) *(.ramConst) }
+                         load = FLASH0 | FLASH1,
+                         LOAD_START(ramfuncLoadStart), RUN_START(ramfuncRunStart),
+                         SIZE(ramfuncSize)
+#endif
 /* USER CODE END */
 }
 
@@ -49,6 +49,7 @@
 
 
 /* USER CODE BEGIN (0) */
+#include "ramfunc.h"
 /* USER CODE END */
 
 
@@ -250,6 +251,8 @@ void _c_int00(void)
         /* initialize global variable and constructors */
     __TI_auto_init();
 /* USER CODE BEGIN (26) */
+    /* copy the RAM-resident CRC kernels, tables and RX ISR */
+    ramfuncCopy();
 /* USER CODE END */
     
         /* call the application */
@@ -0,0 +1,62 @@
+/**
+ ******************************************************************************
+ * @file    baud.c
+ * @brief   Runtime Baud-Rate Negotiation (SCI3)
+ *
+ * @details
+ *   - Divider arithmetic and the verification pattern. The handshake
+ *     itself runs in uart_dma_crc_main.c, which owns the RX ring.
+ *   - Asynchronous mode with 16x oversampling and the integer prescaler
+ *     only, the same computation as sciSetBaudrate() in HL_sci.c.
+ ******************************************************************************
+ */
+#include "baud.h"
+
+/* BRS prescaler field */
+#define BAUD_PRESCALER_MAX      0x00FFFFFFU
+
+/**
+ * @brief  Computes the prescaler for a rate and the rate it really gives.
+ * @param  vclkHz     SCI clock (VCLK1).
+ * @param  requested  Proposed rate in baud.
+ * @param  plan       Result; usable is zero if the rate is out of range
+ *                    or off by more than BAUD_MAX_ERROR_PERMILLE.
+ */
+void baudPlan(uint32_t vclkHz, uint32_t requested, baudPlan_t *plan)
+{
+    uint32_t divisor;
+    int64_t diff;
+
+    plan->requested = requested;
+    plan->prescaler = 0U;
+    plan->actual = 0U;
+    plan->errorPerMille = 0;
+    plan->usable = 0U;
+
+    if ((requested == 0U) || (requested > (vclkHz / 16U)))
+    {
+        return;
+    }
+
+    /* Rounded vclk / (16 * rate) */
+    divisor = (vclkHz + (8U * requested)) / (16U * requested);
+    if ((divisor == 0U) || ((divisor - 1U) > BAUD_PRESCALER_MAX))
+    {
+        return;
+    }
+
+    plan->prescaler = divisor - 1U;
+    plan->actual = vclkHz / (16U * divisor);
+    diff = (int64_t)plan->actual - (int64_t)requested;
+    plan->errorPerMille = (int32_t)((diff * 1000) / (int64_t)requested);
+    plan->usable = ((plan->errorPerMille <= BAUD_MAX_ERROR_PERMILLE)
+                 && (plan->errorPerMille >= -BAUD_MAX_ERROR_PERMILLE)) ? 1U : 0U;
+}
+
+/**
+ * @brief  Byte of the verification pattern.
+ */
+uint8_t baudPatternByte(uint32_t index)
+{
+    return (uint8_t)((index * 37U) ^ 0x55U);
+}
@@ -0,0 +1,350 @@
+/**
+ ******************************************************************************
+ * @file    capture.c
+ * @brief   Capture of Received Windows into External SDRAM (EMIF)
+ *
+ * @details
+ *   - captureInit() follows the SDRAM initialisation of the TRM (and of
+ *     HALCoGen's emif_SDRAMInit()): timings and a 200 us refresh count
+ *     first, SDCR starts the power-up sequence, a read waits for it, then
+ *     the real refresh interval. A pattern at both ends of the SDRAM tells
+ *     whether a device answered.
+ *   - A span is copied with 32-bit elements when ring and image address
+ *     are equally aligned (bytes up to the first word boundary and after
+ *     the last by the CPU), with 8-bit elements otherwise. The copy of the
+ *     previous span is waited for first, the last one runs on while the
+ *     caller computes the CRC.
+ *
+ * @note
+ *   - Both the RAM and the EMIF are slaves of the CPU interconnect, so
+ *     both sides of the transfer use DMA port A.
+ ******************************************************************************
+ */
+#include "capture.h"
+
+#if (CAPTURE_ENABLE == 1)
+
+#include "HL_emif.h"
+#include "HL_reg_emif.h"
+#include "HL_sys_dma.h"
+#include "HL_sys_pmu.h"
+#include "manifest.h"
+
+/* EMIF CS0 SDRAM, PTR of HL_emif.h */
+#define CAPTURE_SDRAM           ((uint8_t *)PTR)
+
+/* SDCR fields */
+#define CAPTURE_SDCR_NM         0x00004000U     /* 16-bit data bus */
+#define CAPTURE_SDCR_CL_SHIFT   9U
+#define CAPTURE_SDCR_LOCK       0x00000100U     /* BIT11_9LOCK, CL writable */
+#define CAPTURE_SDCR_IBANK_SHIFT 4U
+
+/* Timings of the HDK's IS42S16400J-7 in EMIF clocks (VCLK3, 75 MHz) minus
+ * one: tRFC 63 ns, tRP 20 ns, tRCD 20 ns, tWR 2 clocks, tRAS 42 ns,
+ * tRC 63 ns, tRRD 14 ns */
+#define CAPTURE_SDTIMR          ((4U << 27U) | (1U << 24U) | (1U << 20U) | (1U << 16U) \
+                               | (3U << 12U) | (4U << 8U) | (1U << 4U))
+/* tXSR 70 ns */
+#define CAPTURE_SDSRETR         5U
+/* 200 us of power-up refresh, eight refreshes per count */
+#define CAPTURE_SDRCR_INIT      1875U
+/* 64 ms over 4096 rows: 15.6 us */
+#define CAPTURE_SDRCR           1170U
+/* CAS latency 2, 4 banks, 256-word pages */
+#define CAPTURE_SDCR            (CAPTURE_SDCR_NM | (2U << CAPTURE_SDCR_CL_SHIFT) | CAPTURE_SDCR_LOCK \
+                               | (2U << CAPTURE_SDCR_IBANK_SHIFT) | 0U)
+
+/* Largest element count of one transfer */
+#define CAPTURE_DMA_MAX_ELEMENTS 8191U
+#define CAPTURE_PROBE           0x5AA5C33CU
+
+static uint32_t s_present = 0U;
+static volatile uint32_t s_busy = 0U;
+static captureInfo_t s_info;
+/* Bytes of the current window in the image and their CRC32 */
+static uint32_t s_windowLen = 0U;
+static uint32_t s_windowCrc = 0U;
+/* Set by captureCopy(), the next captureAdvance() takes its CRC */
+static uint32_t s_taken = 0U;
+
+static void captureWait(void);
+static void captureDma(const uint8_t *src, uint8_t *dst, uint32_t count, uint32 size);
+
+/**
+ * @brief  Initialises the SDRAM and checks that it answers.
+ * @return Non-zero if the SDRAM holds the probe pattern at both ends.
+ */
+uint32_t captureInit(void)
+{
+    volatile uint32_t *first = (volatile uint32_t *)CAPTURE_SDRAM;
+    volatile uint32_t *last = (volatile uint32_t *)&CAPTURE_SDRAM[CAPTURE_SDRAM_SIZE - 4U];
+    uint32_t dummy;
+
+    emifREG->SDTIMR = CAPTURE_SDTIMR;
+    emifREG->SDSRETR = CAPTURE_SDSRETR;
+    emifREG->SDRCR = CAPTURE_SDRCR_INIT;
+    emifREG->SDCR = CAPTURE_SDCR;
+    /* Stalls until the power-up sequence is done */
+    dummy = *first;
+    (void)dummy;
+    emifREG->SDRCR = CAPTURE_SDRCR;
+
+    *first = CAPTURE_PROBE;
+    *last = ~CAPTURE_PROBE;
+    s_present = ((*first == CAPTURE_PROBE) && (*last == ~CAPTURE_PROBE)) ? 1U : 0U;
+
+    dmaEnable();
+    s_info.active = 0U;
+    s_info.len = 0U;
+    s_info.crc = 0U;
+    s_info.windows = 0U;
+    s_info.dropped = 0U;
+    return s_present;
+}
+
+/**
+ * @brief  Empties the image and captures the windows from now on.
+ *         Called between windows.
+ * @return 0 if there is no SDRAM.
+ */
+uint32_t captureStart(void)
+{
+    if (s_present == 0U)
+    {
+        return 0U;
+    }
+    captureWait();
+    s_info.active = 1U;
+    s_info.len = 0U;
+    s_info.crc = 0U;
+    s_info.windows = 0U;
+    s_info.dropped = 0U;
+    s_windowLen = 0U;
+    s_taken = 0U;
+    return 1U;
+}
+
+/**
+ * @brief  Stops capturing, the image stays. Called between windows.
+ */
+void captureStop(void)
+{
+    captureWait();
+    s_info.active = 0U;
+}
+
+/**
+ * @brief  Cuts a span at the end of the SDRAM.
+ * @param  len  Bytes the caller is about to add.
+ * @return Bytes to add in this step, all of them unless the SDRAM fills
+ *         in between.
+ */
+uint32_t captureSpan(uint32_t len)
+{
+    uint32_t room = CAPTURE_SDRAM_SIZE - s_info.len;
+
+    if ((s_info.active == 0U) || (room == 0U) || (len <= room))
+    {
+        return len;
+    }
+    return room;
+}
+
+/**
+ * @brief  Appends a span to the image, by DMA unless it is short. Returns
+ *         with the last transfer still running.
+ * @param  data  Span, no longer than captureSpan() allowed.
+ * @param  len   Span length.
+ */
+void captureCopy(const uint8_t *data, uint32_t len)
+{
+    uint8_t *dst = &CAPTURE_SDRAM[s_info.len];
+    uint32_t head;
+    uint32_t n;
+    uint32_t i;
+
+    if (s_info.active == 0U)
+    {
+        return;
+    }
+    if (s_info.len == CAPTURE_SDRAM_SIZE)
+    {
+        s_info.dropped += len;
+        return;
+    }
+    s_info.len += len;
+    s_windowLen += len;
+    s_taken = 1U;
+
+    if (len < CAPTURE_DMA_MIN)
+    {
+        for (i = 0U; i < len; i++)
+        {
+            dst[i] = data[i];
+        }
+        return;
+    }
+
+    if ((((uint32_t)data ^ (uint32_t)dst) & 3U) == 0U)
+    {
+        head = (4U - ((uint32_t)dst & 3U)) & 3U;
+        for (i = 0U; i < head; i++)
+        {
+            dst[i] = data[i];
+        }
+        data += head;
+        dst += head;
+        len -= head;
+        /* Tail first, the body is left running */
+        for (i = len & ~3U; i < len; i++)
+        {
+            dst[i] = data[i];
+        }
+        len &= ~3U;
+        while (len > 0U)
+        {
+            n = ((len / 4U) < CAPTURE_DMA_MAX_ELEMENTS) ? (len / 4U) : CAPTURE_DMA_MAX_ELEMENTS;
+            captureDma(data, dst, n, ACCESS_32_BIT);
+            data += n * 4U;
+            dst += n * 4U;
+            len -= n * 4U;
+        }
+    }
+    else
+    {
+        while (len > 0U)
+        {
+            n = (len < CAPTURE_DMA_MAX_ELEMENTS) ? len : CAPTURE_DMA_MAX_ELEMENTS;
+            captureDma(data, dst, n, ACCESS_8_BIT);
+            data += n;
+            dst += n;
+            len -= n;
+        }
+    }
+}
+
+/**
+ * @brief  Takes the window's running CRC32 after a span, if the span went
+ *         into the image.
+ * @param  crc  Finalized CRC32 of the window so far.
+ */
+void captureAdvance(uint32_t crc)
+{
+    if (s_taken != 0U)
+    {
+        s_windowCrc = crc;
+        s_taken = 0U;
+    }
+}
+
+/**
+ * @brief  Joins the window's part of the image to the image CRC32.
+ */
+void captureWindowEnd(void)
+{
+    if (s_windowLen != 0U)
+    {
+        s_info.crc = manifestCombine(s_info.crc, s_windowCrc, s_windowLen);
+        s_info.windows++;
+        s_windowLen = 0U;
+    }
+}
+
+/**
+ * @brief  Copies out the state of the capture, the open window included.
+ */
+void captureGetInfo(captureInfo_t *info)
+{
+    *info = s_info;
+    if (s_windowLen != 0U)
+    {
+        info->crc = manifestCombine(s_info.crc, s_windowCrc, s_windowLen);
+        info->windows++;
+    }
+}
+
+/**
+ * @brief  Start of the image, once the last copy has landed.
+ */
+const uint8_t *captureImage(void)
+{
+    captureWait();
+    return CAPTURE_SDRAM;
+}
+
+/**
+ * @brief  Runs the checksum engine over the image, from the SDRAM.
+ * @param  set     CHECKSUM_* mask, CRC32 is added.
+ * @param  digest  Checksums of the image.
+ * @return CPU cycles taken.
+ */
+uint32_t captureVerify(uint32_t set, checksumDigest_t *digest)
+{
+    checksumCtx_t ctx;
+    const uint8_t *image = captureImage();
+    uint32_t cycles;
+
+    _pmuInit_();
+    _pmuEnableCountersGlobal_();
+    _pmuResetCycleCounter_();
+    _pmuStartCounters_(pmuCYCLE_COUNTER);
+
+    checksumInit(&ctx, set | CHECKSUM_CRC32);
+    checksumUpdate(&ctx, image, s_info.len);
+    checksumFinal(&ctx, digest);
+
+    _pmuStopCounters_(pmuCYCLE_COUNTER);
+    cycles = _pmuGetCycleCount_();
+    return cycles;
+}
+
+/**
+ * @brief  Waits for the copy in flight.
+ */
+static void captureWait(void)
+{
+    while ((s_busy != 0U) && (dmaGetInterruptStatus(CAPTURE_DMA_CH, BTC) != TRUE))
+    {
+        /* Wait */
+    }
+    if (s_busy != 0U)
+    {
+        dmaREG->BTCFLAG = (uint32)1U << CAPTURE_DMA_CH;
+        s_busy = 0U;
+    }
+}
+
+/**
+ * @brief  Starts one block transfer of count elements, after the previous
+ *         one.
+ */
+static void captureDma(const uint8_t *src, uint8_t *dst, uint32_t count, uint32 size)
+{
+    g_dmaCTRL pkt;
+
+    captureWait();
+
+    pkt.SADD      = (uint32_t)src;
+    pkt.DADD      = (uint32_t)dst;
+    pkt.CHCTRL    = 0U;
+    pkt.FRCNT     = 1U;
+    pkt.ELCNT     = count;
+    pkt.ELDOFFSET = 0U;
+    pkt.ELSOFFSET = 0U;
+    pkt.FRDOFFSET = 0U;
+    pkt.FRSOFFSET = 0U;
+    pkt.PORTASGN  = PORTA_READ_PORTA_WRITE;
+    pkt.RDSIZE    = size;
+    pkt.WRSIZE    = size;
+    pkt.TTYPE     = BLOCK_TRANSFER;
+    pkt.ADDMODERD = ADDR_INC1;
+    pkt.ADDMODEWR = ADDR_INC1;
+    pkt.AUTOINIT  = AUTOINIT_OFF;
+
+    dmaREG->BTCFLAG = (uint32)1U << CAPTURE_DMA_CH;
+    dmaSetCtrlPacket(CAPTURE_DMA_CH, pkt);
+    s_busy = 1U;
+    dmaSetChEnable(CAPTURE_DMA_CH, DMA_SW);
+}
+
+#endif
@@ -0,0 +1,336 @@
+/**
+ ******************************************************************************
+ * @file    checksum.c
+ * @brief   Single-Pass Multi-Checksum Engine
+ *
+ * @details
+ *   - checksumUpdate() splits a span into a byte head up to the first
+ *     32-byte boundary, whole blocks and a byte tail. Each block is read
+ *     into eight registers once and every selected kernel runs on them, so
+ *     adding an algorithm adds its arithmetic but no buffer traffic.
+ *   - Adler-32 and Fletcher-32 defer their modulo: the sums are reduced
+ *     every CHECKSUM_REDUCE_BLOCKS blocks (512 bytes, well inside Adler's
+ *     5552-byte and Fletcher's 359-word overflow bounds) and at the end of
+ *     every call.
+ *
+ * @note
+ *   - The CRC steps are the ones of crc32_kernel.c, parameterised by table
+ *     so the same code serves CRC32 and CRC32C.
+ ******************************************************************************
+ */
+#include "checksum.h"
+
+#define CHECKSUM_ADLER_MOD      65521U
+#define CHECKSUM_FLETCHER_MOD   65535U
+/* Blocks between reductions of the Adler and Fletcher sums */
+#define CHECKSUM_REDUCE_BLOCKS  16U
+
+#if (CRC32_LITTLE_ENDIAN == 1)
+#define CHECKSUM_CRC_BYTE(t, c, b)  ((t)[0][((c) ^ (uint32_t)(b)) & 0xFFU] ^ ((c) >> 8U))
+#define CHECKSUM_CRC_WORD(t, c)     ((t)[3][(c) & 0xFFU] ^ (t)[2][((c) >> 8U) & 0xFFU] \
+                                   ^ (t)[1][((c) >> 16U) & 0xFFU] ^ (t)[0][(c) >> 24U])
+#define CHECKSUM_TO_NATIVE(c)       (c)
+/* Byte n (memory order) of a loaded word */
+#define CHECKSUM_BYTE(w, n)         (((w) >> (8U * (n))) & 0xFFU)
+#else
+#define CHECKSUM_CRC_BYTE(t, c, b)  ((t)[0][((c) >> 24U) ^ (uint32_t)(b)] ^ ((c) << 8U))
+#define CHECKSUM_CRC_WORD(t, c)     ((t)[0][(c) & 0xFFU] ^ (t)[1][((c) >> 8U) & 0xFFU] \
+                                   ^ (t)[2][((c) >> 16U) & 0xFFU] ^ (t)[3][(c) >> 24U])
+#define CHECKSUM_TO_NATIVE(c)       ((((c) >> 24U) & 0x000000FFU) | (((c) >> 8U) & 0x0000FF00U) \
+                                   | (((c) << 8U) & 0x00FF0000U) | (((c) << 24U) & 0xFF000000U))
+#define CHECKSUM_BYTE(w, n)         (((w) >> (24U - (8U * (n)))) & 0xFFU)
+#endif
+
+static void checksumUpdateBytes(checksumCtx_t *ctx, const uint8_t *data, uint32_t len);
+static void checksumUpdateBlocks(checksumCtx_t *ctx, const uint32_t *block, uint32_t count);
+
+/* Runs from RAM with the CRC kernels (ramfunc.h) */
+#pragma CODE_SECTION(checksumUpdate, ".ramCode")
+#pragma CODE_SECTION(checksumUpdateBytes, ".ramCode")
+#pragma CODE_SECTION(checksumUpdateBlocks, ".ramCode")
+
+static const char * const s_names[CHECKSUM_COUNT] =
+{
+    "CRC32", "CRC32C", "Adler-32", "Fletcher-32"
+};
+
+/**
+ * @brief  Starts a new message.
+ * @param  ctx  State to initialise.
+ * @param  set  CHECKSUM_* mask of the algorithms to compute.
+ */
+void checksumInit(checksumCtx_t *ctx, uint32_t set)
+{
+    ctx->set = set & CHECKSUM_ALL;
+    ctx->crc32 = CRC32_INIT;
+    ctx->crc32c = CRC32_INIT;
+    ctx->adlerA = 1U;
+    ctx->adlerB = 0U;
+    ctx->fletcher0 = 0U;
+    ctx->fletcher1 = 0U;
+    ctx->fletcherLow = 0U;
+    ctx->fletcherOdd = 0U;
+}
+
+/**
+ * @brief  Adds a span to every selected checksum.
+ * @param  ctx   Running state.
+ * @param  data  Bytes to add, any alignment.
+ * @param  len   Number of bytes.
+ */
+void checksumUpdate(checksumCtx_t *ctx, const uint8_t *data, uint32_t len)
+{
+    uint32_t head;
+    uint32_t blocks;
+
+    if (ctx->set == CHECKSUM_CRC32)
+    {
+        ctx->crc32 = crc32UpdateBurst(ctx->crc32, data, len);
+        return;
+    }
+
+    head = (CHECKSUM_BLOCK_LEN - ((uint32_t)(uintptr_t)data & (CHECKSUM_BLOCK_LEN - 1U)))
+         & (CHECKSUM_BLOCK_LEN - 1U);
+    if (head > len)
+    {
+        head = len;
+    }
+    checksumUpdateBytes(ctx, data, head);
+    data += head;
+    len -= head;
+
+    blocks = len / CHECKSUM_BLOCK_LEN;
+    checksumUpdateBlocks(ctx, (const uint32_t *)data, blocks);
+    data += blocks * CHECKSUM_BLOCK_LEN;
+    len -= blocks * CHECKSUM_BLOCK_LEN;
+
+    checksumUpdateBytes(ctx, data, len);
+}
+
+/**
+ * @brief  Finalizes the selected checksums. The state is left unchanged,
+ *         so the message can be continued.
+ * @param  ctx     Running state.
+ * @param  digest  Receives the set and one value per selected algorithm,
+ *                 the others are zero.
+ */
+void checksumFinal(const checksumCtx_t *ctx, checksumDigest_t *digest)
+{
+    uint32_t f0 = ctx->fletcher0;
+    uint32_t f1 = ctx->fletcher1;
+    uint32_t i;
+
+    for (i = 0U; i < CHECKSUM_COUNT; i++)
+    {
+        digest->value[i] = 0U;
+    }
+    digest->set = ctx->set;
+
+    if ((ctx->set & CHECKSUM_CRC32) != 0U)
+    {
+        digest->value[CHECKSUM_IDX_CRC32] = ctx->crc32 ^ CRC32_XOROUT;
+    }
+    if ((ctx->set & CHECKSUM_CRC32C) != 0U)
+    {
+        digest->value[CHECKSUM_IDX_CRC32C] = ctx->crc32c ^ CRC32_XOROUT;
+    }
+    if ((ctx->set & CHECKSUM_ADLER32) != 0U)
+    {
+        digest->value[CHECKSUM_IDX_ADLER32] = (ctx->adlerB << 16U) | ctx->adlerA;
+    }
+    if ((ctx->set & CHECKSUM_FLETCHER32) != 0U)
+    {
+        /* Odd length: the last word is the pending byte padded with zero */
+        if (ctx->fletcherOdd != 0U)
+        {
+            f0 = (f0 + ctx->fletcherLow) % CHECKSUM_FLETCHER_MOD;
+            f1 = (f1 + f0) % CHECKSUM_FLETCHER_MOD;
+        }
+        digest->value[CHECKSUM_IDX_FLETCHER32] = (f1 << 16U) | f0;
+    }
+}
+
+/**
+ * @brief  Printable name of an algorithm.
+ * @param  index  CHECKSUM_IDX_* value.
+ */
+const char *checksumName(uint32_t index)
+{
+    return (index < CHECKSUM_COUNT) ? s_names[index] : "?";
+}
+
+/**
+ * @brief  Byte-at-a-time path for heads and tails (fewer than 32 bytes).
+ */
+static void checksumUpdateBytes(checksumCtx_t *ctx, const uint8_t *data, uint32_t len)
+{
+    uint32_t set = ctx->set;
+    uint32_t c32 = CHECKSUM_TO_NATIVE(ctx->crc32);
+    uint32_t c32c = CHECKSUM_TO_NATIVE(ctx->crc32c);
+    uint32_t a = ctx->adlerA;
+    uint32_t b = ctx->adlerB;
+    uint32_t f0 = ctx->fletcher0;
+    uint32_t f1 = ctx->fletcher1;
+    uint32_t low = ctx->fletcherLow;
+    uint32_t odd = ctx->fletcherOdd;
+    uint32_t d;
+
+    if (len == 0U)
+    {
+        return;
+    }
+
+    while (len > 0U)
+    {
+        d = (uint32_t)*data;
+        if ((set & CHECKSUM_CRC32) != 0U)
+        {
+            c32 = CHECKSUM_CRC_BYTE(crc32_table, c32, d);
+        }
+        if ((set & CHECKSUM_CRC32C) != 0U)
+        {
+            c32c = CHECKSUM_CRC_BYTE(crc32c_table, c32c, d);
+        }
+        if ((set & CHECKSUM_ADLER32) != 0U)
+        {
+            a += d;
+            b += a;
+        }
+        if ((set & CHECKSUM_FLETCHER32) != 0U)
+        {
+            if (odd == 0U)
+            {
+                low = d;
+                odd = 1U;
+            }
+            else
+            {
+                f0 += low | (d << 8U);
+                f1 += f0;
+                odd = 0U;
+            }
+        }
+        data++;
+        len--;
+    }
+
+    ctx->crc32 = CHECKSUM_TO_NATIVE(c32);
+    ctx->crc32c = CHECKSUM_TO_NATIVE(c32c);
+    ctx->adlerA = a % CHECKSUM_ADLER_MOD;
+    ctx->adlerB = b % CHECKSUM_ADLER_MOD;
+    ctx->fletcher0 = f0 % CHECKSUM_FLETCHER_MOD;
+    ctx->fletcher1 = f1 % CHECKSUM_FLETCHER_MOD;
+    ctx->fletcherLow = low;
+    ctx->fletcherOdd = odd;
+}
+
+/**
+ * @brief  Block path: one load of each 32-byte block, shared by all kernels.
+ * @param  ctx    Running state.
+ * @param  block  32-byte aligned pointer to the first block.
+ * @param  count  Number of blocks.
+ */
+static void checksumUpdateBlocks(checksumCtx_t *ctx, const uint32_t *block, uint32_t count)
+{
+    uint32_t set = ctx->set;
+    uint32_t c32 = CHECKSUM_TO_NATIVE(ctx->crc32);
+    uint32_t c32c = CHECKSUM_TO_NATIVE(ctx->crc32c);
+    uint32_t a = ctx->adlerA;
+    uint32_t b = ctx->adlerB;
+    uint32_t f0 = ctx->fletcher0;
+    uint32_t f1 = ctx->fletcher1;
+    uint32_t low = ctx->fletcherLow;
+    uint32_t w[CHECKSUM_BLOCK_LEN / 4U];
+    uint32_t sinceReduce = 0U;
+    uint32_t i;
+
+    if (count == 0U)
+    {
+        return;
+    }
+
+    while (count > 0U)
+    {
+        for (i = 0U; i < (CHECKSUM_BLOCK_LEN / 4U); i++)
+        {
+            w[i] = block[i];
+        }
+
+        if ((set & CHECKSUM_CRC32) != 0U)
+        {
+            for (i = 0U; i < (CHECKSUM_BLOCK_LEN / 4U); i++)
+            {
+                c32 ^= w[i];
+                c32 = CHECKSUM_CRC_WORD(crc32_table, c32);
+            }
+        }
+        if ((set & CHECKSUM_CRC32C) != 0U)
+        {
+            for (i = 0U; i < (CHECKSUM_BLOCK_LEN / 4U); i++)
+            {
+                c32c ^= w[i];
+                c32c = CHECKSUM_CRC_WORD(crc32c_table, c32c);
+            }
+        }
+        if ((set & CHECKSUM_ADLER32) != 0U)
+        {
+            for (i = 0U; i < (CHECKSUM_BLOCK_LEN / 4U); i++)
+            {
+                a += CHECKSUM_BYTE(w[i], 0U);
+                b += a;
+                a += CHECKSUM_BYTE(w[i], 1U);
+                b += a;
+                a += CHECKSUM_BYTE(w[i], 2U);
+                b += a;
+                a += CHECKSUM_BYTE(w[i], 3U);
+                b += a;
+            }
+        }
+        if ((set & CHECKSUM_FLETCHER32) != 0U)
+        {
+            if (ctx->fletcherOdd == 0U)
+            {
+                for (i = 0U; i < (CHECKSUM_BLOCK_LEN / 4U); i++)
+                {
+                    f0 += CHECKSUM_BYTE(w[i], 0U) | (CHECKSUM_BYTE(w[i], 1U) << 8U);
+                    f1 += f0;
+                    f0 += CHECKSUM_BYTE(w[i], 2U) | (CHECKSUM_BYTE(w[i], 3U) << 8U);
+                    f1 += f0;
+                }
+            }
+            else
+            {
+                /* Words straddle the loaded words by one byte */
+                for (i = 0U; i < (CHECKSUM_BLOCK_LEN / 4U); i++)
+                {
+                    f0 += low | (CHECKSUM_BYTE(w[i], 0U) << 8U);
+                    f1 += f0;
+                    f0 += CHECKSUM_BYTE(w[i], 1U) | (CHECKSUM_BYTE(w[i], 2U) << 8U);
+                    f1 += f0;
+                    low = CHECKSUM_BYTE(w[i], 3U);
+                }
+            }
+        }
+
+        sinceReduce++;
+        if (sinceReduce == CHECKSUM_REDUCE_BLOCKS)
+        {
+            a %= CHECKSUM_ADLER_MOD;
+            b %= CHECKSUM_ADLER_MOD;
+            f0 %= CHECKSUM_FLETCHER_MOD;
+            f1 %= CHECKSUM_FLETCHER_MOD;
+            sinceReduce = 0U;
+        }
+
+        block += CHECKSUM_BLOCK_LEN / 4U;
+        count--;
+    }
+
+    ctx->crc32 = CHECKSUM_TO_NATIVE(c32);
+    ctx->crc32c = CHECKSUM_TO_NATIVE(c32c);
+    ctx->adlerA = a % CHECKSUM_ADLER_MOD;
+    ctx->adlerB = b % CHECKSUM_ADLER_MOD;
+    ctx->fletcher0 = f0 % CHECKSUM_FLETCHER_MOD;
+    ctx->fletcher1 = f1 % CHECKSUM_FLETCHER_MOD;
+    ctx->fletcherLow = low;
+}
@@ -0,0 +1,359 @@
+/**
+ ******************************************************************************
+ * @file    command.c
+ * @brief   In-Band Command Interpreter
+ *
+ * @details
+ *   - cmdScan() collects a candidate line from the ring spans, cmdParse()
+ *     turns a complete line into a cmd_t. Executing the command is left to
+ *     the caller, which owns the state being changed.
+ *   - A line that overflows CMD_LINE_MAX or does not parse is data; its
+ *     bytes stay available through cmdHeld() until cmdRelease().
+ ******************************************************************************
+ */
+#include "command.h"
+#include "checksum.h"
+#include <string.h>
+
+typedef struct
+{
+    const char *name;
+    uint32_t value;
+} cmdName_t;
+
+static const cmdName_t s_commands[] =
+{
+    { "reset",    (uint32_t)CMD_RESET },
+    { "stats",    (uint32_t)CMD_STATS },
+    { "idle",     (uint32_t)CMD_IDLE },
+    { "preset",   (uint32_t)CMD_PRESET },
+    { "format",   (uint32_t)CMD_FORMAT },
+    { "bench",    (uint32_t)CMD_BENCH },
+    { "selftest", (uint32_t)CMD_SELFTEST },
+    { "baud",     (uint32_t)CMD_BAUD },
+    { "manifest", (uint32_t)CMD_MANIFEST },
+    { "tree",     (uint32_t)CMD_TREE },
+    { "node",     (uint32_t)CMD_NODE },
+    { "trace",    (uint32_t)CMD_TRACE },
+    { "capture",  (uint32_t)CMD_CAPTURE },
+    { "verify",   (uint32_t)CMD_VERIFY },
+    { "replay",   (uint32_t)CMD_REPLAY }
+};
+
+static const cmdName_t s_presets[] =
+{
+    { "crc32",      CHECKSUM_CRC32 },
+    { "crc32c",     CHECKSUM_CRC32C },
+    { "adler32",    CHECKSUM_ADLER32 },
+    { "fletcher32", CHECKSUM_FLETCHER32 },
+    { "all",        CHECKSUM_ALL }
+};
+
+static const cmdName_t s_switches[] =
+{
+    { "off", 0U },
+    { "on",  1U }
+};
+
+static const cmdName_t s_formats[] =
+{
+    { "text",    CMD_FORMAT_TEXT },
+    { "compact", CMD_FORMAT_COMPACT },
+    { "raw",     CMD_FORMAT_RAW }
+};
+
+#define CMD_COUNT_OF(a)         (sizeof(a) / sizeof((a)[0]))
+
+static uint8_t s_line[CMD_LINE_MAX];
+static uint32_t s_lineLen = 0U;
+static uint32_t s_collecting = 0U;
+
+static uint32_t cmdLookup(const cmdName_t *table, uint32_t count,
+                          const char *word, uint32_t len, uint32_t *value);
+static uint32_t cmdNumber(const char *text, uint32_t len, uint32_t base, uint32_t *value);
+static uint32_t cmdPreset(const char *text, uint32_t len, uint32_t *set);
+
+/**
+ * @brief  Collects a command line from a ring span.
+ * @param  data  Span, the first byte of a window unless cmdCollecting().
+ * @param  len   Span length.
+ * @param  used  Bytes taken from the span.
+ * @return CMD_SCAN_DATA when the window is data: nothing was taken if the
+ *         span does not start with CMD_ESCAPE, otherwise the bytes taken
+ *         are in cmdHeld(). CMD_SCAN_MORE or CMD_SCAN_LINE otherwise.
+ */
+cmdScan_t cmdScan(const uint8_t *data, uint32_t len, uint32_t *used)
+{
+    uint32_t i = 0U;
+    uint8_t byte;
+
+    *used = 0U;
+    if (s_collecting == 0U)
+    {
+        if ((len == 0U) || (data[0U] != CMD_ESCAPE))
+        {
+            return CMD_SCAN_DATA;
+        }
+        s_lineLen = 0U;
+        s_collecting = 1U;
+    }
+
+    while (i < len)
+    {
+        byte = data[i];
+        s_line[s_lineLen] = byte;
+        s_lineLen++;
+        i++;
+        if ((byte == (uint8_t)'\r') || (byte == (uint8_t)'\n'))
+        {
+            s_collecting = 0U;
+            *used = i;
+            return CMD_SCAN_LINE;
+        }
+        if (s_lineLen == CMD_LINE_MAX)
+        {
+            s_collecting = 0U;
+            *used = i;
+            return CMD_SCAN_DATA;
+        }
+    }
+    *used = i;
+    return CMD_SCAN_MORE;
+}
+
+/**
+ * @brief  Returns non-zero while a started line waits for more bytes.
+ */
+uint32_t cmdCollecting(void)
+{
+    return s_collecting;
+}
+
+/**
+ * @brief  Parses the line completed by cmdScan().
+ * @param  cmd  Command and argument.
+ * @return Non-zero for a valid command. Otherwise the line is data.
+ */
+uint32_t cmdParse(cmd_t *cmd)
+{
+    const char *text = (const char *)&s_line[1U];
+    uint32_t len;
+    uint32_t wordLen = 0U;
+    const char *arg;
+    uint32_t argLen;
+    uint32_t id;
+    uint32_t ok;
+    uint32_t n = 0U;
+
+    cmd->id = CMD_NONE;
+    cmd->arg = 0U;
+    cmd->arg2 = 0U;
+
+    /* Escape and terminator are not part of the text */
+    if (s_lineLen < 2U)
+    {
+        return 0U;
+    }
+    len = s_lineLen - 2U;
+
+    while ((wordLen < len) && (text[wordLen] != ' '))
+    {
+        wordLen++;
+    }
+    if (cmdLookup(s_commands, CMD_COUNT_OF(s_commands), text, wordLen, &id) == 0U)
+    {
+        return 0U;
+    }
+
+    arg = &text[wordLen];
+    argLen = len - wordLen;
+    while ((argLen > 0U) && (*arg == ' '))
+    {
+        arg++;
+        argLen--;
+    }
+
+    switch ((cmdId_t)id)
+    {
+    case CMD_IDLE:
+    case CMD_BAUD:
+        ok = cmdNumber(arg, argLen, 10U, &cmd->arg);
+        if (cmd->arg == 0U)
+        {
+            ok = 0U;
+        }
+        break;
+    case CMD_MANIFEST:
+    case CMD_TREE:
+        ok = cmdNumber(arg, argLen, 10U, &cmd->arg);
+        break;
+    case CMD_NODE:
+        while ((n < argLen) && (arg[n] != ' '))
+        {
+            n++;
+        }
+        ok = ((n < argLen)
+           && (cmdNumber(arg, n, 10U, &cmd->arg) != 0U)
+           && (cmdNumber(&arg[n + 1U], argLen - n - 1U, 10U, &cmd->arg2) != 0U)) ? 1U : 0U;
+        break;
+    case CMD_PRESET:
+        ok = cmdPreset(arg, argLen, &cmd->arg);
+        break;
+    case CMD_FORMAT:
+        ok = cmdLookup(s_formats, CMD_COUNT_OF(s_formats), arg, argLen, &cmd->arg);
+        break;
+    case CMD_CAPTURE:
+        ok = cmdLookup(s_switches, CMD_COUNT_OF(s_switches), arg, argLen, &cmd->arg);
+        break;
+    case CMD_VERIFY:
+        /* 0 for the current preset */
+        ok = (argLen == 0U) ? 1U : cmdPreset(arg, argLen, &cmd->arg);
+        break;
+    default:
+        ok = (argLen == 0U) ? 1U : 0U;
+        break;
+    }
+
+    if (ok != 0U)
+    {
+        cmd->id = (cmdId_t)id;
+    }
+    return ok;
+}
+
+/**
+ * @brief  Bytes held back by cmdScan() (the escape included).
+ * @param  len  Number of bytes.
+ */
+const uint8_t *cmdHeld(uint32_t *len)
+{
+    *len = s_lineLen;
+    return s_line;
+}
+
+/**
+ * @brief  Drops the held bytes and any line in progress.
+ */
+void cmdRelease(void)
+{
+    s_lineLen = 0U;
+    s_collecting = 0U;
+}
+
+/**
+ * @brief  Printable name of a report format (CMD_FORMAT_*).
+ */
+const char *cmdFormatName(uint32_t format)
+{
+    return (format < CMD_COUNT_OF(s_formats)) ? s_formats[format].name : "?";
+}
+
+/**
+ * @brief  Finds a word in a name table.
+ * @return Non-zero if found, with its value in *value.
+ */
+static uint32_t cmdLookup(const cmdName_t *table, uint32_t count,
+                          const char *word, uint32_t len, uint32_t *value)
+{
+    uint32_t i;
+
+    for (i = 0U; i < count; i++)
+    {
+        if ((strlen(table[i].name) == len) && (strncmp(table[i].name, word, len) == 0))
+        {
+            *value = table[i].value;
+            return 1U;
+        }
+    }
+    return 0U;
+}
+
+/**
+ * @brief  Parses an unsigned decimal or hexadecimal number.
+ * @return Non-zero if the whole text is a number that fits 32 bits.
+ */
+static uint32_t cmdNumber(const char *text, uint32_t len, uint32_t base, uint32_t *value)
+{
+    uint32_t n = 0U;
+    uint32_t digit;
+    uint32_t i;
+
+    if (len == 0U)
+    {
+        return 0U;
+    }
+    for (i = 0U; i < len; i++)
+    {
+        if ((text[i] >= '0') && (text[i] <= '9'))
+        {
+            digit = (uint32_t)(text[i] - '0');
+        }
+        else if ((base == 16U) && (text[i] >= 'a') && (text[i] <= 'f'))
+        {
+            digit = (uint32_t)(text[i] - 'a') + 10U;
+        }
+        else if ((base == 16U) && (text[i] >= 'A') && (text[i] <= 'F'))
+        {
+            digit = (uint32_t)(text[i] - 'A') + 10U;
+        }
+        else
+        {
+            return 0U;
+        }
+        if (n > ((0xFFFFFFFFU - digit) / base))
+        {
+            return 0U;
+        }
+        n = (n * base) + digit;
+    }
+    *value = n;
+    return 1U;
+}
+
+/**
+ * @brief  Parses a checksum set: names joined with '+', or a 0x mask.
+ * @return Non-zero for a non-empty set of known algorithms.
+ */
+static uint32_t cmdPreset(const char *text, uint32_t len, uint32_t *set)
+{
+    uint32_t mask = 0U;
+    uint32_t bit;
+    uint32_t n;
+
+    if ((len > 2U) && (text[0U] == '0') && ((text[1U] == 'x') || (text[1U] == 'X')))
+    {
+        if (cmdNumber(&text[2U], len - 2U, 16U, &mask) == 0U)
+        {
+            return 0U;
+        }
+    }
+    else
+    {
+        while (len > 0U)
+        {
+            n = 0U;
+            while ((n < len) && (text[n] != '+'))
+            {
+                n++;
+            }
+            if (cmdLookup(s_presets, CMD_COUNT_OF(s_presets), text, n, &bit) == 0U)
+            {
+                return 0U;
+            }
+            mask |= bit;
+            if (n < len)
+            {
+                n++;
+            }
+            text += n;
+            len -= n;
+        }
+    }
+
+    if ((mask == 0U) || ((mask & ~CHECKSUM_ALL) != 0U))
+    {
+        return 0U;
+    }
+    *set = mask;
+    return 1U;
+}
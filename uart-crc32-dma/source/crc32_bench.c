@@ -0,0 +1,276 @@
+/**
+ ******************************************************************************
+ * @file    crc32_bench.c
+ * @brief   PMU Benchmark of the CRC32 Kernels
+ *
+ * @details
+ *   - PMU counter 0 counts PMU_DATA_READ_ARCH_EXECUTED, counter 1 counts
+ *     PMU_DATA_WRITE_ARCH_EXECUTED, the cycle counter runs at CPU clock.
+ *   - The read count includes the table lookups, so the word kernel shows
+ *     one buffer read per four bytes plus four table reads per word. The
+ *     burst kernel makes the same number of reads, but its buffer reads are
+ *     LDM bursts of eight words.
+ *   - The 64 KB run shows the steady per-byte cost, with the call and the
+ *     unaligned head/tail handling spread over sixteen times more data.
+ *   - Every size is measured with the caches off (the configuration the DMA
+ *     needs) and on. Whether the kernels and tables run from flash or RAM is
+ *     chosen at link time (RAMFUNC_IN_RAM in HL_sys_link.cmd) and printed
+ *     in the header, so the flash/RAM comparison takes two builds.
+ *   - The checksum benchmark prints each algorithm alone, the sum of the
+ *     four separate passes and the single pass over all of them; the
+ *     difference in reads is the buffer traffic the shared loads save.
+ *
+ * @note
+ *   - Run with IRQs quiet (before the DMA channel is armed), otherwise the
+ *     counters include the interrupt handlers. The caches must be off on
+ *     entry; they are cleaned and disabled again before returning.
+ ******************************************************************************
+ */
+#include "crc32_bench.h"
+#include "crc32_kernel.h"
+#include "checksum.h"
+#include "ramfunc.h"
+#include "HL_sys_pmu.h"
+#include "HL_sys_core.h"
+#include <string.h>
+#include <stdio.h>
+
+#define CRC32_BENCH_COUNTERS    (pmuCOUNTER0 | pmuCOUNTER1 | pmuCYCLE_COUNTER)
+
+#pragma DATA_ALIGN(s_benchBuf, 32)
+static uint8_t s_benchBuf[CRC32_BENCH_LEN_LARGE];
+
+static const char * const s_kernelName[CRC32_KERNEL_COUNT] =
+{
+    "bitwise", "table  ", "word   ", "burst  "
+};
+
+static void crc32BenchPrint(sciBASE_t *sci, const char *text);
+static void crc32BenchFill(void);
+static void crc32BenchPrintResult(sciBASE_t *sci, const char *name, uint32_t len,
+                                  const crc32BenchResult_t *result);
+
+/**
+ * @brief  Runs one kernel over the benchmark buffer under the PMU.
+ * @param  kernel  Kernel to measure.
+ * @param  len     Bytes to process, up to CRC32_BENCH_LEN_LARGE.
+ * @param  result  Counter values and the finalized CRC.
+ */
+void crc32BenchRun(crc32Kernel_t kernel, uint32_t len, crc32BenchResult_t *result)
+{
+    uint32_t crc = CRC32_INIT;
+    uint32_t i;
+
+    _pmuResetCounters_();
+    _pmuStartCounters_(CRC32_BENCH_COUNTERS);
+
+    switch (kernel)
+    {
+    case CRC32_KERNEL_BITWISE:
+        for (i = 0U; i < len; i++)
+        {
+            crc = update_crc32(crc, s_benchBuf[i]);
+        }
+        crc = reflect32(crc);
+        break;
+    case CRC32_KERNEL_TABLE:
+        crc = crc32UpdateTable(crc, s_benchBuf, len);
+        break;
+    case CRC32_KERNEL_WORD:
+        crc = crc32UpdateWord(crc, s_benchBuf, len);
+        break;
+    default:
+        crc = crc32UpdateBurst(crc, s_benchBuf, len);
+        break;
+    }
+
+    _pmuStopCounters_(CRC32_BENCH_COUNTERS);
+
+    result->cycles     = _pmuGetCycleCount_();
+    result->dataReads  = _pmuGetEventCount_(pmuCOUNTER0);
+    result->dataWrites = _pmuGetEventCount_(pmuCOUNTER1);
+    result->crc        = crc ^ CRC32_XOROUT;
+}
+
+/**
+ * @brief  Measures all kernels and prints one line per kernel.
+ * @param  sci  Port used for the report (polling).
+ */
+void crc32Benchmark(sciBASE_t *sci)
+{
+    static const uint32_t lens[2U] = { CRC32_BENCH_LEN, CRC32_BENCH_LEN_LARGE };
+    crc32BenchResult_t result;
+    char line[112];
+    uint32_t k;
+    uint32_t n;
+    uint32_t cache;
+
+    crc32BenchFill();
+
+    _pmuInit_();
+    _pmuEnableCountersGlobal_();
+    _pmuSetCountEvent_(pmuCOUNTER0, PMU_DATA_READ_ARCH_EXECUTED);
+    _pmuSetCountEvent_(pmuCOUNTER1, PMU_DATA_WRITE_ARCH_EXECUTED);
+
+    for (cache = 0U; cache < 2U; cache++)
+    {
+        if (cache != 0U)
+        {
+            _cacheEnable_();
+        }
+        for (n = 0U; n < 2U; n++)
+        {
+            sprintf(line, "\r\nCRC32 kernel benchmark, %lu bytes, code in %s, cache %s\r\n",
+                    (unsigned long)lens[n],
+                    (ramfuncInRam() != 0U) ? "RAM" : "flash",
+                    (cache != 0U) ? "on" : "off");
+            crc32BenchPrint(sci, line);
+            for (k = 0U; k < (uint32_t)CRC32_KERNEL_COUNT; k++)
+            {
+                crc32BenchRun((crc32Kernel_t)k, lens[n], &result);
+                crc32BenchPrintResult(sci, s_kernelName[k], lens[n], &result);
+            }
+        }
+    }
+
+    /* Back to the DMA-safe configuration */
+    _dCacheClean_();
+    _cacheDisable_();
+}
+
+/**
+ * @brief  Runs the multi-checksum engine over the benchmark buffer under
+ *         the PMU.
+ * @param  set     CHECKSUM_* mask of the algorithms to compute.
+ * @param  len     Bytes to process, up to CRC32_BENCH_LEN_LARGE.
+ * @param  result  Counter values; crc holds the digest of the lowest
+ *                 selected algorithm.
+ */
+void checksumBenchRun(uint32_t set, uint32_t len, crc32BenchResult_t *result)
+{
+    checksumCtx_t ctx;
+    checksumDigest_t digest;
+    uint32_t i;
+
+    checksumInit(&ctx, set);
+
+    _pmuResetCounters_();
+    _pmuStartCounters_(CRC32_BENCH_COUNTERS);
+
+    checksumUpdate(&ctx, s_benchBuf, len);
+    checksumFinal(&ctx, &digest);
+
+    _pmuStopCounters_(CRC32_BENCH_COUNTERS);
+
+    result->cycles     = _pmuGetCycleCount_();
+    result->dataReads  = _pmuGetEventCount_(pmuCOUNTER0);
+    result->dataWrites = _pmuGetEventCount_(pmuCOUNTER1);
+    result->crc        = 0U;
+    for (i = 0U; i < CHECKSUM_COUNT; i++)
+    {
+        if ((set & (1U << i)) != 0U)
+        {
+            result->crc = digest.value[i];
+            break;
+        }
+    }
+}
+
+/**
+ * @brief  Measures each checksum alone and all of them in one pass, with
+ *         the caches on.
+ * @param  sci  Port used for the report (polling).
+ */
+void checksumBenchmark(sciBASE_t *sci)
+{
+    static const uint32_t lens[2U] = { CRC32_BENCH_LEN, CRC32_BENCH_LEN_LARGE };
+    crc32BenchResult_t result;
+    crc32BenchResult_t separate;
+    char line[112];
+    uint32_t k;
+    uint32_t n;
+
+    crc32BenchFill();
+
+    _pmuInit_();
+    _pmuEnableCountersGlobal_();
+    _pmuSetCountEvent_(pmuCOUNTER0, PMU_DATA_READ_ARCH_EXECUTED);
+    _pmuSetCountEvent_(pmuCOUNTER1, PMU_DATA_WRITE_ARCH_EXECUTED);
+
+    _cacheEnable_();
+    for (n = 0U; n < 2U; n++)
+    {
+        sprintf(line, "\r\nChecksum engine benchmark, %lu bytes, code in %s, cache on\r\n",
+                (unsigned long)lens[n],
+                (ramfuncInRam() != 0U) ? "RAM" : "flash");
+        crc32BenchPrint(sci, line);
+
+        separate.cycles = 0U;
+        separate.dataReads = 0U;
+        separate.dataWrites = 0U;
+        separate.crc = 0U;
+        for (k = 0U; k < CHECKSUM_COUNT; k++)
+        {
+            checksumBenchRun(1U << k, lens[n], &result);
+            sprintf(line, "%-11s", checksumName(k));
+            crc32BenchPrintResult(sci, line, lens[n], &result);
+            separate.cycles += result.cycles;
+            separate.dataReads += result.dataReads;
+            separate.dataWrites += result.dataWrites;
+        }
+        crc32BenchPrintResult(sci, "4 passes   ", lens[n], &separate);
+
+        checksumBenchRun(CHECKSUM_ALL, lens[n], &result);
+        crc32BenchPrintResult(sci, "1 pass     ", lens[n], &result);
+    }
+
+    /* Back to the DMA-safe configuration */
+    _dCacheClean_();
+    _cacheDisable_();
+}
+
+/**
+ * @brief  Fills the benchmark buffer with a fixed pattern.
+ */
+static void crc32BenchFill(void)
+{
+    uint32_t k;
+
+    for (k = 0U; k < CRC32_BENCH_LEN_LARGE; k++)
+    {
+        s_benchBuf[k] = (uint8_t)((k * 7U) + 3U);
+    }
+}
+
+/**
+ * @brief  Prints one result line: cycles, cycles per byte, reads, writes
+ *         and the checksum.
+ */
+static void crc32BenchPrintResult(sciBASE_t *sci, const char *name, uint32_t len,
+                                  const crc32BenchResult_t *result)
+{
+    char line[112];
+
+    sprintf(line, "%s cycles %8lu (%3lu.%02lu/B) reads %6lu writes %6lu crc %08lX\r\n",
+            name,
+            (unsigned long)result->cycles,
+            (unsigned long)(result->cycles / len),
+            (unsigned long)(((result->cycles % len) * 100U) / len),
+            (unsigned long)result->dataReads,
+            (unsigned long)result->dataWrites,
+            (unsigned long)result->crc);
+    crc32BenchPrint(sci, line);
+}
+
+/**
+ * @brief  Sends a null-terminated string using polling.
+ */
+static void crc32BenchPrint(sciBASE_t *sci, const char *text)
+{
+    uint32 length = strlen(text);
+
+    while (length--)
+    {
+        sciSendByte(sci, (uint8)*text++);
+    }
+}
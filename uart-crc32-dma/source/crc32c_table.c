@@ -0,0 +1,388 @@
+/**
+ ******************************************************************************
+ * @file    crc32c_table.c
+ * @brief   Lookup Tables for the Slice-by-4 CRC32C (Castagnoli) Kernel
+ *
+ * @details
+ *   - Same layout as crc32_table.c for the reflected Castagnoli polynomial
+ *     0x82F63B78, used by the multi-checksum engine (checksum.c).
+ *   - Big-endian builds use the byte-swapped tables.
+ *
+ * @note
+ *   - Generated, do not edit by hand.
+ ******************************************************************************
+ */
+#include "checksum.h"
+
+/* Runs from RAM with the kernels (ramfunc.h) */
+#pragma DATA_SECTION(crc32c_table, ".ramConst")
+
+#if (CRC32_LITTLE_ENDIAN == 1)
+const uint32_t crc32c_table[4][256] =
+{
+    {
+        0x00000000U, 0xF26B8303U, 0xE13B70F7U, 0x1350F3F4U, 0xC79A971FU, 0x35F1141CU,
+        0x26A1E7E8U, 0xD4CA64EBU, 0x8AD958CFU, 0x78B2DBCCU, 0x6BE22838U, 0x9989AB3BU,
+        0x4D43CFD0U, 0xBF284CD3U, 0xAC78BF27U, 0x5E133C24U, 0x105EC76FU, 0xE235446CU,
+        0xF165B798U, 0x030E349BU, 0xD7C45070U, 0x25AFD373U, 0x36FF2087U, 0xC494A384U,
+        0x9A879FA0U, 0x68EC1CA3U, 0x7BBCEF57U, 0x89D76C54U, 0x5D1D08BFU, 0xAF768BBCU,
+        0xBC267848U, 0x4E4DFB4BU, 0x20BD8EDEU, 0xD2D60DDDU, 0xC186FE29U, 0x33ED7D2AU,
+        0xE72719C1U, 0x154C9AC2U, 0x061C6936U, 0xF477EA35U, 0xAA64D611U, 0x580F5512U,
+        0x4B5FA6E6U, 0xB93425E5U, 0x6DFE410EU, 0x9F95C20DU, 0x8CC531F9U, 0x7EAEB2FAU,
+        0x30E349B1U, 0xC288CAB2U, 0xD1D83946U, 0x23B3BA45U, 0xF779DEAEU, 0x05125DADU,
+        0x1642AE59U, 0xE4292D5AU, 0xBA3A117EU, 0x4851927DU, 0x5B016189U, 0xA96AE28AU,
+        0x7DA08661U, 0x8FCB0562U, 0x9C9BF696U, 0x6EF07595U, 0x417B1DBCU, 0xB3109EBFU,
+        0xA0406D4BU, 0x522BEE48U, 0x86E18AA3U, 0x748A09A0U, 0x67DAFA54U, 0x95B17957U,
+        0xCBA24573U, 0x39C9C670U, 0x2A993584U, 0xD8F2B687U, 0x0C38D26CU, 0xFE53516FU,
+        0xED03A29BU, 0x1F682198U, 0x5125DAD3U, 0xA34E59D0U, 0xB01EAA24U, 0x42752927U,
+        0x96BF4DCCU, 0x64D4CECFU, 0x77843D3BU, 0x85EFBE38U, 0xDBFC821CU, 0x2997011FU,
+        0x3AC7F2EBU, 0xC8AC71E8U, 0x1C661503U, 0xEE0D9600U, 0xFD5D65F4U, 0x0F36E6F7U,
+        0x61C69362U, 0x93AD1061U, 0x80FDE395U, 0x72966096U, 0xA65C047DU, 0x5437877EU,
+        0x4767748AU, 0xB50CF789U, 0xEB1FCBADU, 0x197448AEU, 0x0A24BB5AU, 0xF84F3859U,
+        0x2C855CB2U, 0xDEEEDFB1U, 0xCDBE2C45U, 0x3FD5AF46U, 0x7198540DU, 0x83F3D70EU,
+        0x90A324FAU, 0x62C8A7F9U, 0xB602C312U, 0x44694011U, 0x5739B3E5U, 0xA55230E6U,
+        0xFB410CC2U, 0x092A8FC1U, 0x1A7A7C35U, 0xE811FF36U, 0x3CDB9BDDU, 0xCEB018DEU,
+        0xDDE0EB2AU, 0x2F8B6829U, 0x82F63B78U, 0x709DB87BU, 0x63CD4B8FU, 0x91A6C88CU,
+        0x456CAC67U, 0xB7072F64U, 0xA457DC90U, 0x563C5F93U, 0x082F63B7U, 0xFA44E0B4U,
+        0xE9141340U, 0x1B7F9043U, 0xCFB5F4A8U, 0x3DDE77ABU, 0x2E8E845FU, 0xDCE5075CU,
+        0x92A8FC17U, 0x60C37F14U, 0x73938CE0U, 0x81F80FE3U, 0x55326B08U, 0xA759E80BU,
+        0xB4091BFFU, 0x466298FCU, 0x1871A4D8U, 0xEA1A27DBU, 0xF94AD42FU, 0x0B21572CU,
+        0xDFEB33C7U, 0x2D80B0C4U, 0x3ED04330U, 0xCCBBC033U, 0xA24BB5A6U, 0x502036A5U,
+        0x4370C551U, 0xB11B4652U, 0x65D122B9U, 0x97BAA1BAU, 0x84EA524EU, 0x7681D14DU,
+        0x2892ED69U, 0xDAF96E6AU, 0xC9A99D9EU, 0x3BC21E9DU, 0xEF087A76U, 0x1D63F975U,
+        0x0E330A81U, 0xFC588982U, 0xB21572C9U, 0x407EF1CAU, 0x532E023EU, 0xA145813DU,
+        0x758FE5D6U, 0x87E466D5U, 0x94B49521U, 0x66DF1622U, 0x38CC2A06U, 0xCAA7A905U,
+        0xD9F75AF1U, 0x2B9CD9F2U, 0xFF56BD19U, 0x0D3D3E1AU, 0x1E6DCDEEU, 0xEC064EEDU,
+        0xC38D26C4U, 0x31E6A5C7U, 0x22B65633U, 0xD0DDD530U, 0x0417B1DBU, 0xF67C32D8U,
+        0xE52CC12CU, 0x1747422FU, 0x49547E0BU, 0xBB3FFD08U, 0xA86F0EFCU, 0x5A048DFFU,
+        0x8ECEE914U, 0x7CA56A17U, 0x6FF599E3U, 0x9D9E1AE0U, 0xD3D3E1ABU, 0x21B862A8U,
+        0x32E8915CU, 0xC083125FU, 0x144976B4U, 0xE622F5B7U, 0xF5720643U, 0x07198540U,
+        0x590AB964U, 0xAB613A67U, 0xB831C993U, 0x4A5A4A90U, 0x9E902E7BU, 0x6CFBAD78U,
+        0x7FAB5E8CU, 0x8DC0DD8FU, 0xE330A81AU, 0x115B2B19U, 0x020BD8EDU, 0xF0605BEEU,
+        0x24AA3F05U, 0xD6C1BC06U, 0xC5914FF2U, 0x37FACCF1U, 0x69E9F0D5U, 0x9B8273D6U,
+        0x88D28022U, 0x7AB90321U, 0xAE7367CAU, 0x5C18E4C9U, 0x4F48173DU, 0xBD23943EU,
+        0xF36E6F75U, 0x0105EC76U, 0x12551F82U, 0xE03E9C81U, 0x34F4F86AU, 0xC69F7B69U,
+        0xD5CF889DU, 0x27A40B9EU, 0x79B737BAU, 0x8BDCB4B9U, 0x988C474DU, 0x6AE7C44EU,
+        0xBE2DA0A5U, 0x4C4623A6U, 0x5F16D052U, 0xAD7D5351U
+    },
+    {
+        0x00000000U, 0x13A29877U, 0x274530EEU, 0x34E7A899U, 0x4E8A61DCU, 0x5D28F9ABU,
+        0x69CF5132U, 0x7A6DC945U, 0x9D14C3B8U, 0x8EB65BCFU, 0xBA51F356U, 0xA9F36B21U,
+        0xD39EA264U, 0xC03C3A13U, 0xF4DB928AU, 0xE7790AFDU, 0x3FC5F181U, 0x2C6769F6U,
+        0x1880C16FU, 0x0B225918U, 0x714F905DU, 0x62ED082AU, 0x560AA0B3U, 0x45A838C4U,
+        0xA2D13239U, 0xB173AA4EU, 0x859402D7U, 0x96369AA0U, 0xEC5B53E5U, 0xFFF9CB92U,
+        0xCB1E630BU, 0xD8BCFB7CU, 0x7F8BE302U, 0x6C297B75U, 0x58CED3ECU, 0x4B6C4B9BU,
+        0x310182DEU, 0x22A31AA9U, 0x1644B230U, 0x05E62A47U, 0xE29F20BAU, 0xF13DB8CDU,
+        0xC5DA1054U, 0xD6788823U, 0xAC154166U, 0xBFB7D911U, 0x8B507188U, 0x98F2E9FFU,
+        0x404E1283U, 0x53EC8AF4U, 0x670B226DU, 0x74A9BA1AU, 0x0EC4735FU, 0x1D66EB28U,
+        0x298143B1U, 0x3A23DBC6U, 0xDD5AD13BU, 0xCEF8494CU, 0xFA1FE1D5U, 0xE9BD79A2U,
+        0x93D0B0E7U, 0x80722890U, 0xB4958009U, 0xA737187EU, 0xFF17C604U, 0xECB55E73U,
+        0xD852F6EAU, 0xCBF06E9DU, 0xB19DA7D8U, 0xA23F3FAFU, 0x96D89736U, 0x857A0F41U,
+        0x620305BCU, 0x71A19DCBU, 0x45463552U, 0x56E4AD25U, 0x2C896460U, 0x3F2BFC17U,
+        0x0BCC548EU, 0x186ECCF9U, 0xC0D23785U, 0xD370AFF2U, 0xE797076BU, 0xF4359F1CU,
+        0x8E585659U, 0x9DFACE2EU, 0xA91D66B7U, 0xBABFFEC0U, 0x5DC6F43DU, 0x4E646C4AU,
+        0x7A83C4D3U, 0x69215CA4U, 0x134C95E1U, 0x00EE0D96U, 0x3409A50FU, 0x27AB3D78U,
+        0x809C2506U, 0x933EBD71U, 0xA7D915E8U, 0xB47B8D9FU, 0xCE1644DAU, 0xDDB4DCADU,
+        0xE9537434U, 0xFAF1EC43U, 0x1D88E6BEU, 0x0E2A7EC9U, 0x3ACDD650U, 0x296F4E27U,
+        0x53028762U, 0x40A01F15U, 0x7447B78CU, 0x67E52FFBU, 0xBF59D487U, 0xACFB4CF0U,
+        0x981CE469U, 0x8BBE7C1EU, 0xF1D3B55BU, 0xE2712D2CU, 0xD69685B5U, 0xC5341DC2U,
+        0x224D173FU, 0x31EF8F48U, 0x050827D1U, 0x16AABFA6U, 0x6CC776E3U, 0x7F65EE94U,
+        0x4B82460DU, 0x5820DE7AU, 0xFBC3FAF9U, 0xE861628EU, 0xDC86CA17U, 0xCF245260U,
+        0xB5499B25U, 0xA6EB0352U, 0x920CABCBU, 0x81AE33BCU, 0x66D73941U, 0x7575A136U,
+        0x419209AFU, 0x523091D8U, 0x285D589DU, 0x3BFFC0EAU, 0x0F186873U, 0x1CBAF004U,
+        0xC4060B78U, 0xD7A4930FU, 0xE3433B96U, 0xF0E1A3E1U, 0x8A8C6AA4U, 0x992EF2D3U,
+        0xADC95A4AU, 0xBE6BC23DU, 0x5912C8C0U, 0x4AB050B7U, 0x7E57F82EU, 0x6DF56059U,
+        0x1798A91CU, 0x043A316BU, 0x30DD99F2U, 0x237F0185U, 0x844819FBU, 0x97EA818CU,
+        0xA30D2915U, 0xB0AFB162U, 0xCAC27827U, 0xD960E050U, 0xED8748C9U, 0xFE25D0BEU,
+        0x195CDA43U, 0x0AFE4234U, 0x3E19EAADU, 0x2DBB72DAU, 0x57D6BB9FU, 0x447423E8U,
+        0x70938B71U, 0x63311306U, 0xBB8DE87AU, 0xA82F700DU, 0x9CC8D894U, 0x8F6A40E3U,
+        0xF50789A6U, 0xE6A511D1U, 0xD242B948U, 0xC1E0213FU, 0x26992BC2U, 0x353BB3B5U,
+        0x01DC1B2CU, 0x127E835BU, 0x68134A1EU, 0x7BB1D269U, 0x4F567AF0U, 0x5CF4E287U,
+        0x04D43CFDU, 0x1776A48AU, 0x23910C13U, 0x30339464U, 0x4A5E5D21U, 0x59FCC556U,
+        0x6D1B6DCFU, 0x7EB9F5B8U, 0x99C0FF45U, 0x8A626732U, 0xBE85CFABU, 0xAD2757DCU,
+        0xD74A9E99U, 0xC4E806EEU, 0xF00FAE77U, 0xE3AD3600U, 0x3B11CD7CU, 0x28B3550BU,
+        0x1C54FD92U, 0x0FF665E5U, 0x759BACA0U, 0x663934D7U, 0x52DE9C4EU, 0x417C0439U,
+        0xA6050EC4U, 0xB5A796B3U, 0x81403E2AU, 0x92E2A65DU, 0xE88F6F18U, 0xFB2DF76FU,
+        0xCFCA5FF6U, 0xDC68C781U, 0x7B5FDFFFU, 0x68FD4788U, 0x5C1AEF11U, 0x4FB87766U,
+        0x35D5BE23U, 0x26772654U, 0x12908ECDU, 0x013216BAU, 0xE64B1C47U, 0xF5E98430U,
+        0xC10E2CA9U, 0xD2ACB4DEU, 0xA8C17D9BU, 0xBB63E5ECU, 0x8F844D75U, 0x9C26D502U,
+        0x449A2E7EU, 0x5738B609U, 0x63DF1E90U, 0x707D86E7U, 0x0A104FA2U, 0x19B2D7D5U,
+        0x2D557F4CU, 0x3EF7E73BU, 0xD98EEDC6U, 0xCA2C75B1U, 0xFECBDD28U, 0xED69455FU,
+        0x97048C1AU, 0x84A6146DU, 0xB041BCF4U, 0xA3E32483U
+    },
+    {
+        0x00000000U, 0xA541927EU, 0x4F6F520DU, 0xEA2EC073U, 0x9EDEA41AU, 0x3B9F3664U,
+        0xD1B1F617U, 0x74F06469U, 0x38513EC5U, 0x9D10ACBBU, 0x773E6CC8U, 0xD27FFEB6U,
+        0xA68F9ADFU, 0x03CE08A1U, 0xE9E0C8D2U, 0x4CA15AACU, 0x70A27D8AU, 0xD5E3EFF4U,
+        0x3FCD2F87U, 0x9A8CBDF9U, 0xEE7CD990U, 0x4B3D4BEEU, 0xA1138B9DU, 0x045219E3U,
+        0x48F3434FU, 0xEDB2D131U, 0x079C1142U, 0xA2DD833CU, 0xD62DE755U, 0x736C752BU,
+        0x9942B558U, 0x3C032726U, 0xE144FB14U, 0x4405696AU, 0xAE2BA919U, 0x0B6A3B67U,
+        0x7F9A5F0EU, 0xDADBCD70U, 0x30F50D03U, 0x95B49F7DU, 0xD915C5D1U, 0x7C5457AFU,
+        0x967A97DCU, 0x333B05A2U, 0x47CB61CBU, 0xE28AF3B5U, 0x08A433C6U, 0xADE5A1B8U,
+        0x91E6869EU, 0x34A714E0U, 0xDE89D493U, 0x7BC846EDU, 0x0F382284U, 0xAA79B0FAU,
+        0x40577089U, 0xE516E2F7U, 0xA9B7B85BU, 0x0CF62A25U, 0xE6D8EA56U, 0x43997828U,
+        0x37691C41U, 0x92288E3FU, 0x78064E4CU, 0xDD47DC32U, 0xC76580D9U, 0x622412A7U,
+        0x880AD2D4U, 0x2D4B40AAU, 0x59BB24C3U, 0xFCFAB6BDU, 0x16D476CEU, 0xB395E4B0U,
+        0xFF34BE1CU, 0x5A752C62U, 0xB05BEC11U, 0x151A7E6FU, 0x61EA1A06U, 0xC4AB8878U,
+        0x2E85480BU, 0x8BC4DA75U, 0xB7C7FD53U, 0x12866F2DU, 0xF8A8AF5EU, 0x5DE93D20U,
+        0x29195949U, 0x8C58CB37U, 0x66760B44U, 0xC337993AU, 0x8F96C396U, 0x2AD751E8U,
+        0xC0F9919BU, 0x65B803E5U, 0x1148678CU, 0xB409F5F2U, 0x5E273581U, 0xFB66A7FFU,
+        0x26217BCDU, 0x8360E9B3U, 0x694E29C0U, 0xCC0FBBBEU, 0xB8FFDFD7U, 0x1DBE4DA9U,
+        0xF7908DDAU, 0x52D11FA4U, 0x1E704508U, 0xBB31D776U, 0x511F1705U, 0xF45E857BU,
+        0x80AEE112U, 0x25EF736CU, 0xCFC1B31FU, 0x6A802161U, 0x56830647U, 0xF3C29439U,
+        0x19EC544AU, 0xBCADC634U, 0xC85DA25DU, 0x6D1C3023U, 0x8732F050U, 0x2273622EU,
+        0x6ED23882U, 0xCB93AAFCU, 0x21BD6A8FU, 0x84FCF8F1U, 0xF00C9C98U, 0x554D0EE6U,
+        0xBF63CE95U, 0x1A225CEBU, 0x8B277743U, 0x2E66E53DU, 0xC448254EU, 0x6109B730U,
+        0x15F9D359U, 0xB0B84127U, 0x5A968154U, 0xFFD7132AU, 0xB3764986U, 0x1637DBF8U,
+        0xFC191B8BU, 0x595889F5U, 0x2DA8ED9CU, 0x88E97FE2U, 0x62C7BF91U, 0xC7862DEFU,
+        0xFB850AC9U, 0x5EC498B7U, 0xB4EA58C4U, 0x11ABCABAU, 0x655BAED3U, 0xC01A3CADU,
+        0x2A34FCDEU, 0x8F756EA0U, 0xC3D4340CU, 0x6695A672U, 0x8CBB6601U, 0x29FAF47FU,
+        0x5D0A9016U, 0xF84B0268U, 0x1265C21BU, 0xB7245065U, 0x6A638C57U, 0xCF221E29U,
+        0x250CDE5AU, 0x804D4C24U, 0xF4BD284DU, 0x51FCBA33U, 0xBBD27A40U, 0x1E93E83EU,
+        0x5232B292U, 0xF77320ECU, 0x1D5DE09FU, 0xB81C72E1U, 0xCCEC1688U, 0x69AD84F6U,
+        0x83834485U, 0x26C2D6FBU, 0x1AC1F1DDU, 0xBF8063A3U, 0x55AEA3D0U, 0xF0EF31AEU,
+        0x841F55C7U, 0x215EC7B9U, 0xCB7007CAU, 0x6E3195B4U, 0x2290CF18U, 0x87D15D66U,
+        0x6DFF9D15U, 0xC8BE0F6BU, 0xBC4E6B02U, 0x190FF97CU, 0xF321390FU, 0x5660AB71U,
+        0x4C42F79AU, 0xE90365E4U, 0x032DA597U, 0xA66C37E9U, 0xD29C5380U, 0x77DDC1FEU,
+        0x9DF3018DU, 0x38B293F3U, 0x7413C95FU, 0xD1525B21U, 0x3B7C9B52U, 0x9E3D092CU,
+        0xEACD6D45U, 0x4F8CFF3BU, 0xA5A23F48U, 0x00E3AD36U, 0x3CE08A10U, 0x99A1186EU,
+        0x738FD81DU, 0xD6CE4A63U, 0xA23E2E0AU, 0x077FBC74U, 0xED517C07U, 0x4810EE79U,
+        0x04B1B4D5U, 0xA1F026ABU, 0x4BDEE6D8U, 0xEE9F74A6U, 0x9A6F10CFU, 0x3F2E82B1U,
+        0xD50042C2U, 0x7041D0BCU, 0xAD060C8EU, 0x08479EF0U, 0xE2695E83U, 0x4728CCFDU,
+        0x33D8A894U, 0x96993AEAU, 0x7CB7FA99U, 0xD9F668E7U, 0x9557324BU, 0x3016A035U,
+        0xDA386046U, 0x7F79F238U, 0x0B899651U, 0xAEC8042FU, 0x44E6C45CU, 0xE1A75622U,
+        0xDDA47104U, 0x78E5E37AU, 0x92CB2309U, 0x378AB177U, 0x437AD51EU, 0xE63B4760U,
+        0x0C158713U, 0xA954156DU, 0xE5F54FC1U, 0x40B4DDBFU, 0xAA9A1DCCU, 0x0FDB8FB2U,
+        0x7B2BEBDBU, 0xDE6A79A5U, 0x3444B9D6U, 0x91052BA8U
+    },
+    {
+        0x00000000U, 0xDD45AAB8U, 0xBF672381U, 0x62228939U, 0x7B2231F3U, 0xA6679B4BU,
+        0xC4451272U, 0x1900B8CAU, 0xF64463E6U, 0x2B01C95EU, 0x49234067U, 0x9466EADFU,
+        0x8D665215U, 0x5023F8ADU, 0x32017194U, 0xEF44DB2CU, 0xE964B13DU, 0x34211B85U,
+        0x560392BCU, 0x8B463804U, 0x924680CEU, 0x4F032A76U, 0x2D21A34FU, 0xF06409F7U,
+        0x1F20D2DBU, 0xC2657863U, 0xA047F15AU, 0x7D025BE2U, 0x6402E328U, 0xB9474990U,
+        0xDB65C0A9U, 0x06206A11U, 0xD725148BU, 0x0A60BE33U, 0x6842370AU, 0xB5079DB2U,
+        0xAC072578U, 0x71428FC0U, 0x136006F9U, 0xCE25AC41U, 0x2161776DU, 0xFC24DDD5U,
+        0x9E0654ECU, 0x4343FE54U, 0x5A43469EU, 0x8706EC26U, 0xE524651FU, 0x3861CFA7U,
+        0x3E41A5B6U, 0xE3040F0EU, 0x81268637U, 0x5C632C8FU, 0x45639445U, 0x98263EFDU,
+        0xFA04B7C4U, 0x27411D7CU, 0xC805C650U, 0x15406CE8U, 0x7762E5D1U, 0xAA274F69U,
+        0xB327F7A3U, 0x6E625D1BU, 0x0C40D422U, 0xD1057E9AU, 0xABA65FE7U, 0x76E3F55FU,
+        0x14C17C66U, 0xC984D6DEU, 0xD0846E14U, 0x0DC1C4ACU, 0x6FE34D95U, 0xB2A6E72DU,
+        0x5DE23C01U, 0x80A796B9U, 0xE2851F80U, 0x3FC0B538U, 0x26C00DF2U, 0xFB85A74AU,
+        0x99A72E73U, 0x44E284CBU, 0x42C2EEDAU, 0x9F874462U, 0xFDA5CD5BU, 0x20E067E3U,
+        0x39E0DF29U, 0xE4A57591U, 0x8687FCA8U, 0x5BC25610U, 0xB4868D3CU, 0x69C32784U,
+        0x0BE1AEBDU, 0xD6A40405U, 0xCFA4BCCFU, 0x12E11677U, 0x70C39F4EU, 0xAD8635F6U,
+        0x7C834B6CU, 0xA1C6E1D4U, 0xC3E468EDU, 0x1EA1C255U, 0x07A17A9FU, 0xDAE4D027U,
+        0xB8C6591EU, 0x6583F3A6U, 0x8AC7288AU, 0x57828232U, 0x35A00B0BU, 0xE8E5A1B3U,
+        0xF1E51979U, 0x2CA0B3C1U, 0x4E823AF8U, 0x93C79040U, 0x95E7FA51U, 0x48A250E9U,
+        0x2A80D9D0U, 0xF7C57368U, 0xEEC5CBA2U, 0x3380611AU, 0x51A2E823U, 0x8CE7429BU,
+        0x63A399B7U, 0xBEE6330FU, 0xDCC4BA36U, 0x0181108EU, 0x1881A844U, 0xC5C402FCU,
+        0xA7E68BC5U, 0x7AA3217DU, 0x52A0C93FU, 0x8FE56387U, 0xEDC7EABEU, 0x30824006U,
+        0x2982F8CCU, 0xF4C75274U, 0x96E5DB4DU, 0x4BA071F5U, 0xA4E4AAD9U, 0x79A10061U,
+        0x1B838958U, 0xC6C623E0U, 0xDFC69B2AU, 0x02833192U, 0x60A1B8ABU, 0xBDE41213U,
+        0xBBC47802U, 0x6681D2BAU, 0x04A35B83U, 0xD9E6F13BU, 0xC0E649F1U, 0x1DA3E349U,
+        0x7F816A70U, 0xA2C4C0C8U, 0x4D801BE4U, 0x90C5B15CU, 0xF2E73865U, 0x2FA292DDU,
+        0x36A22A17U, 0xEBE780AFU, 0x89C50996U, 0x5480A32EU, 0x8585DDB4U, 0x58C0770CU,
+        0x3AE2FE35U, 0xE7A7548DU, 0xFEA7EC47U, 0x23E246FFU, 0x41C0CFC6U, 0x9C85657EU,
+        0x73C1BE52U, 0xAE8414EAU, 0xCCA69DD3U, 0x11E3376BU, 0x08E38FA1U, 0xD5A62519U,
+        0xB784AC20U, 0x6AC10698U, 0x6CE16C89U, 0xB1A4C631U, 0xD3864F08U, 0x0EC3E5B0U,
+        0x17C35D7AU, 0xCA86F7C2U, 0xA8A47EFBU, 0x75E1D443U, 0x9AA50F6FU, 0x47E0A5D7U,
+        0x25C22CEEU, 0xF8878656U, 0xE1873E9CU, 0x3CC29424U, 0x5EE01D1DU, 0x83A5B7A5U,
+        0xF90696D8U, 0x24433C60U, 0x4661B559U, 0x9B241FE1U, 0x8224A72BU, 0x5F610D93U,
+        0x3D4384AAU, 0xE0062E12U, 0x0F42F53EU, 0xD2075F86U, 0xB025D6BFU, 0x6D607C07U,
+        0x7460C4CDU, 0xA9256E75U, 0xCB07E74CU, 0x16424DF4U, 0x106227E5U, 0xCD278D5DU,
+        0xAF050464U, 0x7240AEDCU, 0x6B401616U, 0xB605BCAEU, 0xD4273597U, 0x09629F2FU,
+        0xE6264403U, 0x3B63EEBBU, 0x59416782U, 0x8404CD3AU, 0x9D0475F0U, 0x4041DF48U,
+        0x22635671U, 0xFF26FCC9U, 0x2E238253U, 0xF36628EBU, 0x9144A1D2U, 0x4C010B6AU,
+        0x5501B3A0U, 0x88441918U, 0xEA669021U, 0x37233A99U, 0xD867E1B5U, 0x05224B0DU,
+        0x6700C234U, 0xBA45688CU, 0xA345D046U, 0x7E007AFEU, 0x1C22F3C7U, 0xC167597FU,
+        0xC747336EU, 0x1A0299D6U, 0x782010EFU, 0xA565BA57U, 0xBC65029DU, 0x6120A825U,
+        0x0302211CU, 0xDE478BA4U, 0x31035088U, 0xEC46FA30U, 0x8E647309U, 0x5321D9B1U,
+        0x4A21617BU, 0x9764CBC3U, 0xF54642FAU, 0x2803E842U
+    }
+};
+#else
+const uint32_t crc32c_table[4][256] =
+{
+    {
+        0x00000000U, 0x03836BF2U, 0xF7703BE1U, 0xF4F35013U, 0x1F979AC7U, 0x1C14F135U,
+        0xE8E7A126U, 0xEB64CAD4U, 0xCF58D98AU, 0xCCDBB278U, 0x3828E26BU, 0x3BAB8999U,
+        0xD0CF434DU, 0xD34C28BFU, 0x27BF78ACU, 0x243C135EU, 0x6FC75E10U, 0x6C4435E2U,
+        0x98B765F1U, 0x9B340E03U, 0x7050C4D7U, 0x73D3AF25U, 0x8720FF36U, 0x84A394C4U,
+        0xA09F879AU, 0xA31CEC68U, 0x57EFBC7BU, 0x546CD789U, 0xBF081D5DU, 0xBC8B76AFU,
+        0x487826BCU, 0x4BFB4D4EU, 0xDE8EBD20U, 0xDD0DD6D2U, 0x29FE86C1U, 0x2A7DED33U,
+        0xC11927E7U, 0xC29A4C15U, 0x36691C06U, 0x35EA77F4U, 0x11D664AAU, 0x12550F58U,
+        0xE6A65F4BU, 0xE52534B9U, 0x0E41FE6DU, 0x0DC2959FU, 0xF931C58CU, 0xFAB2AE7EU,
+        0xB149E330U, 0xB2CA88C2U, 0x4639D8D1U, 0x45BAB323U, 0xAEDE79F7U, 0xAD5D1205U,
+        0x59AE4216U, 0x5A2D29E4U, 0x7E113ABAU, 0x7D925148U, 0x8961015BU, 0x8AE26AA9U,
+        0x6186A07DU, 0x6205CB8FU, 0x96F69B9CU, 0x9575F06EU, 0xBC1D7B41U, 0xBF9E10B3U,
+        0x4B6D40A0U, 0x48EE2B52U, 0xA38AE186U, 0xA0098A74U, 0x54FADA67U, 0x5779B195U,
+        0x7345A2CBU, 0x70C6C939U, 0x8435992AU, 0x87B6F2D8U, 0x6CD2380CU, 0x6F5153FEU,
+        0x9BA203EDU, 0x9821681FU, 0xD3DA2551U, 0xD0594EA3U, 0x24AA1EB0U, 0x27297542U,
+        0xCC4DBF96U, 0xCFCED464U, 0x3B3D8477U, 0x38BEEF85U, 0x1C82FCDBU, 0x1F019729U,
+        0xEBF2C73AU, 0xE871ACC8U, 0x0315661CU, 0x00960DEEU, 0xF4655DFDU, 0xF7E6360FU,
+        0x6293C661U, 0x6110AD93U, 0x95E3FD80U, 0x96609672U, 0x7D045CA6U, 0x7E873754U,
+        0x8A746747U, 0x89F70CB5U, 0xADCB1FEBU, 0xAE487419U, 0x5ABB240AU, 0x59384FF8U,
+        0xB25C852CU, 0xB1DFEEDEU, 0x452CBECDU, 0x46AFD53FU, 0x0D549871U, 0x0ED7F383U,
+        0xFA24A390U, 0xF9A7C862U, 0x12C302B6U, 0x11406944U, 0xE5B33957U, 0xE63052A5U,
+        0xC20C41FBU, 0xC18F2A09U, 0x357C7A1AU, 0x36FF11E8U, 0xDD9BDB3CU, 0xDE18B0CEU,
+        0x2AEBE0DDU, 0x29688B2FU, 0x783BF682U, 0x7BB89D70U, 0x8F4BCD63U, 0x8CC8A691U,
+        0x67AC6C45U, 0x642F07B7U, 0x90DC57A4U, 0x935F3C56U, 0xB7632F08U, 0xB4E044FAU,
+        0x401314E9U, 0x43907F1BU, 0xA8F4B5CFU, 0xAB77DE3DU, 0x5F848E2EU, 0x5C07E5DCU,
+        0x17FCA892U, 0x147FC360U, 0xE08C9373U, 0xE30FF881U, 0x086B3255U, 0x0BE859A7U,
+        0xFF1B09B4U, 0xFC986246U, 0xD8A47118U, 0xDB271AEAU, 0x2FD44AF9U, 0x2C57210BU,
+        0xC733EBDFU, 0xC4B0802DU, 0x3043D03EU, 0x33C0BBCCU, 0xA6B54BA2U, 0xA5362050U,
+        0x51C57043U, 0x52461BB1U, 0xB922D165U, 0xBAA1BA97U, 0x4E52EA84U, 0x4DD18176U,
+        0x69ED9228U, 0x6A6EF9DAU, 0x9E9DA9C9U, 0x9D1EC23BU, 0x767A08EFU, 0x75F9631DU,
+        0x810A330EU, 0x828958FCU, 0xC97215B2U, 0xCAF17E40U, 0x3E022E53U, 0x3D8145A1U,
+        0xD6E58F75U, 0xD566E487U, 0x2195B494U, 0x2216DF66U, 0x062ACC38U, 0x05A9A7CAU,
+        0xF15AF7D9U, 0xF2D99C2BU, 0x19BD56FFU, 0x1A3E3D0DU, 0xEECD6D1EU, 0xED4E06ECU,
+        0xC4268DC3U, 0xC7A5E631U, 0x3356B622U, 0x30D5DDD0U, 0xDBB11704U, 0xD8327CF6U,
+        0x2CC12CE5U, 0x2F424717U, 0x0B7E5449U, 0x08FD3FBBU, 0xFC0E6FA8U, 0xFF8D045AU,
+        0x14E9CE8EU, 0x176AA57CU, 0xE399F56FU, 0xE01A9E9DU, 0xABE1D3D3U, 0xA862B821U,
+        0x5C91E832U, 0x5F1283C0U, 0xB4764914U, 0xB7F522E6U, 0x430672F5U, 0x40851907U,
+        0x64B90A59U, 0x673A61ABU, 0x93C931B8U, 0x904A5A4AU, 0x7B2E909EU, 0x78ADFB6CU,
+        0x8C5EAB7FU, 0x8FDDC08DU, 0x1AA830E3U, 0x192B5B11U, 0xEDD80B02U, 0xEE5B60F0U,
+        0x053FAA24U, 0x06BCC1D6U, 0xF24F91C5U, 0xF1CCFA37U, 0xD5F0E969U, 0xD673829BU,
+        0x2280D288U, 0x2103B97AU, 0xCA6773AEU, 0xC9E4185CU, 0x3D17484FU, 0x3E9423BDU,
+        0x756F6EF3U, 0x76EC0501U, 0x821F5512U, 0x819C3EE0U, 0x6AF8F434U, 0x697B9FC6U,
+        0x9D88CFD5U, 0x9E0BA427U, 0xBA37B779U, 0xB9B4DC8BU, 0x4D478C98U, 0x4EC4E76AU,
+        0xA5A02DBEU, 0xA623464CU, 0x52D0165FU, 0x51537DADU
+    },
+    {
+        0x00000000U, 0x7798A213U, 0xEE304527U, 0x99A8E734U, 0xDC618A4EU, 0xABF9285DU,
+        0x3251CF69U, 0x45C96D7AU, 0xB8C3149DU, 0xCF5BB68EU, 0x56F351BAU, 0x216BF3A9U,
+        0x64A29ED3U, 0x133A3CC0U, 0x8A92DBF4U, 0xFD0A79E7U, 0x81F1C53FU, 0xF669672CU,
+        0x6FC18018U, 0x1859220BU, 0x5D904F71U, 0x2A08ED62U, 0xB3A00A56U, 0xC438A845U,
+        0x3932D1A2U, 0x4EAA73B1U, 0xD7029485U, 0xA09A3696U, 0xE5535BECU, 0x92CBF9FFU,
+        0x0B631ECBU, 0x7CFBBCD8U, 0x02E38B7FU, 0x757B296CU, 0xECD3CE58U, 0x9B4B6C4BU,
+        0xDE820131U, 0xA91AA322U, 0x30B24416U, 0x472AE605U, 0xBA209FE2U, 0xCDB83DF1U,
+        0x5410DAC5U, 0x238878D6U, 0x664115ACU, 0x11D9B7BFU, 0x8871508BU, 0xFFE9F298U,
+        0x83124E40U, 0xF48AEC53U, 0x6D220B67U, 0x1ABAA974U, 0x5F73C40EU, 0x28EB661DU,
+        0xB1438129U, 0xC6DB233AU, 0x3BD15ADDU, 0x4C49F8CEU, 0xD5E11FFAU, 0xA279BDE9U,
+        0xE7B0D093U, 0x90287280U, 0x098095B4U, 0x7E1837A7U, 0x04C617FFU, 0x735EB5ECU,
+        0xEAF652D8U, 0x9D6EF0CBU, 0xD8A79DB1U, 0xAF3F3FA2U, 0x3697D896U, 0x410F7A85U,
+        0xBC050362U, 0xCB9DA171U, 0x52354645U, 0x25ADE456U, 0x6064892CU, 0x17FC2B3FU,
+        0x8E54CC0BU, 0xF9CC6E18U, 0x8537D2C0U, 0xF2AF70D3U, 0x6B0797E7U, 0x1C9F35F4U,
+        0x5956588EU, 0x2ECEFA9DU, 0xB7661DA9U, 0xC0FEBFBAU, 0x3DF4C65DU, 0x4A6C644EU,
+        0xD3C4837AU, 0xA45C2169U, 0xE1954C13U, 0x960DEE00U, 0x0FA50934U, 0x783DAB27U,
+        0x06259C80U, 0x71BD3E93U, 0xE815D9A7U, 0x9F8D7BB4U, 0xDA4416CEU, 0xADDCB4DDU,
+        0x347453E9U, 0x43ECF1FAU, 0xBEE6881DU, 0xC97E2A0EU, 0x50D6CD3AU, 0x274E6F29U,
+        0x62870253U, 0x151FA040U, 0x8CB74774U, 0xFB2FE567U, 0x87D459BFU, 0xF04CFBACU,
+        0x69E41C98U, 0x1E7CBE8BU, 0x5BB5D3F1U, 0x2C2D71E2U, 0xB58596D6U, 0xC21D34C5U,
+        0x3F174D22U, 0x488FEF31U, 0xD1270805U, 0xA6BFAA16U, 0xE376C76CU, 0x94EE657FU,
+        0x0D46824BU, 0x7ADE2058U, 0xF9FAC3FBU, 0x8E6261E8U, 0x17CA86DCU, 0x605224CFU,
+        0x259B49B5U, 0x5203EBA6U, 0xCBAB0C92U, 0xBC33AE81U, 0x4139D766U, 0x36A17575U,
+        0xAF099241U, 0xD8913052U, 0x9D585D28U, 0xEAC0FF3BU, 0x7368180FU, 0x04F0BA1CU,
+        0x780B06C4U, 0x0F93A4D7U, 0x963B43E3U, 0xE1A3E1F0U, 0xA46A8C8AU, 0xD3F22E99U,
+        0x4A5AC9ADU, 0x3DC26BBEU, 0xC0C81259U, 0xB750B04AU, 0x2EF8577EU, 0x5960F56DU,
+        0x1CA99817U, 0x6B313A04U, 0xF299DD30U, 0x85017F23U, 0xFB194884U, 0x8C81EA97U,
+        0x15290DA3U, 0x62B1AFB0U, 0x2778C2CAU, 0x50E060D9U, 0xC94887EDU, 0xBED025FEU,
+        0x43DA5C19U, 0x3442FE0AU, 0xADEA193EU, 0xDA72BB2DU, 0x9FBBD657U, 0xE8237444U,
+        0x718B9370U, 0x06133163U, 0x7AE88DBBU, 0x0D702FA8U, 0x94D8C89CU, 0xE3406A8FU,
+        0xA68907F5U, 0xD111A5E6U, 0x48B942D2U, 0x3F21E0C1U, 0xC22B9926U, 0xB5B33B35U,
+        0x2C1BDC01U, 0x5B837E12U, 0x1E4A1368U, 0x69D2B17BU, 0xF07A564FU, 0x87E2F45CU,
+        0xFD3CD404U, 0x8AA47617U, 0x130C9123U, 0x64943330U, 0x215D5E4AU, 0x56C5FC59U,
+        0xCF6D1B6DU, 0xB8F5B97EU, 0x45FFC099U, 0x3267628AU, 0xABCF85BEU, 0xDC5727ADU,
+        0x999E4AD7U, 0xEE06E8C4U, 0x77AE0FF0U, 0x0036ADE3U, 0x7CCD113BU, 0x0B55B328U,
+        0x92FD541CU, 0xE565F60FU, 0xA0AC9B75U, 0xD7343966U, 0x4E9CDE52U, 0x39047C41U,
+        0xC40E05A6U, 0xB396A7B5U, 0x2A3E4081U, 0x5DA6E292U, 0x186F8FE8U, 0x6FF72DFBU,
+        0xF65FCACFU, 0x81C768DCU, 0xFFDF5F7BU, 0x8847FD68U, 0x11EF1A5CU, 0x6677B84FU,
+        0x23BED535U, 0x54267726U, 0xCD8E9012U, 0xBA163201U, 0x471C4BE6U, 0x3084E9F5U,
+        0xA92C0EC1U, 0xDEB4ACD2U, 0x9B7DC1A8U, 0xECE563BBU, 0x754D848FU, 0x02D5269CU,
+        0x7E2E9A44U, 0x09B63857U, 0x901EDF63U, 0xE7867D70U, 0xA24F100AU, 0xD5D7B219U,
+        0x4C7F552DU, 0x3BE7F73EU, 0xC6ED8ED9U, 0xB1752CCAU, 0x28DDCBFEU, 0x5F4569EDU,
+        0x1A8C0497U, 0x6D14A684U, 0xF4BC41B0U, 0x8324E3A3U
+    },
+    {
+        0x00000000U, 0x7E9241A5U, 0x0D526F4FU, 0x73C02EEAU, 0x1AA4DE9EU, 0x64369F3BU,
+        0x17F6B1D1U, 0x6964F074U, 0xC53E5138U, 0xBBAC109DU, 0xC86C3E77U, 0xB6FE7FD2U,
+        0xDF9A8FA6U, 0xA108CE03U, 0xD2C8E0E9U, 0xAC5AA14CU, 0x8A7DA270U, 0xF4EFE3D5U,
+        0x872FCD3FU, 0xF9BD8C9AU, 0x90D97CEEU, 0xEE4B3D4BU, 0x9D8B13A1U, 0xE3195204U,
+        0x4F43F348U, 0x31D1B2EDU, 0x42119C07U, 0x3C83DDA2U, 0x55E72DD6U, 0x2B756C73U,
+        0x58B54299U, 0x2627033CU, 0x14FB44E1U, 0x6A690544U, 0x19A92BAEU, 0x673B6A0BU,
+        0x0E5F9A7FU, 0x70CDDBDAU, 0x030DF530U, 0x7D9FB495U, 0xD1C515D9U, 0xAF57547CU,
+        0xDC977A96U, 0xA2053B33U, 0xCB61CB47U, 0xB5F38AE2U, 0xC633A408U, 0xB8A1E5ADU,
+        0x9E86E691U, 0xE014A734U, 0x93D489DEU, 0xED46C87BU, 0x8422380FU, 0xFAB079AAU,
+        0x89705740U, 0xF7E216E5U, 0x5BB8B7A9U, 0x252AF60CU, 0x56EAD8E6U, 0x28789943U,
+        0x411C6937U, 0x3F8E2892U, 0x4C4E0678U, 0x32DC47DDU, 0xD98065C7U, 0xA7122462U,
+        0xD4D20A88U, 0xAA404B2DU, 0xC324BB59U, 0xBDB6FAFCU, 0xCE76D416U, 0xB0E495B3U,
+        0x1CBE34FFU, 0x622C755AU, 0x11EC5BB0U, 0x6F7E1A15U, 0x061AEA61U, 0x7888ABC4U,
+        0x0B48852EU, 0x75DAC48BU, 0x53FDC7B7U, 0x2D6F8612U, 0x5EAFA8F8U, 0x203DE95DU,
+        0x49591929U, 0x37CB588CU, 0x440B7666U, 0x3A9937C3U, 0x96C3968FU, 0xE851D72AU,
+        0x9B91F9C0U, 0xE503B865U, 0x8C674811U, 0xF2F509B4U, 0x8135275EU, 0xFFA766FBU,
+        0xCD7B2126U, 0xB3E96083U, 0xC0294E69U, 0xBEBB0FCCU, 0xD7DFFFB8U, 0xA94DBE1DU,
+        0xDA8D90F7U, 0xA41FD152U, 0x0845701EU, 0x76D731BBU, 0x05171F51U, 0x7B855EF4U,
+        0x12E1AE80U, 0x6C73EF25U, 0x1FB3C1CFU, 0x6121806AU, 0x47068356U, 0x3994C2F3U,
+        0x4A54EC19U, 0x34C6ADBCU, 0x5DA25DC8U, 0x23301C6DU, 0x50F03287U, 0x2E627322U,
+        0x8238D26EU, 0xFCAA93CBU, 0x8F6ABD21U, 0xF1F8FC84U, 0x989C0CF0U, 0xE60E4D55U,
+        0x95CE63BFU, 0xEB5C221AU, 0x4377278BU, 0x3DE5662EU, 0x4E2548C4U, 0x30B70961U,
+        0x59D3F915U, 0x2741B8B0U, 0x5481965AU, 0x2A13D7FFU, 0x864976B3U, 0xF8DB3716U,
+        0x8B1B19FCU, 0xF5895859U, 0x9CEDA82DU, 0xE27FE988U, 0x91BFC762U, 0xEF2D86C7U,
+        0xC90A85FBU, 0xB798C45EU, 0xC458EAB4U, 0xBACAAB11U, 0xD3AE5B65U, 0xAD3C1AC0U,
+        0xDEFC342AU, 0xA06E758FU, 0x0C34D4C3U, 0x72A69566U, 0x0166BB8CU, 0x7FF4FA29U,
+        0x16900A5DU, 0x68024BF8U, 0x1BC26512U, 0x655024B7U, 0x578C636AU, 0x291E22CFU,
+        0x5ADE0C25U, 0x244C4D80U, 0x4D28BDF4U, 0x33BAFC51U, 0x407AD2BBU, 0x3EE8931EU,
+        0x92B23252U, 0xEC2073F7U, 0x9FE05D1DU, 0xE1721CB8U, 0x8816ECCCU, 0xF684AD69U,
+        0x85448383U, 0xFBD6C226U, 0xDDF1C11AU, 0xA36380BFU, 0xD0A3AE55U, 0xAE31EFF0U,
+        0xC7551F84U, 0xB9C75E21U, 0xCA0770CBU, 0xB495316EU, 0x18CF9022U, 0x665DD187U,
+        0x159DFF6DU, 0x6B0FBEC8U, 0x026B4EBCU, 0x7CF90F19U, 0x0F3921F3U, 0x71AB6056U,
+        0x9AF7424CU, 0xE46503E9U, 0x97A52D03U, 0xE9376CA6U, 0x80539CD2U, 0xFEC1DD77U,
+        0x8D01F39DU, 0xF393B238U, 0x5FC91374U, 0x215B52D1U, 0x529B7C3BU, 0x2C093D9EU,
+        0x456DCDEAU, 0x3BFF8C4FU, 0x483FA2A5U, 0x36ADE300U, 0x108AE03CU, 0x6E18A199U,
+        0x1DD88F73U, 0x634ACED6U, 0x0A2E3EA2U, 0x74BC7F07U, 0x077C51EDU, 0x79EE1048U,
+        0xD5B4B104U, 0xAB26F0A1U, 0xD8E6DE4BU, 0xA6749FEEU, 0xCF106F9AU, 0xB1822E3FU,
+        0xC24200D5U, 0xBCD04170U, 0x8E0C06ADU, 0xF09E4708U, 0x835E69E2U, 0xFDCC2847U,
+        0x94A8D833U, 0xEA3A9996U, 0x99FAB77CU, 0xE768F6D9U, 0x4B325795U, 0x35A01630U,
+        0x466038DAU, 0x38F2797FU, 0x5196890BU, 0x2F04C8AEU, 0x5CC4E644U, 0x2256A7E1U,
+        0x0471A4DDU, 0x7AE3E578U, 0x0923CB92U, 0x77B18A37U, 0x1ED57A43U, 0x60473BE6U,
+        0x1387150CU, 0x6D1554A9U, 0xC14FF5E5U, 0xBFDDB440U, 0xCC1D9AAAU, 0xB28FDB0FU,
+        0xDBEB2B7BU, 0xA5796ADEU, 0xD6B94434U, 0xA82B0591U
+    },
+    {
+        0x00000000U, 0xB8AA45DDU, 0x812367BFU, 0x39892262U, 0xF331227BU, 0x4B9B67A6U,
+        0x721245C4U, 0xCAB80019U, 0xE66344F6U, 0x5EC9012BU, 0x67402349U, 0xDFEA6694U,
+        0x1552668DU, 0xADF82350U, 0x94710132U, 0x2CDB44EFU, 0x3DB164E9U, 0x851B2134U,
+        0xBC920356U, 0x0438468BU, 0xCE804692U, 0x762A034FU, 0x4FA3212DU, 0xF70964F0U,
+        0xDBD2201FU, 0x637865C2U, 0x5AF147A0U, 0xE25B027DU, 0x28E30264U, 0x904947B9U,
+        0xA9C065DBU, 0x116A2006U, 0x8B1425D7U, 0x33BE600AU, 0x0A374268U, 0xB29D07B5U,
+        0x782507ACU, 0xC08F4271U, 0xF9066013U, 0x41AC25CEU, 0x6D776121U, 0xD5DD24FCU,
+        0xEC54069EU, 0x54FE4343U, 0x9E46435AU, 0x26EC0687U, 0x1F6524E5U, 0xA7CF6138U,
+        0xB6A5413EU, 0x0E0F04E3U, 0x37862681U, 0x8F2C635CU, 0x45946345U, 0xFD3E2698U,
+        0xC4B704FAU, 0x7C1D4127U, 0x50C605C8U, 0xE86C4015U, 0xD1E56277U, 0x694F27AAU,
+        0xA3F727B3U, 0x1B5D626EU, 0x22D4400CU, 0x9A7E05D1U, 0xE75FA6ABU, 0x5FF5E376U,
+        0x667CC114U, 0xDED684C9U, 0x146E84D0U, 0xACC4C10DU, 0x954DE36FU, 0x2DE7A6B2U,
+        0x013CE25DU, 0xB996A780U, 0x801F85E2U, 0x38B5C03FU, 0xF20DC026U, 0x4AA785FBU,
+        0x732EA799U, 0xCB84E244U, 0xDAEEC242U, 0x6244879FU, 0x5BCDA5FDU, 0xE367E020U,
+        0x29DFE039U, 0x9175A5E4U, 0xA8FC8786U, 0x1056C25BU, 0x3C8D86B4U, 0x8427C369U,
+        0xBDAEE10BU, 0x0504A4D6U, 0xCFBCA4CFU, 0x7716E112U, 0x4E9FC370U, 0xF63586ADU,
+        0x6C4B837CU, 0xD4E1C6A1U, 0xED68E4C3U, 0x55C2A11EU, 0x9F7AA107U, 0x27D0E4DAU,
+        0x1E59C6B8U, 0xA6F38365U, 0x8A28C78AU, 0x32828257U, 0x0B0BA035U, 0xB3A1E5E8U,
+        0x7919E5F1U, 0xC1B3A02CU, 0xF83A824EU, 0x4090C793U, 0x51FAE795U, 0xE950A248U,
+        0xD0D9802AU, 0x6873C5F7U, 0xA2CBC5EEU, 0x1A618033U, 0x23E8A251U, 0x9B42E78CU,
+        0xB799A363U, 0x0F33E6BEU, 0x36BAC4DCU, 0x8E108101U, 0x44A88118U, 0xFC02C4C5U,
+        0xC58BE6A7U, 0x7D21A37AU, 0x3FC9A052U, 0x8763E58FU, 0xBEEAC7EDU, 0x06408230U,
+        0xCCF88229U, 0x7452C7F4U, 0x4DDBE596U, 0xF571A04BU, 0xD9AAE4A4U, 0x6100A179U,
+        0x5889831BU, 0xE023C6C6U, 0x2A9BC6DFU, 0x92318302U, 0xABB8A160U, 0x1312E4BDU,
+        0x0278C4BBU, 0xBAD28166U, 0x835BA304U, 0x3BF1E6D9U, 0xF149E6C0U, 0x49E3A31DU,
+        0x706A817FU, 0xC8C0C4A2U, 0xE41B804DU, 0x5CB1C590U, 0x6538E7F2U, 0xDD92A22FU,
+        0x172AA236U, 0xAF80E7EBU, 0x9609C589U, 0x2EA38054U, 0xB4DD8585U, 0x0C77C058U,
+        0x35FEE23AU, 0x8D54A7E7U, 0x47ECA7FEU, 0xFF46E223U, 0xC6CFC041U, 0x7E65859CU,
+        0x52BEC173U, 0xEA1484AEU, 0xD39DA6CCU, 0x6B37E311U, 0xA18FE308U, 0x1925A6D5U,
+        0x20AC84B7U, 0x9806C16AU, 0x896CE16CU, 0x31C6A4B1U, 0x084F86D3U, 0xB0E5C30EU,
+        0x7A5DC317U, 0xC2F786CAU, 0xFB7EA4A8U, 0x43D4E175U, 0x6F0FA59AU, 0xD7A5E047U,
+        0xEE2CC225U, 0x568687F8U, 0x9C3E87E1U, 0x2494C23CU, 0x1D1DE05EU, 0xA5B7A583U,
+        0xD89606F9U, 0x603C4324U, 0x59B56146U, 0xE11F249BU, 0x2BA72482U, 0x930D615FU,
+        0xAA84433DU, 0x122E06E0U, 0x3EF5420FU, 0x865F07D2U, 0xBFD625B0U, 0x077C606DU,
+        0xCDC46074U, 0x756E25A9U, 0x4CE707CBU, 0xF44D4216U, 0xE5276210U, 0x5D8D27CDU,
+        0x640405AFU, 0xDCAE4072U, 0x1616406BU, 0xAEBC05B6U, 0x973527D4U, 0x2F9F6209U,
+        0x034426E6U, 0xBBEE633BU, 0x82674159U, 0x3ACD0484U, 0xF075049DU, 0x48DF4140U,
+        0x71566322U, 0xC9FC26FFU, 0x5382232EU, 0xEB2866F3U, 0xD2A14491U, 0x6A0B014CU,
+        0xA0B30155U, 0x18194488U, 0x219066EAU, 0x993A2337U, 0xB5E167D8U, 0x0D4B2205U,
+        0x34C20067U, 0x8C6845BAU, 0x46D045A3U, 0xFE7A007EU, 0xC7F3221CU, 0x7F5967C1U,
+        0x6E3347C7U, 0xD699021AU, 0xEF102078U, 0x57BA65A5U, 0x9D0265BCU, 0x25A82061U,
+        0x1C210203U, 0xA48B47DEU, 0x88500331U, 0x30FA46ECU, 0x0973648EU, 0xB1D92153U,
+        0x7B61214AU, 0xC3CB6497U, 0xFA4246F5U, 0x42E80328U
+    }
+};
+#endif
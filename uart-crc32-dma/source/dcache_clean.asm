@@ -0,0 +1,49 @@
+;-------------------------------------------------------------------------------
+; dcache_clean.asm
+;
+; Clean the whole L1 data cache by set/way, so dirty lines reach RAM before
+; _cacheDisable_() is called. HALCoGen only provides invalidate operations,
+; and the RAM region is write-back (MPU region 3), so disabling the cache
+; without this would drop pending writes, including the stack.
+;-------------------------------------------------------------------------------
+
+    .text
+    .arm
+
+;-------------------------------------------------------------------------------
+; Clean Data Cache
+
+        .def  _dCacheClean_
+        .asmfunc
+
+_dCacheClean_
+
+        stmfd sp!, {r4-r5}
+        mov   r0,  #0
+        mcr   p15, #2, r0, c0, c0, #0   ; select the L1 data cache (CSSELR)
+        isb
+        mrc   p15, #1, r0, c0, c0, #0   ; read its geometry (CCSIDR)
+        and   r1,  r0,  #7
+        add   r1,  r1,  #4              ; set field shift = log2(line bytes)
+        movw  r2,  #0x3FF
+        and   r2,  r2,  r0, lsr #3      ; ways - 1
+        clz   r3,  r2                   ; way field shift
+        movw  r12, #0x7FFF
+        and   r12, r12, r0, lsr #13     ; sets - 1
+
+dCacheCleanWay
+        mov   r4,  r12
+
+dCacheCleanSet
+        mov   r5,  r2,  lsl r3
+        orr   r5,  r5,  r4, lsl r1
+        mcr   p15, #0, r5, c7, c10, #2  ; clean line by set/way (DCCSW)
+        subs  r4,  r4,  #1
+        bge   dCacheCleanSet
+        subs  r2,  r2,  #1
+        bge   dCacheCleanWay
+
+        dsb
+        ldmfd sp!, {r4-r5}
+        bx    lr
+        .endasmfunc
@@ -0,0 +1,163 @@
+/**
+ ******************************************************************************
+ * @file    flow_control.c
+ * @brief   Back-Pressure Flow Control from RX Ring Occupancy
+ *
+ * @details
+ *   - The project has no HALCoGen GIO driver (HL_gio.c), so the RTS pin is
+ *     driven through the port registers directly.
+ ******************************************************************************
+ */
+#include "flow_control.h"
+#include "HL_reg_gio.h"
+
+/* GCR0 bit that takes the GIO module out of reset */
+#define FLOW_GIO_RESET          0x00000001U
+
+static sciBASE_t *s_sci = NULL;
+static uint32_t s_high = 0U;
+static uint32_t s_low = 0U;
+static uint32_t s_stopped = 0U;
+static uint32_t s_stopMs = 0U;
+/* Binary output in flight, and an XON/XOFF held back meanwhile */
+static uint32_t s_binary = 0U;
+static uint32_t s_deferred = 0U;
+static flowStats_t s_stats;
+
+static void flowSignal(uint32_t stop);
+
+/**
+ * @brief  Sets the watermarks and lets the host send.
+ * @param  sci        Port the host sends on.
+ * @param  highWater  Occupancy at which the host is stopped.
+ * @param  lowWater   Occupancy at which it may send again, below highWater.
+ */
+void flowInit(sciBASE_t *sci, uint32_t highWater, uint32_t lowWater)
+{
+    s_sci = sci;
+    s_high = highWater;
+    s_low = lowWater;
+    s_stopped = 0U;
+    s_binary = 0U;
+    s_deferred = 0U;
+    flowResetStats();
+
+#if (FLOW_USE_RTS == 1)
+    gioREG->GCR0 = FLOW_GIO_RESET;
+    FLOW_RTS_PORT->DCLR = (uint32)1U << FLOW_RTS_PIN;
+    FLOW_RTS_PORT->DIR |= (uint32)1U << FLOW_RTS_PIN;
+#endif
+}
+
+/**
+ * @brief  Stops or releases the host according to the ring occupancy.
+ *         Does nothing before flowInit().
+ * @param  occupancy  Unread bytes in the RX ring.
+ * @param  nowMs      Free-running millisecond count.
+ */
+void flowService(uint32_t occupancy, uint32_t nowMs)
+{
+    /* Output before flowInit() passes through */
+    if (s_sci == NULL)
+    {
+        return;
+    }
+    if (occupancy > s_stats.peak)
+    {
+        s_stats.peak = occupancy;
+    }
+
+    if ((s_stopped == 0U) && (occupancy >= s_high))
+    {
+        flowSignal(1U);
+        s_stopped = 1U;
+        s_stopMs = nowMs;
+        s_stats.stops++;
+    }
+    else if ((s_stopped != 0U) && (occupancy <= s_low))
+    {
+        flowSignal(0U);
+        s_stopped = 0U;
+        s_stats.stallMs += nowMs - s_stopMs;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/**
+ * @brief  Marks binary output in flight, where the host cannot tell
+ *         XON/XOFF from data. Until it ends they are held back; the end
+ *         sends the state the host has to be in, if it changed.
+ * @param  active  Non-zero before the first binary byte, 0 after the last.
+ */
+void flowBinary(uint32_t active)
+{
+    s_binary = active;
+    if ((active == 0U) && (s_deferred != 0U))
+    {
+        s_deferred = 0U;
+        flowSignal(s_stopped);
+    }
+}
+
+/**
+ * @brief  Returns non-zero while the host is stopped.
+ */
+uint32_t flowStopped(void)
+{
+    return s_stopped;
+}
+
+/**
+ * @brief  Copies the counters.
+ * @param  nowMs  Free-running millisecond count, for a stop in progress.
+ */
+void flowGetStats(uint32_t nowMs, flowStats_t *stats)
+{
+    *stats = s_stats;
+    if (s_stopped != 0U)
+    {
+        stats->stallMs += nowMs - s_stopMs;
+    }
+}
+
+/**
+ * @brief  Zeroes the counters.
+ */
+void flowResetStats(void)
+{
+    s_stats.stops = 0U;
+    s_stats.stallMs = 0U;
+    s_stats.peak = 0U;
+}
+
+/**
+ * @brief  Sends XOFF/XON and drives RTS.
+ * @param  stop  Non-zero to stop the host.
+ */
+static void flowSignal(uint32_t stop)
+{
+#if (FLOW_USE_XONXOFF == 1)
+    if (s_binary != 0U)
+    {
+        s_deferred = 1U;
+    }
+    else
+    {
+        while ((s_sci->FLR & 0x4) == 4); /* wait until busy */
+        sciSendByte(s_sci, (stop != 0U) ? FLOW_XOFF : FLOW_XON);
+    }
+#endif
+#if (FLOW_USE_RTS == 1)
+    if (stop != 0U)
+    {
+        FLOW_RTS_PORT->DSET = (uint32)1U << FLOW_RTS_PIN;
+    }
+    else
+    {
+        FLOW_RTS_PORT->DCLR = (uint32)1U << FLOW_RTS_PIN;
+    }
+#endif
+}
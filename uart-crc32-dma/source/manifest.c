@@ -0,0 +1,259 @@
+/**
+ ******************************************************************************
+ * @file    manifest.c
+ * @brief   Block CRC32 Manifest of a Window
+ *
+ * @details
+ *   - All CRC values here are finalized (xorout applied), which makes the
+ *     combination rule free of init terms; the running value of an empty
+ *     window is 0.
+ *   - Polynomials are kept reflected, as in the table kernels: bit 31 is
+ *     x^0, so "1" is 0x80000000 and "x" is 0x40000000.
+ *   - Tree nodes are not stored. manifestNode() folds the blocks under a
+ *     node, one multiply each, so the root costs MANIFEST_MAX_BLOCKS
+ *     multiplies at most; a query is a command, never on the data path.
+ ******************************************************************************
+ */
+#include "manifest.h"
+#include "crc32_kernel.h"
+
+#define MANIFEST_ONE            0x80000000U
+
+static uint32_t s_blocks[MANIFEST_MAX_BLOCKS];
+static uint32_t s_count = 0U;
+static uint32_t s_blockLen = 0U;
+/* x^(8 * s_blockLen) mod P */
+static uint32_t s_shift = 0U;
+/* Bytes of the current block so far, and the running CRC at its start */
+static uint32_t s_fill = 0U;
+static uint32_t s_start = 0U;
+/* Length of the last closed block, shorter than s_blockLen at the end */
+static uint32_t s_lastLen = 0U;
+
+static uint32_t manifestMultiply(uint32_t a, uint32_t b);
+static uint32_t manifestShift(uint32_t len);
+static void manifestMerge(void);
+
+/**
+ * @brief  Starts a new window.
+ * @param  blockLen  Block length, a power of two from MANIFEST_MIN_LEN to
+ *                   MANIFEST_MAX_LEN, or 0 for no manifest.
+ * @return Non-zero if blockLen is valid.
+ */
+uint32_t manifestStart(uint32_t blockLen)
+{
+    if ((blockLen != 0U)
+     && ((blockLen < MANIFEST_MIN_LEN) || (blockLen > MANIFEST_MAX_LEN)
+      || ((blockLen & (blockLen - 1U)) != 0U)))
+    {
+        return 0U;
+    }
+    if (blockLen != s_blockLen)
+    {
+        s_blockLen = blockLen;
+        s_shift = (blockLen != 0U) ? manifestShift(blockLen) : 0U;
+    }
+    s_count = 0U;
+    s_fill = 0U;
+    s_start = 0U;
+    s_lastLen = 0U;
+    return 1U;
+}
+
+/**
+ * @brief  Bytes of a span that fit in the current block.
+ * @param  len  Span length.
+ * @return len, or less if the span crosses a block boundary.
+ */
+uint32_t manifestSpan(uint32_t len)
+{
+    uint32_t room = s_blockLen - s_fill;
+
+    return ((s_blockLen != 0U) && (len > room)) ? room : len;
+}
+
+/**
+ * @brief  Accounts for bytes added to the running CRC.
+ * @param  len  Bytes added, at most manifestSpan() of them.
+ * @param  crc  Finalized running CRC32 of the window after them.
+ */
+void manifestAdvance(uint32_t len, uint32_t crc)
+{
+    if (s_blockLen == 0U)
+    {
+        return;
+    }
+    s_fill += len;
+    if (s_fill == s_blockLen)
+    {
+        s_blocks[s_count] = crc ^ manifestMultiply(s_shift, s_start);
+        s_count++;
+        s_fill = 0U;
+        s_start = crc;
+        s_lastLen = s_blockLen;
+        if (s_count == MANIFEST_MAX_BLOCKS)
+        {
+            manifestMerge();
+        }
+    }
+}
+
+/**
+ * @brief  Closes the last, partial block.
+ * @param  crc       Finalized running CRC32 of the whole window.
+ * @param  blockLen  Block length in use.
+ * @return Number of blocks, 0 without a manifest.
+ */
+uint32_t manifestFinish(uint32_t crc, uint32_t *blockLen)
+{
+    *blockLen = s_blockLen;
+    /* The table is never left full, there is room for this one */
+    if ((s_blockLen != 0U) && (s_fill != 0U))
+    {
+        s_blocks[s_count] = crc ^ manifestMultiply(manifestShift(s_fill), s_start);
+        s_count++;
+        s_lastLen = s_fill;
+        s_fill = 0U;
+        s_start = crc;
+    }
+    return s_count;
+}
+
+/**
+ * @brief  Finalized CRC32 of a block, after manifestFinish().
+ */
+uint32_t manifestBlock(uint32_t index)
+{
+    return s_blocks[index];
+}
+
+/**
+ * @brief  CRC32 of A followed by B, from the CRC32 of each part.
+ * @param  crcA  Finalized CRC32 of A, 0 if A is empty.
+ * @param  crcB  Finalized CRC32 of B.
+ * @param  lenB  Length of B in bytes.
+ */
+uint32_t manifestCombine(uint32_t crcA, uint32_t crcB, uint32_t lenB)
+{
+    return manifestMultiply(manifestShift(lenB), crcA) ^ crcB;
+}
+
+/**
+ * @brief  Height of the tree over the blocks, after manifestFinish(): the
+ *         level of its root, 0 for a single block.
+ */
+uint32_t manifestLevels(void)
+{
+    uint32_t levels = 0U;
+
+    while ((s_count > 1U) && ((1U << levels) < s_count))
+    {
+        levels++;
+    }
+    return levels;
+}
+
+/**
+ * @brief  A node of the tree over the blocks, after manifestFinish().
+ *         Node (level, index) spans blocks index * 2^level up to the next
+ *         node, or the last block, and its CRC is the finalized CRC32 of
+ *         those bytes, combined from the block CRCs.
+ * @param  level   0 for the blocks, manifestLevels() for the root.
+ * @param  index   Node within the level, from the start of the window.
+ * @param  offset  Window offset of the first byte.
+ * @param  len     Bytes spanned.
+ * @param  crc     Finalized CRC32 of the span.
+ * @return Non-zero if the node exists.
+ */
+uint32_t manifestNode(uint32_t level, uint32_t index, uint32_t *offset, uint32_t *len, uint32_t *crc)
+{
+    uint32_t first;
+    uint32_t end;
+    uint32_t i;
+
+    if ((level > manifestLevels()) || (index >= s_count) || ((index << level) >= s_count))
+    {
+        return 0U;
+    }
+    first = index << level;
+    end = ((s_count - first) > (1U << level)) ? (first + (1U << level)) : s_count;
+
+    *offset = first * s_blockLen;
+    *len = 0U;
+    *crc = 0U;
+    for (i = first; i < end; i++)
+    {
+        if ((i + 1U) < s_count)
+        {
+            *crc = manifestMultiply(s_shift, *crc) ^ s_blocks[i];
+            *len += s_blockLen;
+        }
+        else
+        {
+            *crc = manifestMultiply(manifestShift(s_lastLen), *crc) ^ s_blocks[i];
+            *len += s_lastLen;
+        }
+    }
+    return 1U;
+}
+
+/**
+ * @brief  Product of two polynomials modulo the CRC32 polynomial.
+ */
+static uint32_t manifestMultiply(uint32_t a, uint32_t b)
+{
+    uint32_t m = MANIFEST_ONE;
+    uint32_t p = 0U;
+
+    while (m != 0U)
+    {
+        if ((a & m) != 0U)
+        {
+            p ^= b;
+        }
+        b = ((b & 1U) != 0U) ? ((b >> 1U) ^ CRC32_POLYNOMIAL_REFL) : (b >> 1U);
+        m >>= 1U;
+    }
+    return p;
+}
+
+/**
+ * @brief  x^(8 * len) modulo the CRC32 polynomial, by square and multiply.
+ */
+static uint32_t manifestShift(uint32_t len)
+{
+    uint32_t bits = len;
+    uint32_t p = MANIFEST_ONE;
+    /* x^8, squared for every bit of len */
+    uint32_t sq = MANIFEST_ONE >> 8U;
+
+    while (bits != 0U)
+    {
+        if ((bits & 1U) != 0U)
+        {
+            p = manifestMultiply(p, sq);
+        }
+        sq = manifestMultiply(sq, sq);
+        bits >>= 1U;
+    }
+    return p;
+}
+
+/**
+ * @brief  Halves the full table by merging neighbouring blocks and doubles
+ *         the block length. Called right after a block boundary, which is
+ *         also a boundary of the doubled blocks.
+ */
+static void manifestMerge(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < (MANIFEST_MAX_BLOCKS / 2U); i++)
+    {
+        s_blocks[i] = manifestMultiply(s_shift, s_blocks[2U * i]) ^ s_blocks[(2U * i) + 1U];
+    }
+    s_count = MANIFEST_MAX_BLOCKS / 2U;
+    s_blockLen *= 2U;
+    s_lastLen = s_blockLen;
+    s_shift = manifestMultiply(s_shift, s_shift);
+}
@@ -0,0 +1,249 @@
+/**
+ ******************************************************************************
+ * @file    psa_offload.c
+ * @brief   Hardware Signature of Received Blocks (MCRC PSA, fed by DMA)
+ *
+ * @details
+ *   - The project has no HALCoGen CRC driver (HL_crc.c), so the few
+ *     registers needed are programmed directly: CTRL2 selects full-CPU mode
+ *     for channel 1, CTRL0 CH1_PSA_SWREST clears the signature.
+ *   - One DMA block transfer per block: 64-bit elements, source
+ *     incrementing over the block, destination fixed on PSA_SIGREGL1.
+ *
+ * @note
+ *   - The MCRC is a slave of the CPU interconnect, so both sides of the
+ *     transfer use DMA port A.
+ *   - psaOffloadFeed() needs an 8-byte aligned block. Blocks of the ring
+ *     start wherever the previous window ended and may wrap around its
+ *     end, so the caller sends those through psaOffloadFeedRing(), which
+ *     stages them in the aligned s_tail first.
+ ******************************************************************************
+ */
+#include "psa_offload.h"
+#include "HL_crc.h"
+#include "HL_sys_dma.h"
+#include <string.h>
+
+/* CTRL0 bit that holds the channel 1 PSA signature in reset */
+#define PSA_CTRL0_CH1_SWREST    0x00000001U
+/* CTRL2 channel 1 mode field */
+#define PSA_CTRL2_CH1_MODE      0x00000003U
+
+#pragma DATA_ALIGN(s_tail, 8)
+static uint8_t s_tail[PSA_TAIL_MAX];
+static volatile uint32_t s_busy = 0U;
+static uint32_t s_blocks = 0U;
+static uint64 s_blockSig = 0U;
+
+/* Feedback (taps 0x1B) of the top nibble after four shifts */
+static const uint8_t s_psaNibble[16U] =
+{
+    0x00U, 0x1BU, 0x36U, 0x2DU, 0x6CU, 0x77U, 0x5AU, 0x41U,
+    0xD8U, 0xC3U, 0xEEU, 0xF5U, 0xB4U, 0xAFU, 0x82U, 0x99U
+};
+
+static uint64 psaOffloadRead(void);
+
+/**
+ * @brief  Puts CRC channel 1 into full-CPU mode and clears its signature.
+ */
+void psaOffloadInit(void)
+{
+    crcREG1->CTRL2 = (crcREG1->CTRL2 & ~PSA_CTRL2_CH1_MODE) | CRC_FULL_CPU;
+    dmaEnable();
+    psaOffloadReset();
+}
+
+/**
+ * @brief  Waits for a pending block and clears the signature, starting a
+ *         new transfer.
+ */
+void psaOffloadReset(void)
+{
+    while (psaOffloadBusy() != 0U)
+    {
+        /* Wait */
+    }
+    crcREG1->CTRL0 |= PSA_CTRL0_CH1_SWREST;
+    crcREG1->CTRL0 &= ~PSA_CTRL0_CH1_SWREST;
+
+    s_blocks = 0U;
+    s_blockSig = 0U;
+}
+
+/**
+ * @brief  Returns non-zero while a block is being fed. Picks up the block
+ *         signature once the DMA block transfer has completed.
+ */
+uint32_t psaOffloadBusy(void)
+{
+    if ((s_busy != 0U) && (dmaGetInterruptStatus(PSA_DMA_CH, BTC) == TRUE))
+    {
+        dmaREG->BTCFLAG = (uint32)1U << PSA_DMA_CH;
+        s_blockSig = psaOffloadRead();
+        s_blocks++;
+        s_busy = 0U;
+    }
+    return s_busy;
+}
+
+/**
+ * @brief  Starts feeding a block into the PSA. Waits for the previous one.
+ * @param  block  8-byte aligned data.
+ * @param  len    Length in bytes, a multiple of 8.
+ */
+void psaOffloadFeed(const uint8_t *block, uint32_t len)
+{
+    g_dmaCTRL pkt;
+
+    while (psaOffloadBusy() != 0U)
+    {
+        /* Wait */
+    }
+
+    pkt.SADD      = (uint32_t)block;
+    pkt.DADD      = (uint32_t)&crcREG1->PSA_SIGREGL1;
+    pkt.CHCTRL    = 0U;
+    pkt.FRCNT     = 1U;
+    pkt.ELCNT     = len / 8U;
+    pkt.ELDOFFSET = 0U;
+    pkt.ELSOFFSET = 0U;
+    pkt.FRDOFFSET = 0U;
+    pkt.FRSOFFSET = 0U;
+    pkt.PORTASGN  = PORTA_READ_PORTA_WRITE;
+    pkt.RDSIZE    = ACCESS_64_BIT;
+    pkt.WRSIZE    = ACCESS_64_BIT;
+    pkt.TTYPE     = BLOCK_TRANSFER;
+    pkt.ADDMODERD = ADDR_INC1;
+    pkt.ADDMODEWR = ADDR_FIXED;
+    pkt.AUTOINIT  = AUTOINIT_OFF;
+
+    dmaREG->BTCFLAG = (uint32)1U << PSA_DMA_CH;
+    dmaSetCtrlPacket(PSA_DMA_CH, pkt);
+    s_busy = 1U;
+    dmaSetChEnable(PSA_DMA_CH, DMA_SW);
+}
+
+/**
+ * @brief  Feeds the last bytes of a transfer, zero padded to 64 bits.
+ * @param  data  Bytes, any alignment.
+ * @param  len   Length, at most PSA_TAIL_MAX. Nothing is fed for 0.
+ */
+void psaOffloadFeedTail(const uint8_t *data, uint32_t len)
+{
+    uint32_t padded = (len + 7U) & ~7U;
+
+    if ((len == 0U) || (len > PSA_TAIL_MAX))
+    {
+        return;
+    }
+    while (psaOffloadBusy() != 0U)
+    {
+        /* Wait */
+    }
+    memcpy(s_tail, data, len);
+    memset(&s_tail[len], 0, padded - len);
+    psaOffloadFeed(s_tail, padded);
+}
+
+/**
+ * @brief  Feeds bytes of a power-of-two ring through the staging buffer,
+ *         for spans that are not 8-byte aligned or wrap around the end.
+ * @param  ring   Ring base.
+ * @param  mask   Ring size - 1.
+ * @param  start  Ring index of the first byte.
+ * @param  len    Length, at most PSA_TAIL_MAX, zero padded to 64 bits.
+ *                Nothing is fed for 0.
+ */
+void psaOffloadFeedRing(const uint8_t *ring, uint32_t mask, uint32_t start, uint32_t len)
+{
+    uint32_t padded = (len + 7U) & ~7U;
+    uint32_t first = (mask + 1U) - start;
+
+    if ((len == 0U) || (len > PSA_TAIL_MAX))
+    {
+        return;
+    }
+    while (psaOffloadBusy() != 0U)
+    {
+        /* Wait */
+    }
+    if (first > len)
+    {
+        first = len;
+    }
+    memcpy(s_tail, &ring[start], first);
+    memcpy(&s_tail[first], ring, len - first);
+    memset(&s_tail[len], 0, padded - len);
+    psaOffloadFeed(s_tail, padded);
+}
+
+/**
+ * @brief  Signature over everything fed since the last reset. Waits for a
+ *         pending block.
+ */
+uint64 psaOffloadSignature(void)
+{
+    while (psaOffloadBusy() != 0U)
+    {
+        /* Wait */
+    }
+    return psaOffloadRead();
+}
+
+/**
+ * @brief  Signature after the last completed block.
+ */
+uint64 psaOffloadBlockSignature(void)
+{
+    (void)psaOffloadBusy();
+    return s_blockSig;
+}
+
+/**
+ * @brief  Blocks (including a padded tail) signed since the last reset.
+ */
+uint32_t psaOffloadBlocks(void)
+{
+    (void)psaOffloadBusy();
+    return s_blocks;
+}
+
+/**
+ * @brief  Software model of the PSA compression.
+ * @param  sig   Signature to continue from (0 after a reset).
+ * @param  data  Bytes, taken as big-endian 64-bit words.
+ * @param  len   Length in bytes, a multiple of 8.
+ * @return Updated signature.
+ */
+uint64 psaSoftwareSign(uint64 sig, const uint8_t *data, uint32_t len)
+{
+    uint64 word;
+    uint32_t i;
+
+    while (len >= 8U)
+    {
+        word = 0U;
+        for (i = 0U; i < 8U; i++)
+        {
+            word = (word << 8U) | (uint64)data[i];
+        }
+        sig ^= word;
+        for (i = 0U; i < 16U; i++)
+        {
+            sig = (sig << 4U) ^ (uint64)s_psaNibble[sig >> 60U];
+        }
+        data += 8U;
+        len -= 8U;
+    }
+    return sig;
+}
+
+/**
+ * @brief  Reads the channel 1 signature. On the BE32 device the L register
+ *         holds the upper half (as in HALCoGen's crcGetPSASig()).
+ */
+static uint64 psaOffloadRead(void)
+{
+    return ((uint64)crcREG1->PSA_SIGREGL1 << 32U) | (uint64)crcREG1->PSA_SIGREGH1;
+}
@@ -0,0 +1,108 @@
+/**
+ ******************************************************************************
+ * @file    trace.c
+ * @brief   Timestamped Event Trace in RAM
+ *
+ * @details
+ *   - s_head counts every record ever claimed; record n lives in slot
+ *     n % TRACE_DEPTH. The ring holds min(s_head, TRACE_DEPTH) records.
+ *   - A record is the time stamp, then (event << 24) | arg.
+ ******************************************************************************
+ */
+#include "trace.h"
+
+#if (TRACE_ENABLE == 1)
+
+#include "HL_reg_rti.h"
+#include <stdio.h>
+
+#define TRACE_MASK              (TRACE_DEPTH - 1U)
+#define TRACE_ARG_MASK          0x00FFFFFFU
+
+typedef struct
+{
+    uint32_t time;
+    uint32_t info;
+} traceRecord_t;
+
+static traceRecord_t s_ring[TRACE_DEPTH];
+static volatile uint32_t s_head = 0U;
+static volatile uint32_t s_paused = 0U;
+
+/* trace_reserve.asm: returns *head and increments it, atomically */
+extern uint32_t traceReserve(volatile uint32_t *head);
+
+static void traceSend(sciBASE_t *sci, uint32_t value);
+
+/**
+ * @brief  Appends a record. Safe from interrupt handlers and the main loop.
+ * @param  event  TRACE_* event.
+ * @param  arg    Argument, the low 24 bits are kept.
+ */
+void traceRecord(uint32_t event, uint32_t arg)
+{
+    traceRecord_t *rec;
+
+    if (s_paused != 0U)
+    {
+        return;
+    }
+    rec = &s_ring[traceReserve(&s_head) & TRACE_MASK];
+    rec->time = rtiREG1->CNT[0U].FRCx;
+    rec->info = (event << 24U) | (arg & TRACE_ARG_MASK);
+}
+
+/**
+ * @brief  Drops all records.
+ */
+void traceClear(void)
+{
+    s_head = 0U;
+}
+
+/**
+ * @brief  Sends the records, oldest first, and clears the ring. Records
+ *         are not taken while the dump runs.
+ * @param  sci  Port used for the dump (polling).
+ */
+void traceDump(sciBASE_t *sci)
+{
+    char line[40];
+    uint32_t head;
+    uint32_t count;
+    uint32_t i;
+    uint32_t k;
+
+    s_paused = 1U;
+    head = s_head;
+    count = (head < TRACE_DEPTH) ? head : TRACE_DEPTH;
+
+    sprintf(line, "TRACE %lu %lu\r\n", (unsigned long)count, (unsigned long)TRACE_TICK_HZ);
+    for (k = 0U; line[k] != '\0'; k++)
+    {
+        sciSendByte(sci, (uint8)line[k]);
+    }
+    for (i = head - count; i != head; i++)
+    {
+        traceSend(sci, s_ring[i & TRACE_MASK].time);
+        traceSend(sci, s_ring[i & TRACE_MASK].info);
+    }
+
+    s_head = 0U;
+    s_paused = 0U;
+}
+
+/**
+ * @brief  Sends a word as four bytes, most significant first.
+ */
+static void traceSend(sciBASE_t *sci, uint32_t value)
+{
+    uint32_t shift;
+
+    for (shift = 32U; shift > 0U; shift -= 8U)
+    {
+        sciSendByte(sci, (uint8)(value >> (shift - 8U)));
+    }
+}
+
+#endif
@@ -0,0 +1,28 @@
+;-------------------------------------------------------------------------------
+; trace_reserve.asm
+;
+; Claims a trace slot: returns the head index and increments it in one
+; LDREX/STREX sequence. An interrupt handler that claims a slot in between
+; clears the exclusive monitor with its own STREX, so the interrupted claim
+; retries instead of taking the same slot.
+;-------------------------------------------------------------------------------
+
+    .text
+    .arm
+
+;-------------------------------------------------------------------------------
+; uint32_t traceReserve(volatile uint32_t *head)
+
+        .def  traceReserve
+        .asmfunc
+
+traceReserve
+
+        ldrex r1,  [r0]
+        add   r2,  r1,  #1
+        strex r3,  r2,  [r0]
+        cmp   r3,  #0
+        bne   traceReserve
+        mov   r0,  r1
+        bx    lr
+        .endasmfunc
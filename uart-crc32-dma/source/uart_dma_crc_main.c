@@ -1,23 +1,74 @@
 /**
  ******************************************************************************
  * @file    uart_crc32_dma_main.c
- * @brief   UART CRC32 Calculation with 5-Second Window (DMA RX, SCI3)
+ * @brief   UART CRC32 Calculation with 5-Second Idle Timeout (DMA RX Ring, SCI3)
  *
  * @details
- *   - Receives UART data on SCI3 using DMA (1 byte at a time, re-armed after each byte).
- *   - Buffers all received bytes and updates CRC32 incrementally.
- *   - After 5 seconds of idle, sends the CRC32 value via UART TX (polling).
+ *   - Receives UART data on SCI3 into a circular DMA ring (AUTOINIT on).
+ *     The DMA channel is armed once and never stopped or re-armed. The
+ *     ring is the DMA ring backend of the shared core (common/,
+ *     core_cfg.h), which also provides the text output, the idle timeout,
+ *     the window stats and the report lines.
+ *   - The main loop derives the DMA write position from the channel's
+ *     current destination address and updates CRC32 from its read index
+ *     up to that position through the multi-checksum engine (checksum.c),
+ *     which computes every algorithm in CHECKSUM_SET in one pass. CRC32
+ *     alone goes straight to the burst kernel (crc32_kernel.c).
+ *   - With CRC_BENCHMARK set, the CRC kernels are measured with the PMU
+ *     and the checksum engine at startup (crc32_bench.c).
+ *   - With SELFTEST_ON_BOOT set, the SCI3 loopback self-benchmark runs the
+ *     ring backend before the ring is set up for the main loop
+ *     (selftest.c).
+ *   - With CRC_PSA_OFFLOAD set, every PSA_BLOCK_LEN bytes of the ring are
+ *     also fed by DMA into the CRC controller's PSA (psa_offload.c), and
+ *     the 64-bit signature is reported with (1) or instead of (2) the
+ *     software CRC32.
+ *   - After 5 seconds of idle, sends the CRC32 value and any other selected
+ *     checksum via UART TX (polling).
+ *   - With CMD_ENABLE set, a window that starts with ESC and holds a known
+ *     command line is executed instead of checksummed (command.h): reset,
+ *     stats, idle timeout, checksum preset, report format, benchmark and
+ *     self-test, without rebuilding. "ESC baud <rate>" negotiates a new
+ *     line rate with the host and falls back if it does not verify (baud.h).
+ *   - With FLOW_ENABLE set, the host is stopped with XOFF (and/or RTS, see
+ *     flow_control.h) when the ring fills past FLOW_HIGH_WATER and released
+ *     below FLOW_LOW_WATER, so it can send at full rate without overrunning
+ *     the consumer or the report path.
+ *   - "ESC manifest <len>" adds the CRC32 of every len-byte block of the
+ *     window to its report (manifest.h), taken from the running CRC32 at
+ *     the block boundaries without another pass over the data.
+ *     "ESC tree <len>" reports only the root of the hash tree over the same
+ *     blocks; "ESC node <level> <index>" then answers for any subtree of
+ *     the last window, until the next one receives data.
+ *   - With TRACE_ENABLE set in trace.h, interrupts, ring wraps and peaks,
+ *     SCI3 receive errors, checksum spans, window ends and report output
+ *     are recorded with RTI time stamps; "ESC trace" dumps them for
+ *     host/build/crcctl trace.
+ *   - With CAPTURE_ENABLE set in capture.h (a board with SDRAM on the
+ *     EMIF), "ESC capture on" also copies every data window into SDRAM by
+ *     DMA while the CRC32 of the image is kept from the window CRCs.
+ *     "ESC verify [preset]" then checksums the image at memory speed and
+ *     checks it against that CRC32, "ESC replay" sends it back, both
+ *     without a resend from the host.
  *   - If no data is received in a window, the last calculated CRC is resent.
+ *   - The DMA's BTC interrupt counts the ring wraps. A window in which the
+ *     DMA lapped the read index (the consumer fell a whole ring behind) is
+ *     reported as an overrun with the bytes lost instead of a CRC.
  *   - Prints a welcome message at startup.
  *   - Designed for LAUNCHXL2-570LC43 board, using FTDI USB-to-UART.
  *   - Baud rate: 26042 (set in HALCoGen and terminal).
  *   - DMA channel, request, and control packet are set up for SCI3 RX.
- *   - DMA is re-armed for every byte, so reception is continuous.
  *
  * @note
  *   - **Cache must be disabled** in the R5-MPU-PMU tab for DMA to work.
- *   - For best practice, reserve .dmaRAM in the linker file.
- *   - For reliable operation, use baud rates <= 50000.
+ *   - The ring (core_rx_ring) lives in its own .rxRing section (see
+ *     HL_sys_link.cmd).
+ *   - DMA writes stay 8-bit: every SCI3 RX request moves one byte as its
+ *     own frame, and the controller only packs elements within a frame.
+ *   - The consumer must drain the ring at least once every CORE_RX_RING_SIZE
+ *     character times, otherwise unread data is overwritten. consume_ring()
+ *     notices from the wrap count (coreRxRingWritten()) and skips to the
+ *     write position.
  *
  * @author  Nirmal Thyvalappil Muraleedharan
  * @date    07.08.2025
@@ -29,60 +80,132 @@
 #include "HL_sys_dma.h"
 #include "HL_sci.h"
 #include "HL_rti.h"
+#include "HL_sys_vim.h"
+#include "core.h"
+#include "core_rx.h"
+#include "crc32_kernel.h"
+#include "checksum.h"
+#include "crc32_bench.h"
+#include "selftest.h"
+#include "psa_offload.h"
+#include "command.h"
+#include "baud.h"
+#include "flow_control.h"
+#include "manifest.h"
+#include "trace.h"
+#include "capture.h"
 #include "string.h"
 #include <stdio.h>
 
 /* USER CODE END */
 
 /* USER CODE BEGIN (1) */
-#define DMA_SCI3_RX  DMA_REQ30
-#define SCI_SET_RX_DMA      (1<<17)
-#define SCI_SET_RX_DMA_ALL  (1<<18)
-
-#if ((__little_endian__ == 1) || (__LITTLE_ENDIAN__ == 1))
-#define SCI3_RX_ADDR ((uint32_t)(&(sciREG3->RD)))
-#else
-#define SCI3_RX_ADDR ((uint32_t)(&(sciREG3->RD)) + 3)
+/* The consumer reads core_rx_ring and coreRxRingWritePos() directly */
+#if (CORE_RX_BACKEND != CORE_RX_DMA_RING)
+#error "uart-crc32-dma needs CORE_RX_BACKEND CORE_RX_DMA_RING (core_cfg.h)"
 #endif
+#define USB_UART CORE_UART
+#define SCI_FLR_TX_EMPTY 0x00000800U
+#define SCI_VCLK_HZ ((uint32_t)(VCLK1_FREQ * 1000000.0F))
+/* Checksums computed over the ring in one pass (CHECKSUM_* mask, checksum.h),
+ * ESC preset changes it. CRC32 alone runs the burst kernel
+ * (crc32_kernel_r5.asm on the R5) */
+#define CHECKSUM_SET (CHECKSUM_CRC32)
+/* Set to 1 to print the CRC kernel benchmark at startup */
+#define CRC_BENCHMARK 0
+/* Set to 1 to run the loopback self-benchmark at startup */
+#define SELFTEST_ON_BOOT 0
+/* Hardware PSA signature of received blocks:
+ * 0 off, 1 alongside the software CRC32, 2 instead of it */
+#define CRC_PSA_OFFLOAD 0
+/* Set to 1 to accept in-band commands (ESC + line, see command.h) */
+#define CMD_ENABLE 1
+/* Set to 1 to throttle the host from the ring occupancy (flow_control.h) */
+#define FLOW_ENABLE 1
+
+/* VIM channel of the DMA block transfer complete interrupt, group A */
+#define DMA_BTCA_VIM 40U
+/* Stop the host at 3/4 full, release it at 1/4 */
+#define FLOW_HIGH_WATER ((CORE_RX_RING_SIZE * 3U) / 4U)
+#define FLOW_LOW_WATER  (CORE_RX_RING_SIZE / 4U)
 
-#define POLYNOMIAL 0x04C11DB7
-#define INIT_CRC 0xFFFFFFFF
-#define FINAL_XOR 0xFFFFFFFF
-#define IDLE_TIMEOUT_MS 5000U
-#define SCI_RECEIVE_LENGTH  1U
-#define USB_UART sciREG3
+/* Consumer read index into core_rx_ring */
+uint32_t rx_read = 0;
+uint32_t rx_count = 0;
+/* Unwrapped ring count (coreRxRingWritten()) rx_read stood at after the
+ * last consumer pass */
+uint32_t rx_taken = 0;
+/* Bytes of the window overwritten or skipped after the DMA lapped rx_read */
+uint32_t rx_lost = 0;
+/* Free-running 1 ms count, never reset */
+volatile uint32_t uptime_ms = 0;
 
-/* Byte for sciReceive function */
-volatile uint8_t rx_byte = 0;
-volatile uint32_t rx_count = 0;
-volatile uint32_t systemTick = 0;
+checksumCtx_t rx_sum;
+/* Runtime settings, changed by commands (and the idle timeout, coreSetTimeout()) */
+uint32_t checksum_set = CHECKSUM_SET;
+uint32_t report_format = CMD_FORMAT_TEXT;
+/* Manifest block length, 0 for none (ESC manifest, ESC tree) */
+uint32_t manifest_len = 0;
+/* Non-zero to report only the tree root instead of every block (ESC tree) */
+uint32_t manifest_tree = 0;
+/* Non-zero while windows go into the SDRAM image (ESC capture) */
+uint32_t capture_on = 0;
+/* Commands for ESC stats, the window counts are kept by the core */
+uint32_t stat_commands = 0;
+/* Windows reported as a ring overrun, for ESC stats */
+uint32_t stat_overruns = 0;
 
-uint32_t crc_value = INIT_CRC;
-/* 8 hex digits + null terminator */
-char crc_formatBuffer[9] = {0};
+#if (SELFTEST_ON_BOOT == 1)
+selftestSummary_t selftest_summary;
+#endif
+
+#if (CRC_PSA_OFFLOAD != 0)
+/* Ring index of the next block to feed into the PSA, trails rx_read */
+uint32_t psa_read = 0;
+#endif
 
-g_dmaCTRL g_dmaCTRLPKT;
+#if (TRACE_ENABLE == 1)
+/* Highest ring occupancy traced in the current window */
+uint32_t trace_peak = 0;
+#endif
 
 /* USER CODE END */
 
 /* USER CODE BEGIN (2) */
-void sciDisplayText(sciBASE_t *sci, unsigned char *text);
-uint8_t reflect8(uint8_t data);
-uint32_t reflect32(uint32_t data);
-uint32_t calc_crc32(uint8_t *data, uint32_t len);
-uint32_t update_crc32(uint32_t crc, uint8_t data);
-
-void debug_receivedData(sciBASE_t *sci, uint8_t *data, uint32_t len);
-void debug_byteCount(sciBASE_t *sci, uint32_t len);
-void sci3DisplayText(unsigned char *text);
 void setup_dma(void);
 void start_reception(void);
+void consume_ring(void);
+void report_window(void);
+void psa_service(void);
+void psa_report(void);
+void checksum_report(void);
+void overrun_report(void);
+void checksum_add(const uint8_t *data, uint32_t len);
+void checksum_restart(void);
+void manifest_report(void);
+void tree_report(uint32_t count, uint32_t len);
+void send_word(uint32_t value);
+uint32_t command_scan(uint32_t end);
+void command_reject(void);
+void command_execute(const cmd_t *cmd);
+void command_bench(void);
+void command_selftest(void);
+uint32_t command_baud(uint32_t rate);
+uint32_t command_verify(uint32_t set);
+void command_replay(void);
+uint32_t ring_receive(uint8_t *dst, uint32_t len, uint32_t timeout_ms);
+void wait_ms(uint32_t ms);
+void wait_tx_empty(void);
+void ring_wrap_isr(void);
+#if (TRACE_ENABLE == 1)
+void trace_service(uint32_t occupancy);
+#endif
 /* USER CODE END */
 
 
 /**
  * @brief  Main function: Initializes SCI3 and DMA, prints welcome message,
- *         and continuously echoes received characters using DMA RX and polling TX.
+ *         then consumes the DMA ring and reports CRC32 after each idle timeout.
  */
 void main(void)
 {
@@ -99,6 +222,7 @@ void main(void)
 
     /* Init RTI (for 1ms system tick) */
     rtiInit();
+    coreInit();
     /* Enable RTI compare interrupt and start counter */
     rtiEnableNotification(rtiREG1, rtiNOTIFICATION_COMPARE0);
     rtiStartCounter(rtiREG1, rtiCOUNTER_BLOCK0);
@@ -107,29 +231,48 @@ void main(void)
     /* Optional: Welcome message */
     sciDisplayText(USB_UART, (uint8_t *)"Sequential CRC Calculator with SCI1 Block Rx DMA Started...\r\n");
 
+#if (CRC_BENCHMARK == 1)
+    crc32Benchmark(USB_UART);
+    checksumBenchmark(USB_UART);
+#endif
+
+#if (SELFTEST_ON_BOOT == 1)
+    /* Runs the ring itself, so it has to finish before setup_dma() */
+    selftestSweep(&selftest_summary);
+#endif
+
+    checksum_restart();
+
     /* Setup DMA for SCI3 */
     setup_dma();
 
-    /* Start the receive */
-    start_reception();
+#if (CRC_PSA_OFFLOAD != 0)
+    psaOffloadInit();
+#endif
 
-    while(1)
+#if (CAPTURE_ENABLE == 1)
+    if (captureInit() == 0U)
     {
+        sciDisplayText(USB_UART, (uint8_t *)"No SDRAM on EMIF CS0, capture not available\r\n");
+    }
+#endif
 
-        /* Wait for byte */
-        if(dmaGetInterruptStatus(DMA_CH1, BTC) == TRUE)
-        {
-            /* Update CRC with each received byte */
-            crc_value = update_crc32(crc_value, rx_byte);
+    /* Start the receive, the channel runs from here on without CPU help */
+    start_reception();
 
-            /* Increment the received byte count */
-            rx_count++;
+#if (FLOW_ENABLE == 1)
+    flowInit(USB_UART, FLOW_HIGH_WATER, FLOW_LOW_WATER);
+#endif
 
-            /* Clear the BTC flag immediately! */
-            dmaREG->BTCFLAG = (1U << DMA_CH1);
+    while(1)
+    {
+        /* CRC everything the DMA has written since the last pass */
+        consume_ring();
 
-            /* Start next receive */
-            start_reception();
+        /* Reached the idle timeout without new data */
+        if (coreWindowDue() != 0U)
+        {
+            report_window();
         }
     }
 /* USER CODE END */
@@ -143,177 +286,994 @@ void main(void)
 void rtiNotification(rtiBASE_t *rtiREG, uint32 notification)
 {
     if (rtiREG == rtiREG1 && notification == rtiNOTIFICATION_COMPARE0) {
-        systemTick++;
-    }
-
-    /* Reached IDLE_TIMEOUT_MS and no data received */
-    if((IDLE_TIMEOUT_MS <= systemTick) && (0U == rx_count))
-    {
-        /* Formatting CRC and sending via UART */
-        sciDisplayText(USB_UART, (uint8_t *)"No Data Received, Last Calculated CRC in Hex is : 0x");
-        sciDisplayText(USB_UART, (unsigned char *)crc_formatBuffer);
-        sciDisplayText(USB_UART, (uint8_t *)"\r\n");
-        /* Reset the rti timer */
-        systemTick = 0;
-    }
-    /* Reached IDLE_TIMEOUT_MS and some data received */
-    else if((IDLE_TIMEOUT_MS <= systemTick) && (0U != rx_count))
-    {
-        debug_byteCount(USB_UART, rx_count);
-        /* Finalize the CRC */
-        crc_value = reflect32(crc_value) ^ FINAL_XOR;
-        /* Formatting CRC and sending via UART */
-        sciDisplayText(USB_UART, (uint8_t *)"Updated CRC in Hex is : 0x");
-        sprintf(crc_formatBuffer, "%08X", crc_value);  /* Format CRC as 8-digit upper case hex */
-        sciDisplayText(USB_UART, (unsigned char *)crc_formatBuffer);
-        sciDisplayText(USB_UART, (uint8_t *)"\r\n");
-        /* Reset the rti timer */
-        systemTick = 0;
-        /* Reset the rti timer */
+        coreTick();
+        uptime_ms++;
+    }
+}
+
+/**
+ * @brief  Updates the running CRC from the read index up to the DMA
+ *         write position, in at most two spans around the wrap. If the
+ *         DMA has written a whole ring or more since the last pass, the
+ *         unread bytes are gone: the window is marked lost and the read
+ *         index skips to the write position.
+ */
+void consume_ring(void)
+{
+    uint32_t written = coreRxRingWritten();
+    uint32_t write_pos = written & CORE_RX_RING_MASK;
+
+    if ((int32_t)(written - rx_taken) >= (int32_t)CORE_RX_RING_SIZE)
+    {
+        rx_lost += written - rx_taken;
+        rx_read = write_pos;
+#if (CRC_PSA_OFFLOAD != 0)
+        psa_read = rx_read;
+#endif
+        coreWindowRestart();
+    }
+
+#if (TRACE_ENABLE == 1)
+    trace_service((write_pos - rx_read) & CORE_RX_RING_MASK);
+#endif
+    while (rx_read != write_pos)
+    {
+        uint32_t end = (write_pos > rx_read) ? write_pos : CORE_RX_RING_SIZE;
+
+#if (CMD_ENABLE == 1)
+        /* Only the first byte of a window can start a command */
+        if (((rx_count == 0U) || (cmdCollecting() != 0U)) && (command_scan(end) != 0U))
+        {
+            /* A command may have restarted the ring */
+            written = coreRxRingWritten();
+            write_pos = written & CORE_RX_RING_MASK;
+            coreWindowRestart();
+            continue;
+        }
+#endif
+        checksum_add(&core_rx_ring[rx_read], end - rx_read);
+        rx_read = end & CORE_RX_RING_MASK;
+
+        /* New data restarts the idle timeout */
+        coreWindowRestart();
+    }
+    rx_taken = written;
+
+#if (CRC_PSA_OFFLOAD != 0)
+    psa_service();
+#endif
+    flow_service();
+}
+
+/**
+ * @brief  Stops or releases the host from the current ring occupancy.
+ *         Only called from the main loop, between characters it sends, so
+ *         XON/XOFF never land inside another character.
+ */
+void flow_service(void)
+{
+#if (FLOW_ENABLE == 1)
+#if (TRACE_ENABLE == 1)
+    uint32_t stopped = flowStopped();
+#endif
+
+    flowService((coreRxRingWritePos() - rx_read) & CORE_RX_RING_MASK, uptime_ms);
+#if (TRACE_ENABLE == 1)
+    if (flowStopped() != stopped)
+    {
+        TRACE(TRACE_FLOW, flowStopped());
+    }
+#endif
+#endif
+}
+
+#if (TRACE_ENABLE == 1)
+/**
+ * @brief  Traces SCI3 receive errors and new occupancy peaks of the ring
+ *         before a consumer pass.
+ * @param  occupancy  Unread bytes in the ring.
+ */
+void trace_service(uint32_t occupancy)
+{
+    uint32_t errors = sciREG3->FLR & ((uint32)SCI_FE_INT | (uint32)SCI_OE_INT | (uint32)SCI_PE_INT);
+
+    if (errors != 0U)
+    {
+        /* Write one to clear */
+        sciREG3->FLR = errors;
+        TRACE(TRACE_SCI_ERROR, errors >> 24U);
+    }
+    if (occupancy > trace_peak)
+    {
+        trace_peak = occupancy;
+        TRACE(TRACE_RING_PEAK, occupancy);
+    }
+}
+#endif
+
+/**
+ * @brief  DMA block transfer complete, group A: the ring wrapped. Counted
+ *         for the overrun check of consume_ring().
+ */
+#pragma CODE_STATE(ring_wrap_isr, 32)
+#pragma INTERRUPT(ring_wrap_isr, IRQ)
+void ring_wrap_isr(void)
+{
+    TRACE(TRACE_ISR_ENTER, TRACE_SRC_DMA);
+    /* Only the ring channel raises BTC on group A */
+    dmaREG->BTCFLAG = (uint32_t)1U << CORE_RX_DMA_CH;
+    coreRxRingWrapped();
+    TRACE(TRACE_DMA_BTC, CORE_RX_DMA_CH);
+    TRACE(TRACE_ISR_EXIT, TRACE_SRC_DMA);
+}
+
+#if (CRC_PSA_OFFLOAD != 0)
+/**
+ * @brief  Starts the PSA feed of the next whole block behind rx_read.
+ *         Windows start wherever the previous one ended, so a block that
+ *         is not 8-byte aligned or wraps the ring goes through the
+ *         staging copy of psaOffloadFeedRing().
+ */
+void psa_service(void)
+{
+    if ((psaOffloadBusy() == 0U)
+     && (((rx_read - psa_read) & CORE_RX_RING_MASK) >= PSA_BLOCK_LEN))
+    {
+        if (((psa_read & 7U) == 0U) && ((psa_read + PSA_BLOCK_LEN) <= CORE_RX_RING_SIZE))
+        {
+            psaOffloadFeed(&core_rx_ring[psa_read], PSA_BLOCK_LEN);
+        }
+        else
+        {
+            psaOffloadFeedRing(core_rx_ring, CORE_RX_RING_MASK, psa_read, PSA_BLOCK_LEN);
+        }
+        psa_read = (psa_read + PSA_BLOCK_LEN) & CORE_RX_RING_MASK;
+    }
+}
+
+/**
+ * @brief  Feeds the blocks still pending and the padded tail, prints the
+ *         signature of the window and resets the PSA for the next one.
+ */
+void psa_report(void)
+{
+    char msg[64];
+    uint64 sig;
+
+    while (((rx_read - psa_read) & CORE_RX_RING_MASK) >= PSA_BLOCK_LEN)
+    {
+        psa_service();
+    }
+    psaOffloadFeedRing(core_rx_ring, CORE_RX_RING_MASK, psa_read, (rx_read - psa_read) & CORE_RX_RING_MASK);
+    psa_read = rx_read;
+
+    sig = psaOffloadSignature();
+    if (report_format == CMD_FORMAT_TEXT)
+    {
+        sprintf(msg, "PSA signature: 0x%08lX%08lX (%lu blocks)\r\n",
+                (unsigned long)(sig >> 32U), (unsigned long)(sig & 0xFFFFFFFFU),
+                (unsigned long)psaOffloadBlocks());
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+    }
+    else if (report_format == CMD_FORMAT_COMPACT)
+    {
+        sprintf(msg, " psa=%08lX%08lX",
+                (unsigned long)(sig >> 32U), (unsigned long)(sig & 0xFFFFFFFFU));
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+    }
+    else
+    {
+        send_word((uint32_t)(sig >> 32U));
+        send_word((uint32_t)sig);
+    }
+    psaOffloadReset();
+}
+#endif
+
+/**
+ * @brief  Adds a span to the window.
+ */
+void checksum_add(const uint8_t *data, uint32_t len)
+{
+#if (CRC_PSA_OFFLOAD != 2)
+    uint32_t n;
+
+    /* The last window's blocks stay queryable (ESC node) until now */
+    if (rx_count == 0U)
+    {
+        (void)manifestStart(manifest_len);
+    }
+    rx_count += len;
+    /* Only written by the DMA; the out-of-line call keeps the compiler
+     * from caching ring contents across passes. With a manifest the span
+     * is cut at block boundaries, where the running CRC32 is needed. */
+    TRACE(TRACE_CRC_BEGIN, len);
+    while (len > 0U)
+    {
+        n = manifestSpan(len);
+#if (CAPTURE_ENABLE == 1)
+        /* Also cut at the end of the SDRAM; the copy runs during the CRC */
+        n = captureSpan(n);
+        captureCopy(data, n);
+#endif
+        checksumUpdate(&rx_sum, data, n);
+        manifestAdvance(n, rx_sum.crc32 ^ CRC32_XOROUT);
+#if (CAPTURE_ENABLE == 1)
+        captureAdvance(rx_sum.crc32 ^ CRC32_XOROUT);
+#endif
+        data += n;
+        len -= n;
+    }
+    TRACE(TRACE_CRC_END, 0U);
+#else
+    rx_count += len;
+#endif
+}
+
+/**
+ * @brief  Starts the checksums of a new window. The manifest and the
+ *         capture CRC are cut from the CRC32, so it is always computed
+ *         with one; the manifest itself restarts with the first data of
+ *         the window (checksum_add()).
+ */
+void checksum_restart(void)
+{
+    checksumInit(&rx_sum, ((manifest_len != 0U) || (capture_on != 0U))
+                          ? (checksum_set | CHECKSUM_CRC32) : checksum_set);
+}
+
+/**
+ * @brief  Sends the result of the current window and starts a new one.
+ *         Empty windows are only reported in the text format.
+ */
+void report_window(void)
+{
+    char msg[16];
+
+#if (CMD_ENABLE == 1)
+    /* A line still open at the timeout was data */
+    if (cmdCollecting() != 0U)
+    {
+        command_reject();
+    }
+#endif
+
+    coreStatsAdd(rx_count + rx_lost);
+
+    /* No data received */
+    if ((0U == rx_count) && (0U == rx_lost) && (report_format == CMD_FORMAT_TEXT))
+    {
+        coreReportEmpty();
+    }
+    /* Some data received */
+    else if ((0U != rx_count) || (0U != rx_lost))
+    {
+        TRACE(TRACE_WINDOW_END, rx_count);
+        if (report_format == CMD_FORMAT_TEXT)
+        {
+            debug_byteCount(USB_UART, rx_count);
+        }
+        else if (report_format == CMD_FORMAT_COMPACT)
+        {
+            sprintf(msg, "n=%lu", (unsigned long)rx_count);
+            sciDisplayText(USB_UART, (uint8_t *)msg);
+        }
+        else
+        {
+            send_word((rx_lost != 0U) ? (rx_count | CMD_RAW_OVERRUN) : rx_count);
+        }
+        if (rx_lost != 0U)
+        {
+            /* The checksums miss the lost bytes: none is reported */
+            overrun_report();
+        }
+        else
+        {
+#if (CRC_PSA_OFFLOAD != 0)
+            psa_report();
+#endif
+#if (CRC_PSA_OFFLOAD != 2)
+            checksum_report();
+            manifest_report();
+#endif
+        }
+#if ((CRC_PSA_OFFLOAD != 2) && (CAPTURE_ENABLE == 1))
+        captureWindowEnd();
+#endif
+        if (report_format == CMD_FORMAT_COMPACT)
+        {
+            sciDisplayText(USB_UART, (uint8_t *)"\r\n");
+        }
+        /* Reset the received byte count */
         rx_count = 0;
-        /* Reset the crc buffer */
-        crc_value = INIT_CRC;
+        rx_lost = 0;
+        /* Reset the checksum state */
+        checksum_restart();
+#if (TRACE_ENABLE == 1)
+        trace_peak = 0U;
+#endif
     }
     else
     {
         /* Do Nothing */
     }
+    /* Reset the rti timer */
+    coreWindowRestart();
 }
 
-/* Function used to send data through SCI buffer */
-void sciDisplayText(sciBASE_t *sci, unsigned char *text)
+/**
+ * @brief  Reports the bytes lost to a ring overrun in place of the
+ *         checksums of the window.
+ */
+void overrun_report(void)
 {
-    uint32 length = strlen((const char *)text);
+    char msg[48];
 
-    while(length--)
+    stat_overruns++;
+    if (report_format == CMD_FORMAT_COMPACT)
+    {
+        sprintf(msg, " overrun=%lu", (unsigned long)rx_lost);
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+    }
+    else if (report_format == CMD_FORMAT_RAW)
+    {
+        send_word(rx_lost);
+    }
+    else
     {
-        while ((sci->FLR & 0x4) == 4); /* wait until busy */
-        sciSendByte(sci,*text++);      /* send out text   */
-    };
+        sprintf(msg, "Ring overrun, %lu bytes lost, no CRC\r\n", (unsigned long)rx_lost);
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+    }
 }
 
-/* Supporting Function for calculating CRC */
-uint8_t reflect8(uint8_t data)
+#if (CRC_PSA_OFFLOAD != 2)
+/**
+ * @brief  Finalizes and prints every checksum of the window in the
+ *         current report format. CRC32 keeps its original text line and
+ *         is remembered for empty windows.
+ */
+void checksum_report(void)
 {
-    uint8_t res = 0;
-    int i;
-    for (i = 0; i < 8; i++)
-        res |= ((data >> i) & 1) << (7 - i);
-    return res;
+    checksumDigest_t digest;
+    char msg[48];
+    uint32_t i;
+
+    checksumFinal(&rx_sum, &digest);
+
+    for (i = 0U; i < CHECKSUM_COUNT; i++)
+    {
+        if ((digest.set & (1U << i)) == 0U)
+        {
+            continue;
+        }
+        if ((i == CHECKSUM_IDX_CRC32) && (report_format != CMD_FORMAT_TEXT))
+        {
+            coreKeepCrc(digest.value[i]);
+        }
+        if (report_format == CMD_FORMAT_COMPACT)
+        {
+            sprintf(msg, " %s=%08lX", checksumName(i), (unsigned long)digest.value[i]);
+            sciDisplayText(USB_UART, (uint8_t *)msg);
+        }
+        else if (report_format == CMD_FORMAT_RAW)
+        {
+            send_word(digest.value[i]);
+        }
+        else if (i == CHECKSUM_IDX_CRC32)
+        {
+            coreReportCrc(digest.value[i]);
+        }
+        else
+        {
+            sprintf(msg, "%s in Hex is : 0x%08lX\r\n", checksumName(i), (unsigned long)digest.value[i]);
+            sciDisplayText(USB_UART, (uint8_t *)msg);
+        }
+    }
 }
+#endif
 
-/* Supporting Function for calculating CRC */
-uint32_t reflect32(uint32_t data)
+/**
+ * @brief  Prints the block CRCs of the window, if a manifest is on.
+ *         Text: a header line, then eight CRCs per line. Compact: the
+ *         block length and the CRCs appended to the line. Raw: block
+ *         length, block count and the CRCs as words.
+ */
+void manifest_report(void)
 {
-    uint32_t res = 0;
-    int i;
-    for (i = 0; i < 32; i++)
-        res |= ((data >> i) & 1) << (31 - i);
-    return res;
+    char msg[48];
+    uint32_t len;
+    uint32_t count = manifestFinish(rx_sum.crc32 ^ CRC32_XOROUT, &len);
+    const char *sep;
+    uint32_t i;
+
+    if (count == 0U)
+    {
+        return;
+    }
+    if (manifest_tree != 0U)
+    {
+        tree_report(count, len);
+        return;
+    }
+
+    if (report_format == CMD_FORMAT_TEXT)
+    {
+        sprintf(msg, "Manifest: %lu blocks of %lu bytes\r\n", (unsigned long)count, (unsigned long)len);
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+    }
+    else if (report_format == CMD_FORMAT_COMPACT)
+    {
+        sprintf(msg, " manifest=%lu:", (unsigned long)len);
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+    }
+    else
+    {
+        send_word(len);
+        send_word(count);
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        if (report_format == CMD_FORMAT_RAW)
+        {
+            send_word(manifestBlock(i));
+            continue;
+        }
+        if (report_format == CMD_FORMAT_TEXT)
+        {
+            sep = ((i % 8U) == 0U) ? "" : " ";
+        }
+        else
+        {
+            sep = (i == 0U) ? "" : ",";
+        }
+        sprintf(msg, "%s%08lX", sep, (unsigned long)manifestBlock(i));
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+        if ((report_format == CMD_FORMAT_TEXT) && (((i % 8U) == 7U) || ((i + 1U) == count)))
+        {
+            sciDisplayText(USB_UART, (uint8_t *)"\r\n");
+        }
+    }
 }
 
-/* Calculating CRC */
-uint32_t calc_crc32(uint8_t *data, uint32_t len)
+/**
+ * @brief  Prints the root of the tree over the blocks of the window. Text:
+ *         one line with the shape and the root. Compact: block length,
+ *         block count and root appended to the line. Raw: the same three
+ *         as words.
+ * @param  count  Number of blocks.
+ * @param  len    Block length.
+ */
+void tree_report(uint32_t count, uint32_t len)
 {
-    uint32_t i, crc = INIT_CRC;
-    int j;
-    for (i = 0; i < len; i++) {
-        crc ^= ((uint32_t)reflect8(data[i])) << 24;
-        for (j = 0; j < 8; j++)
-            crc = (crc & 0x80000000) ? (crc << 1) ^ POLYNOMIAL : (crc << 1);
-    }
-    return reflect32(crc) ^ FINAL_XOR;
+    char msg[80];
+    uint32_t levels = manifestLevels();
+    uint32_t offset;
+    uint32_t span;
+    uint32_t root;
+
+    (void)manifestNode(levels, 0U, &offset, &span, &root);
+
+    if (report_format == CMD_FORMAT_TEXT)
+    {
+        sprintf(msg, "Tree: %lu blocks of %lu bytes, %lu levels, root %08lX\r\n",
+                (unsigned long)count, (unsigned long)len,
+                (unsigned long)levels, (unsigned long)root);
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+    }
+    else if (report_format == CMD_FORMAT_COMPACT)
+    {
+        sprintf(msg, " tree=%lu:%lu:%08lX", (unsigned long)len, (unsigned long)count, (unsigned long)root);
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+    }
+    else
+    {
+        send_word(len);
+        send_word(count);
+        send_word(root);
+    }
 }
 
-/* Calculating CRC using incremental method */
-uint32_t update_crc32(uint32_t crc, uint8_t data)
+/**
+ * @brief  Sends a word as four raw bytes, most significant first.
+ */
+void send_word(uint32_t value)
 {
-    crc ^= ((uint32_t)reflect8(data)) << 24;
-    for (int j = 0; j < 8; j++)
-        crc = (crc & 0x80000000) ? (crc << 1) ^ POLYNOMIAL : (crc << 1);
-    return crc;
+    uint32_t shift;
+
+    TRACE(TRACE_TX_BEGIN, 4U);
+    for (shift = 32U; shift > 0U; shift -= 8U)
+    {
+        flow_service();
+        while ((USB_UART->FLR & 0x4) == 4); /* wait until busy */
+        sciSendByte(USB_UART, (uint8)(value >> (shift - 8U)));
+    }
+    TRACE(TRACE_TX_END, 0U);
 }
 
+#if (CMD_ENABLE == 1)
 /**
- * @brief  Sends a null-terminated string over SCI3 using polling.
- * @param  text Pointer to the string to send.
+ * @brief  Offers the ring from rx_read up to end to the command
+ *         interpreter and executes a completed command.
+ * @param  end  Ring index where the contiguous span ends.
+ * @return Non-zero if bytes were taken (rx_read advanced); zero when the
+ *         window is data and the span is left to the checksum.
  */
-void sci3DisplayText(unsigned char *text)
+uint32_t command_scan(uint32_t end)
 {
-    uint32 length = strlen((const char *)text);
-    while(length--)
+    cmd_t cmd;
+    uint32_t used;
+    cmdScan_t scan = cmdScan(&core_rx_ring[rx_read], end - rx_read, &used);
+
+    rx_read = (rx_read + used) & CORE_RX_RING_MASK;
+
+    if ((scan == CMD_SCAN_LINE) && (cmdParse(&cmd) != 0U))
     {
-        while ((sciREG3->FLR & 0x4) == 0x4); // Wait until not busy
-        sciSendByte(sciREG3, *text++);
+        cmdRelease();
+#if (CRC_PSA_OFFLOAD != 0)
+        /* The command is not part of the signed data */
+        psa_read = rx_read;
+#endif
+        command_execute(&cmd);
     }
+    else if (scan != CMD_SCAN_MORE)
+    {
+        command_reject();
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return used;
 }
 
 /**
- * @brief  Sets up DMA channel 1 for single-byte SCI3 RX.
- *         Configures the DMA control packet and enables the hardware trigger.
+ * @brief  Hands the bytes held back for a line that was not a command to
+ *         the checksum.
  */
-void setup_dma(void)
+void command_reject(void)
 {
-    dmaReqAssign(DMA_CH1, DMA_SCI3_RX);
-
-    g_dmaCTRLPKT.SADD      = SCI3_RX_ADDR;
-    g_dmaCTRLPKT.DADD      = (uint32_t)&rx_byte;
-    g_dmaCTRLPKT.CHCTRL    = 0;
-    g_dmaCTRLPKT.FRCNT     = 1;
-    g_dmaCTRLPKT.ELCNT     = 1;
-    g_dmaCTRLPKT.ELDOFFSET = 0;
-    g_dmaCTRLPKT.ELSOFFSET = 0;
-    g_dmaCTRLPKT.FRDOFFSET = 0;
-    g_dmaCTRLPKT.FRSOFFSET = 0;
-    g_dmaCTRLPKT.PORTASGN  = PORTB_READ_PORTA_WRITE;
-    g_dmaCTRLPKT.RDSIZE    = ACCESS_8_BIT;
-    g_dmaCTRLPKT.WRSIZE    = ACCESS_8_BIT;
-    g_dmaCTRLPKT.TTYPE     = FRAME_TRANSFER;
-    g_dmaCTRLPKT.ADDMODERD = ADDR_FIXED;
-    g_dmaCTRLPKT.ADDMODEWR = ADDR_FIXED;
-    g_dmaCTRLPKT.AUTOINIT  = AUTOINIT_OFF;
-
-    dmaEnable();
-    sciREG3->SETINT |= SCI_SET_RX_DMA | SCI_SET_RX_DMA_ALL;
+    uint32_t len;
+    const uint8_t *held = cmdHeld(&len);
+
+    if (len != 0U)
+    {
+        checksum_add(held, len);
+    }
+    cmdRelease();
 }
 
 /**
- * @brief  Arms DMA channel 1 for the next single-byte SCI3 RX transfer.
- *         Resets the RX byte and enables the channel.
+ * @brief  Carries out a command. Commands arrive between windows, so the
+ *         checksum state is always fresh here.
  */
-void start_reception(void)
+void command_execute(const cmd_t *cmd)
 {
-    rx_byte = 0;
-    dmaSetCtrlPacket(DMA_CH1, g_dmaCTRLPKT);
-    dmaSetChEnable(DMA_CH1, DMA_HW);
+    char msg[160];
+    uint32_t ok = 1U;
+    uint32_t offset;
+    uint32_t len;
+    uint32_t crc;
+    uint32_t child;
+#if (FLOW_ENABLE == 1)
+    flowStats_t flow;
+#endif
+#if (CAPTURE_ENABLE == 1)
+    captureInfo_t capture;
+#endif
+
+    stat_commands++;
+    TRACE(TRACE_COMMAND, cmd->id);
+
+    switch (cmd->id)
+    {
+    case CMD_RESET:
+        checksum_restart();
+        (void)manifestStart(manifest_len);
+#if (TRACE_ENABLE == 1)
+        traceClear();
+#endif
+        coreClearStats();
+        stat_commands = 0U;
+        stat_overruns = 0U;
+#if (FLOW_ENABLE == 1)
+        flowResetStats();
+#endif
+        break;
+    case CMD_STATS:
+        sprintf(msg, "bytes %lu windows %lu overruns %lu commands %lu idle %lu ms preset 0x%lX format %s manifest %lu%s\r\n",
+                (unsigned long)coreGetStats()->bytes, (unsigned long)coreGetStats()->windows,
+                (unsigned long)stat_overruns, (unsigned long)stat_commands, (unsigned long)coreTimeout(),
+                (unsigned long)checksum_set, cmdFormatName(report_format),
+                (unsigned long)manifest_len, (manifest_tree != 0U) ? " tree" : "");
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+#if (FLOW_ENABLE == 1)
+        flowGetStats(uptime_ms, &flow);
+        sprintf(msg, "xoff %lu stall %lu ms peak %lu of %lu\r\n",
+                (unsigned long)flow.stops, (unsigned long)flow.stallMs,
+                (unsigned long)flow.peak, (unsigned long)CORE_RX_RING_SIZE);
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+#endif
+#if (CAPTURE_ENABLE == 1)
+        captureGetInfo(&capture);
+        sprintf(msg, "capture %s %lu of %lu bytes windows %lu dropped %lu crc %08lX\r\n",
+                (capture.active != 0U) ? "on" : "off", (unsigned long)capture.len,
+                (unsigned long)CAPTURE_SDRAM_SIZE, (unsigned long)capture.windows,
+                (unsigned long)capture.dropped, (unsigned long)capture.crc);
+        sciDisplayText(USB_UART, (uint8_t *)msg);
+#endif
+        break;
+    case CMD_IDLE:
+        coreSetTimeout(cmd->arg);
+        break;
+    case CMD_PRESET:
+        checksum_set = cmd->arg;
+        checksum_restart();
+        break;
+    case CMD_MANIFEST:
+    case CMD_TREE:
+#if (CRC_PSA_OFFLOAD != 2)
+        if (manifestStart(cmd->arg) != 0U)
+        {
+            manifest_len = cmd->arg;
+            manifest_tree = (cmd->id == CMD_TREE) ? 1U : 0U;
+            checksum_restart();
+        }
+        else
+        {
+            ok = 0U;
+        }
+#else
+        /* No software CRC32 to cut the blocks from */
+        ok = 0U;
+#endif
+        break;
+    case CMD_NODE:
+        /* Level, index, offset, length and CRC, then the children's CRCs */
+        ok = manifestNode(cmd->arg, cmd->arg2, &offset, &len, &crc);
+        if (ok != 0U)
+        {
+            sprintf(msg, "NODE %lu %lu %lu %lu %08lX", (unsigned long)cmd->arg, (unsigned long)cmd->arg2,
+                    (unsigned long)offset, (unsigned long)len, (unsigned long)crc);
+            sciDisplayText(USB_UART, (uint8_t *)msg);
+            for (child = 0U; (cmd->arg != 0U) && (child < 2U); child++)
+            {
+                if (manifestNode(cmd->arg - 1U, (2U * cmd->arg2) + child, &offset, &len, &crc) != 0U)
+                {
+                    sprintf(msg, " %08lX", (unsigned long)crc);
+                    sciDisplayText(USB_UART, (uint8_t *)msg);
+                }
+            }
+            sciDisplayText(USB_UART, (uint8_t *)"\r\n");
+        }
+        break;
+    case CMD_FORMAT:
+        report_format = cmd->arg;
+        break;
+    case CMD_BENCH:
+        command_bench();
+        break;
+    case CMD_SELFTEST:
+        command_selftest();
+        break;
+    case CMD_BAUD:
+        ok = command_baud(cmd->arg);
+        break;
+    case CMD_TRACE:
+#if (TRACE_ENABLE == 1)
+        traceDump(USB_UART);
+#else
+        ok = 0U;
+#endif
+        break;
+    case CMD_CAPTURE:
+#if ((CAPTURE_ENABLE == 1) && (CRC_PSA_OFFLOAD != 2))
+        if (cmd->arg != 0U)
+        {
+            ok = captureStart();
+        }
+        else
+        {
+            captureStop();
+        }
+        capture_on = (ok != 0U) ? cmd->arg : 0U;
+        checksum_restart();
+#else
+        /* No SDRAM, or no software CRC32 for the image */
+        ok = 0U;
+#endif
+        break;
+    case CMD_VERIFY:
+#if (CAPTURE_ENABLE == 1)
+        ok = command_verify((cmd->arg != 0U) ? cmd->arg : checksum_set);
+#else
+        ok = 0U;
+#endif
+        break;
+    case CMD_REPLAY:
+#if (CAPTURE_ENABLE == 1)
+        command_replay();
+#else
+        ok = 0U;
+#endif
+        break;
+    default:
+        break;
+    }
+    sciDisplayText(USB_UART, (uint8_t *)((ok != 0U) ? "OK\r\n" : "ERR\r\n"));
 }
 
+/**
+ * @brief  Runs the kernel and checksum benchmarks. They switch the cache
+ *         on, which the live ring must never see, and their PMU counts
+ *         include any interrupt: reception is stopped as for the
+ *         self-test and the RTI notification is off meanwhile. Bytes
+ *         arriving meanwhile are lost.
+ */
+void command_bench(void)
+{
+    coreRxStop();
+    rtiDisableNotification(rtiREG1, rtiNOTIFICATION_COMPARE0);
 
-/*
- * Debugging purpose only
- *
+    crc32Benchmark(USB_UART);
+    checksumBenchmark(USB_UART);
+
+    rtiEnableNotification(rtiREG1, rtiNOTIFICATION_COMPARE0);
+    setup_dma();
+    start_reception();
+#if (CRC_PSA_OFFLOAD != 0)
+    psa_read = 0;
+#endif
+}
+
+/**
+ * @brief  Runs the loopback self-benchmark, which needs SCI3 and the ring
+ *         to itself: reception is stopped, and set up and started again
+ *         afterwards. Bytes arriving meanwhile are lost.
  */
-void debug_receivedData(sciBASE_t *sci, uint8_t *data, uint32_t len)
+void command_selftest(void)
 {
-    char hexByte[6];
+    selftestSummary_t summary;
+
+    coreRxStop();
+
+    selftestSweep(&summary);
+
+    setup_dma();
+    start_reception();
+#if (CRC_PSA_OFFLOAD != 0)
+    psa_read = 0;
+#endif
+}
+
+/**
+ * @brief  Switches SCI3 to a proposed rate and verifies the link with the
+ *         host (handshake in baud.h). Returns to the old rate on failure.
+ * @param  rate  Proposed rate in baud.
+ * @return Non-zero if the new rate is in use.
+ */
+uint32_t command_baud(uint32_t rate)
+{
+    baudPlan_t plan;
+    uint8_t buf[BAUD_PATTERN_LEN];
+    char msg[48];
+    uint32_t saved_brs = USB_UART->BRS;
+    uint32_t ok = 1U;
+    uint32_t err;
     uint32_t i;
-    sciDisplayText(sci, (uint8_t *)"\r\nData Received is : ");
-    for (i = 0; i < len; i++) {
-        sprintf(hexByte, " %02X", data[i]);
-        sciDisplayText(sci, (uint8_t *)hexByte);
+
+    baudPlan(SCI_VCLK_HZ, rate, &plan);
+    err = (uint32_t)((plan.errorPerMille < 0) ? -plan.errorPerMille : plan.errorPerMille);
+    /* RANGE instead of BAUD tells the host the rate was refused */
+    sprintf(msg, "%s %lu %c%lu.%lu%%\r\n", (plan.usable != 0U) ? "BAUD" : "RANGE",
+            (unsigned long)plan.actual,
+            (plan.errorPerMille < 0) ? '-' : '+',
+            (unsigned long)(err / 10U), (unsigned long)(err % 10U));
+    sciDisplayText(USB_UART, (uint8_t *)msg);
+    if (plan.usable == 0U)
+    {
+        return 0U;
+    }
+
+    wait_tx_empty();
+    sciSetBaudrate(USB_UART, plan.actual);
+
+    /* Drop what the host sent while both sides were switching */
+    wait_ms(BAUD_SETTLE_MS);
+    rx_read = coreRxRingWritePos();
+    USB_UART->FLR = SCI_FE_INT | SCI_OE_INT | SCI_PE_INT;
+
+    if (ring_receive(buf, BAUD_PATTERN_LEN, BAUD_VERIFY_MS) != BAUD_PATTERN_LEN)
+    {
+        ok = 0U;
+    }
+    for (i = 0U; (ok != 0U) && (i < BAUD_PATTERN_LEN); i++)
+    {
+        if (buf[i] != baudPatternByte(i))
+        {
+            ok = 0U;
+        }
     }
-    sciDisplayText(sci, (uint8_t *)"\r\n");
+
+    if (ok != 0U)
+    {
+        for (i = 0U; i < BAUD_PATTERN_LEN; i++)
+        {
+            while ((USB_UART->FLR & 0x4) == 4); /* wait until busy */
+            sciSendByte(USB_UART, buf[i]);
+        }
+        if (ring_receive(buf, BAUD_ACK_LEN, BAUD_VERIFY_MS) != BAUD_ACK_LEN)
+        {
+            ok = 0U;
+        }
+        for (i = 0U; (ok != 0U) && (i < BAUD_ACK_LEN); i++)
+        {
+            if (buf[i] != BAUD_ACK)
+            {
+                ok = 0U;
+            }
+        }
+    }
+
+    if (ok == 0U)
+    {
+        wait_tx_empty();
+        USB_UART->BRS = saved_brs;
+        /* The host gives up after its own timeout, answer once it listens
+         * on the old rate again */
+        wait_ms(BAUD_REVERT_MS);
+        rx_read = coreRxRingWritePos();
+    }
+#if (CRC_PSA_OFFLOAD != 0)
+    psa_read = rx_read;
+#endif
+    return ok;
 }
 
-/*
- * Debugging purpose only
- *
+#if (CAPTURE_ENABLE == 1)
+/**
+ * @brief  Checksums the SDRAM image and compares its CRC32 with the one
+ *         kept while it was captured. Prints the size, the time and rate
+ *         and every checksum of the set in the text format.
+ * @param  set  CHECKSUM_* mask.
+ * @return Non-zero if the CRC32s match.
  */
-void debug_byteCount(sciBASE_t *sci, uint32_t len)
+uint32_t command_verify(uint32_t set)
 {
-    char msg[64];
-    sprintf(msg, "\r\nBytes received: %lu\r\n", len);
-    sciDisplayText(sci, (uint8_t *)msg);
+    captureInfo_t info;
+    checksumDigest_t digest;
+    char msg[80];
+    uint32_t cycles;
+    uint32_t rate;
+    uint32_t i;
+
+    captureGetInfo(&info);
+    cycles = captureVerify(set, &digest);
+    /* Bytes per second over ten, for one decimal of MB/s */
+    rate = (cycles != 0U)
+         ? (uint32_t)(((uint64)info.len * (uint32_t)(GCLK_FREQ * 100000.0F)) / cycles) : 0U;
+
+    sprintf(msg, "Capture: %lu bytes in %lu windows, %lu cycles, %lu.%lu MB/s\r\n",
+            (unsigned long)info.len, (unsigned long)info.windows, (unsigned long)cycles,
+            (unsigned long)(rate / 100000U), (unsigned long)((rate / 10000U) % 10U));
+    sciDisplayText(USB_UART, (uint8_t *)msg);
+    for (i = 0U; i < CHECKSUM_COUNT; i++)
+    {
+        if ((digest.set & (1U << i)) != 0U)
+        {
+            sprintf(msg, "%s in Hex is : 0x%08lX\r\n", checksumName(i), (unsigned long)digest.value[i]);
+            sciDisplayText(USB_UART, (uint8_t *)msg);
+        }
+    }
+    sprintf(msg, "Streamed CRC32 0x%08lX: %s\r\n", (unsigned long)info.crc,
+            (digest.value[CHECKSUM_IDX_CRC32] == info.crc) ? "match" : "MISMATCH");
+    sciDisplayText(USB_UART, (uint8_t *)msg);
+    return (digest.value[CHECKSUM_IDX_CRC32] == info.crc) ? 1U : 0U;
 }
-/* USER CODE END */
 
+/**
+ * @brief  Sends the SDRAM image back: "REPLAY <len> <crc32>" and the raw
+ *         bytes, as the trace dump. The host may throttle it with RTS;
+ *         XON/XOFF is held back until the image is out (flowBinary()),
+ *         as any byte value can be in it.
+ */
+void command_replay(void)
+{
+    captureInfo_t info;
+    const uint8_t *image = captureImage();
+    char msg[40];
+    uint32_t i;
+
+    captureGetInfo(&info);
+    sprintf(msg, "REPLAY %lu %08lX\r\n", (unsigned long)info.len, (unsigned long)info.crc);
+    sciDisplayText(USB_UART, (uint8_t *)msg);
+
+    TRACE(TRACE_TX_BEGIN, info.len);
+    flowBinary(1U);
+    for (i = 0U; i < info.len; i++)
+    {
+        flow_service();
+        while ((USB_UART->FLR & 0x4) == 4); /* wait until busy */
+        sciSendByte(USB_UART, image[i]);
+    }
+    flowBinary(0U);
+    TRACE(TRACE_TX_END, 0U);
+}
+#endif
+
+/**
+ * @brief  Takes bytes straight from the ring, outside the checksum.
+ * @param  dst         Destination.
+ * @param  len         Bytes wanted.
+ * @param  timeout_ms  Time allowed for all of them.
+ * @return Bytes received.
+ */
+uint32_t ring_receive(uint8_t *dst, uint32_t len, uint32_t timeout_ms)
+{
+    uint32_t start = uptime_ms;
+    uint32_t got = 0U;
+
+    while ((got < len) && ((uptime_ms - start) < timeout_ms))
+    {
+        if (rx_read != coreRxRingWritePos())
+        {
+            dst[got] = core_rx_ring[rx_read];
+            got++;
+            rx_read = (rx_read + 1U) & CORE_RX_RING_MASK;
+        }
+    }
+    return got;
+}
+
+/**
+ * @brief  Busy-waits on the RTI tick.
+ */
+void wait_ms(uint32_t ms)
+{
+    uint32_t start = uptime_ms;
+
+    while ((uptime_ms - start) < ms)
+    {
+        /* Wait */
+    }
+}
+
+/**
+ * @brief  Waits until the last stop bit has left the shift register, so
+ *         a rate change does not cut a character.
+ */
+void wait_tx_empty(void)
+{
+    while ((USB_UART->FLR & SCI_FLR_TX_EMPTY) == 0U)
+    {
+        /* Wait */
+    }
+}
+#endif
+
+/**
+ * @brief  Sets up DMA channel 1 as the circular SCI3 RX ring of the core
+ *         (coreRxRingSetup()), plus the ring wrap interrupt.
+ */
+void setup_dma(void)
+{
+    coreRxRingSetup();
+
+    /* Block transfer complete counts each wrap of the ring (and marks it
+     * in the trace) */
+    vimChannelMap(DMA_BTCA_VIM, DMA_BTCA_VIM, &ring_wrap_isr);
+    vimEnableInterrupt(DMA_BTCA_VIM, SYS_IRQ);
+    dmaEnableInterrupt(CORE_RX_DMA_CH, BTC, DMA_INTA);
+}
+
+/**
+ * @brief  Enables DMA channel 1 for hardware requests. Called once; with
+ *         AUTOINIT the channel keeps running over the ring.
+ */
+void start_reception(void)
+{
+    rx_read = 0;
+    rx_taken = 0;
+    coreRxRingStart();
+}
+/* USER CODE END */
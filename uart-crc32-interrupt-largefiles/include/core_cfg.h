@@ -0,0 +1,23 @@
+/**
+ ******************************************************************************
+ * @file    core_cfg.h
+ * @brief   Shared Core Configuration of uart-crc32-interrupt-largefiles
+ *
+ * @details
+ *   - SCI1 (USB UART) reception through the LIN multi-buffer backend, up
+ *     to 8 bytes per RX interrupt. CORE_RX_INTERRUPT selects one RX
+ *     interrupt per byte instead.
+ *   - A report every 5 s from the RTI compare 0 notification.
+ ******************************************************************************
+ */
+#ifndef CORE_CFG_H_
+#define CORE_CFG_H_
+
+#define CORE_RX_BACKEND         CORE_RX_LIN_MBUF
+#define CORE_UART               sciREG1
+#define CORE_TIMEOUT_MS         5000U
+#define CORE_WINDOW_MODE        CORE_WINDOW_FIXED
+/* Bytes per RX interrupt in multi-buffer mode (1..8) */
+#define CORE_RX_LIN_FRAME_LEN   8U
+
+#endif /* CORE_CFG_H_ */
@@ -0,0 +1,73 @@
+/**
+ ******************************************************************************
+ * @file    fee_checkpoint.h
+ * @brief   Session Checkpoints in Flash (TI FEE)
+ *
+ * @details
+ *   - A checkpoint is the session id, the file length, the byte offset and
+ *     the raw (not finalized) CRC state at that offset, stored as one FEE
+ *     block in the bank 7 data flash.
+ *   - ckptSave() only copies the record to RAM and may be called from the
+ *     receive interrupt; ckptService() in the main loop hands the newest
+ *     copy to TI_Fee_WriteAsync() and runs TI_Fee_MainFunction(). Bank 7
+ *     is programmed while the CPU keeps running from bank 0/1, so reception
+ *     never waits for the flash. A checkpoint saved while the previous one
+ *     is still being written replaces it in RAM.
+ *   - ckptInit() reads the stored checkpoint once at startup (blocking);
+ *     from then on ckptLoad() answers from the RAM copy of what is in
+ *     flash.
+ *   - Session id 0 is never used; ckptErase() stores a record with it.
+ *
+ * @note
+ *   - Needs the FEE driver enabled in HALCoGen (Driver Enable tab, which
+ *     also generates fee_cfg.h and adds the F021 flash API) with block
+ *     CKPT_FEE_BLOCK of CKPT_RECORD_SIZE bytes, and CKPT_ENABLE set here.
+ *     Until then "make -C sim ckpt" builds the enabled path against a FEE
+ *     model (sim_fee.c) and checks it across simulated resets.
+ ******************************************************************************
+ */
+#ifndef FEE_CHECKPOINT_H_
+#define FEE_CHECKPOINT_H_
+
+#include "HL_sys_common.h"
+
+/* Set to 1 once the FEE driver is configured in HALCoGen */
+#ifndef CKPT_ENABLE
+#define CKPT_ENABLE             0
+#endif
+/* FEE block number of the checkpoint (HALCoGen FEE tab) */
+#define CKPT_FEE_BLOCK          1U
+/* FEE block size, sizeof(ckptRecord_t) */
+#define CKPT_RECORD_SIZE        32U
+/* "CKP2": reflected CRC state since the shared core; "CKPT" records held
+ * the bit-serial state and are not resumed */
+#define CKPT_MAGIC              0x434B5032U
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t session;
+    uint32_t lengthHigh;
+    uint32_t lengthLow;
+    uint32_t offsetHigh;
+    uint32_t offsetLow;
+    uint32_t crc;           /* Running CRC at offset, reflected state before the XOR */
+    uint32_t check;         /* Inverted XOR of the other words */
+} ckptRecord_t;
+
+typedef struct
+{
+    uint32_t saves;         /* ckptSave() calls */
+    uint32_t writes;        /* Records written to flash */
+    uint32_t replaced;      /* Saves replaced by a newer one before being written */
+    uint32_t failures;      /* FEE jobs that did not end JOB_OK */
+} ckptStats_t;
+
+void ckptInit(void);
+uint32_t ckptLoad(uint32_t session, ckptRecord_t *record);
+void ckptSave(uint32_t session, uint64 length, uint64 offset, uint32_t crc);
+void ckptErase(void);
+void ckptService(void);
+void ckptGetStats(ckptStats_t *stats);
+
+#endif /* FEE_CHECKPOINT_H_ */
@@ -0,0 +1,31 @@
+/**
+ ******************************************************************************
+ * @file    ramfunc.h
+ * @brief   Code and Tables Executed from RAM
+ *
+ * @details
+ *   - Functions tagged with #pragma CODE_SECTION(fn, ".ramCode") and data
+ *     tagged with #pragma DATA_SECTION(obj, ".ramConst") are collected in
+ *     the .ramfunc output section (HL_sys_link.cmd, USER CODE (6)).
+ *   - With RAMFUNC_IN_RAM set to 1 in the linker command file the section
+ *     is loaded in flash and runs from RAM; ramfuncCopy(), called from
+ *     _c_int00() before main(), copies it. With 0 it runs in place from
+ *     flash and ramfuncCopy() does nothing.
+ *   - Tagged: the SCI1 RX interrupt path (lin1HighLevelInterrupt() and
+ *     sciReceive() in HL_sci.c, linMbufRxHandler() in lin_mbuf_rx.c,
+ *     rxBlockReceived() and crcAdd() in the main file, coreAdd() in
+ *     core.c) and the CRC32 kernels with their tables (crc32_kernel.c,
+ *     crc32_kernel_r5.asm, crc32_table.c). The session scanning and the
+ *     checkpoint writes reached from rxBlockReceived() stay in flash:
+ *     they run once per window or per checkpoint, not per frame.
+ ******************************************************************************
+ */
+#ifndef RAMFUNC_H_
+#define RAMFUNC_H_
+
+#include "HL_sys_common.h"
+
+void ramfuncCopy(void);
+uint32_t ramfuncInRam(void);
+
+#endif /* RAMFUNC_H_ */
@@ -0,0 +1,48 @@
+/**
+ ******************************************************************************
+ * @file    session.h
+ * @brief   Resumable Transfer Sessions: Command Line
+ *
+ * @details
+ *   - A window that starts with SESSION_ESCAPE (0x1B) and holds
+ *
+ *         ESC session <id> <length> CR
+ *
+ *     (id: 1..8 hex digits, not 0; length: 1..16 hex digits) within
+ *     SESSION_LINE_MAX bytes opens or resumes a session for a file of that
+ *     length. The board answers
+ *
+ *         RESUME <id> <offset>
+ *
+ *     with the offset (16 hex digits) to continue from: 0 for a new
+ *     session, otherwise the end of the data it still has, from RAM or
+ *     from the last checkpoint in flash after a reset.
+ *   - A window that starts with ESC but is not a valid line is data; its
+ *     bytes stay available through sessionHeld() until sessionRelease().
+ *   - sessionScan() runs in the receive interrupt, so it only looks at the
+ *     first byte of a window unless that byte is ESC.
+ ******************************************************************************
+ */
+#ifndef SESSION_H_
+#define SESSION_H_
+
+#include "HL_sys_common.h"
+
+#define SESSION_ESCAPE          0x1BU
+/* Longest command line, including the escape and the terminator */
+#define SESSION_LINE_MAX        48U
+
+typedef enum
+{
+    SESSION_SCAN_DATA = 0U,     /* Not a command, *used bytes were taken and are in sessionHeld() */
+    SESSION_SCAN_MORE = 1U,     /* All bytes taken, line not complete yet */
+    SESSION_SCAN_LINE = 2U      /* Line complete, *used bytes taken (terminator included) */
+} sessionScan_t;
+
+sessionScan_t sessionScan(const uint8_t *data, uint32_t len, uint32_t *used);
+uint32_t sessionCollecting(void);
+uint32_t sessionParse(uint32_t *id, uint64 *length);
+const uint8_t *sessionHeld(uint32_t *len);
+void sessionRelease(void);
+
+#endif /* SESSION_H_ */
@@ -47,6 +47,11 @@
 #include "HL_sys_vim.h"
 #include "math.h"
 /* USER CODE BEGIN (1) */
+#include "lin_mbuf_rx.h"
+
+/* The SCI1 RX interrupt path runs from RAM (ramfunc.h) */
+#pragma CODE_SECTION(lin1HighLevelInterrupt, ".ramCode")
+#pragma CODE_SECTION(sciReceive, ".ramCode")
 /* USER CODE END */
 /** @struct g_sciTransfer
 *   @brief Interrupt mode globals
@@ -696,6 +701,12 @@ void lin1HighLevelInterrupt(void)
     uint32 vec = sciREG1->INTVECT0;
 	uint8 byte;
 /* USER CODE BEGIN (28) */
+    /* Multi-buffer mode: RXRDY means a whole frame is waiting in RD0/RD1 */
+    if ((vec == 11U) && (linMbufRxIsActive() != 0U))
+    {
+        linMbufRxHandler();
+        return;
+    }
 /* USER CODE END */
 
     switch (vec)
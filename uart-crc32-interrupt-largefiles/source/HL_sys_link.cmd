@@ -67,6 +67,10 @@ MEMORY
 }
 
 /* USER CODE BEGIN (4) */
+/* 1: the RX interrupt path, CRC kernels and CRC tables (.ramCode/.ramConst)
+ *    are loaded in flash and run from RAM, copied by ramfuncCopy().
+ * 0: they run in place from flash. */
+#define RAMFUNC_IN_RAM 1
 /* USER CODE END */
 
 
@@ -88,6 +92,19 @@ SECTIONS
 	
 
 /* USER CODE BEGIN (6) */
+    /* Buffer of the DMA backends of the shared core (core_rx.h) */
+    .rxRing  align(32) : {} > RAM
+#if (RAMFUNC_IN_RAM == 1)
+    .ramfunc align(32) : { *(.ramCode) *(.ramConst) }
+                         load = FLASH0 | FLASH1, run = RAM,
+                         LOAD_START(ramfuncLoadStart), RUN_START(ramfuncRunStart),
+                         SIZE(ramfuncSize)
+#else
+    .ramfunc align(32) : { *(.ramCode) *(.ramConst) }
+                         load = FLASH0 | FLASH1,
+                         LOAD_START(ramfuncLoadStart), RUN_START(ramfuncRunStart),
+                         SIZE(ramfuncSize)
+#endif
 /* USER CODE END */
 }
 
@@ -0,0 +1,178 @@
+/**
+ ******************************************************************************
+ * @file    fee_checkpoint.c
+ * @brief   Session Checkpoints in Flash (TI FEE)
+ *
+ * @details
+ *   - s_pending is written by ckptSave() (interrupt) and copied to
+ *     s_writing by ckptService() (main loop). s_pendingSeq changes with
+ *     every save, so a copy torn by an interrupt is seen and retried.
+ *   - The FEE driver keeps a pointer to the data until the job ends, so
+ *     s_writing is not touched while a write is in progress.
+ ******************************************************************************
+ */
+#include "fee_checkpoint.h"
+
+#if (CKPT_ENABLE == 1)
+
+#include "ti_fee.h"
+
+/* FEE instance used (EEP0) */
+#define CKPT_EEP                0U
+
+static ckptRecord_t s_pending;
+static volatile uint32_t s_pendingSeq = 0U;
+static uint32_t s_writtenSeq = 0U;
+#pragma DATA_ALIGN(s_writing, 8)
+static ckptRecord_t s_writing;
+static uint32_t s_busy = 0U;
+/* Contents of the FEE block, valid if s_storedValid */
+static ckptRecord_t s_stored;
+static uint32_t s_storedValid = 0U;
+static ckptStats_t s_stats;
+
+static uint32_t ckptCheck(const ckptRecord_t *record);
+static void ckptWaitIdle(void);
+
+/**
+ * @brief  Starts the FEE driver and reads the stored checkpoint. Blocks
+ *         until both are done; call once at startup.
+ */
+void ckptInit(void)
+{
+    TI_Fee_Init();
+    ckptWaitIdle();
+
+    if (TI_Fee_Read(CKPT_FEE_BLOCK, 0U, (uint8 *)&s_stored, CKPT_RECORD_SIZE) == E_OK)
+    {
+        ckptWaitIdle();
+        if ((TI_Fee_GetJobResult(CKPT_EEP) == JOB_OK)
+         && (s_stored.magic == CKPT_MAGIC)
+         && (s_stored.check == ckptCheck(&s_stored)))
+        {
+            s_storedValid = 1U;
+        }
+    }
+}
+
+/**
+ * @brief  Returns the stored checkpoint of a session.
+ * @param  session  Session id.
+ * @param  record   Checkpoint, if found.
+ * @return Non-zero if flash holds a checkpoint of this session.
+ */
+uint32_t ckptLoad(uint32_t session, ckptRecord_t *record)
+{
+    if ((s_storedValid == 0U) || (session == 0U) || (s_stored.session != session))
+    {
+        return 0U;
+    }
+    *record = s_stored;
+    return 1U;
+}
+
+/**
+ * @brief  Queues a checkpoint for writing. Safe from interrupt context.
+ * @param  session  Session id.
+ * @param  length   Length of the file in the session.
+ * @param  offset   Bytes of the file received so far.
+ * @param  crc      Running CRC after offset bytes.
+ */
+void ckptSave(uint32_t session, uint64 length, uint64 offset, uint32_t crc)
+{
+    if (s_pendingSeq != s_writtenSeq)
+    {
+        s_stats.replaced++;
+    }
+    s_pending.magic      = CKPT_MAGIC;
+    s_pending.session    = session;
+    s_pending.lengthHigh = (uint32_t)(length >> 32U);
+    s_pending.lengthLow  = (uint32_t)length;
+    s_pending.offsetHigh = (uint32_t)(offset >> 32U);
+    s_pending.offsetLow  = (uint32_t)offset;
+    s_pending.crc        = crc;
+    s_pending.check      = ckptCheck(&s_pending);
+    s_pendingSeq++;
+    s_stats.saves++;
+}
+
+/**
+ * @brief  Queues a record of session 0, which ckptLoad() never matches,
+ *         once a session is complete.
+ */
+void ckptErase(void)
+{
+    ckptSave(0U, 0U, 0U, 0U);
+}
+
+/**
+ * @brief  Runs the FEE driver and starts the write of the newest queued
+ *         checkpoint when the previous one has finished. Main loop only.
+ */
+void ckptService(void)
+{
+    uint32_t seq;
+
+    TI_Fee_MainFunction();
+
+    if ((s_busy != 0U) && (TI_Fee_GetStatus(CKPT_EEP) == IDLE))
+    {
+        s_busy = 0U;
+        if (TI_Fee_GetJobResult(CKPT_EEP) == JOB_OK)
+        {
+            s_stored = s_writing;
+            s_storedValid = 1U;
+            s_stats.writes++;
+        }
+        else
+        {
+            s_stats.failures++;
+        }
+    }
+
+    if ((s_busy == 0U) && (s_pendingSeq != s_writtenSeq))
+    {
+        do
+        {
+            seq = s_pendingSeq;
+            s_writing = s_pending;
+        } while (seq != s_pendingSeq);
+
+        if (TI_Fee_WriteAsync(CKPT_FEE_BLOCK, (uint8 *)&s_writing) == E_OK)
+        {
+            s_busy = 1U;
+            s_writtenSeq = seq;
+        }
+    }
+}
+
+/**
+ * @brief  Copies the counters.
+ */
+void ckptGetStats(ckptStats_t *stats)
+{
+    *stats = s_stats;
+}
+
+/**
+ * @brief  Check word of a record: inverted XOR of the other words, so a
+ *         blank (all ones) or foreign block does not pass.
+ */
+static uint32_t ckptCheck(const ckptRecord_t *record)
+{
+    return ~(record->magic ^ record->session ^ record->lengthHigh ^ record->lengthLow
+           ^ record->offsetHigh ^ record->offsetLow ^ record->crc);
+}
+
+/**
+ * @brief  Runs the FEE driver until the current job has finished.
+ */
+static void ckptWaitIdle(void)
+{
+    while (TI_Fee_GetStatus(CKPT_EEP) != IDLE)
+    {
+        TI_Fee_MainFunction();
+    }
+}
+
+#endif /* CKPT_ENABLE */
@@ -0,0 +1,182 @@
+/**
+ ******************************************************************************
+ * @file    session.c
+ * @brief   Resumable Transfer Sessions: Command Line
+ *
+ * @details
+ *   - sessionScan() collects a candidate line from the received blocks,
+ *     sessionParse() checks it and returns the id and length. Restoring
+ *     the CRC state is left to the caller, which owns it.
+ ******************************************************************************
+ */
+#include "session.h"
+#include <string.h>
+
+static const char s_keyword[] = "session ";
+
+static uint8_t s_line[SESSION_LINE_MAX];
+static uint32_t s_lineLen = 0U;
+static uint32_t s_collecting = 0U;
+
+static uint32_t sessionHex(const char *text, uint32_t len, uint32_t maxDigits, uint64 *value);
+
+/**
+ * @brief  Collects a command line from a received block.
+ * @param  data  Block, the first bytes of a window unless sessionCollecting().
+ * @param  len   Block length.
+ * @param  used  Bytes taken from the block.
+ * @return SESSION_SCAN_DATA when the window is data: nothing was taken if
+ *         the block does not start with SESSION_ESCAPE, otherwise the bytes
+ *         taken are in sessionHeld(). SESSION_SCAN_MORE or
+ *         SESSION_SCAN_LINE otherwise.
+ */
+sessionScan_t sessionScan(const uint8_t *data, uint32_t len, uint32_t *used)
+{
+    uint32_t i = 0U;
+    uint8_t byte;
+
+    *used = 0U;
+    if (s_collecting == 0U)
+    {
+        if ((len == 0U) || (data[0U] != SESSION_ESCAPE))
+        {
+            return SESSION_SCAN_DATA;
+        }
+        s_lineLen = 0U;
+        s_collecting = 1U;
+    }
+
+    while (i < len)
+    {
+        byte = data[i];
+        s_line[s_lineLen] = byte;
+        s_lineLen++;
+        i++;
+        if ((byte == (uint8_t)'\r') || (byte == (uint8_t)'\n'))
+        {
+            s_collecting = 0U;
+            *used = i;
+            return SESSION_SCAN_LINE;
+        }
+        if (s_lineLen == SESSION_LINE_MAX)
+        {
+            s_collecting = 0U;
+            *used = i;
+            return SESSION_SCAN_DATA;
+        }
+    }
+    *used = i;
+    return SESSION_SCAN_MORE;
+}
+
+/**
+ * @brief  Returns non-zero while a started line waits for more bytes.
+ */
+uint32_t sessionCollecting(void)
+{
+    return s_collecting;
+}
+
+/**
+ * @brief  Parses the line completed by sessionScan().
+ * @param  id      Session id.
+ * @param  length  File length in bytes.
+ * @return Non-zero for a valid session command. Otherwise the line is data.
+ */
+uint32_t sessionParse(uint32_t *id, uint64 *length)
+{
+    const char *text = (const char *)&s_line[1U];
+    uint32_t keyLen = sizeof(s_keyword) - 1U;
+    uint32_t len;
+    uint32_t idLen = 0U;
+    uint64 value;
+
+    /* Escape and terminator are not part of the text */
+    if (s_lineLen < (keyLen + 2U))
+    {
+        return 0U;
+    }
+    len = s_lineLen - 2U;
+    if (strncmp(text, s_keyword, keyLen) != 0)
+    {
+        return 0U;
+    }
+    text += keyLen;
+    len -= keyLen;
+
+    while ((idLen < len) && (text[idLen] != ' '))
+    {
+        idLen++;
+    }
+    if ((idLen == len) || (sessionHex(text, idLen, 8U, &value) == 0U) || (value == 0U))
+    {
+        return 0U;
+    }
+    *id = (uint32_t)value;
+
+    text += idLen + 1U;
+    len -= idLen + 1U;
+    if ((sessionHex(text, len, 16U, &value) == 0U) || (value == 0U))
+    {
+        return 0U;
+    }
+    *length = value;
+    return 1U;
+}
+
+/**
+ * @brief  Bytes held back by sessionScan() (the escape included).
+ * @param  len  Number of bytes.
+ */
+const uint8_t *sessionHeld(uint32_t *len)
+{
+    *len = s_lineLen;
+    return s_line;
+}
+
+/**
+ * @brief  Drops the held bytes and any line in progress.
+ */
+void sessionRelease(void)
+{
+    s_lineLen = 0U;
+    s_collecting = 0U;
+}
+
+/**
+ * @brief  Parses an unsigned hexadecimal number.
+ * @return Non-zero if the whole text is 1..maxDigits hex digits.
+ */
+static uint32_t sessionHex(const char *text, uint32_t len, uint32_t maxDigits, uint64 *value)
+{
+    uint64 n = 0U;
+    uint32_t digit;
+    uint32_t i;
+
+    if ((len == 0U) || (len > maxDigits))
+    {
+        return 0U;
+    }
+    for (i = 0U; i < len; i++)
+    {
+        if ((text[i] >= '0') && (text[i] <= '9'))
+        {
+            digit = (uint32_t)(text[i] - '0');
+        }
+        else if ((text[i] >= 'a') && (text[i] <= 'f'))
+        {
+            digit = (uint32_t)(text[i] - 'a') + 10U;
+        }
+        else if ((text[i] >= 'A') && (text[i] <= 'F'))
+        {
+            digit = (uint32_t)(text[i] - 'A') + 10U;
+        }
+        else
+        {
+            return 0U;
+        }
+        n = (n << 4U) | digit;
+    }
+    *value = n;
+    return 1U;
+}
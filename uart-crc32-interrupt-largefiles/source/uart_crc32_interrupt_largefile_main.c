@@ -9,9 +9,18 @@
  *     data received during each 5-second window.
  *   - If no data is received in a window, the last calculated CRC is resent.
  *   - Uses interrupt-driven reception with sciReceive() (1 byte at a time)
- *     for robust, variable-length data handling.
+ *     for robust, variable-length data handling, or the LIN multi-buffer
+ *     backend (up to 8 bytes per interrupt): the backends of the shared
+ *     core (common/), selected with CORE_RX_BACKEND in core_cfg.h.
  *   - CRC is sent via UART at the end of each 5-second interval.
  *   - No buffer size limitation: supports arbitrarily large data streams.
+ *   - With SESSION_ENABLE set, "ESC session <id> <length>" opens a resumable
+ *     session (session.h), whose CRC runs over the whole file across
+ *     windows. A window without data before the file is complete is
+ *     reported as paused; the CRC state is kept and the host continues
+ *     from the offset the board returns. With CKPT_ENABLE set in
+ *     fee_checkpoint.h the state is also checkpointed to flash every
+ *     SESSION_CKPT_INTERVAL bytes, so a session survives a board reset.
  *
  * @hardware
  *   - MCU: TMS570LS12x HDK (e.g., TMS570LS1227)
@@ -31,8 +40,10 @@
  * @note
  *   - CRC32 uses Ethernet polynomial (0x04C11DB7), initial value 0xFFFFFFFF,
  *     final XOR 0xFFFFFFFF, input/output reflected.
- *   - sciNotification() and rtiNotification() are implemented in this file
- *     (remove from HL_notification.c).
+ *   - rtiNotification() is implemented in this file, sciNotification() in
+ *     common/source/core_rx_interrupt.c (remove both from HL_notification.c).
+ *   - CORE_RX_LIN_MBUF hooks lin1HighLevelInterrupt() through USER CODE (28)
+ *     in HL_sci.c; keep that block when regenerating with HALCoGen.
  *
  * @author  Nirmal Thyvalappil Muraleedharan
  * @date    25.07.2025
@@ -46,38 +57,46 @@
 #include "HL_sci.h"
 #include "HL_rti.h"
 #include "HL_system.h"
+#include "core.h"
+#include "core_rx.h"
+#include "crc32_kernel.h"
+#include "session.h"
+#include "fee_checkpoint.h"
 #include "string.h"
 #include <stdio.h>
 
 /* USER CODE END */
 
 /* USER CODE BEGIN (1) */
-#define POLYNOMIAL 0x04C11DB7
-#define INIT_CRC 0xFFFFFFFF
-#define FINAL_XOR 0xFFFFFFFF
-#define IDLE_TIMEOUT_MS 5000U
-#define SCI_RECEIVE_LENGTH  1U
-#define USB_UART sciREG1
-
-/* Byte for sciReceive function */
-volatile uint8_t temp_byte = 0;
-volatile uint32_t rx_count = 0;
-volatile uint32_t systemTick = 0;
-
-uint32_t crc_value = INIT_CRC;
-/* 8 hex digits + null terminator */
-char crc_formatBuffer[9] = {0};
+/* Set to 1 to accept resumable sessions (ESC session, see session.h) */
+#define SESSION_ENABLE 1
+/* Bytes between checkpoints of a session (with CKPT_ENABLE) */
+#define SESSION_CKPT_INTERVAL 0x100000U
+
+#if (SESSION_ENABLE == 1)
+/* Open session; the core CRC then runs over the whole file, not the window */
+uint32_t session_id = 0;
+uint64 session_length = 0;
+uint64 session_offset = 0;
+uint64 session_next_ckpt = 0;
+/* Data of the session is expected, commands are not scanned for */
+volatile uint32_t session_streaming = 0;
+/* RESUME answer due, sent from the RTI notification */
+volatile uint32_t session_reply = 0;
+#endif
 /* USER CODE END */
 
 /* USER CODE BEGIN (2) */
-void sciDisplayText(sciBASE_t *sci, unsigned char *text);
-uint8_t reflect8(uint8_t data);
-uint32_t reflect32(uint32_t data);
-uint32_t calc_crc32(uint8_t *data, uint32_t len);
-uint32_t update_crc32(uint32_t crc, uint8_t data);
-
-void debug_receivedData(sciBASE_t *sci, uint8_t *data, uint32_t len);
-void debug_byteCount(sciBASE_t *sci, uint32_t len);
+void rxBlockReceived(const uint8_t *data, uint32_t len);
+void crcAdd(const uint8_t *data, uint32_t len);
+void reportWindow(void);
+void sessionOpen(uint32_t id, uint64 length);
+void sessionReport(void);
+void sessionReply(void);
+
+/* The frame callback runs in the RX interrupt, from RAM (ramfunc.h) */
+#pragma CODE_SECTION(rxBlockReceived, ".ramCode")
+#pragma CODE_SECTION(crcAdd, ".ramCode")
 /* USER CODE END */
 
 int main(void)
@@ -88,27 +107,33 @@ int main(void)
     sciInit();
     /* Init RTI (for 1ms system tick) */
     rtiInit();
+    coreInit();
 
     /* Enable RTI compare interrupt and start counter */
     rtiEnableNotification(rtiREG1, rtiNOTIFICATION_COMPARE0);
     rtiStartCounter(rtiREG1, rtiCOUNTER_BLOCK0);
 
-    /* Enable UART RX interrupt */
-    sciEnableNotification(USB_UART, SCI_RX_INT);
-
     /* Enable global interrupts */
     _enable_interrupt_();
 
+#if (CKPT_ENABLE == 1)
+    /* Reads the last checkpoint, before any session can be opened */
+    ckptInit();
+#endif
+
     /* Optional: Welcome message */
-    sciDisplayText(USB_UART, (uint8_t *)"Sequential CRC Calculator with SCI1 Block Rx Interrupt Started...\r\n");
+    sciDisplayText(CORE_UART, (uint8_t *)"Sequential CRC Calculator with SCI1 Block Rx Interrupt Started...\r\n");
 
-    /* Start first receive sciReceive Designed for Interrupt Reception */
-    sciReceive(USB_UART, SCI_RECEIVE_LENGTH, (uint8_t *)&temp_byte);
+    /* Enable UART RX interrupt and start the backend */
+    coreRxInit(&rxBlockReceived);
 
 
     while (1)
     {
-        /* Do Nothing */
+#if (CKPT_ENABLE == 1)
+        /* Flash writes run here, interrupts keep receiving meanwhile */
+        ckptService();
+#endif
     }
 
 /* USER CODE END */
@@ -117,18 +142,75 @@ int main(void)
 
 /* USER CODE BEGIN (4) */
 
-/* Interrupt handler (called automatically by HALCoGen if enabled) */
-#pragma WEAK(sciNotification)
-void sciNotification(sciBASE_t *sci, uint32 flags)
+/* Receive backend callback: update CRC with a block of received bytes */
+void rxBlockReceived(const uint8_t *data, uint32_t len)
 {
-    /* Update CRC with each received byte */
-    crc_value = update_crc32(crc_value, temp_byte);
+#if (SESSION_ENABLE == 1)
+    sessionScan_t scan;
+    uint32_t used;
+    uint32_t id;
+    uint64 length;
+    uint32_t held_len;
+    const uint8_t *held;
+
+    /* Only the first byte of a window can start a command */
+    if (((coreCount() == 0U) && (session_streaming == 0U)) || (sessionCollecting() != 0U))
+    {
+        scan = sessionScan(data, len, &used);
+        if (scan == SESSION_SCAN_MORE)
+        {
+            return;
+        }
+        if ((scan == SESSION_SCAN_LINE) && (sessionParse(&id, &length) != 0U))
+        {
+            sessionRelease();
+            sessionOpen(id, length);
+        }
+        else
+        {
+            /* Plain data: it does not belong to a paused session */
+            if (session_id != 0U)
+            {
+                session_id = 0U;
+                coreSetCrcState(CRC32_INIT);
+            }
+            held = sessionHeld(&held_len);
+            crcAdd(held, held_len);
+            sessionRelease();
+        }
+        data += used;
+        len -= used;
+    }
+#endif
+    crcAdd(data, len);
+}
 
-    /* Increment the received byte count */
-    rx_count++;
+/* Updates CRC, window count and session offset with received data */
+void crcAdd(const uint8_t *data, uint32_t len)
+{
+    coreAdd(data, len);
 
-    /* Start next receive */
-    sciReceive(sci, SCI_RECEIVE_LENGTH, (uint8_t *)&temp_byte);
+#if (SESSION_ENABLE == 1)
+    if (session_streaming != 0U)
+    {
+        session_offset += len;
+        if (session_offset >= session_length)
+        {
+            session_streaming = 0U;
+        }
+#if (CKPT_ENABLE == 1)
+        else if (session_offset >= session_next_ckpt)
+        {
+            ckptSave(session_id, session_length, session_offset, coreCrcState());
+            session_next_ckpt = session_offset + SESSION_CKPT_INTERVAL;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+#endif
+    }
+#endif
 }
 
 /* RTI 1ms Tick Interrupt */
@@ -136,122 +218,137 @@ void sciNotification(sciBASE_t *sci, uint32 flags)
 void rtiNotification(rtiBASE_t *rtiREG, uint32 notification)
 {
     if (rtiREG == rtiREG1 && notification == rtiNOTIFICATION_COMPARE0) {
-        systemTick++;
+        coreTick();
+        /* Flush a partial frame once the line goes idle */
+        coreRxTick();
+#if (SESSION_ENABLE == 1)
+        if (session_reply != 0U)
+        {
+            coreRxSuspend();
+            sessionReply();
+            coreRxResume();
+        }
+#endif
     }
 
-    /* Reached IDLE_TIMEOUT_MS and no data received */
-    if((IDLE_TIMEOUT_MS <= systemTick) && (0U == rx_count))
+    /* Reached CORE_TIMEOUT_MS */
+    if (coreWindowDue() != 0U)
     {
-        /* Formatting CRC and sending via UART */
-        sciDisplayText(USB_UART, (uint8_t *)"No Data Received, Last Calculated CRC in Hex is : 0x");
-        sciDisplayText(USB_UART, (unsigned char *)crc_formatBuffer);
-        sciDisplayText(USB_UART, (uint8_t *)"\r\n");
-        /* Reset the rti timer */
-        systemTick = 0;
+        /* Pick up a short transfer that never completed a frame, then
+         * leave multi-buffer mode so the report can be sent byte-wise */
+        coreRxFlush();
+        coreRxSuspend();
+        reportWindow();
+        coreRxResume();
     }
-    /* Reached IDLE_TIMEOUT_MS and some data received */
-    else if((IDLE_TIMEOUT_MS <= systemTick) && (0U != rx_count))
+}
+
+/* Sends the result of the current window and starts a new one */
+void reportWindow(void)
+{
+#if (SESSION_ENABLE == 1)
+    /* A line still open at the timeout was data */
+    if (sessionCollecting() != 0U)
     {
-        debug_byteCount(USB_UART, rx_count);
-        /* Finalize the CRC */
-        crc_value = reflect32(crc_value) ^ FINAL_XOR;
-        /* Formatting CRC and sending via UART */
-        sciDisplayText(USB_UART, (uint8_t *)"Updated CRC in Hex is : 0x");
-        sprintf(crc_formatBuffer, "%08X", crc_value);  /* Format CRC as 8-digit upper case hex */
-        sciDisplayText(USB_UART, (unsigned char *)crc_formatBuffer);
-        sciDisplayText(USB_UART, (uint8_t *)"\r\n");
-        /* Reset the rti timer */
-        systemTick = 0;
-        /* Reset the rti timer */
-        rx_count = 0;
-        /* Reset the crc buffer */
-        crc_value = INIT_CRC;
+        uint32_t held_len;
+        const uint8_t *held = sessionHeld(&held_len);
+
+        crcAdd(held, held_len);
+        sessionRelease();
     }
-    else
+    if (session_id != 0U)
     {
-        /* Do Nothing */
+        sessionReport();
+        return;
     }
+#endif
+
+    /* CRC of the window, or the last one if no data came in */
+    coreReport();
 }
 
-/* Function used to send data through SCI buffer */
-void sciDisplayText(sciBASE_t *sci, unsigned char *text)
+#if (SESSION_ENABLE == 1)
+/* Opens a session, or resumes it from RAM or from the last checkpoint */
+void sessionOpen(uint32_t id, uint64 length)
 {
-    uint32 length = strlen((const char *)text);
+#if (CKPT_ENABLE == 1)
+    ckptRecord_t record;
+#endif
 
-    while(length--)
+    if ((id == session_id) && (length == session_length))
     {
-        while ((sci->FLR & 0x4) == 4); /* wait until busy */
-        sciSendByte(sci,*text++);      /* send out text   */
-    };
-}
+        /* Still in RAM: the transfer stopped without a reset */
+    }
+#if (CKPT_ENABLE == 1)
+    else if ((ckptLoad(id, &record) != 0U)
+          && (record.lengthHigh == (uint32_t)(length >> 32U))
+          && (record.lengthLow == (uint32_t)length))
+    {
+        session_offset = ((uint64)record.offsetHigh << 32U) | record.offsetLow;
+        coreSetCrcState(record.crc);
+    }
+#endif
+    else
+    {
+        session_offset = 0U;
+        coreSetCrcState(CRC32_INIT);
+    }
 
-/* Supporting Function for calculating CRC */
-uint8_t reflect8(uint8_t data)
-{
-    uint8_t res = 0;
-    int i;
-    for (i = 0; i < 8; i++)
-        res |= ((data >> i) & 1) << (7 - i);
-    return res;
+    session_id = id;
+    session_length = length;
+    session_next_ckpt = session_offset + SESSION_CKPT_INTERVAL;
+    session_streaming = (session_offset < session_length) ? 1U : 0U;
+    session_reply = 1U;
 }
 
-/* Supporting Function for calculating CRC */
-uint32_t reflect32(uint32_t data)
+/* Answers ESC session with the offset to continue from */
+void sessionReply(void)
 {
-    uint32_t res = 0;
-    int i;
-    for (i = 0; i < 32; i++)
-        res |= ((data >> i) & 1) << (31 - i);
-    return res;
-}
+    char msg[48];
 
-/* Calculating CRC */
-uint32_t calc_crc32(uint8_t *data, uint32_t len)
-{
-    uint32_t i, crc = INIT_CRC;
-    int j;
-    for (i = 0; i < len; i++) {
-        crc ^= ((uint32_t)reflect8(data[i])) << 24;
-        for (j = 0; j < 8; j++)
-            crc = (crc & 0x80000000) ? (crc << 1) ^ POLYNOMIAL : (crc << 1);
-    }
-    return reflect32(crc) ^ FINAL_XOR;
+    sprintf(msg, "RESUME %08lX %08lX%08lX\r\n", (unsigned long)session_id,
+            (unsigned long)(session_offset >> 32U), (unsigned long)session_offset);
+    sciDisplayText(CORE_UART, (uint8_t *)msg);
+    session_reply = 0U;
+    coreWindowRestart();
 }
 
-/* Calculating CRC using incremental method */
-uint32_t update_crc32(uint32_t crc, uint8_t data)
+/* Ends the window of a session: the file CRC once it is complete, the
+ * offset reached if no data came in, nothing while the file is arriving */
+void sessionReport(void)
 {
-    crc ^= ((uint32_t)reflect8(data)) << 24;
-    for (int j = 0; j < 8; j++)
-        crc = (crc & 0x80000000) ? (crc << 1) ^ POLYNOMIAL : (crc << 1);
-    return crc;
-}
-
+    char msg[64];
 
-/*
- * Debugging purpose only
- *
- */
-void debug_receivedData(sciBASE_t *sci, uint8_t *data, uint32_t len)
-{
-    char hexByte[6];
-    uint32_t i;
-    sciDisplayText(sci, (uint8_t *)"\r\nData Received is : ");
-    for (i = 0; i < len; i++) {
-        sprintf(hexByte, " %02X", data[i]);
-        sciDisplayText(sci, (uint8_t *)hexByte);
+    if (session_offset >= session_length)
+    {
+        debug_byteCount(CORE_UART, coreCount());
+        coreReportCrc(coreCrcState() ^ CRC32_XOROUT);
+        sprintf(msg, "SESSION %08lX done\r\n", (unsigned long)session_id);
+        sciDisplayText(CORE_UART, (uint8_t *)msg);
+#if (CKPT_ENABLE == 1)
+        ckptErase();
+#endif
+        session_id = 0U;
+        coreSetCrcState(CRC32_INIT);
     }
-    sciDisplayText(sci, (uint8_t *)"\r\n");
+    else if (coreCount() == 0U)
+    {
+        sprintf(msg, "PAUSED %08lX %08lX%08lX\r\n", (unsigned long)session_id,
+                (unsigned long)(session_offset >> 32U), (unsigned long)session_offset);
+        sciDisplayText(CORE_UART, (uint8_t *)msg);
+#if (CKPT_ENABLE == 1)
+        /* Exact position, a reset from here on loses nothing */
+        ckptSave(session_id, session_length, session_offset, coreCrcState());
+#endif
+        session_streaming = 0U;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    /* The CRC state runs on across windows until the file is done */
+    coreWindowNext();
 }
+#endif
 
-/*
- * Debugging purpose only
- *
- */
-void debug_byteCount(sciBASE_t *sci, uint32_t len)
-{
-    char msg[64];
-    sprintf(msg, "\r\nBytes received: %lu\r\n", len);
-    sciDisplayText(sci, (uint8_t *)msg);
-}
 /* USER CODE END */
@@ -0,0 +1,19 @@
+/**
+ ******************************************************************************
+ * @file    core_cfg.h
+ * @brief   Shared Core Configuration of uart-crc32-interrupt
+ *
+ * @details
+ *   - One RX interrupt per byte on SCI1 (USB UART); a report every 5 s
+ *     from the RTI compare 0 notification, data or not.
+ ******************************************************************************
+ */
+#ifndef CORE_CFG_H_
+#define CORE_CFG_H_
+
+#define CORE_RX_BACKEND         CORE_RX_INTERRUPT
+#define CORE_UART               sciREG1
+#define CORE_TIMEOUT_MS         5000U
+#define CORE_WINDOW_MODE        CORE_WINDOW_FIXED
+
+#endif /* CORE_CFG_H_ */
@@ -48,6 +48,9 @@
 #include "HL_sys_vim.h"
 #include "math.h"
 /* USER CODE BEGIN (1) */
+/* The SCI1 RX interrupt path runs from RAM (ramfunc.h) */
+#pragma CODE_SECTION(lin1HighLevelInterrupt, ".ramCode")
+#pragma CODE_SECTION(sciReceive, ".ramCode")
 /* USER CODE END */
 /** @struct g_sciTransfer
 *   @brief Interrupt mode globals
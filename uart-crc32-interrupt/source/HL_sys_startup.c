@@ -49,6 +49,7 @@
 
 
 /* USER CODE BEGIN (0) */
+#include "ramfunc.h"
 /* USER CODE END */
 
 
@@ -252,6 +253,8 @@ void _c_int00(void)
         /* initialize global variable and constructors */
     __TI_auto_init();
 /* USER CODE BEGIN (26) */
+    /* copy the RAM-resident RX interrupt path, CRC kernels and tables */
+    ramfuncCopy();
 /* USER CODE END */
     
         /* call the application */
@@ -0,0 +1,37 @@
+/**
+ ******************************************************************************
+ * @file    ramfunc.c
+ * @brief   Code and Tables Executed from RAM
+ *
+ * @note
+ *   - ramfuncCopy() runs with the caches off (HALCoGen startup), so no
+ *     cache maintenance is needed between copying and executing the code.
+ ******************************************************************************
+ */
+#include "ramfunc.h"
+#include <string.h>
+
+/* Defined by the linker (HL_sys_link.cmd) */
+extern uint32_t ramfuncLoadStart;
+extern uint32_t ramfuncRunStart;
+extern uint32_t ramfuncSize;
+
+/**
+ * @brief  Copies the .ramfunc section from its flash load address to its
+ *         RAM run address. Must run before any tagged function is called.
+ */
+void ramfuncCopy(void)
+{
+    if (ramfuncInRam() != 0U)
+    {
+        memcpy(&ramfuncRunStart, &ramfuncLoadStart, (size_t)&ramfuncSize);
+    }
+}
+
+/**
+ * @brief  Returns non-zero when .ramfunc is linked to run from RAM.
+ */
+uint32_t ramfuncInRam(void)
+{
+    return (&ramfuncRunStart != &ramfuncLoadStart) ? 1U : 0U;
+}
@@ -0,0 +1,19 @@
+/**
+ ******************************************************************************
+ * @file    core_cfg.h
+ * @brief   Shared Core Configuration of uart-crc32
+ *
+ * @details
+ *   - Polled reception on SCI1 (USB UART); the window ends after 500 ms
+ *     without data, counted by the delay loop of the main.
+ ******************************************************************************
+ */
+#ifndef CORE_CFG_H_
+#define CORE_CFG_H_
+
+#define CORE_RX_BACKEND         CORE_RX_POLLING
+#define CORE_UART               sciREG1
+#define CORE_TIMEOUT_MS         500U
+#define CORE_WINDOW_MODE        CORE_WINDOW_IDLE
+
+#endif /* CORE_CFG_H_ */
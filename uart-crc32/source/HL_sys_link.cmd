@@ -88,6 +88,10 @@ SECTIONS
 	
 
 /* USER CODE BEGIN (6) */
+    /* Buffer of the DMA backends of the shared core (core_rx.h) */
+    .rxRing  align(32) : {} > RAM
+    /* Shared CRC kernels and tables (common/), run in place from flash */
+    .ramfunc align(32) : { *(.ramCode) *(.ramConst) } > FLASH0 | FLASH1
 /* USER CODE END */
 }
 
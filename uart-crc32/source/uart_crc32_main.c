@@ -38,13 +38,19 @@
  * Replace the content of `sys_main.c` with this example source file.
  *
  * Functional Overview:
- * - Receives bytes via UART SCI2.
+ * - Receives bytes via UART SCI2 through the polling backend of the shared
+ *   core (common/, core_cfg.h).
  * - Waits 500ms of inactivity (idle timeout) to assume end of transmission.
- * - Calculates CRC32 over the received buffer using Ethernet polynomial.
- * - Sends calculated CRC32 value back to host terminal.
+ * - Updates the CRC32 (Ethernet polynomial) with every burst received, so
+ *   there is no buffer and no limit on the data size.
+ * - Sends the byte count and the calculated CRC32 value back to the host terminal.
+ * - A window that holds nothing but the line "ESC selftest" runs the SCI1
+ *   loopback self-test of the polling backend (common/source/selftest.c)
+ *   instead of the CRC report.
  *
  * Limitations:
- * - No framing or escape sequence for binary or non-ASCII data.
+ * - No framing or escape sequence for binary or non-ASCII data; "ESC selftest"
+ *   is only recognised as a window of its own.
  * - No integration with external protocol layers.
  *
  * @note: This example is meant for local development and testing, and is not intended for production use.
@@ -66,26 +72,14 @@
 
 /* USER CODE BEGIN (1) */
 #include "HL_sci.h"
+#include "core.h"
+#include "core_rx.h"
+#include "crc32_kernel.h"
+#include "selftest.h"
 
-/* Maximum data size of single crc Calculation */
-#define MAX_DATA_LEN 4096
-#define POLYNOMIAL 0x04C11DB7
-#define INIT_CRC 0xFFFFFFFF
-#define FINAL_XOR 0xFFFFFFFF
-
-uint8_t rx_data[MAX_DATA_LEN];
-uint32_t rx_count = 0;
-
-
-void sciDisplayText(sciBASE_t *sci, unsigned char *text);
 void delay_ms(uint32_t ms);
-uint8_t reflect8(uint8_t data);
-uint32_t reflect32(uint32_t data);
-uint32_t calc_crc32(uint8_t *data, uint32_t len);
-void debug_receivedData(uint8_t *data, uint32_t len);
-void debug_byteCount(uint32_t len);
-
-#define USB_UART sciREG1
+void rxReceived(const uint8_t *data, uint32_t len);
+void command_selftest(void);
 /* USER CODE END */
 
 /** @fn void main(void)
@@ -101,57 +95,36 @@ void main(void)
 {
 /* USER CODE BEGIN (3) */
 
-    uint32_t crc_value = 0xFFFFFFFF;
-    char crc_formatBuffer[9];  // 8 hex digits + null terminator
-    uint32_t idle_counter = 0;
-
     /* initialize sci/sci-lin */
     sciInit();
+    coreInit();
+    coreRxInit(&rxReceived);
     /* Optional: Welcome message */
-    sciDisplayText(USB_UART, (uint8_t *)"Sequential CRC Calculator Started\r\n");
+    sciDisplayText(CORE_UART, (uint8_t *)"Sequential CRC Calculator Started\r\n");
 
     while (1)
     {
-        /* Clear buffer count */
-        rx_count = 0;
-        idle_counter = 0;
-
         /* Optional: send message */
-        sciDisplayText(USB_UART, (uint8_t *)"UART Ready. Send data...\r\n");
+        sciDisplayText(CORE_UART, (uint8_t *)"UART Ready. Send data...\r\n");
 
         // Wait for data (timeout after idle)
-        while (idle_counter < 500 && rx_count < MAX_DATA_LEN) // 500ms idle
+        while (coreWindowDue() == 0U)
         {
-            if (sciIsRxReady(USB_UART))
-            {
-                rx_data[rx_count++] = sciReceiveByte(USB_UART);
-                idle_counter = 0;  // Reset idle timer on new byte
-            }
-            else
+            if (coreRxPoll() == 0U)
             {
                 delay_ms(1);
-                idle_counter++;
+                coreTick();
             }
         }
 
-        /* Only calculate if new data received */
-        if(0 < rx_count)
+        if (selftestRequested() != 0U)
         {
-            /* Compute CRC */
-            crc_value = calc_crc32(rx_data, rx_count);
-
-            /* Formatting CRC and sending via UART */
-            sciDisplayText(USB_UART, (uint8_t *)"Updated CRC in Hex is : 0x");
-            sprintf(crc_formatBuffer, "%08X", crc_value);  /* Format CRC as 8-digit upper case hex */
-            sciDisplayText(USB_UART, (unsigned char *)crc_formatBuffer);
-            sciDisplayText(USB_UART, (uint8_t *)"\r\n");
+            command_selftest();
         }
         else
         {
-            /* Formatting CRC and sending via UART */
-            sciDisplayText(USB_UART, (uint8_t *)"No Data Received, Last Calculated CRC in Hex is : 0x");
-            sciDisplayText(USB_UART, (unsigned char *)crc_formatBuffer);
-            sciDisplayText(USB_UART, (uint8_t *)"\r\n");
+            /* CRC of the window, or the last one if no data came in */
+            coreReport();
         }
     }
 
@@ -159,16 +132,28 @@ void main(void)
 }
 
 /* USER CODE BEGIN (4) */
-void sciDisplayText(sciBASE_t *sci, unsigned char *text)
+/* Receive backend callback: CRC and the in-band self-test request */
+void rxReceived(const uint8_t *data, uint32_t len)
 {
-    uint32 length = strlen((const char *)text);
+    selftestScan(data, len);
+    coreAdd(data, len);
+}
 
-    while(length--)
-    {
-        while ((sci->FLR & 0x4) == 4); /* wait until busy */
-        sciSendByte(sci,*text++);      /* send out text   */
-    };
+/* "ESC selftest": loopback sweep of the polling backend, the window of
+   the request is dropped */
+void command_selftest(void)
+{
+    selftestSummary_t summary;
+
+    coreRxStop();
+
+    selftestSweep(&summary);
+
+    coreWindowNext();
+    coreSetCrcState(CRC32_INIT);
+    coreRxInit(&rxReceived);
 }
+
 /*  Delay Function
  *  Considering 160Mhz system clock
  *  delay in ms
@@ -187,65 +172,5 @@ void delay_ms(uint32_t ms)
     }
 }
 
-/* Supporting Function for calculating CRC */
-uint8_t reflect8(uint8_t data)
-{
-    uint8_t res = 0;
-    int i;
-    for (i = 0; i < 8; i++)
-        res |= ((data >> i) & 1) << (7 - i);
-    return res;
-}
-
-/* Supporting Function for calculating CRC */
-uint32_t reflect32(uint32_t data)
-{
-    uint32_t res = 0;
-    int i;
-    for (i = 0; i < 32; i++)
-        res |= ((data >> i) & 1) << (31 - i);
-    return res;
-}
-
-/* Calculating CRC */
-uint32_t calc_crc32(uint8_t *data, uint32_t len)
-{
-    uint32_t i, crc = INIT_CRC;
-    int j;
-    for (i = 0; i < len; i++) {
-        crc ^= ((uint32_t)reflect8(data[i])) << 24;
-        for (j = 0; j < 8; j++)
-            crc = (crc & 0x80000000) ? (crc << 1) ^ POLYNOMIAL : (crc << 1);
-    }
-    return reflect32(crc) ^ FINAL_XOR;
-}
-
-/*
- * Debugging purpose only
- *
- */
-void debug_receivedData(uint8_t *data, uint32_t len)
-{
-    char hexByte[6];
-    uint32_t i;
-    sciDisplayText(USB_UART, (uint8_t *)"\r\nData Received is : ");
-    for (i = 0; i < len; i++) {
-        sprintf(hexByte, " %02X", data[i]);
-        sciDisplayText(USB_UART, (uint8_t *)hexByte);
-    }
-    sciDisplayText(USB_UART, (uint8_t *)"\r\n");
-}
-
-/*
- * Debugging purpose only
- *
- */
-void debug_byteCount(uint32_t len)
-{
-    char msg[64];
-    sprintf(msg, "\r\nBytes received: %lu\r\n", len);
-    sciDisplayText(USB_UART, (uint8_t *)msg);
-}
-
 /* USER CODE END */
 
@@ -0,0 +1,25 @@
+/**
+ ******************************************************************************
+ * @file    core_cfg.h
+ * @brief   Shared Core Configuration of uart-dma
+ *
+ * @details
+ *   - SCI3 into blocks of the pool (DMA pool backend), echoed from the
+ *     blocks by the TX channel: the echo retains each span until its TX
+ *     block is done. Only the pool and the text output of the core are
+ *     used; the echo has no CRC window.
+ ******************************************************************************
+ */
+#ifndef CORE_CFG_H_
+#define CORE_CFG_H_
+
+#define CORE_RX_BACKEND         CORE_RX_DMA_POOL
+#define CORE_UART               sciREG3
+#define CORE_RX_DMA_CH          DMA_CH1
+/* 4 KB of echo blocks (DMA frame count is limited to 8191) */
+#define CORE_POOL_BLOCKS        8U
+#define CORE_POOL_BLOCK_SIZE    512U
+/* The echo, and the loopback test's check */
+#define CORE_POOL_CONSUMERS     2U
+
+#endif /* CORE_CFG_H_ */
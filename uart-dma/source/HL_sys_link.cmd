@@ -90,6 +90,10 @@ SECTIONS
 	
 
 /* USER CODE BEGIN (6) */
+    /* SCI3 echo blocks (core_pool_arena), shared by the RX and TX DMA channels */
+    .rxRing  align(32) : {} > RAM
+    /* Shared CRC kernels and tables (common/), run in place from flash */
+    .ramfunc align(32) : { *(.ramCode) *(.ramConst) } > FLASH0 | FLASH1
 /* USER CODE END */
 }
 
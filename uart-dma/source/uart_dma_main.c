@@ -1,21 +1,33 @@
 /**
  ******************************************************************************
  * @file    uart_dma_main.c
- * @brief   SCI3 UART DMA RX Echo Example for TMS570LC43x
+ * @brief   SCI3 UART Full-Duplex DMA Echo Example for TMS570LC43x
  *
  * @details
- *   - Receives UART data on SCI3 using DMA (1 byte at a time).
- *   - Echoes each received character back using polling TX.
+ *   - DMA channel 1 (SCI3 RX request) writes every received byte into a
+ *     block of the pool, re-armed into the next free block at each block
+ *     end: the DMA pool backend of the shared core (common/, core_cfg.h).
+ *   - The echo is a pool consumer: it retains every span published to it
+ *     and queues it, growing the last span while the bytes follow on in
+ *     the same block. Nothing is copied.
+ *   - DMA channel 2 (SCI3 TX request) sends the queue back out, one span
+ *     per TX block, straight from the pool block. The span's reference is
+ *     released at its TX block complete (BTC), so a block goes back to
+ *     the pool once it is both received and sent.
+ *   - All byte values are echoed, including 0x00.
+ *   - With ECHO_LOOPBACK_TEST set, a digital loopback throughput test runs
+ *     at startup before the echo starts.
  *   - Prints a welcome message at startup.
  *   - Designed for LAUNCHXL2-570LC43 board, using FTDI USB-to-UART.
  *   - Baud rate: 26042 (set in HALCoGen and terminal).
- *   - DMA channel, request, and control packet are set up for SCI3 RX.
- *   - DMA is re-armed for every byte, so echo is continuous.
  *
  * @note
- *   - DMA Parameter RAM is not explicitly mapped in the linker file, but DMA works as long as nothing else uses 0xFFF80000.
- *   - For best practice, reserve .dmaRAM in the linker file.
- *   - For reliable operation, use baud rates <= 50000.
+ *   - **Cache must be disabled** in the R5-MPU-PMU tab for DMA to work.
+ *   - DMA Parameter RAM is reserved as .dmaRAM in the linker file, the pool
+ *     (core_pool_arena) lives in its own .rxRing section.
+ *   - Echo keeps up with any baud rate: TX drains at the same rate RX fills,
+ *     so the pool only has to cover the gap of one TX block. Should TX
+ *     fall behind, the pool runs empty and RX overruns (corePoolGetStats()).
  *
  * @author  Nirmal Thyvalappil Muraleedharan
  * @date    07.08.2025
@@ -24,79 +36,351 @@
 #include "HL_sys_common.h"
 #include "HL_system.h"
 #include "HL_sys_dma.h"
+#include "HL_sys_pmu.h"
 #include "HL_sci.h"
+#include "core.h"
+#include "core_rx.h"
+#include "core_pool.h"
 #include <string.h>
+#include <stdio.h>
 
-#define DMA_SCI3_RX  DMA_REQ30
-#define SCI_SET_RX_DMA      (1<<17)
-#define SCI_SET_RX_DMA_ALL  (1<<18)
+#define DMA_SCI3_TX  DMA_REQ31
+#define SCI_SET_TX_DMA      (1<<16)
+#define SCI_FLR_TX_EMPTY    0x800U
 
 #if ((__little_endian__ == 1) || (__LITTLE_ENDIAN__ == 1))
-#define SCI3_RX_ADDR ((uint32_t)(&(sciREG3->RD)))
+#define SCI3_TX_ADDR ((uint32_t)(&(sciREG3->TD)))
 #else
-#define SCI3_RX_ADDR ((uint32_t)(&(sciREG3->RD)) + 3)
+#define SCI3_TX_ADDR ((uint32_t)(&(sciREG3->TD)) + 3)
 #endif
 
-uint8_t rx_byte = 0;
-g_dmaCTRL g_dmaCTRLPKT;
+#define DMA_TX_CH    DMA_CH2
+
+/* Queued spans: one per block in use, plus the one being sent sharing its
+ * block with the next */
+#define ECHO_SPANS   (CORE_POOL_BLOCKS + 1U)
+
+/* Set to 1 to run the loopback throughput test at startup (sim/ builds
+ * it with 1 for make sim_echo) */
+#ifndef ECHO_LOOPBACK_TEST
+#define ECHO_LOOPBACK_TEST  0
+#endif
+#define LOOPBACK_TEST_MS    2000U
+/* Seed length, every byte value once */
+#define LOOPBACK_SEED_LEN   256U
+
+#define GCLK_HZ ((uint32_t)(GCLK_FREQ * 1000000.0F))
+#define VCLK_HZ ((uint32_t)(VCLK1_FREQ * 1000000.0F))
+
+/* A span of a pool block waiting for the TX channel, holding a reference */
+typedef struct
+{
+    corePoolBlock_t *block;
+    uint32_t offset;
+    uint32_t len;
+} echo_span_t;
+
+/* Echo queue; the head is the span the TX channel is sending */
+echo_span_t echo_spans[ECHO_SPANS];
+uint32_t echo_head = 0;
+uint32_t echo_count = 0;
+/* Length of the span the TX channel is sending, 0 while idle */
+uint32_t tx_len = 0;
+/* Bytes echoed since startup */
+uint32_t tx_total = 0;
+
+/* Loopback test: seed, stream position and mismatches of its check */
+static uint8_t loopback_seed[LOOPBACK_SEED_LEN];
+uint32_t loopback_active = 0;
+uint32_t loopback_stream = 0;
+uint32_t loopback_errors = 0;
+
+g_dmaCTRL g_dmaTxCTRLPKT;
+
+void setup_dma(void);
+void start_reception(void);
+void start_transmit(const uint8_t *data, uint32_t len);
+uint32_t transmit_done(void);
+void echo_hold(corePoolBlock_t *block, uint32_t offset, uint32_t len);
+void echo_service(void);
+void echo_drop(void);
+uint32_t line_rate(void);
+void loopback_check(corePoolBlock_t *block, uint32_t offset, uint32_t len);
+void loopback_test(void);
+
+/**
+ * @brief  Fills in the fixed part of the SCI3 TX packet for channel 2.
+ *         The RX channel is set up by coreRxInit().
+ */
+void setup_dma(void)
+{
+    dmaReqAssign(DMA_TX_CH, DMA_SCI3_TX);
+
+    /* Source address and frame count are set per span in start_transmit() */
+    g_dmaTxCTRLPKT.SADD      = (uint32_t)core_pool_arena;
+    g_dmaTxCTRLPKT.DADD      = SCI3_TX_ADDR;
+    g_dmaTxCTRLPKT.CHCTRL    = 0;
+    g_dmaTxCTRLPKT.FRCNT     = 1;
+    g_dmaTxCTRLPKT.ELCNT     = 1;
+    g_dmaTxCTRLPKT.ELDOFFSET = 0;
+    g_dmaTxCTRLPKT.ELSOFFSET = 0;
+    g_dmaTxCTRLPKT.FRDOFFSET = 0;
+    g_dmaTxCTRLPKT.FRSOFFSET = 0;
+    g_dmaTxCTRLPKT.PORTASGN  = PORTA_READ_PORTB_WRITE;
+    g_dmaTxCTRLPKT.RDSIZE    = ACCESS_8_BIT;
+    g_dmaTxCTRLPKT.WRSIZE    = ACCESS_8_BIT;
+    g_dmaTxCTRLPKT.TTYPE     = FRAME_TRANSFER;
+    g_dmaTxCTRLPKT.ADDMODERD = ADDR_INC1;
+    g_dmaTxCTRLPKT.ADDMODEWR = ADDR_FIXED;
+    g_dmaTxCTRLPKT.AUTOINIT  = AUTOINIT_OFF;
+}
+
+/**
+ * @brief  Starts reception into the pool, with the echo as its consumer.
+ */
+void start_reception(void)
+{
+    echo_head = 0;
+    echo_count = 0;
+    tx_len = 0;
+    coreRxInit(NULL);
+    (void)corePoolSubscribe(&echo_hold);
+}
 
 /**
- * @brief  Sends a null-terminated string over SCI3 using polling.
- * @param  text Pointer to the string to send.
+ * @brief  Starts a TX DMA block of len bytes from data.
+ *         SCI3 raises a TX request whenever TD is empty, so setting the
+ *         TX DMA enable with TD already empty starts the first transfer.
  */
-void sci3DisplayText(unsigned char *text)
+void start_transmit(const uint8_t *data, uint32_t len)
 {
-    uint32 length = strlen((const char *)text);
-    while(length--)
+    g_dmaTxCTRLPKT.SADD  = (uint32_t)data;
+    g_dmaTxCTRLPKT.FRCNT = len;
+
+    tx_len = len;
+    dmaSetCtrlPacket(DMA_TX_CH, g_dmaTxCTRLPKT);
+    dmaSetChEnable(DMA_TX_CH, DMA_HW);
+    sciREG3->SETINT = SCI_SET_TX_DMA;
+}
+
+/**
+ * @brief  Returns non-zero once the TX block started by start_transmit()
+ *         has been handed to SCI3, and releases the TX request.
+ *         The last one or two bytes are still in TD and the shift register.
+ */
+uint32_t transmit_done(void)
+{
+    if (dmaGetInterruptStatus(DMA_TX_CH, BTC) != TRUE)
     {
-        while ((sciREG3->FLR & 0x4) == 0x4); // Wait until not busy
-        sciSendByte(sciREG3, *text++);
+        return 0U;
     }
+
+    dmaREG->BTCFLAG = (uint32)1U << DMA_TX_CH;
+    sciREG3->CLEARINT = SCI_SET_TX_DMA;
+    return 1U;
 }
 
 /**
- * @brief  Sets up DMA channel 1 for single-byte SCI3 RX.
- *         Configures the DMA control packet and enables the hardware trigger.
+ * @brief  Pool consumer: queues the span for the TX channel, retaining
+ *         its block until the span has been sent.
  */
-void setup_dma(void)
+void echo_hold(corePoolBlock_t *block, uint32_t offset, uint32_t len)
 {
-    dmaReqAssign(DMA_CH1, DMA_SCI3_RX);
-
-    g_dmaCTRLPKT.SADD      = SCI3_RX_ADDR;
-    g_dmaCTRLPKT.DADD      = (uint32_t)&rx_byte;
-    g_dmaCTRLPKT.CHCTRL    = 0;
-    g_dmaCTRLPKT.FRCNT     = 1;
-    g_dmaCTRLPKT.ELCNT     = 1;
-    g_dmaCTRLPKT.ELDOFFSET = 0;
-    g_dmaCTRLPKT.ELSOFFSET = 0;
-    g_dmaCTRLPKT.FRDOFFSET = 0;
-    g_dmaCTRLPKT.FRSOFFSET = 0;
-    g_dmaCTRLPKT.PORTASGN  = PORTB_READ_PORTA_WRITE;
-    g_dmaCTRLPKT.RDSIZE    = ACCESS_8_BIT;
-    g_dmaCTRLPKT.WRSIZE    = ACCESS_8_BIT;
-    g_dmaCTRLPKT.TTYPE     = FRAME_TRANSFER;
-    g_dmaCTRLPKT.ADDMODERD = ADDR_FIXED;
-    g_dmaCTRLPKT.ADDMODEWR = ADDR_FIXED;
-    g_dmaCTRLPKT.AUTOINIT  = AUTOINIT_OFF;
-
-    dmaEnable();
-    sciREG3->SETINT |= SCI_SET_RX_DMA | SCI_SET_RX_DMA_ALL;
+    echo_span_t *span;
+    uint32_t last;
+
+    if (echo_count != 0U)
+    {
+        /* Bytes following on in the same block grow the last span, unless
+         * the TX channel is already sending it */
+        last = (echo_head + echo_count - 1U) % ECHO_SPANS;
+        span = &echo_spans[last];
+        if ((span->block == block) && ((span->offset + span->len) == offset)
+         && ((last != echo_head) || (tx_len == 0U)))
+        {
+            span->len += len;
+            return;
+        }
+    }
+    if (echo_count >= ECHO_SPANS)
+    {
+        /* Cannot happen: a span per block in use, plus the one being sent */
+        return;
+    }
+
+    corePoolRetain(block);
+    span = &echo_spans[(echo_head + echo_count) % ECHO_SPANS];
+    span->block = block;
+    span->offset = offset;
+    span->len = len;
+    echo_count++;
 }
 
 /**
- * @brief  Arms DMA channel 1 for the next single-byte SCI3 RX transfer.
- *         Resets the RX byte and enables the channel.
+ * @brief  Echo engine. Publishes what the RX channel has written, releases
+ *         the span that has gone out and starts the next one.
  */
-void start_reception(void)
+void echo_service(void)
 {
-    rx_byte = 0;
-    dmaSetCtrlPacket(DMA_CH1, g_dmaCTRLPKT);
-    dmaSetChEnable(DMA_CH1, DMA_HW);
+    echo_span_t *span;
+
+    (void)coreRxPoll();
+
+    if (tx_len != 0U)
+    {
+        if (transmit_done() == 0U)
+        {
+            return;
+        }
+        corePoolRelease(echo_spans[echo_head].block);
+        echo_head = (echo_head + 1U) % ECHO_SPANS;
+        echo_count--;
+        tx_total += tx_len;
+        tx_len = 0U;
+    }
+
+    if (echo_count != 0U)
+    {
+        span = &echo_spans[echo_head];
+        start_transmit(&span->block->data[span->offset], span->len);
+    }
+}
+
+/**
+ * @brief  Drops the queued spans without sending them and releases their
+ *         blocks. The TX channel has to be idle.
+ */
+void echo_drop(void)
+{
+    while (echo_count != 0U)
+    {
+        corePoolRelease(echo_spans[echo_head].block);
+        echo_head = (echo_head + 1U) % ECHO_SPANS;
+        echo_count--;
+    }
+}
+
+/**
+ * @brief  Returns the SCI3 line rate in bytes per second from the current
+ *         baud rate prescaler and frame format.
+ */
+uint32_t line_rate(void)
+{
+    uint32_t baud = VCLK_HZ / (16U * ((sciREG3->BRS & 0x00FFFFFFU) + 1U));
+    uint32_t bits = 1U + ((sciREG3->FORMAT & 0x7U) + 1U);   /* start + data */
+
+    bits += ((sciREG3->GCR1 & 0x10U) != 0U) ? 2U : 1U;        /* stop */
+    bits += ((sciREG3->GCR1 & 0x04U) != 0U) ? 1U : 0U;        /* parity */
+
+    return baud / bits;
+}
+
+/**
+ * @brief  Pool consumer of the loopback test: checks every byte published
+ *         against the seed while the test runs.
+ */
+void loopback_check(corePoolBlock_t *block, uint32_t offset, uint32_t len)
+{
+    uint32_t i;
+
+    if (loopback_active == 0U)
+    {
+        return;
+    }
+    for (i = 0U; i < len; i++)
+    {
+        if (block->data[offset + i] != loopback_seed[loopback_stream % LOOPBACK_SEED_LEN])
+        {
+            loopback_errors++;
+        }
+        loopback_stream++;
+    }
+}
+
+/**
+ * @brief  Loopback throughput test.
+ *
+ *         SCI3 is put in digital loopback and a 256 byte seed holding every
+ *         byte value is sent once. The echo engine then sends everything it
+ *         receives back to itself, so the stream keeps circulating at the
+ *         rate the engine sustains. Because the echo repeats the stream,
+ *         stream byte n must equal seed[n % 256]; loopback_check(), a
+ *         second consumer of the same blocks, checks every byte.
+ *
+ *         Reports bytes echoed per second against the line rate and the
+ *         number of mismatching bytes.
+ *
+ * @note   Test traffic may also appear on the TX pin.
+ */
+void loopback_test(void)
+{
+    char msg[96];
+    uint32_t start, cycles, bytes, i;
+
+    for (i = 0U; i < LOOPBACK_SEED_LEN; i++)
+    {
+        loopback_seed[i] = (uint8_t)i;
+    }
+    loopback_stream = 0U;
+    loopback_errors = 0U;
+    loopback_active = 1U;
+    (void)corePoolSubscribe(&loopback_check);
+
+    _pmuInit_();
+    _pmuEnableCountersGlobal_();
+    _pmuStartCounters_(pmuCYCLE_COUNTER);
+
+    /* The welcome message must not loop back into the stream */
+    while ((sciREG3->FLR & SCI_FLR_TX_EMPTY) == 0U)
+    {
+        /* Wait */
+    }
+    sciEnableLoopback(sciREG3, Digital_Lbk);
+
+    start_transmit(loopback_seed, LOOPBACK_SEED_LEN);
+    while (transmit_done() == 0U)
+    {
+        /* Wait */
+    }
+    tx_len = 0U;
+    tx_total = 0U;
+
+    start = _pmuGetCycleCount_();
+    do
+    {
+        echo_service();
+        cycles = _pmuGetCycleCount_() - start;
+    } while (cycles < ((GCLK_HZ / 1000U) * LOOPBACK_TEST_MS));
+
+    /* Let the last span drain, then drop what is still circulating. The
+     * polls keep re-arming the RX channel at block ends meanwhile */
+    while ((tx_len != 0U) && (transmit_done() == 0U))
+    {
+        (void)coreRxPoll();
+    }
+    bytes = tx_total + tx_len;
+    tx_len = 0U;
+    while ((sciREG3->FLR & SCI_FLR_TX_EMPTY) == 0U)
+    {
+        (void)coreRxPoll();
+    }
+    sciDisableLoopback(sciREG3);
+    loopback_active = 0U;
+    (void)coreRxPoll();
+    echo_drop();
+
+    sprintf(msg, "Loopback: %lu bytes in %lu ms, %lu B/s (line %lu B/s), errors %lu\r\n",
+            (unsigned long)bytes,
+            (unsigned long)LOOPBACK_TEST_MS,
+            (unsigned long)((bytes * 1000U) / LOOPBACK_TEST_MS),
+            (unsigned long)line_rate(),
+            (unsigned long)loopback_errors);
+    sciDisplayText(CORE_UART, (unsigned char *)msg);
 }
 
 /**
  * @brief  Main function: Initializes SCI3 and DMA, prints welcome message,
- *         and continuously echoes received characters using DMA RX and polling TX.
+ *         and runs the DMA echo engine.
  */
 void main(void)
 {
@@ -109,21 +393,17 @@ void main(void)
     }
 
     // Send welcome message
-    sci3DisplayText((unsigned char *)"SCI3 DMA RX Echo Ready!\r\n");
+    sciDisplayText(CORE_UART, (unsigned char *)"SCI3 DMA RX Echo Ready!\r\n");
 
     setup_dma();
+    start_reception();
+
+#if (ECHO_LOOPBACK_TEST == 1)
+    loopback_test();
+#endif
 
     while(1)
     {
-        start_reception();
-
-        // Wait for byte
-        while(dmaGetInterruptStatus(DMA_CH1, BTC) != TRUE);
-
-        // Echo immediately
-        if(rx_byte != 0)
-        {
-            sciSendByte(sciREG3, rx_byte);
-        }
+        echo_service();
     }
 }